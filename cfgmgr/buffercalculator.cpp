@@ -0,0 +1,449 @@
+#include <cmath>
+#include <string.h>
+#include "logger.h"
+#include "redisapi.h"
+#include "tokenize.h"
+#include "buffercalculator.h"
+
+using namespace std;
+using namespace swss;
+
+#define STATE_ASIC_TABLE_NAME "ASIC_TABLE"
+#define CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME "LOSSLESS_TRAFFIC_PATTERN"
+
+#define SPEED_OF_LIGHT 198000000
+#define MINIMAL_PACKET_SIZE 64
+
+// Pause quanta should be taken for each operating speed is defined in IEEE 802.3 31B.3.7.
+// The key is operating speed at Mb/s and the value is the number of pause quanta.
+static const map<long, double> mellanoxPauseQuantaPerSpeed =
+{
+    { 800000, 905 },
+    { 400000, 905 },
+    { 200000, 453 },
+    { 100000, 394 },
+    { 50000, 147 },
+    { 40000, 118 },
+    { 25000, 80 },
+    { 10000, 67 },
+    { 1000, 2 },
+    { 100, 1 }
+};
+
+static const map<long, double> barefootPauseQuantaPerSpeed =
+{
+    { 400000, 905 },
+    { 200000, 453 },
+    { 100000, 394 },
+    { 50000, 147 },
+    { 40000, 118 },
+    { 25000, 80 },
+    { 10000, 67 },
+    { 1000, 2 },
+    { 100, 1 }
+};
+
+static string ceilToString(double value)
+{
+    return to_string(static_cast<long long>(ceil(value)));
+}
+
+static double ceilTo1024(double value)
+{
+    return ceil(value / 1024) * 1024;
+}
+
+BufferCalculator::BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb) :
+        m_applDb(applDb),
+        m_stateAsicTable(stateDb, STATE_ASIC_TABLE_NAME),
+        m_cfgLosslessTrafficPatternTable(cfgDb, CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME),
+        m_native(false)
+{
+    m_param.loaded = false;
+}
+
+unique_ptr<BufferCalculator> BufferCalculator::create(const string &platform, DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb)
+{
+    // buffer_headroom_vs.lua is identical to buffer_headroom_mellanox.lua
+    if (platform == "mellanox" || platform == "vs")
+    {
+        return unique_ptr<BufferCalculator>(new MellanoxBufferCalculator(cfgDb, stateDb, applDb));
+    }
+
+    if (platform == "barefoot")
+    {
+        return unique_ptr<BufferCalculator>(new BarefootBufferCalculator(cfgDb, stateDb, applDb));
+    }
+
+    return unique_ptr<BufferCalculator>(new BufferCalculator(cfgDb, stateDb, applDb));
+}
+
+void BufferCalculator::loadPlugins(const string &platform)
+{
+    string headroomPluginName = "buffer_headroom_" + platform + ".lua";
+    string bufferpoolPluginName = "buffer_pool_" + platform + ".lua";
+    string checkHeadroomPluginName = "buffer_check_headroom_" + platform + ".lua";
+
+    // The headroom plugin is still loaded for natively calculating vendors
+    // It serves as the fallback in case the parameters are not available in the database
+    string headroomLuaScript = swss::loadLuaScript(headroomPluginName);
+    m_headroomSha = swss::loadRedisScript(m_applDb, headroomLuaScript);
+
+    string bufferpoolLuaScript = swss::loadLuaScript(bufferpoolPluginName);
+    m_bufferpoolSha = swss::loadRedisScript(m_applDb, bufferpoolLuaScript);
+
+    string checkHeadroomLuaScript = swss::loadLuaScript(checkHeadroomPluginName);
+    m_checkHeadroomSha = swss::loadRedisScript(m_applDb, checkHeadroomLuaScript);
+}
+
+bool BufferCalculator::calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    vector<string> keys = {};
+    vector<string> argv = {};
+
+    argv.emplace_back(input.speed);
+    argv.emplace_back(input.cable_length);
+    argv.emplace_back(input.port_mtu);
+    argv.emplace_back(input.gearbox_delay);
+    argv.emplace_back(to_string(input.lane_count));
+
+    auto ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+
+    if (ret.empty())
+    {
+        return false;
+    }
+
+    // The format of the result:
+    // a list of strings containing key, value pairs with colon as separator
+    // each is a field of the profile
+    // "xon:18432"
+    // "xoff:18432"
+    // "size:36864"
+    for (auto &i : ret)
+    {
+        auto pairs = tokenize(i, ':');
+        if (pairs.size() < 2)
+            continue;
+        if (pairs[0] == "xon")
+            headroom.xon = pairs[1];
+        if (pairs[0] == "xoff")
+            headroom.xoff = pairs[1];
+        if (pairs[0] == "size")
+            headroom.size = pairs[1];
+        if (pairs[0] == "xon_offset")
+            headroom.xon_offset = pairs[1];
+    }
+
+    return true;
+}
+
+vector<string> BufferCalculator::calculatePoolSizes()
+{
+    vector<string> keys = {};
+    vector<string> argv = {};
+
+    return swss::runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+}
+
+vector<string> BufferCalculator::checkHeadroom(const vector<string> &keys, const vector<string> &argv)
+{
+    return swss::runRedisScript(*m_applDb, m_checkHeadroomSha, keys, argv);
+}
+
+// Fetch the parameters which are used by the lua plugins but are not provided as arguments
+// They are fetched once and kept until resetParameters() is called
+bool BufferCalculator::loadParameters()
+{
+    if (m_param.loaded)
+    {
+        return true;
+    }
+
+    vector<string> keys;
+    vector<FieldValueTuple> fvs;
+    bool hasCellSize = false, hasPipelineLatency = false, hasMacPhyDelay = false;
+    bool hasLosslessMtu = false, hasSmallPacketPercentage = false;
+
+    m_param.peer_response_time = 0;
+
+    // Only one key should exist
+    m_stateAsicTable.getKeys(keys);
+    if (keys.empty() || !m_stateAsicTable.get(keys[0], fvs))
+    {
+        SWSS_LOG_INFO("ASIC table isn't available for calculating headroom");
+        return false;
+    }
+
+    try
+    {
+        for (auto &fv : fvs)
+        {
+            if (fvField(fv) == "cell_size")
+            {
+                m_param.cell_size = stod(fvValue(fv));
+                hasCellSize = true;
+            }
+            else if (fvField(fv) == "pipeline_latency")
+            {
+                m_param.pipeline_latency = stod(fvValue(fv)) * 1024;
+                hasPipelineLatency = true;
+            }
+            else if (fvField(fv) == "mac_phy_delay")
+            {
+                m_param.mac_phy_delay = stod(fvValue(fv)) * 1024;
+                hasMacPhyDelay = true;
+            }
+            else if (fvField(fv) == "peer_response_time")
+            {
+                m_param.peer_response_time = stod(fvValue(fv)) * 1024;
+            }
+        }
+
+        // Only one key should exist
+        keys.clear();
+        fvs.clear();
+        m_cfgLosslessTrafficPatternTable.getKeys(keys);
+        if (keys.empty() || !m_cfgLosslessTrafficPatternTable.get(keys[0], fvs))
+        {
+            SWSS_LOG_INFO("Lossless traffic pattern isn't available for calculating headroom");
+            return false;
+        }
+
+        for (auto &fv : fvs)
+        {
+            if (fvField(fv) == "mtu")
+            {
+                m_param.lossless_mtu = stod(fvValue(fv));
+                hasLosslessMtu = true;
+            }
+            else if (fvField(fv) == "small_packet_percentage")
+            {
+                m_param.small_packet_percentage = stod(fvValue(fv));
+                hasSmallPacketPercentage = true;
+            }
+        }
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid parameter for calculating headroom: %s", e.what());
+        return false;
+    }
+
+    m_param.loaded = hasCellSize && hasPipelineLatency && hasMacPhyDelay && hasLosslessMtu && hasSmallPacketPercentage;
+    if (!m_param.loaded)
+    {
+        SWSS_LOG_INFO("Parameters for calculating headroom are incomplete");
+    }
+
+    return m_param.loaded;
+}
+
+bool BufferCalculator::isSharedHeadroomPoolEnabled(const buffer_headroom_input_t &input) const
+{
+    return (!input.shared_headroom_pool_size.empty() && atof(input.shared_headroom_pool_size.c_str()) != 0)
+        || (!input.over_subscribe_ratio.empty() && atof(input.over_subscribe_ratio.c_str()) != 0);
+}
+
+MellanoxBufferCalculator::MellanoxBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb) :
+        BufferCalculator(cfgDb, stateDb, applDb)
+{
+    m_native = true;
+}
+
+bool MellanoxBufferCalculator::calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    if (!loadParameters() || input.cable_length.empty())
+    {
+        return BufferCalculator::calculateHeadroom(input, headroom);
+    }
+
+    double port_speed, cable_length, port_mtu, gearbox_delay = 0;
+
+    try
+    {
+        port_speed = stod(input.speed);
+        cable_length = stod(input.cable_length.substr(0, input.cable_length.size() - 1));
+        port_mtu = stod(input.port_mtu);
+        if (!input.gearbox_delay.empty())
+            gearbox_delay = stod(input.gearbox_delay);
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid input for calculating headroom (speed %s cable %s mtu %s): %s",
+                       input.speed.c_str(), input.cable_length.c_str(), input.port_mtu.c_str(), e.what());
+        return false;
+    }
+
+    bool is_8lane = (input.lane_count == 8);
+    double pipeline_latency = m_param.pipeline_latency;
+    double peer_response_time = m_param.peer_response_time;
+    double speed_overhead = 0;
+    double worst_case_factor;
+    double bytes_on_gearbox = 0;
+
+    // Adjustment for 8-lane port
+    if (is_8lane)
+    {
+        pipeline_latency = pipeline_latency * 2 - 1024;
+        speed_overhead = port_mtu;
+    }
+
+    if (m_param.cell_size > 2 * MINIMAL_PACKET_SIZE)
+    {
+        worst_case_factor = m_param.cell_size / MINIMAL_PACKET_SIZE;
+    }
+    else
+    {
+        worst_case_factor = (2 * m_param.cell_size) / (1 + m_param.cell_size);
+    }
+
+    double cell_occupancy = (100 - m_param.small_packet_percentage + m_param.small_packet_percentage * worst_case_factor) / 100;
+
+    if (gearbox_delay != 0)
+    {
+        bytes_on_gearbox = port_speed * gearbox_delay / (8 * 1024);
+    }
+
+    // If successfully get pause_quanta from the table, then calculate peer_response_time from it
+    auto pauseQuanta = mellanoxPauseQuantaPerSpeed.find(static_cast<long>(port_speed));
+    if (pauseQuanta != mellanoxPauseQuantaPerSpeed.end())
+    {
+        peer_response_time = pauseQuanta->second * 512 / 8;
+    }
+
+    double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / SPEED_OF_LIGHT / (8 * 1024);
+    double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + m_param.mac_phy_delay + peer_response_time;
+
+    // Calculate the xoff and xon and then round up at 1024 bytes
+    double xoff_value = ceilTo1024(m_param.lossless_mtu + propagation_delay * cell_occupancy);
+    double xon_value = ceilTo1024(pipeline_latency);
+    double headroom_size;
+
+    if (isSharedHeadroomPoolEnabled(input))
+    {
+        headroom_size = xon_value;
+    }
+    else
+    {
+        headroom_size = xoff_value + xon_value + speed_overhead;
+    }
+    headroom_size = ceilTo1024(headroom_size);
+
+    headroom.xon = ceilToString(xon_value);
+    headroom.xoff = ceilToString(xoff_value);
+    headroom.size = ceilToString(headroom_size);
+
+    return true;
+}
+
+BarefootBufferCalculator::BarefootBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb) :
+        BufferCalculator(cfgDb, stateDb, applDb)
+{
+    m_native = true;
+}
+
+bool BarefootBufferCalculator::calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    if (!loadParameters() || input.cable_length.empty())
+    {
+        return BufferCalculator::calculateHeadroom(input, headroom);
+    }
+
+    double port_speed, cable_length, port_mtu, gearbox_delay = 0;
+
+    try
+    {
+        port_speed = stod(input.speed);
+        cable_length = stod(input.cable_length.substr(0, input.cable_length.size() - 1));
+        port_mtu = stod(input.port_mtu);
+        if (!input.gearbox_delay.empty())
+            gearbox_delay = stod(input.gearbox_delay);
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid input for calculating headroom (speed %s cable %s mtu %s): %s",
+                       input.speed.c_str(), input.cable_length.c_str(), input.port_mtu.c_str(), e.what());
+        return false;
+    }
+
+    double peer_response_time = m_param.peer_response_time;
+    double worst_case_factor;
+    double bytes_on_gearbox = 0;
+
+    if (m_param.cell_size > 2 * MINIMAL_PACKET_SIZE)
+    {
+        worst_case_factor = m_param.cell_size / MINIMAL_PACKET_SIZE;
+    }
+    else
+    {
+        worst_case_factor = (2 * m_param.cell_size) / (1 + m_param.cell_size);
+    }
+
+    double cell_occupancy = (100 - m_param.small_packet_percentage + m_param.small_packet_percentage * worst_case_factor) / 100;
+
+    if (gearbox_delay != 0)
+    {
+        bytes_on_gearbox = port_speed * gearbox_delay / (8 * 1024);
+    }
+
+    auto pauseQuanta = barefootPauseQuantaPerSpeed.find(static_cast<long>(port_speed));
+    if (pauseQuanta != barefootPauseQuantaPerSpeed.end())
+    {
+        peer_response_time = pauseQuanta->second * 512 / 8;
+    }
+
+    if (port_speed == 400000)
+    {
+        peer_response_time = 2 * peer_response_time;
+    }
+
+    double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / SPEED_OF_LIGHT / (8 * 1024);
+    double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + m_param.mac_phy_delay + peer_response_time;
+
+    // Calculate the xoff and xon and then round up at 1024 bytes
+    double xoff_value = ceilTo1024(m_param.lossless_mtu + propagation_delay * cell_occupancy);
+    double xon_value = ceilTo1024(m_param.pipeline_latency);
+    double headroom_size = ceilTo1024(xon_value);
+
+    headroom.xon = ceilToString(xon_value);
+    headroom.xoff = ceilToString(xoff_value);
+    headroom.size = ceilToString(headroom_size);
+
+    return true;
+}
+
+BufferHeadroomCache::cache_key_t BufferHeadroomCache::makeKey(const buffer_headroom_input_t &input)
+{
+    return make_tuple(input.speed, input.cable_length, input.port_mtu, input.threshold, input.gearbox_model, input.lane_count);
+}
+
+bool BufferHeadroomCache::lookup(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    auto it = m_cache.find(makeKey(input));
+    if (it == m_cache.end())
+    {
+        m_misses++;
+        return false;
+    }
+
+    m_hits++;
+    headroom = it->second;
+    return true;
+}
+
+void BufferHeadroomCache::insert(const buffer_headroom_input_t &input, const buffer_headroom_t &headroom)
+{
+    if (m_cache.size() >= BUFFER_HEADROOM_CACHE_SIZE)
+    {
+        SWSS_LOG_INFO("Headroom cache is full, flushing %zu entries", m_cache.size());
+        m_cache.clear();
+    }
+
+    m_cache[makeKey(input)] = headroom;
+}
+
+void BufferHeadroomCache::clear()
+{
+    m_cache.clear();
+}
@@ -0,0 +1,140 @@
+#ifndef __BUFFERCALCULATOR__
+#define __BUFFERCALCULATOR__
+
+#include "dbconnector.h"
+#include "table.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace swss {
+
+// Maximum number of memoized headroom results before the cache is flushed
+#define BUFFER_HEADROOM_CACHE_SIZE 1024
+
+// Inputs of the headroom calculation of a lossless PG
+typedef struct {
+    std::string speed;
+    std::string cable_length;
+    std::string port_mtu;
+    std::string threshold;
+    std::string gearbox_model;
+    std::string gearbox_delay;
+    long lane_count;
+    // Shared headroom pool related parameters, CONFIG_DB values
+    std::string over_subscribe_ratio;
+    std::string shared_headroom_pool_size;
+} buffer_headroom_input_t;
+
+typedef struct {
+    std::string xon;
+    std::string xon_offset;
+    std::string xoff;
+    std::string size;
+} buffer_headroom_t;
+
+// Parameters retrieved from STATE_DB.ASIC_TABLE and CONFIG_DB.LOSSLESS_TRAFFIC_PATTERN
+typedef struct {
+    bool loaded;
+    double cell_size;
+    double pipeline_latency;
+    double mac_phy_delay;
+    double peer_response_time;
+    double lossless_mtu;
+    double small_packet_percentage;
+} buffer_headroom_param_t;
+
+/*
+ * BufferCalculator calculates the headroom of lossless PGs and the sizes of shared buffer pools.
+ *
+ * The default implementation runs the vendor specific lua plugins:
+ *  - buffer_headroom_<vendor>.lua for headroom
+ *  - buffer_pool_<vendor>.lua for shared buffer pool and shared headroom pool
+ * Vendors whose headroom model is implemented natively override calculateHeadroom,
+ * which saves a redis script execution (and the database reads in it) per calculation.
+ */
+class BufferCalculator
+{
+public:
+    BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+    virtual ~BufferCalculator() = default;
+
+    static std::unique_ptr<BufferCalculator> create(const std::string &platform, DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+
+    void loadPlugins(const std::string &platform);
+    bool isHeadroomCalculatedNatively() const { return m_native; }
+
+    // Calculate xon, xoff, xon_offset and size of a lossless headroom. Return false on failure.
+    virtual bool calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom);
+    // Calculate the sizes of buffer pools. Format of each line is the same as the output of buffer_pool_<vendor>.lua
+    virtual std::vector<std::string> calculatePoolSizes();
+    // Check whether the accumulative headroom on the port exceeds the limit using buffer_check_headroom_<vendor>.lua
+    std::vector<std::string> checkHeadroom(const std::vector<std::string> &keys, const std::vector<std::string> &argv);
+
+    // Drop the parameters fetched from the database, they will be fetched again on the next calculation
+    void resetParameters() { m_param.loaded = false; }
+
+protected:
+    DBConnector *m_applDb;
+    Table m_stateAsicTable;
+    Table m_cfgLosslessTrafficPatternTable;
+    buffer_headroom_param_t m_param;
+    bool m_native;
+
+    bool loadParameters();
+    bool isSharedHeadroomPoolEnabled(const buffer_headroom_input_t &input) const;
+
+private:
+    std::string m_headroomSha;
+    std::string m_bufferpoolSha;
+    std::string m_checkHeadroomSha;
+};
+
+// Native implementation of buffer_headroom_mellanox.lua, which is shared by the vs platform
+class MellanoxBufferCalculator : public BufferCalculator
+{
+public:
+    MellanoxBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+    bool calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom) override;
+};
+
+// Native implementation of buffer_headroom_barefoot.lua
+class BarefootBufferCalculator : public BufferCalculator
+{
+public:
+    BarefootBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+    bool calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom) override;
+};
+
+/*
+ * Memo of the calculated headroom.
+ * Key: (speed, cable length, mtu, threshold, gearbox model, lane count)
+ * The cache must be cleared whenever any input not represented in the key is changed,
+ * like shared headroom pool state or the parameters in ASIC_TABLE.
+ */
+class BufferHeadroomCache
+{
+public:
+    typedef std::tuple<std::string, std::string, std::string, std::string, std::string, long> cache_key_t;
+
+    bool lookup(const buffer_headroom_input_t &input, buffer_headroom_t &headroom);
+    void insert(const buffer_headroom_input_t &input, const buffer_headroom_t &headroom);
+    void clear();
+
+    uint64_t hits() const { return m_hits; }
+    uint64_t misses() const { return m_misses; }
+
+private:
+    std::map<cache_key_t, buffer_headroom_t> m_cache;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+
+    static cache_key_t makeKey(const buffer_headroom_input_t &input);
+};
+
+}
+
+#endif /* __BUFFERCALCULATOR__ */
@@ -51,6 +51,10 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_bufferPoolReady(false),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
+        m_deferPoolRecalculation(false),
+        m_poolRecalculationPending(false),
+        m_poolSizeSettled(false),
+        m_poolSizeResyncCountdown(0),
         m_mmuSizeNumber(0)
 {
     SWSS_LOG_ENTER();
@@ -62,17 +66,13 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_zeroPoolAndProfileInfo = *zeroProfilesInfo;
 
     string platform = getenv("ASIC_VENDOR") ? getenv("ASIC_VENDOR") : "";
+    m_bufferCalculator = BufferCalculator::create(platform, cfgDb, stateDb, applDb);
     if (platform == "")
     {
         SWSS_LOG_ERROR("Platform environment variable is not defined, buffermgrd won't start");
         return;
     }
 
-    string headroomSha, bufferpoolSha;
-    string headroomPluginName = "buffer_headroom_" + platform + ".lua";
-    string bufferpoolPluginName = "buffer_pool_" + platform + ".lua";
-    string checkHeadroomPluginName = "buffer_check_headroom_" + platform + ".lua";
-
     m_platform = platform;
     m_specific_platform = platform;     // default for non-Mellanox
     m_model_number = 0;
@@ -101,14 +101,7 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
 
     try
     {
-        string headroomLuaScript = swss::loadLuaScript(headroomPluginName);
-        m_headroomSha = swss::loadRedisScript(applDb, headroomLuaScript);
-
-        string bufferpoolLuaScript = swss::loadLuaScript(bufferpoolPluginName);
-        m_bufferpoolSha = swss::loadRedisScript(applDb, bufferpoolLuaScript);
-
-        string checkHeadroomLuaScript = swss::loadLuaScript(checkHeadroomPluginName);
-        m_checkHeadroomSha = swss::loadRedisScript(applDb, checkHeadroomLuaScript);
+        m_bufferCalculator->loadPlugins(platform);
     }
     catch (...)
     {
@@ -598,51 +591,61 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
 // Meta flows which are called by main flows
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 {
-    // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size and threshold
-    vector<string> keys = {};
-    vector<string> argv = {};
+    // Calculate the xon, xoff, xon_offset and size by the vendor-specific calculator
+    // The result is memoized as the same parameters are shared by lots of ports in general
+    buffer_headroom_input_t input;
+    buffer_headroom_t result;
 
-    keys.emplace_back(headroom.name);
-    argv.emplace_back(headroom.speed);
-    argv.emplace_back(headroom.cable_length);
-    argv.emplace_back(headroom.port_mtu);
-    argv.emplace_back(m_identifyGearboxDelay);
-    argv.emplace_back(to_string(headroom.lane_count));
+    input.speed = headroom.speed;
+    input.cable_length = headroom.cable_length;
+    input.port_mtu = headroom.port_mtu;
+    input.threshold = headroom.threshold;
+    input.gearbox_model = headroom.gearbox_model;
+    input.gearbox_delay = m_identifyGearboxDelay;
+    input.lane_count = headroom.lane_count;
+    input.over_subscribe_ratio = m_overSubscribeRatio;
+    input.shared_headroom_pool_size = m_configuredSharedHeadroomPoolSize;
 
-    try
+    if (m_headroomCache.lookup(input, result))
     {
-        auto ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
-
-        if (ret.empty())
+        SWSS_LOG_INFO("Headroom for %s fetched from cache", headroom.name.c_str());
+    }
+    else
+    {
+        try
         {
-            SWSS_LOG_WARN("Failed to calculate headroom for %s", headroom.name.c_str());
-            return;
+            if (!m_bufferCalculator->calculateHeadroom(input, result))
+            {
+                SWSS_LOG_WARN("Failed to calculate headroom for %s", headroom.name.c_str());
+                return;
+            }
         }
-
-        // The format of the result:
-        // a list of strings containing key, value pairs with colon as separator
-        // each is a field of the profile
-        // "xon:18432"
-        // "xoff:18432"
-        // "size:36864"
-
-        for ( auto i : ret)
+        catch (...)
         {
-            auto pairs = tokenize(i, ':');
-            if (pairs[0] == "xon")
-                headroom.xon = pairs[1];
-            if (pairs[0] == "xoff")
-                headroom.xoff = pairs[1];
-            if (pairs[0] == "size")
-                headroom.size = pairs[1];
-            if (pairs[0] == "xon_offset")
-                headroom.xon_offset = pairs[1];
+            SWSS_LOG_WARN("Lua scripts for headroom calculation were not executed successfully");
+            return;
         }
+
+        m_headroomCache.insert(input, result);
     }
-    catch (...)
-    {
-        SWSS_LOG_WARN("Lua scripts for headroom calculation were not executed successfully");
-    }
+
+    if (!result.xon.empty())
+        headroom.xon = result.xon;
+    if (!result.xoff.empty())
+        headroom.xoff = result.xoff;
+    if (!result.size.empty())
+        headroom.size = result.size;
+    if (!result.xon_offset.empty())
+        headroom.xon_offset = result.xon_offset;
+}
+
+// The headroom parameters in STATE_DB.ASIC_TABLE and CONFIG_DB.LOSSLESS_TRAFFIC_PATTERN are not subscribed.
+// They are rewritten along with the tables feeding the headroom calculation, like on config reload,
+// so they are fetched again and the memoized headroom is dropped whenever those tables are updated.
+void BufferMgrDynamic::reloadHeadroomParameters()
+{
+    m_bufferCalculator->resetParameters();
+    m_headroomCache.clear();
 }
 
 // This function is designed to fetch the sizes of shared buffer pool and shared headroom pool
@@ -657,9 +660,6 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
 {
     try
     {
-        vector<string> keys = {};
-        vector<string> argv = {};
-
         if (!m_bufferPoolReady)
         {
             // In case all buffer pools have a configured size,
@@ -688,7 +688,8 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
         }
 
-        auto ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        auto ret = m_bufferCalculator->calculatePoolSizes();
+        bool fullyCalculated = false;
 
         // The format of the result:
         // a list of lines containing key, value pairs with colon as separator
@@ -802,9 +803,14 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
             else
             {
+                // The debug information is provided only if the sizes are calculated from all buffer items
+                // instead of being taken from APPL_DB because orchagent hasn't handled all updates
+                fullyCalculated = true;
                 SWSS_LOG_INFO("Buffer pool debug info %s", i.c_str());
             }
         }
+
+        m_poolSizeSettled = fullyCalculated;
     }
     catch (...)
     {
@@ -817,6 +823,32 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
 
 void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initialization = false)
 {
+    if (!force_update_during_initialization)
+    {
+        // Something affecting the pool sizes has been updated
+        m_poolSizeSettled = false;
+
+        if (m_deferPoolRecalculation)
+        {
+            // A bulk update, like cable length or speed updated on lots of ports, is being handled
+            // The pool sizes will be recalculated once the doTask pass is done
+            m_poolRecalculationPending = true;
+            return;
+        }
+    }
+    else if (m_poolSizeSettled && m_bufferPoolReady && m_portInitDone)
+    {
+        // Periodic check. Nothing changed since the sizes were fully calculated last time,
+        // but recalculate them every BUFFERMGR_POOL_RESYNC_PERIODS periods anyway
+        // to catch up with changes made by other components
+        if (m_poolSizeResyncCountdown > 0)
+        {
+            m_poolSizeResyncCountdown--;
+            return;
+        }
+        m_poolSizeResyncCountdown = BUFFERMGR_POOL_RESYNC_PERIODS;
+    }
+
     // PortInitDone indicates all steps of port initialization has been done
     // Only after that does the buffer pool size update starts
     if (!m_portInitDone && !force_update_during_initialization)
@@ -856,6 +888,15 @@ void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initia
         recalculateSharedBufferPool();
 }
 
+void BufferMgrDynamic::handlePendingPoolRecalculation()
+{
+    if (m_poolRecalculationPending)
+    {
+        m_poolRecalculationPending = false;
+        checkSharedBufferPoolSize();
+    }
+}
+
 // For buffer pool, only size can be updated on-the-fly
 void BufferMgrDynamic::updateBufferPoolToDb(const string &name, const buffer_pool_t &pool)
 {
@@ -978,11 +1019,12 @@ task_process_status BufferMgrDynamic::allocateProfile(const string &speed, const
         profile.lane_count = lane_count;
         profile.pool_name = INGRESS_LOSSLESS_PG_POOL_NAME;
 
-        // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size
-        // Pay attention, the threshold can contain valid value
+        // The threshold is part of the key of the memoized headroom, so it must be set before calculating
+        profile.threshold = threshold;
+
+        // Call vendor-specific calculator to calculate the xon, xoff, xon_offset, size
         calculateHeadroomSize(profile);
 
-        profile.threshold = threshold;
         profile.static_configured = false;
         profile.lossless = true;
         profile.name = profile_name;
@@ -1076,7 +1118,7 @@ bool BufferMgrDynamic::isHeadroomResourceValid(const string &port, const buffer_
 
     try
     {
-        auto ret = runRedisScript(*m_applDb, m_checkHeadroomSha, keys, argv);
+        auto ret = m_bufferCalculator->checkHeadroom(keys, argv);
 
         // The format of the result:
         // a list of strings containing key, value pairs with colon as separator
@@ -1553,6 +1595,9 @@ task_process_status BufferMgrDynamic::refreshPgsForPort(const string &port, cons
 
 void BufferMgrDynamic::refreshSharedHeadroomPool(bool enable_state_updated_by_ratio, bool enable_state_updated_by_size)
 {
+    // The memoized headroom depends on the shared headroom pool configuration
+    m_headroomCache.clear();
+
     // The lossless profiles need to be refreshed only if system is switched between SHP and non-SHP
     bool need_refresh_profiles = false;
     bool shp_enabled_by_size = isNonZero(m_configuredSharedHeadroomPoolSize);
@@ -3402,6 +3447,16 @@ task_process_status BufferMgrDynamic::handleBufferPortEgressProfileListTable(Key
     return handleBufferObjectTables(tuple, CFG_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, false);
 }
 
+void BufferMgrDynamic::doTask()
+{
+    // Pool recalculation will be done only once after all the consumers have been drained
+    m_deferPoolRecalculation = true;
+    Orch::doTask();
+    m_deferPoolRecalculation = false;
+
+    handlePendingPoolRecalculation();
+}
+
 void BufferMgrDynamic::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -3416,6 +3471,19 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
         return;
     }
 
+    // Reload the headroom parameters once per batch of updates instead of once per item
+    if (!consumer.m_toSync.empty() &&
+        (table_name == CFG_DEFAULT_LOSSLESS_BUFFER_PARAMETER ||
+         table_name == CFG_PORT_CABLE_LEN_TABLE_NAME ||
+         table_name == CFG_PORT_TABLE_NAME))
+    {
+        reloadHeadroomParameters();
+    }
+
+    // Called from doTask() or drained by the consumer's execute()
+    bool deferredByCaller = m_deferPoolRecalculation;
+    m_deferPoolRecalculation = true;
+
     while (it != consumer.m_toSync.end())
     {
         auto task_status = (this->*(m_bufferTableHandlerMap[table_name]))(it->second);
@@ -3438,6 +3506,12 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    if (!deferredByCaller)
+    {
+        m_deferPoolRecalculation = false;
+        handlePendingPoolRecalculation();
+    }
 }
 
 /*
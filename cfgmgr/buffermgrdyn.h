@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "buffercalculator.h"
 
 #include <map>
 #include <set>
@@ -15,6 +16,8 @@ namespace swss {
 #define DEFAULT_MTU_STR             "9100"
 
 #define BUFFERMGR_TIMER_PERIOD 10
+// Number of timer periods after which settled buffer pool sizes are recalculated anyway
+#define BUFFERMGR_POOL_RESYNC_PERIODS 6
 
 typedef enum {
     BUFFER_INGRESS = 0,
@@ -149,6 +152,7 @@ class BufferMgrDynamic : public Orch
 public:
     BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb, DBConnector *applStateDb, const std::vector<TableConnector> &tables, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> gearboxInfo, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> zeroProfilesInfo);
     using Orch::doTask;
+    void doTask() override;
 
 private:
     std::string     m_platform;             // vendor, e.g. "mellanox"
@@ -249,12 +253,18 @@ private:
     gearbox_delay_t m_gearboxDelay;
     std::string m_identifyGearboxDelay;
 
-    // Vendor specific lua plugins for calculating headroom and buffer pool
-    // Loaded when the buffer manager starts
+    // Vendor specific calculator for headroom and buffer pool
+    // Created when the buffer manager starts
     // Executed whenever the headroom and pool size need to be updated
-    std::string m_headroomSha;
-    std::string m_bufferpoolSha;
-    std::string m_checkHeadroomSha;
+    std::unique_ptr<BufferCalculator> m_bufferCalculator;
+    BufferHeadroomCache m_headroomCache;
+
+    // Buffer pool recalculations requested while draining tables are coalesced into one per doTask pass
+    bool m_deferPoolRecalculation;
+    bool m_poolRecalculationPending;
+    // The pool sizes have been fully calculated and nothing affecting them has changed since then
+    bool m_poolSizeSettled;
+    int m_poolSizeResyncCountdown;
 
     // Parameters for headroom generation
     std::string m_mmuSize;
@@ -290,7 +300,9 @@ private:
     // Meta flows
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
+    void reloadHeadroomParameters();
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
+    void handlePendingPoolRecalculation();
     void recalculateSharedBufferPool();
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
     void releaseProfile(const std::string &profile_name);
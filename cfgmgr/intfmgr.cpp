@@ -7,6 +7,7 @@
 #include "intfmgr.h"
 #include "exec.h"
 #include "shellcmd.h"
+#include "netlinkbatch.h"
 #include "macaddress.h"
 #include "warm_restart.h"
 #include "subscriberstatetable.h"
@@ -75,6 +76,22 @@ IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
     }
 }
 
+static void logNetlinkError(int error, const string &description)
+{
+    if (error)
+    {
+        SWSS_LOG_ERROR("Netlink request '%s' failed: %s", description.c_str(), strerror(error));
+    }
+}
+
+static void throwOnNetlinkError(int error, const string &description)
+{
+    if (error)
+    {
+        throw runtime_error(description + " : " + strerror(error));
+    }
+}
+
 void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
                         const IpPrefix &ipPrefix)
 {
@@ -84,6 +101,9 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
     string          broadcastIpStr = ipPrefix.getBroadcastIp().to_string();
     int             prefixLen = ipPrefix.getMaskLength();
 
+    /* The interface and its VRF binding may still be queued */
+    m_netlinkBatch.commit();
+
     if (ipPrefix.isV4())
     {
         (prefixLen < 31) ?
@@ -137,6 +157,13 @@ void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkMac(alias, MacAddress(mac_str));
+        m_netlinkBatch.onResult(logNetlinkError);
+        return;
+    }
+
     cmd << IP_CMD << " link set " << alias << " address " << mac_str;
 
     int ret = swss::exec(cmd.str(), res);
@@ -151,6 +178,20 @@ void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        if (!vrfName.empty())
+        {
+            m_netlinkBatch.setLinkMaster(alias, vrfName);
+        }
+        else
+        {
+            m_netlinkBatch.setLinkNoMaster(alias);
+        }
+        m_netlinkBatch.onResult(logNetlinkError);
+        return;
+    }
+
     if (!vrfName.empty())
     {
         cmd << IP_CMD << " link set " << shellquote(alias) << " master " << shellquote(vrfName);
@@ -198,6 +239,14 @@ void IntfMgr::addLoopbackIntf(const string &alias)
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.addDummyLink(alias, static_cast<uint32_t>(stoul(LOOPBACK_DEFAULT_MTU_STR)));
+        m_netlinkBatch.setLinkAdminState(alias, true);
+        m_netlinkBatch.onResult(logNetlinkError);
+        return;
+    }
+
     cmd << IP_CMD << " link add " << alias << " mtu " << LOOPBACK_DEFAULT_MTU_STR << " type dummy && ";
     cmd << IP_CMD << " link set " << alias << " up";
     int ret = swss::exec(cmd.str(), res);
@@ -212,6 +261,13 @@ void IntfMgr::delLoopbackIntf(const string &alias)
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delLink(alias);
+        m_netlinkBatch.onResult(logNetlinkError);
+        return;
+    }
+
     cmd << IP_CMD << " link del " << alias;
     int ret = swss::exec(cmd.str(), res);
     if (ret)
@@ -240,6 +296,8 @@ void IntfMgr::flushLoopbackIntfs()
         SWSS_LOG_NOTICE("Remove loopback device %s", alias.c_str());
         delLoopbackIntf(alias);
     }
+
+    m_netlinkBatch.commit();
 }
 
 int IntfMgr::getIntfIpCount(const string &alias)
@@ -247,6 +305,8 @@ int IntfMgr::getIntfIpCount(const string &alias)
     stringstream cmd;
     string res;
 
+    m_netlinkBatch.commit();
+
     /* query ip address of the device with master name, it is much faster */
     // ip address show {{intf_name}}
     // $(ip link show {{intf_name}} | grep -o 'master [^\\s]*') ==> [master {{vrf_name}}]
@@ -334,6 +394,15 @@ void IntfMgr::addHostSubIntf(const string&intf, const string &subIntf, const str
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        /* The task is retried when the sub interface can't be created, so the result is needed now */
+        m_netlinkBatch.addVlanLink(intf, subIntf, static_cast<uint16_t>(stoul(vlan)));
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        m_netlinkBatch.commit();
+        return;
+    }
+
     cmd << IP_CMD " link add link " << shellquote(intf) << " name " << shellquote(subIntf) << " type vlan id " << shellquote(vlan);
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 }
@@ -447,7 +516,21 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
     cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
     std::string cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    int ret;
+
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkMtu(alias, static_cast<uint32_t>(stoul(subifMtu)));
+        m_netlinkBatch.onResult([&](int error, const string &description) {
+            ret = error;
+            res = error ? description + " : " + strerror(error) : "";
+        });
+        m_netlinkBatch.commit();
+    }
+    else
+    {
+        ret = swss::exec(cmd_str, res);
+    }
 
     if (ret && !isIntfStateOk(alias))
     {
@@ -497,7 +580,21 @@ std::string IntfMgr::setHostSubIntfAdminStatus(const string &alias, const string
         SWSS_LOG_INFO("subintf %s admin_status: %s", alias.c_str(), admin_status.c_str());
         cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
         cmd_str = cmd.str();
-        int ret = swss::exec(cmd_str, res);
+        int ret;
+
+        if (NetlinkBatch::isEnabled() && (admin_status == "up" || admin_status == "down"))
+        {
+            m_netlinkBatch.setLinkAdminState(alias, admin_status == "up");
+            m_netlinkBatch.onResult([&](int error, const string &description) {
+                ret = error;
+                res = error ? description + " : " + strerror(error) : "";
+            });
+            m_netlinkBatch.commit();
+        }
+        else
+        {
+            ret = swss::exec(cmd_str, res);
+        }
         if (ret && !isIntfStateOk(alias))
         {
             // Can happen when a DEL notification is sent by portmgrd immediately followed by a new SET notification
@@ -521,6 +618,13 @@ void IntfMgr::removeHostSubIntf(const string &subIntf)
     stringstream cmd;
     string res;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delLink(subIntf);
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        return;
+    }
+
     cmd << IP_CMD " link del " << shellquote(subIntf);
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 }
@@ -577,6 +681,8 @@ bool IntfMgr::setIntfGratArp(const string &alias, const string &grat_arp)
         return false;
     }
 
+    m_netlinkBatch.commit();
+
     cmd << ECHO_CMD << " " << garp_enabled << " > /proc/sys/net/ipv4/conf/" << alias << "/arp_accept";
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
     SWSS_LOG_INFO("ARP accept set to \"%s\" on interface \"%s\"",  grat_arp.c_str(), alias.c_str());
@@ -619,6 +725,8 @@ bool IntfMgr::setIntfProxyArp(const string &alias, const string &proxy_arp)
         return false;
     }
 
+    m_netlinkBatch.commit();
+
     cmd << ECHO_CMD << " " << proxy_arp_status << " > /proc/sys/net/ipv4/conf/" << alias << "/proxy_arp_pvlan";
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 
@@ -1180,6 +1288,8 @@ void IntfMgr::doTask(Consumer &consumer)
         it = consumer.m_toSync.erase(it);
     }
 
+    m_netlinkBatch.commit();
+
     if (!m_replayDone && WarmStart::isWarmStart() && m_pendingReplayIntfList.empty() )
     {
         setWarmReplayDoneState();
@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkbatch.h"
 
 #include <map>
 #include <string>
@@ -38,6 +39,8 @@ private:
     std::set<std::string> m_pendingReplayIntfList;
     std::set<std::string> m_ipv6LinkLocalModeList;
     std::string mySwitchType;
+    /* Kernel configuration of a doTask() pass, committed at its end or before a command which depends on it */
+    NetlinkBatch m_netlinkBatch;
 
     void setIntfIp(const std::string &alias, const std::string &opCmd, const IpPrefix &ipPrefix);
     void setIntfVrf(const std::string &alias, const std::string &vrfName);
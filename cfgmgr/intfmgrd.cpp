@@ -6,6 +6,7 @@
 #include "exec.h"
 #include "schema.h"
 #include "intfmgr.h"
+#include "netlinkbatch.h"
 #include <fstream>
 #include <iostream>
 #include "warm_restart.h"
@@ -41,6 +42,8 @@ int main(int argc, char **argv)
         WarmStart::initialize("intfmgrd", "swss");
         WarmStart::checkWarmStart("intfmgrd", "swss");
 
+        NetlinkBatch::enable();
+
         IntfMgr intfmgr(&cfgDb, &appDb, &stateDb, cfg_intf_tables);
         std::vector<Orch *> cfgOrchList = {&intfmgr};
 
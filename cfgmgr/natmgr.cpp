@@ -15,6 +15,9 @@
  */
 
 #include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <sstream>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
@@ -55,6 +58,9 @@ NatMgr::NatMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
     /* Set the Admin mode to disabled */
     natAdminMode = DISABLED;
 
+    /* Apply the iptables rules as they are set, unless batchIptablesRules() is called */
+    m_iptablesBatched = false;
+
     /* Set NAT default timeout as 600 seconds */
     m_natTimeout = NAT_TIMEOUT_DEFAULT;
     
@@ -352,12 +358,24 @@ bool NatMgr::warmBootingInProgress(void)
     return false;
 }
 
+/* To run a conntrack command, once the iptables rules queued so far are applied. The conntrack
+ * updates are thus done in the same order relative to the iptables rules, whether they are batched
+ * or not. For instance, the rules of a removed pool are deleted before its conntrack entries, so no
+ * new entry is created.
+ */
+int NatMgr::execConntrackCmd(const string &cmds, string &res)
+{
+    applyPendingIptablesRules();
+
+    return swss::exec(cmds, res);
+}
+
 /* To flush all NAT entries */
 void NatMgr::flushAllNatEntries(void)
 {
     std::string res;
     const std::string cmds = std::string("") + CONNTRACK_CMD + FLUSH;
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -377,7 +395,7 @@ void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
     IpAddress   ip_address = IpAddress(key);
 
     cmds += (" -U -s " + ip_address.to_string() + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -401,7 +419,7 @@ void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
     std::string     cmds = std::string("") + CONNTRACK_CMD;
     
     cmds += (" -U -s " + ip_address.to_string() + " -p " + prototype + " --orig-port-src " + to_string(l4_port) + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -425,7 +443,7 @@ void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 
     cmd += (" -U -s " + src_ip.to_string() + " -d " + dst_ip.to_string() + " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
+    execConntrackCmd(cmd, res);
 
     SWSS_LOG_INFO("Updated active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   src_ip.to_string().c_str(), dst_ip.to_string().c_str(), timeout);
@@ -447,7 +465,7 @@ void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
             " -d " + dst_ip.to_string() + " --orig-port-dst " + std::to_string(dst_l4_port) +
             " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
+    execConntrackCmd(cmd, res);
 
     SWSS_LOG_INFO("Updated active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
                   prototype.c_str(), src_ip.to_string().c_str(), src_l4_port, dst_ip.to_string().c_str(), dst_l4_port, timeout);
@@ -476,7 +494,7 @@ void NatMgr::addConntrackStaticSingleNatEntry(const string &key)
                  " --src " + key + " --sport 1 --dst 127.0.0.1 --dport 127 -u ASSURED " + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -501,7 +519,7 @@ void NatMgr::addConntrackStaticTwiceNatEntry(const string &snatKey, const string
              +  " -p udp" + " -t " + to_string(timeout) + " --src " + snatKey + " --sport 1" + " --dst " + dnatKey
              +  " --dport 1" + " -u ASSURED " + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -551,7 +569,7 @@ void NatMgr::addConntrackStaticSingleNaptEntry(const string &key)
                  " --src " + keys[0] + " --sport " + keys[2] + " --dst 127.0.0.1 --dport 127 -u ASSURED " +  state + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -590,7 +608,7 @@ void NatMgr::addConntrackStaticTwiceNaptEntry(const string &snatKey, const strin
              + " --src " + snatKeys[0] + " --sport " + snatKeys[2] + " --dst " + dnatKeys[0] + " --dport " + dnatKeys[2] + " -u ASSURED " 
              +  state + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -623,7 +641,7 @@ void NatMgr::updateConntrackStaticSingleNatEntry(const string &key)
         cmds += (" -U --src " + key + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
     }
 
-    swss::exec(cmds, res);
+    execConntrackCmd(cmds, res);
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAT entry in the kernel */
@@ -637,7 +655,7 @@ void NatMgr::updateConntrackStaticTwiceNatEntry(const string &snatKey, const str
    
     cmds += (" -U --src " + snatKey + " -p udp -t " + to_string(timeout) + " --dst " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    execConntrackCmd(cmds, res);
 }
 
 /* To update a dummy conntrack entry for the Static NAPT entry in the kernel */
@@ -673,7 +691,7 @@ void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
         cmds += (" -U --src " + keys[0] + " -p " + prototype + " --sport " + keys[2] + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
     }
 
-    swss::exec(cmds, res);
+    execConntrackCmd(cmds, res);
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAPT entry in the kernel */
@@ -699,7 +717,7 @@ void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     cmds += (" -U --src " + snatKeys[0] + " --dst " + dnatKeys[0] + " -p udp " + " --sport " + snatKeys[2] + " --dport " + dnatKeys[2]
              + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    execConntrackCmd(cmds, res);
 }
 
 /* To Delete conntrack entry for Static Single NAT entry */
@@ -720,7 +738,7 @@ void NatMgr::deleteConntrackStaticSingleNatEntry(const string &key)
         cmds += (" -D -s " + key + " -p udp" + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -741,7 +759,7 @@ void NatMgr::deleteConntrackStaticTwiceNatEntry(const string &snatKey, const str
 
     cmds += (" -D -s " + snatKey + " -d " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -783,7 +801,7 @@ void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
         cmds += (" -D -s " + keys[0] + " -p " + prototype + " --sport " + keys[2] + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -816,7 +834,7 @@ void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const st
 
     cmds += (" -D -s " + snatKeys[0] + " -p " + prototype + " --orig-port-src " + snatKeys[2] + " -d " + dnatKeys[0] + " --orig-port-dst " + dnatKeys[2] + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmd(cmds, res);
 
     if (ret)
     {
@@ -868,7 +886,7 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
 
         cmds = (std::string("") + CONNTRACK_CMD + " -D -q " + ipAddrString + REDIRECT_TO_DEV_NULL);
 
-        int ret = swss::exec(cmds, res);
+        int ret = execConntrackCmd(cmds, res);
 
         if (ret)
         {
@@ -881,6 +899,213 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
     }
 }
 
+/* To queue the iptables rules of an iptables command string
+ *
+ * The command string is a list of "iptables -t table -opCmd chain rule-spec" commands separated by "&&".
+ * Adding a rule which has been installed already, or deleting a rule which is still referenced or
+ * known to be absent, is skipped. The rules are applied right away in one iptables-restore transaction
+ * per table, and a failure is returned to the caller. Once batchIptablesRules() is called, as done for
+ * each doTask(Consumer &), they are rather applied before the next conntrack command or by
+ * applyIptablesRules().
+ */
+int NatMgr::queueIptablesRules(const string &cmds)
+{
+    vector<string> commands;
+    size_t start = 0, end;
+
+    while ((end = cmds.find("&&", start)) != string::npos)
+    {
+        commands.push_back(cmds.substr(start, end - start));
+        start = end + 2;
+    }
+    commands.push_back(cmds.substr(start));
+
+    for (auto &command : commands)
+    {
+        vector<string> tokens;
+        string token;
+        istringstream iss(command);
+
+        while (iss >> token)
+        {
+            tokens.push_back(token);
+        }
+
+        /* iptables -t table -opCmd chain rule-spec */
+        if ((tokens.size() < 5) or (tokens[0] != IPTABLES_CMD) or (tokens[1] != "-t") or
+            ((tokens[3] != "-" ADD) and (tokens[3] != "-" INSERT) and (tokens[3] != "-" DELETE)))
+        {
+            SWSS_LOG_ERROR("Unexpected iptables command '%s'", command.c_str());
+            return -1;
+        }
+
+        const string &table = tokens[2];
+        const string &op = tokens[3];
+        string rule = tokens[4];
+
+        for (size_t i = 5; i < tokens.size(); i++)
+        {
+            rule += " " + tokens[i];
+        }
+
+        auto &installedRules = m_iptablesInstalledRules[table];
+        auto it = installedRules.find(rule);
+
+        if (op != "-" DELETE)
+        {
+            if ((it != installedRules.end()) and (it->second > 0))
+            {
+                it->second++;
+                SWSS_LOG_INFO("Iptables rule '%s' in %s table is installed already, skipped", rule.c_str(), table.c_str());
+                continue;
+            }
+            installedRules[rule] = 1;
+        }
+        else
+        {
+            if ((it != installedRules.end()) and (it->second != 1))
+            {
+                if (it->second > 1)
+                {
+                    it->second--;
+                }
+                SWSS_LOG_INFO("Iptables rule '%s' in %s table is still referenced or absent, skipped deleting", rule.c_str(), table.c_str());
+                continue;
+            }
+            installedRules[rule] = 0;
+        }
+
+        m_iptablesPendingRules[table].push_back({op, rule});
+    }
+
+    if (!m_iptablesBatched and !applyPendingIptablesRules())
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* To update the installed rules with the result of an iptables rule update */
+void NatMgr::setIptablesRuleResult(const string &table, const iptablesRuleUpdate_t &update, bool success)
+{
+    if (!success)
+    {
+        /* The state of the rule in the kernel is unknown */
+        m_iptablesInstalledRules[table].erase(update.rule);
+    }
+}
+
+/* To apply the updates of an iptables table in a single iptables-restore transaction */
+bool NatMgr::applyIptablesTableRules(const string &table, const vector<iptablesRuleUpdate_t> &updates)
+{
+    string content = "*" + table + "\n";
+    for (auto &update : updates)
+    {
+        content += update.op + " " + update.rule + "\n";
+    }
+    content += "COMMIT\n";
+
+    char fileName[] = "/tmp/natmgr_iptables_XXXXXX";
+    int fd = mkstemp(fileName);
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("Failed to create iptables-restore input file, errno %d", errno);
+        return false;
+    }
+
+    size_t written = 0;
+    while (written < content.size())
+    {
+        ssize_t n = write(fd, content.data() + written, content.size() - written);
+        if (n <= 0)
+        {
+            break;
+        }
+        written += static_cast<size_t>(n);
+    }
+    close(fd);
+
+    int ret = -1;
+    string res;
+    string cmds = std::string("") + IPTABLES_RESTORE_CMD + " -w --noflush < " + fileName;
+
+    if (written == content.size())
+    {
+        ret = swss::exec(cmds, res);
+    }
+    unlink(fileName);
+
+    if (ret)
+    {
+        SWSS_LOG_WARN("Command '%s' failed with rc %d for %zu rules of %s table: %s",
+                      cmds.c_str(), ret, updates.size(), table.c_str(), res.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/* To queue the iptables rules set from now on, until applyIptablesRules() is called.
+ * The callers then only learn about failures from the logs of applyPendingIptablesRules(), which
+ * applies the rules one by one to find out the failed ones.
+ */
+void NatMgr::batchIptablesRules(void)
+{
+    m_iptablesBatched = true;
+}
+
+/* To apply all the pending iptables rule updates and stop batching them, returns false if any of them failed */
+bool NatMgr::applyIptablesRules(void)
+{
+    m_iptablesBatched = false;
+
+    return applyPendingIptablesRules();
+}
+
+/* To apply all the pending iptables rule updates, returns false if any of them failed */
+bool NatMgr::applyPendingIptablesRules(void)
+{
+    iptablesPendingRules_map_t pendingRules;
+    bool success = true;
+
+    pendingRules.swap(m_iptablesPendingRules);
+
+    for (auto &tableRules : pendingRules)
+    {
+        const string &table = tableRules.first;
+        auto &updates = tableRules.second;
+
+        if (updates.empty())
+        {
+            continue;
+        }
+
+        if (applyIptablesTableRules(table, updates))
+        {
+            SWSS_LOG_INFO("Applied %zu iptables rule updates to %s table", updates.size(), table.c_str());
+            continue;
+        }
+
+        /* The transaction is rejected as a whole, apply the rules one by one to find out the failed ones */
+        for (auto &update : updates)
+        {
+            string res;
+            string cmds = std::string("") + IPTABLES_CMD + " -t " + table + " " + update.op + " " + update.rule;
+
+            int ret = swss::exec(cmds, res);
+            if (ret)
+            {
+                SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+                success = false;
+            }
+            setIptablesRuleResult(table, update, ret == 0);
+        }
+    }
+
+    return success;
+}
+
 /* Iptable rules are added in the mangles table, to support use of Loopback IP as NAT Public IP which is a typical use-case in DC scenarios. The way it works is that:
  *
  * *	The mangle table rules are processed first before the nat table rules.
@@ -899,7 +1124,6 @@ bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface
      * iptables -t mangle -opCmd PREROUTING -i port -j MARK --set-mark nat_zone
      * iptables -t mangle -opCmd POSTROUTING -o port -j MARK --set-mark nat_zone
      */
-    std::string res;
     int ret;
 
     if (nat_zone.empty())
@@ -912,7 +1136,7 @@ bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " PREROUTING -i " + interface + " -j MARK --set-mark " + nat_zone + " && "
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " POSTROUTING -o " + interface + " -j MARK --set-mark " + nat_zone ;
 
-    ret = swss::exec(cmds, res);
+    ret = queueIptablesRules(cmds);
 
     if (ret)
     {
@@ -929,7 +1153,6 @@ bool NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
     /* This rule in the PREROUTING chain should be the default rule at the end of the list
      * iptables -t nat -[A/D] PREROUTING -j DNAT --fullcone
      */
-    std::string res;
     int ret;
 
     /* In case of fullcone, the --to-destination is ignored by the stack, giving an aribitrary value so that 
@@ -937,7 +1160,7 @@ bool NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
     const std::string cmds = std::string("")
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + " -j DNAT --to-destination 1.1.1.1 --fullcone";
         
-    ret = swss::exec(cmds, res);
+    ret = queueIptablesRules(cmds);
 
     if (ret)
     {
@@ -956,7 +1179,6 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
      * iptables -t nat -opCmd PREROUTING -m mark --mark zone-value -j DNAT -d external_ip --to-destination internal_ip
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -j SNAT -s internal_ip --to-source external_ip
      */
-    std::string res;
     std::string markStr = std::string("");
     int ret;
 
@@ -968,7 +1190,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + markStr + " -j DNAT -d " + external_ip + " --to-destination " + internal_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + internal_ip + " --to-source " + external_ip ;
         
-        ret = swss::exec(cmds, res);
+        ret = queueIptablesRules(cmds);
 
         if (ret)
         {
@@ -982,7 +1204,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING" + " -j DNAT -d " + internal_ip + " --to-destination " + external_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -j SNAT -s " + external_ip + " --to-source " + internal_ip ;
 
-        ret = swss::exec(cmds, res);
+        ret = queueIptablesRules(cmds);
 
         if (ret)
         {
@@ -1004,7 +1226,6 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
      * iptables -t nat -opCmd PREROUTING -m mark --mark zone-value -p prototype -j DNAT -d external_ip --dport external_port --to-destination internal_ip:internal_port
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -p prototype -j SNAT -s internal_ip --sport internal_port --to-source external_ip:external_port
      */
-    std::string res;
     std::string markStr = std::string("");
     int ret;
 
@@ -1018,7 +1239,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + internal_ip + " --sport " + internal_port + " --to-source " 
           + external_ip + ":" + external_port;
 
-        ret = swss::exec(cmds, res);
+        ret = queueIptablesRules(cmds);
 
         if (ret)
         {
@@ -1034,7 +1255,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -p " + prototype + " -j SNAT -s " + external_ip + " --sport " + external_port + " --to-source "
           + internal_ip + ":" + internal_port;
 
-        ret = swss::exec(cmds, res);
+        ret = queueIptablesRules(cmds);
 
         if (ret)
         {
@@ -1060,7 +1281,6 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -j SNAT -s translated_dst --to-source dst -d src 
      */
 
-    std::string res;
     std::string markStr = std::string("");
     int ret;
 
@@ -1076,7 +1296,7 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + translated_dest_ip
           + " --to-source " + dest_ip + " -d " + src_ip;
 
-    ret = swss::exec(cmds, res);
+    ret = queueIptablesRules(cmds);
 
     if (ret)
     {
@@ -1106,7 +1326,6 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
      * -d src --dport src_l4_port
      */
 
-    std::string res;
     std::string markStr = std::string("");
     int ret;
 
@@ -1122,7 +1341,7 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + translated_dest_ip + " --sport " + translated_dest_port
           + " --to-source " + dest_ip + ":" + dest_port + " -d " + src_ip + " --dport " +src_port;
 
-    ret = swss::exec(cmds, res);
+    ret = queueIptablesRules(cmds);
 
     if (ret)
     {
@@ -1145,7 +1364,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
      * iptables -t nat -opCmd POSTROUTING -p udp -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      * iptables -t nat -opCmd POSTROUTING -p icmp -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      */
-    std::string res, cmd;
+    std::string cmd;
     std::string externalString = EMPTY_STRING;
     std::string fullcone = EMPTY_STRING;
     std::string prototype = EMPTY_STRING;
@@ -1219,7 +1438,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
         }
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = queueIptablesRules(cmds);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
@@ -1247,7 +1466,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
      * iptables -t nat -opCmd POSTROUTING -p icmp srcIpAddressString -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      */
 
-    std::string res, cmd;
+    std::string cmd;
     std::string srcIpAddressString = EMPTY_STRING, dstIpAddressString = EMPTY_STRING;
     std::string srcPortString = EMPTY_STRING, dstPortString = EMPTY_STRING;
     std::string externalString = EMPTY_STRING, fullcone = EMPTY_STRING;
@@ -1448,7 +1667,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
         }
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = queueIptablesRules(cmds);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
@@ -8150,6 +8369,9 @@ void NatMgr::doTask(Consumer &consumer)
 
     string table_name = consumer.getTableName();
 
+    /* The iptables rules of the task are applied at the end, in one transaction per table */
+    batchIptablesRules();
+
     if (table_name == CFG_STATIC_NAT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received update from CFG_STATIC_NAT_TABLE_NAME");
@@ -8193,9 +8415,12 @@ void NatMgr::doTask(Consumer &consumer)
     }
     else
     {
+        applyIptablesRules();
         SWSS_LOG_ERROR("Unknown config table %s ", table_name.c_str());
         throw runtime_error("NatMgr doTask failure.");
     }
+
+    applyIptablesRules();
 }
 
 /* To parse the timeout notifications */
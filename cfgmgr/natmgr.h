@@ -234,6 +234,28 @@ typedef std::map<std::string, std::string> natZoneInterface_map_t;
  */
 typedef std::map<std::string, int> natDnatPool_map_t;
 
+/* To store an iptables rule update pending to be applied,
+ * op is the iptables command (Eg. "-I")
+ * rule is the chain followed by the rule specification (Eg. "PREROUTING -j DNAT -d 65.55.45.1 --to-destination 1.1.1.1")
+ */
+typedef struct iptablesRuleUpdate
+{
+    std::string op;
+    std::string rule;
+} iptablesRuleUpdate_t;
+
+/* To store iptables rule updates pending to be applied,
+ * Key is "table" (Eg. nat)
+ * Value is the list of updates in the order they are requested
+ */
+typedef std::map<std::string, std::vector<iptablesRuleUpdate_t>> iptablesPendingRules_map_t;
+
+/* To store iptables rules installed by NatMgr,
+ * Key is "table" (Eg. nat)
+ * Value is a map from "rule" to the number of references, 0 means the rule is known to be absent
+ */
+typedef std::map<std::string, std::map<std::string, int>> iptablesInstalledRules_map_t;
+
 /* Define NatMgr Class inherited from Orch Class */
 class NatMgr : public Orch
 {
@@ -251,6 +273,8 @@ public:
     void removeStaticNatIptables(const std::string port = NONE_STRING);
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
     void removeDynamicNatRules(const std::string port = NONE_STRING, const std::string ipPrefix = NONE_STRING);
+    void batchIptablesRules(void);
+    bool applyIptablesRules(void);
 
 private:
     /* Declare APPL_DB, CFG_DB and STATE_DB tables */
@@ -275,6 +299,9 @@ private:
     natAclRule_map_t         m_natAclRuleInfo;
     natDnatPool_map_t        m_natDnatPoolInfo;
     SelectableTimer          *m_natRefreshTimer;
+    iptablesPendingRules_map_t   m_iptablesPendingRules;
+    bool                         m_iptablesBatched;
+    iptablesInstalledRules_map_t m_iptablesInstalledRules;
 
     /* Declare doTask related functions */
     void doTask(Consumer &consumer);
@@ -366,6 +393,11 @@ private:
     bool isGlobalIpMatching(const std::string &intf_keys, const std::string &global_ip);
     bool getIpEnabledIntf(const std::string &global_ip, std::string &interface);
     void setNaptPoolIpTable(const std::string &opCmd, const std::string &nat_ip, const std::string &nat_port);
+    int  queueIptablesRules(const std::string &cmds);
+    bool applyPendingIptablesRules(void);
+    int  execConntrackCmd(const std::string &cmds, std::string &res);
+    bool applyIptablesTableRules(const std::string &table, const std::vector<iptablesRuleUpdate_t> &updates);
+    void setIptablesRuleResult(const std::string &table, const iptablesRuleUpdate_t &update, bool success);
     bool setFullConeDnatIptablesRule(const std::string &opCmd);
     bool setMangleIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &nat_zone);
     bool setStaticNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &external_ip, const std::string &internal_ip, const std::string &nat_type);
@@ -88,11 +88,13 @@ void cleanup()
     
     if (natmgr)
     {
+        natmgr->batchIptablesRules();
         natmgr->removeStaticNatIptables();
         natmgr->removeStaticNaptIptables();
         natmgr->removeDynamicNatRules();
 
         natmgr->cleanupMangleIpTables();
+        natmgr->applyIptablesRules();
         natmgr->cleanupPoolIpTable();
     }
 }
@@ -2,12 +2,14 @@
 #include "teammgr.h"
 #include "logger.h"
 #include "shellcmd.h"
+#include "netlinkbatch.h"
 #include "tokenize.h"
 #include "warm_restart.h"
 #include "portmgr.h"
 #include <swss/redisutility.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -164,6 +166,8 @@ void TeamMgr::doTask(Consumer &consumer)
     {
         doPortUpdateTask(consumer);
     }
+
+    m_netlinkBatch.commit();
 }
 
 void TeamMgr::cleanTeamProcesses()
@@ -489,12 +493,26 @@ bool TeamMgr::setLagAdminStatus(const string &alias, const string &admin_status)
     stringstream cmd;
     string res;
 
-    // ip link set dev <port_channel_name> [up|down]
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    if (NetlinkBatch::isEnabled() && (admin_status == "up" || admin_status == "down"))
+    {
+        m_netlinkBatch.setLinkAdminState(alias, admin_status == "up");
+    }
+    else
+    {
+        // ip link set dev <port_channel_name> [up|down]
+        cmd << IP_CMD << " link set dev " << shellquote(alias) << " " << shellquote(admin_status);
+        EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    }
 
-    SWSS_LOG_NOTICE("Set port channel %s admin status to %s",
-            alias.c_str(), admin_status.c_str());
+    m_netlinkBatch.onResult([alias, admin_status](int error, const string &description) {
+        if (error)
+        {
+            throw runtime_error(description + " : " + strerror(error));
+        }
+
+        SWSS_LOG_NOTICE("Set port channel %s admin status to %s",
+                alias.c_str(), admin_status.c_str());
+    });
 
     return true;
 }
@@ -506,32 +524,46 @@ bool TeamMgr::setLagMtu(const string &alias, const string &mtu)
     stringstream cmd;
     string res;
 
-    // ip link set dev <port_channel_name> mtu <mtu_value>
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkMtu(alias, static_cast<uint32_t>(stoul(mtu)));
+    }
+    else
+    {
+        // ip link set dev <port_channel_name> mtu <mtu_value>
+        cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
+        EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    }
 
-    vector<FieldValueTuple> fvs;
-    FieldValueTuple fv("mtu", mtu);
-    fvs.push_back(fv);
-    m_appLagTable.set(alias, fvs);
+    m_netlinkBatch.onResult([this, alias, mtu](int error, const string &description) {
+        if (error)
+        {
+            throw runtime_error(description + " : " + strerror(error));
+        }
 
-    vector<string> keys;
-    m_cfgLagMemberTable.getKeys(keys);
+        vector<FieldValueTuple> fvs;
+        FieldValueTuple fv("mtu", mtu);
+        fvs.push_back(fv);
+        m_appLagTable.set(alias, fvs);
 
-    for (auto key : keys)
-    {
-        auto tokens = tokenize(key, config_db_key_delimiter);
-        auto lag = tokens[0];
-        auto member = tokens[1];
+        vector<string> keys;
+        m_cfgLagMemberTable.getKeys(keys);
 
-        if (alias == lag)
+        for (auto key : keys)
         {
-            m_appPortTable.set(member, fvs);
+            auto tokens = tokenize(key, config_db_key_delimiter);
+            auto lag = tokens[0];
+            auto member = tokens[1];
+
+            if (alias == lag)
+            {
+                m_appPortTable.set(member, fvs);
+            }
         }
-    }
 
-    SWSS_LOG_NOTICE("Set port channel %s MTU to %s",
-            alias.c_str(), mtu.c_str());
+        SWSS_LOG_NOTICE("Set port channel %s MTU to %s",
+                alias.c_str(), mtu.c_str());
+    });
 
     return true;
 }
@@ -6,6 +6,7 @@
 #include "dbconnector.h"
 #include "netmsg.h"
 #include "orch.h"
+#include "netlinkbatch.h"
 #include "producerstatetable.h"
 #include <sys/types.h>
 
@@ -35,6 +36,8 @@ private:
     std::set<std::string> m_lagList;
 
     MacAddress m_mac;
+    /* Kernel configuration of a doTask() pass, committed at its end */
+    NetlinkBatch m_netlinkBatch;
 
     void doTask(Consumer &consumer);
     void doLagTask(Consumer &consumer);
@@ -3,6 +3,7 @@
 #include "teammgr.h"
 #include "netdispatcher.h"
 #include "netlink.h"
+#include "netlinkbatch.h"
 #include "select.h"
 #include "warm_restart.h"
 #include <signal.h>
@@ -62,6 +63,8 @@ int main(int argc, char **argv)
             state_port_table
         };
 
+        NetlinkBatch::enable();
+
         TeamMgr teammgr(&conf_db, &app_db, &state_db, tables);
 
         vector<Orch *> cfgOrchList = {&teammgr};
@@ -2,6 +2,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <cstring>
 #include <net/if.h>
 
 #include "logger.h"
@@ -211,6 +212,8 @@ void TunnelMgr::doTask(Consumer &consumer)
         }
     }
 
+    m_netlinkBatch.commit();
+
     if (!replayDone && m_tunnelReplay.empty() && WarmStart::isWarmStart())
     {
         finalizeWarmReboot();
@@ -309,7 +312,18 @@ bool TunnelMgr::doLpbkIntfTask(const KeyOpFieldsValuesTuple & t)
 
     m_intfCache[alias] = ipPrefix;
 
-    if (alias == LOOPBACK_SRC && !m_tunnelCache.empty())
+    if (alias == LOOPBACK_SRC && !m_tunnelCache.empty() && NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.addAddress(TUNIF, ipPrefix);
+        m_netlinkBatch.onResult([ipPrefix](int error, const std::string &description) {
+            if (error)
+            {
+                SWSS_LOG_WARN("Failed to assign IP addr for tun if %s, res %s : %s",
+                               ipPrefix.to_string().c_str(), description.c_str(), strerror(error));
+            }
+        });
+    }
+    else if (alias == LOOPBACK_SRC && !m_tunnelCache.empty())
     {
         int ret = 0;
         std::string res;
@@ -334,7 +348,26 @@ bool TunnelMgr::doTunnelRouteTask(const KeyOpFieldsValuesTuple & t)
 
     int ret = 0;
     std::string res;
-    if (op == SET_COMMAND)
+    if (NetlinkBatch::isEnabled())
+    {
+        bool add = (op == SET_COMMAND);
+        if (add)
+        {
+            m_netlinkBatch.replaceRoute(TUNIF, IpPrefix(prefix));
+        }
+        else
+        {
+            m_netlinkBatch.delRoute(TUNIF, IpPrefix(prefix));
+        }
+        m_netlinkBatch.onResult([prefix, add](int error, const std::string &description) {
+            if (error)
+            {
+                SWSS_LOG_WARN("Failed to %s route %s, res %s : %s", add ? "add" : "del",
+                              prefix.c_str(), description.c_str(), strerror(error));
+            }
+        });
+    }
+    else if (op == SET_COMMAND)
     {
         ret = cmdIpTunnelRouteAdd(prefix, res);
         if (ret != 0)
@@ -361,6 +394,43 @@ bool TunnelMgr::configIpTunnel(const TunnelInfo& tunInfo)
     int ret = 0;
     std::string res;
 
+    if (NetlinkBatch::isEnabled() && IpAddress(tunInfo.dst_ip).isV4() && IpAddress(tunInfo.remote_ip).isV4())
+    {
+        m_netlinkBatch.addIpipLink(TUNIF, IpAddress(tunInfo.dst_ip), IpAddress(tunInfo.remote_ip));
+        m_netlinkBatch.onResult([tunInfo](int error, const std::string &description) {
+            if (error)
+            {
+                SWSS_LOG_WARN("Failed to create IP tunnel if (dst ip: %s, peer ip %s), res %s : %s",
+                               tunInfo.dst_ip.c_str(), tunInfo.remote_ip.c_str(), description.c_str(), strerror(error));
+            }
+        });
+
+        m_netlinkBatch.setLinkAdminState(TUNIF, true);
+        m_netlinkBatch.onResult([tunInfo](int error, const std::string &description) {
+            if (error)
+            {
+                SWSS_LOG_WARN("Failed to enable IP tunnel intf (dst ip: %s, peer ip %s), res %s : %s",
+                               tunInfo.dst_ip.c_str(), tunInfo.remote_ip.c_str(), description.c_str(), strerror(error));
+            }
+        });
+
+        auto it = m_intfCache.find(LOOPBACK_SRC);
+        if (it != m_intfCache.end())
+        {
+            IpPrefix ipPrefix = it->second;
+            m_netlinkBatch.addAddress(TUNIF, ipPrefix);
+            m_netlinkBatch.onResult([ipPrefix](int error, const std::string &description) {
+                if (error)
+                {
+                    SWSS_LOG_WARN("Failed to assign IP addr for tun if %s, res %s : %s",
+                                   ipPrefix.to_string().c_str(), description.c_str(), strerror(error));
+                }
+            });
+        }
+
+        return true;
+    }
+
     ret = cmdIpTunnelIfCreate(tunInfo, res);
     if (ret != 0)
     {
@@ -3,6 +3,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkbatch.h"
 
 #include <set>
 
@@ -42,6 +43,9 @@ private:
 
     std::set<std::string> m_tunnelReplay;
     bool replayDone = false;
+
+    /* Kernel configuration of a doTask() pass, committed at its end */
+    NetlinkBatch m_netlinkBatch;
 };
 
 }
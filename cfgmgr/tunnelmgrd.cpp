@@ -11,6 +11,7 @@
 #include "exec.h"
 #include "schema.h"
 #include "tunnelmgr.h"
+#include "netlinkbatch.h"
 #include "warm_restart.h"
 
 using namespace std;
@@ -38,6 +39,8 @@ int main(int argc, char **argv)
         WarmStart::initialize("tunnelmgrd", "swss");
         WarmStart::checkWarmStart("tunnelmgrd", "swss");
 
+        NetlinkBatch::enable();
+
         TunnelMgr tunnelmgr(&cfgDb, &appDb, cfgTunTables);
 
         std::vector<Orch *> cfgOrchList = {&tunnelmgr};
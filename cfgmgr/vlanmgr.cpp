@@ -6,6 +6,7 @@
 #include "exec.h"
 #include "tokenize.h"
 #include "shellcmd.h"
+#include "netlinkbatch.h"
 #include "warm_restart.h"
 #include <swss/redisutility.h>
 
@@ -21,6 +22,15 @@ using namespace swss;
 
 extern MacAddress gMacAddress;
 
+/* Netlink failures are fatal like the EXEC_WITH_ERROR_THROW shell commands */
+static void throwOnNetlinkError(int error, const string &description)
+{
+    if (error)
+    {
+        throw runtime_error(description + " : " + strerror(error));
+    }
+}
+
 VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
         Orch(cfgDb, tableNames),
         m_cfgVlanTable(cfgDb, CFG_VLAN_TABLE_NAME),
@@ -119,25 +129,39 @@ bool VlanMgr::addHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
-    //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
-      + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
-               + " up"
-               + " name " + VLAN_PREFIX + std::to_string(vlan_id)
-               + " address " + gMacAddress.to_string()
-               + " type vlan id " + std::to_string(vlan_id) + "\"";
-
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
 
-    res.clear();
-    const std::string echo_cmd = std::string("")
-      + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + VLAN_PREFIX + std::to_string(vlan_id) + "/arp_evict_nocarrier";
-    swss::exec(echo_cmd, res);
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.addBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), false, true);
+        m_netlinkBatch.addVlanLink(DOT1Q_BRIDGE_NAME, VLAN_PREFIX + std::to_string(vlan_id), static_cast<uint16_t>(vlan_id), gMacAddress, true);
+    }
+    else
+    {
+        // The command should be generated as:
+        // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
+        //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
+        const std::string cmds = std::string("")
+          + BASH_CMD + " -c \""
+          + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
+          + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
+                   + " up"
+                   + " name " + VLAN_PREFIX + std::to_string(vlan_id)
+                   + " address " + gMacAddress.to_string()
+                   + " type vlan id " + std::to_string(vlan_id) + "\"";
+
+        EXEC_WITH_ERROR_THROW(cmds, res);
+    }
+
+    /* The sysctl entry exists once the VLAN interface is created */
+    m_netlinkBatch.onResult([vlan_id](int error, const string &description) {
+        throwOnNetlinkError(error, description);
+
+        std::string res;
+        const std::string echo_cmd = std::string("")
+          + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + VLAN_PREFIX + std::to_string(vlan_id) + "/arp_evict_nocarrier";
+        swss::exec(echo_cmd, res);
+    });
 
     return true;
 }
@@ -146,6 +170,14 @@ bool VlanMgr::removeHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delLink(VLAN_PREFIX + std::to_string(vlan_id));
+        m_netlinkBatch.delBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), true);
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        return true;
+    }
+
     // The command should be generated as:
     // /bin/bash -c "/sbin/ip link del Vlan{{vlan_id}} &&
     //               /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self"
@@ -164,6 +196,16 @@ bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
+    if (NetlinkBatch::isEnabled() && (admin_status == "up" || admin_status == "down"))
+    {
+        m_netlinkBatch.setLinkAdminState(VLAN_PREFIX + std::to_string(vlan_id), admin_status == "up");
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        return true;
+    }
+
+    /* The VLAN interface may still be queued */
+    m_netlinkBatch.commit();
+
     // The command should be generated as:
     // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
     ostringstream cmds;
@@ -179,6 +221,15 @@ bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
 {
     SWSS_LOG_ENTER();
 
+    if (NetlinkBatch::isEnabled())
+    {
+        NetlinkBatch batch;
+        batch.setLinkMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu);
+
+        /* VLAN mtu should not be larger than member mtu */
+        return batch.commit();
+    }
+
     // The command should be generated as:
     // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
     const std::string cmds = std::string("")
@@ -199,6 +250,14 @@ bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
 {
     SWSS_LOG_ENTER();
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkMac(VLAN_PREFIX + std::to_string(vlan_id), MacAddress(mac));
+        m_netlinkBatch.setLinkMac(DOT1Q_BRIDGE_NAME, MacAddress(mac));
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        return true;
+    }
+
     // The command should be generated as:
     // /sbin/ip link set Vlan{{vlan_id}} address {{mac}}
     ostringstream cmds;
@@ -215,8 +274,19 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
 {
     SWSS_LOG_ENTER();
 
+    bool untagged = (tagging_mode == "untagged" || tagging_mode == "priority_tagged");
+
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+        m_netlinkBatch.delBridgeVlan(port_alias, static_cast<uint16_t>(std::stoi(DEFAULT_VLAN_ID)));
+        m_netlinkBatch.addBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), untagged);
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+        return true;
+    }
+
     std::string tagging_cmd;
-    if (tagging_mode == "untagged" || tagging_mode == "priority_tagged")
+    if (untagged)
     {
         tagging_cmd = "pvid untagged";
     }
@@ -241,6 +311,29 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
 {
     SWSS_LOG_ENTER();
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id));
+        m_netlinkBatch.onResult([this, port_alias](int error, const string &description) {
+            std::vector<uint16_t> vlans;
+
+            throwOnNetlinkError(error, description);
+
+            if (!NetlinkBatch::getBridgeVlans(port_alias, vlans))
+            {
+                throw runtime_error("Failed to get VLANs of " + port_alias);
+            }
+
+            // When port is not member of any VLAN, it shall be detached from Dot1Q bridge!
+            if (vlans.empty())
+            {
+                m_netlinkBatch.setLinkNoMaster(port_alias);
+                m_netlinkBatch.onResult(throwOnNetlinkError);
+            }
+        });
+        return true;
+    }
+
     // The command should be generated as:
     // /bin/bash -c '/sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
     //               ( vlanShow=$(/sbin/bridge vlan show dev {{port_alias}});
@@ -399,13 +492,17 @@ void VlanMgr::doVlanTask(Consumer &consumer)
             FieldValueTuple hostif_name_fvt("host_ifname", hostif_name);
             fvVector.push_back(hostif_name_fvt);
 
-            m_appVlanTableProducer.set(key, fvVector);
             m_vlans.insert(key);
 
-            fvVector.clear();
-            FieldValueTuple s("state", "ok");
-            fvVector.push_back(s);
-            m_stateVlanTable.set(key, fvVector);
+            /* Host VLAN failures throw from their own handlers, the VLAN is ready when this runs */
+            m_netlinkBatch.onResult([this, key, fvVector](int, const string &) {
+                m_appVlanTableProducer.set(key, fvVector);
+
+                vector<FieldValueTuple> stateFvVector;
+                FieldValueTuple s("state", "ok");
+                stateFvVector.push_back(s);
+                m_stateVlanTable.set(key, stateFvVector);
+            });
 
             it = consumer.m_toSync.erase(it);
 
@@ -424,8 +521,10 @@ void VlanMgr::doVlanTask(Consumer &consumer)
             {
                 removeHostVlan(vlan_id);
                 m_vlans.erase(key);
-                m_appVlanTableProducer.del(key);
-                m_stateVlanTable.del(key);
+                m_netlinkBatch.onResult([this, key](int, const string &) {
+                    m_appVlanTableProducer.del(key);
+                    m_stateVlanTable.del(key);
+                });
             }
             else
             {
@@ -551,6 +650,9 @@ void VlanMgr::processUntaggedVlanMembers(string vlan, const string &members)
         }
     }
 
+    /* The members wait for the VLAN state, which is set once the VLAN is created */
+    m_netlinkBatch.commit();
+
     doTask(consumer);
     return;
 }
@@ -634,12 +736,14 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
                 key = VLAN_PREFIX + to_string(vlan_id);
                 key += DEFAULT_KEY_SEPARATOR;
                 key += port_alias;
-                m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
+                m_netlinkBatch.onResult([this, key, t](int, const string &) {
+                    m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
 
-                vector<FieldValueTuple> fvVector;
-                FieldValueTuple s("state", "ok");
-                fvVector.push_back(s);
-                m_stateVlanMemberTable.set(kfvKey(t), fvVector);
+                    vector<FieldValueTuple> fvVector;
+                    FieldValueTuple s("state", "ok");
+                    fvVector.push_back(s);
+                    m_stateVlanMemberTable.set(kfvKey(t), fvVector);
+                });
 
                 m_vlanMemberReplay.erase(kfvKey(t));
             }
@@ -652,8 +756,11 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
                 key = VLAN_PREFIX + to_string(vlan_id);
                 key += DEFAULT_KEY_SEPARATOR;
                 key += port_alias;
-                m_appVlanMemberTableProducer.del(key);
-                m_stateVlanMemberTable.del(kfvKey(t));
+                string memberKey = kfvKey(t);
+                m_netlinkBatch.onResult([this, key, memberKey](int, const string &) {
+                    m_appVlanMemberTableProducer.del(key);
+                    m_stateVlanMemberTable.del(memberKey);
+                });
             }
             else
             {
@@ -699,4 +806,6 @@ void VlanMgr::doTask(Consumer &consumer)
         SWSS_LOG_ERROR("Unknown config table %s ", table_name.c_str());
         throw runtime_error("VlanMgr doTask failure.");
     }
+
+    m_netlinkBatch.commit();
 }
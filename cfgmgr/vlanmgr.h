@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkbatch.h"
 
 #include <set>
 #include <map>
@@ -26,7 +27,9 @@ private:
     std::set<std::string> m_vlanReplay;
     std::set<std::string> m_vlanMemberReplay;
     bool replayDone;
-    
+    /* Kernel configuration of a doTask() pass, committed at its end */
+    NetlinkBatch m_netlinkBatch;
+
     void doTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
@@ -13,6 +13,7 @@
 #include "producerstatetable.h"
 #include "vlanmgr.h"
 #include "shellcmd.h"
+#include "netlinkbatch.h"
 #include "warm_restart.h"
 
 using namespace std;
@@ -58,6 +59,8 @@ int main(int argc, char **argv)
         }
         gMacAddress = MacAddress(it->second);
 
+        NetlinkBatch::enable();
+
         VlanMgr vlanmgr(&cfgDb, &appDb, &stateDb, cfg_vlan_tables);
 
         std::vector<Orch *> cfgOrchList = {&vlanmgr};
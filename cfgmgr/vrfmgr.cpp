@@ -7,6 +7,7 @@
 #include "vrfmgr.h"
 #include "exec.h"
 #include "shellcmd.h"
+#include "netlinkbatch.h"
 #include "warm_restart.h"
 
 #define VRF_TABLE_START 1001
@@ -17,6 +18,15 @@
 
 using namespace swss;
 
+/* Netlink failures are fatal like the EXEC_WITH_ERROR_THROW shell commands */
+static void throwOnNetlinkError(int error, const string &description)
+{
+    if (error)
+    {
+        throw runtime_error(description + " : " + strerror(error));
+    }
+}
+
 VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
         Orch(cfgDb, tableNames),
         m_appVrfTableProducer(appDb, APP_VRF_TABLE_NAME),
@@ -152,8 +162,16 @@ bool VrfMgr::delLink(const string& vrfName)
         return true;
     }
 
-    cmd << IP_CMD << " link del " << shellquote(vrfName);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delLink(vrfName);
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+    }
+    else
+    {
+        cmd << IP_CMD << " link del " << shellquote(vrfName);
+        EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    }
 
     recycleTable(m_vrfTableMap[vrfName]);
     m_vrfTableMap.erase(vrfName);
@@ -188,6 +206,16 @@ bool VrfMgr::setLink(const string& vrfName)
         return false;
     }
 
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.addVrfLink(vrfName, table);
+        m_netlinkBatch.setLinkAdminState(vrfName, true);
+        m_netlinkBatch.onResult(throwOnNetlinkError);
+
+        m_vrfTableMap.emplace(vrfName, table);
+        return true;
+    }
+
     cmd << IP_CMD << " link add " << shellquote(vrfName) << " type vrf table " << table;
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 
@@ -283,30 +311,33 @@ void VrfMgr::doTask(Consumer &consumer)
                     SWSS_LOG_ERROR("Failed to create vrf netdev %s", vrfName.c_str());
                 }
 
-                bool status = true;
-                vector<FieldValueTuple> fvVector;
-                fvVector.emplace_back("state", "ok");
-                m_stateVrfTable.set(vrfName, fvVector);
-
-                SWSS_LOG_NOTICE("Created vrf netdev %s", vrfName.c_str());
-                if ((consumer.getTableName() == CFG_VRF_TABLE_NAME) ||
-                    (consumer.getTableName() == CFG_MGMT_VRF_CONFIG_TABLE_NAME))
-                {
-                    status  = doVrfVxlanTableCreateTask (t);
-                    if (status == false)
+                /* The VRF is announced ready once its netdev is created, netdev failures throw before */
+                string tableName = consumer.getTableName();
+                m_netlinkBatch.onResult([this, t, vrfName, tableName](int, const string &) {
+                    bool status = true;
+                    vector<FieldValueTuple> fvVector;
+                    fvVector.emplace_back("state", "ok");
+                    m_stateVrfTable.set(vrfName, fvVector);
+
+                    SWSS_LOG_NOTICE("Created vrf netdev %s", vrfName.c_str());
+                    if ((tableName == CFG_VRF_TABLE_NAME) ||
+                        (tableName == CFG_MGMT_VRF_CONFIG_TABLE_NAME))
                     {
-                        SWSS_LOG_ERROR("VRF VNI Map Config Failed");
-                        it = consumer.m_toSync.erase(it);
-                        continue;
-                    }
+                        status  = doVrfVxlanTableCreateTask (t);
+                        if (status == false)
+                        {
+                            SWSS_LOG_ERROR("VRF VNI Map Config Failed");
+                            return;
+                        }
 
-                    m_appVrfTableProducer.set(vrfName, kfvFieldsValues(t));
+                        m_appVrfTableProducer.set(vrfName, kfvFieldsValues(t));
 
-                }
-                else
-                {
-                    m_appVnetTableProducer.set(vrfName, kfvFieldsValues(t));
-                }
+                    }
+                    else
+                    {
+                        m_appVnetTableProducer.set(vrfName, kfvFieldsValues(t));
+                    }
+                });
             }
         }
         else if (op == DEL_COMMAND)
@@ -368,6 +399,8 @@ void VrfMgr::doTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    m_netlinkBatch.commit();
 }
 
 bool VrfMgr::doVrfEvpnNvoAddTask(const KeyOpFieldsValuesTuple & t)
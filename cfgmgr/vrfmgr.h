@@ -7,6 +7,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkbatch.h"
 
 using namespace std;
 
@@ -43,6 +44,8 @@ private:
     VRFNameVNIMapTable m_vrfVniMapTable;
 
     Table m_stateVrfTable, m_stateVrfObjectTable;
+    /* Kernel configuration of a doTask() pass, committed at its end */
+    NetlinkBatch m_netlinkBatch;
     ProducerStateTable m_appVrfTableProducer, m_appVnetTableProducer, m_appVxlanVrfTableProducer;
 };
 
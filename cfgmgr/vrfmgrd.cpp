@@ -6,6 +6,7 @@
 #include "exec.h"
 #include "schema.h"
 #include "vrfmgr.h"
+#include "netlinkbatch.h"
 #include <fstream>
 #include <iostream>
 #include "warm_restart.h"
@@ -40,6 +41,8 @@ int main(int argc, char **argv)
         WarmStart::initialize("vrfmgrd", "swss");
         WarmStart::checkWarmStart("vrfmgrd", "swss");
 
+        NetlinkBatch::enable();
+
         VrfMgr vrfmgr(&cfgDb, &appDb, &stateDb, cfg_vrf_tables);
 
         isWarmStart = WarmStart::isWarmStart();
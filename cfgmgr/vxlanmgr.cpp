@@ -3,6 +3,8 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <cstring>
+#include <memory>
 #include <net/if.h>
 
 #include "logger.h"
@@ -33,6 +35,8 @@ extern MacAddress gMacAddress;
 #define VXLAN_NAME_PREFIX "Vxlan"
 #define VXLAN_IF_NAME_PREFIX "Brvxlan"
 
+#define VXLAN_DST_PORT 4789
+
 #define VLAN "vlan"
 #define DST_IP "dst_ip"
 #define SOURCE_VTEP "source_vtep"
@@ -273,6 +277,8 @@ void VxlanMgr::doTask(Consumer &consumer)
             ++it;
         }
     }
+
+    m_netlinkBatch.commit();
 }
 
 bool VxlanMgr::doVxlanCreateTask(const KeyOpFieldsValuesTuple & t)
@@ -801,6 +807,69 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     std::string res;
     int ret = 0;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        /* Each step rolls back the devices created before it when it fails, like the shell commands below */
+        auto failed = std::make_shared<bool>(false);
+        auto onStepResult = [this, failed](const std::string &step, const std::vector<std::string> &rollback) {
+            m_netlinkBatch.onResult([this, failed, step, rollback](int error, const std::string &description) {
+                if (*failed || !error)
+                {
+                    return;
+                }
+
+                *failed = true;
+                for (const auto &name : rollback)
+                {
+                    m_netlinkBatch.delLink(name);
+                }
+                SWSS_LOG_WARN("%s, %s : %s", step.c_str(), description.c_str(), strerror(error));
+            });
+        };
+
+        IpAddress sourceIp(info.m_sourceIp.empty() ? "0.0.0.0" : info.m_sourceIp);
+
+        m_netlinkBatch.addVxlanLink(info.m_vxlan, static_cast<uint32_t>(stoul(info.m_vni)), sourceIp,
+                                    IpAddress("0.0.0.0"), VXLAN_DST_PORT);
+        onStepResult("Failed to create vxlan " + info.m_vxlan + " (vni: " + info.m_vni + ", source ip " + info.m_sourceIp + ")", {});
+
+        m_netlinkBatch.setLinkAdminState(info.m_vxlan, true);
+        onStepResult("Fail to up vxlan " + info.m_vxlan, {info.m_vxlan});
+
+        m_netlinkBatch.addBridgeLink(info.m_vxlanIf);
+        onStepResult("Fail to create vxlan interface " + info.m_vxlanIf, {info.m_vxlan});
+
+        m_netlinkBatch.setLinkMaster(info.m_vxlan, info.m_vxlanIf);
+        if (!info.m_macAddress.empty())
+        {
+            // Change the MAC address of Vxlan bridge interface to ensure it's same with switch's.
+            // Otherwise it will not response traceroute packets.
+            m_netlinkBatch.setLinkMac(info.m_vxlanIf, MacAddress(info.m_macAddress));
+        }
+        onStepResult("Fail to add " + info.m_vxlan + " into " + info.m_vxlanIf, {info.m_vxlanIf, info.m_vxlan});
+
+        m_netlinkBatch.setLinkMaster(info.m_vxlanIf, info.m_vnet);
+        onStepResult("Fail to set " + info.m_vxlanIf + " master " + info.m_vnet, {info.m_vxlanIf, info.m_vxlan});
+
+        m_netlinkBatch.setLinkAdminState(info.m_vxlanIf, true);
+        onStepResult("Fail to up bridge " + info.m_vxlanIf, {info.m_vxlanIf, info.m_vxlan});
+
+        m_netlinkBatch.onResult([this, failed, info](int, const std::string &) {
+            if (*failed)
+            {
+                SWSS_LOG_ERROR("Cannot create vxlan %s", info.m_vxlan.c_str());
+                m_vnetCache.erase(info.m_vnet);
+                return;
+            }
+
+            std::vector<FieldValueTuple> fvVector;
+            fvVector.emplace_back("state", "ok");
+            m_stateVxlanTable.set(info.m_vxlan, fvVector);
+        });
+
+        return true;
+    }
+
     // Create Vxlan
     ret = cmdCreateVxlan(info, res);
     if (ret != RET_SUCCESS)
@@ -890,10 +959,20 @@ bool VxlanMgr::deleteVxlan(const VxlanInfo & info)
 
     std::string res;
 
-    cmdDetachVxlanIfFromVnet(info, res);
-    cmdDeleteVxlanFromVxlanIf(info, res);
-    cmdDeleteVxlanIf(info, res);
-    cmdDeleteVxlan(info, res);
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkNoMaster(info.m_vxlanIf);
+        m_netlinkBatch.setLinkNoMaster(info.m_vxlan);
+        m_netlinkBatch.delLink(info.m_vxlanIf);
+        m_netlinkBatch.delLink(info.m_vxlan);
+    }
+    else
+    {
+        cmdDetachVxlanIfFromVnet(info, res);
+        cmdDeleteVxlanFromVxlanIf(info, res);
+        cmdDeleteVxlanIf(info, res);
+        cmdDeleteVxlan(info, res);
+    }
 
     m_stateVxlanTable.del(info.m_vxlan);
 
@@ -988,6 +1067,31 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
     // bridge vlan add vid <vlan_id> untagged pvid dev <vxlan_dev_name>
     // ip link set <vxlan_dev_name> up
 
+    if (NetlinkBatch::isEnabled())
+    {
+        uint16_t vlanId = static_cast<uint16_t>(stoul(vlan_id));
+
+        m_netlinkBatch.addVxlanLink(vxlan_dev_name, static_cast<uint32_t>(stoul(vni_id)), IpAddress(src_ip),
+                                    IpAddress(dst_ip.empty() ? "0.0.0.0" : dst_ip), VXLAN_DST_PORT, false, gMacAddress);
+        m_netlinkBatch.setLinkMaster(vxlan_dev_name, "Bridge");
+        m_netlinkBatch.addBridgeVlan(vxlan_dev_name, vlanId, false);
+        m_netlinkBatch.addBridgeVlan(vxlan_dev_name, vlanId, true);
+        if (vlan_id != "1")
+        {
+            m_netlinkBatch.delBridgeVlan(vxlan_dev_name, 1);
+        }
+        m_netlinkBatch.setLinkAdminState(vxlan_dev_name, true);
+        m_netlinkBatch.onResult([vxlan_dev_name](int error, const std::string &description) {
+            if (error)
+            {
+                SWSS_LOG_WARN("Vxlan Net Dev %s creation failure, %s : %s",
+                              vxlan_dev_name.c_str(), description.c_str(), strerror(error));
+            }
+        });
+
+        return RET_SUCCESS;
+    }
+
     link_add_cmd = std::string("") + IP_CMD + " link add " + vxlan_dev_name + 
                    " address " + gMacAddress.to_string() + " type vxlan id " + 
                    std::string(vni_id) + " local " + src_ip + 
@@ -1029,6 +1133,13 @@ int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
 {
     int ret = 0;
     std::string res;
+
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.setLinkAdminState(vxlan_dev_name, false);
+        return ret;
+    }
+
     const std::string cmd = std::string("") + IP_CMD + " link set dev " + vxlan_dev_name + " down";
     exec(cmd, res);
     return ret;
@@ -1037,6 +1148,13 @@ int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
 int VxlanMgr::deleteVxlanNetdevice(std::string vxlan_dev_name)
 {    
     std::string res;
+
+    if (NetlinkBatch::isEnabled())
+    {
+        m_netlinkBatch.delLink(vxlan_dev_name);
+        return RET_SUCCESS;
+    }
+
     const std::string cmd = std::string("") + IP_CMD  + " link del dev " + vxlan_dev_name;
     return swss::exec(cmd, res);
 }
@@ -1193,21 +1311,19 @@ void VxlanMgr::clearAllVxlanDevices()
         std::string netdev_name = it->first;
         std::string netdev_type = it->second;
         SWSS_LOG_INFO("Deleting Stale NetDevice %s, type: %s\n", netdev_name.c_str(), netdev_type.c_str());
-        VxlanInfo info;
-        std::string res;
         if (netdev_type.compare(VXLAN))
         {
-            info.m_vxlan = netdev_name;
             downVxlanNetdevice(netdev_name);
-            cmdDeleteVxlan(info, res);
+            deleteVxlanNetdevice(netdev_name);
         }
         else if(netdev_type.compare(VXLAN_IF))
         {
-            info.m_vxlanIf = netdev_name;
-            cmdDeleteVxlanIf(info, res);
+            deleteVxlanNetdevice(netdev_name);
         }
         it = m_vxlanNetDevices.erase(it);
     }
+
+    m_netlinkBatch.commit();
 }
 
 void VxlanMgr::waitTillReadyToReconcile()
@@ -12,6 +12,7 @@
 #include "macaddress.h"
 #include "producerstatetable.h"
 #include "vxlanmgr.h"
+#include "netlinkbatch.h"
 #include "shellcmd.h"
 #include "warm_restart.h"
 
@@ -50,6 +51,8 @@ int main(int argc, char **argv)
             CFG_VXLAN_EVPN_NVO_TABLE_NAME,
         };
 
+        NetlinkBatch::enable();
+
         VxlanMgr vxlanmgr(&cfgDb, &appDb, &stateDb, cfg_vnet_tables);
 
         std::vector<Orch *> cfgOrchList = {&vxlanmgr};
@@ -4,6 +4,7 @@
 #include <netlink/route/neighbour.h>
 #include <netlink/route/link/vxlan.h>
 #include <arpa/inet.h>
+#include <linux/neighbour.h>
 
 #include "logger.h"
 #include "dbconnector.h"
@@ -21,6 +22,13 @@ using namespace swss;
 
 #define VXLAN_BR_IF_NAME_PREFIX    "Brvxlan"
 
+#ifndef NTF_EXT_LEARNED
+#define NTF_EXT_LEARNED 0x10
+#endif
+#ifndef NTF_STICKY
+#define NTF_STICKY      0x40
+#endif
+
 FdbSync::FdbSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *config_db) :
     m_fdbTable(pipelineAppDB, APP_VXLAN_FDB_TABLE_NAME),
     m_imetTable(pipelineAppDB, APP_VXLAN_REMOTE_VNI_TABLE_NAME),
@@ -97,6 +105,7 @@ void FdbSync::processCfgEvpnNvo()
             updateAllLocalMac();
         }
     }
+    flushKernelFdb();
     return;
 }
 
@@ -178,6 +187,7 @@ void FdbSync::processStateFdb()
         }
         updateLocalMac(&info);
     }
+    flushKernelFdb();
 }
 
 void FdbSync::processStateMclagRemoteFdb()
@@ -241,6 +251,7 @@ void FdbSync::processStateMclagRemoteFdb()
         }
         updateMclagRemoteMac(&info);
     }
+    flushKernelFdb();
 }
 
 void FdbSync::macUpdateCache(struct m_fdb_info *info)
@@ -277,6 +288,20 @@ void FdbSync::macDelVxlanEntry(string auxkey, struct m_fdb_info *info)
 {
     std::string vtep = m_mac[auxkey].vtep;
 
+    if (NetlinkBatch::isEnabled())
+    {
+        try
+        {
+            m_kernelFdbBatch.delVxlanFdb(m_mac[auxkey].ifname, MacAddress(info->mac),
+                                         static_cast<uint16_t>(stoi(info->vid.substr(4))), IpAddress(vtep));
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to delete VXLAN FDB %s dst %s: %s", auxkey.c_str(), vtep.c_str(), e.what());
+        }
+        return;
+    }
+
     const std::string cmds = std::string("")
         + " bridge fdb del " + info->mac + " dev " 
         + m_mac[auxkey].ifname + " dst " + vtep + " vlan " + info->vid.substr(4);
@@ -293,6 +318,91 @@ void FdbSync::macDelVxlanEntry(string auxkey, struct m_fdb_info *info)
     return;
 }
 
+/*
+ * Program a bridge FDB entry in kernel, like
+ * "bridge fdb <op> <mac> dev <port> master <type> vlan <vlan>".
+ * With netlink, the request is queued and sent by flushKernelFdb(),
+ * otherwise the bridge command is executed right away.
+ */
+int FdbSync::kernelFdbUpdate(const string &op, const string &mac, const string &port,
+                             const string &type, const string &vlan, const char *context)
+{
+    if (NetlinkBatch::isEnabled())
+    {
+        try
+        {
+            MacAddress macAddress(mac);
+            uint16_t vlanId = static_cast<uint16_t>(stoi(vlan));
+
+            if (op == "del")
+            {
+                m_kernelFdbBatch.delFdb(port, macAddress, vlanId, NTF_MASTER);
+            }
+            else
+            {
+                uint16_t state = (type.find("dynamic") != string::npos) ? NUD_REACHABLE : NUD_NOARP;
+                uint8_t flags = NTF_MASTER;
+
+                if (type.find("extern_learn") != string::npos)
+                {
+                    flags |= NTF_EXT_LEARNED;
+                }
+                if (type.find("sticky") != string::npos)
+                {
+                    flags |= NTF_STICKY;
+                }
+                m_kernelFdbBatch.replaceFdb(port, macAddress, vlanId, state, flags);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("%s: invalid FDB %s vlan %s dev %s: %s", context, mac.c_str(), vlan.c_str(), port.c_str(), e.what());
+            return -1;
+        }
+
+        SWSS_LOG_INFO("%s: queued fdb %s %s dev %s master %s vlan %s", context, op.c_str(), mac.c_str(),
+                      port.c_str(), type.c_str(), vlan.c_str());
+        return 0;
+    }
+
+    const std::string cmds = std::string("")
+        + " bridge fdb " + op + " " + mac + " dev "
+        + port + " master " + type + " vlan " + vlan;
+
+    std::string res;
+    int ret = swss::exec(cmds, res);
+    if (ret != 0)
+    {
+        SWSS_LOG_INFO("%s: failed cmd:%s, res=%s, ret=%d", context, cmds.c_str(), res.c_str(), ret);
+    }
+    else
+    {
+        SWSS_LOG_INFO("%s: cmd:%s, res=%s, ret=%d", context, cmds.c_str(), res.c_str(), ret);
+    }
+
+    return ret;
+}
+
+void FdbSync::flushKernelFdb()
+{
+    if (m_kernelFdbBatch.size() == 0)
+    {
+        return;
+    }
+
+    size_t count = m_kernelFdbBatch.size();
+    if (!m_kernelFdbBatch.commit())
+    {
+        size_t failed = 0;
+        for (auto result : m_kernelFdbBatch.results())
+        {
+            failed += (result != 0);
+        }
+        SWSS_LOG_INFO("%zu of %zu kernel FDB updates failed, first error: %s", failed, count,
+                      m_kernelFdbBatch.getLastError().c_str());
+    }
+}
+
 void FdbSync::updateLocalMac (struct m_fdb_info *info)
 {
     char *op;
@@ -331,14 +441,7 @@ void FdbSync::updateLocalMac (struct m_fdb_info *info)
         type = "sticky static";
     }
 
-    const std::string cmds = std::string("")
-        + " bridge fdb " + op + " " + info->mac + " dev " 
-        + port_name + " master " + type + " vlan " + info->vid.substr(4);
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-
-    SWSS_LOG_INFO("cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+    kernelFdbUpdate(op, info->mac, port_name, type, info->vid.substr(4), "Local MAC");
 
     if (info->op_type == FDB_OPER_ADD)
     {
@@ -391,18 +494,7 @@ void FdbSync::addLocalMac(string key, string op)
             type = "static";
         }
 
-        const std::string cmds = std::string("")
-                + " bridge fdb " + op + " " + mac + " dev "
-                + port_name + " master " + type  + " vlan " + vlan;
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret != 0)
-        {
-            SWSS_LOG_INFO("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-        }
-
-        SWSS_LOG_INFO("Config triggered cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+        kernelFdbUpdate(op, mac, port_name, type, vlan, "Config triggered");
     }
     return;
 }
@@ -439,14 +531,7 @@ void FdbSync::updateMclagRemoteMac (struct m_fdb_info *info)
         type = "static";
     }
 
-    const std::string cmds = std::string("")
-        + " bridge fdb " + op + " " + info->mac + " dev "
-        + port_name + " master " + type + " vlan " + info->vid.substr(4);
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-
-    SWSS_LOG_INFO("cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+    kernelFdbUpdate(op, info->mac, port_name, type, info->vid.substr(4), "MCLAG remote MAC");
 
     return;
 }
@@ -467,19 +552,7 @@ void FdbSync::updateMclagRemoteMacPort(int ifindex, int vlan, std::string mac)
 
         if (type == FDB_TYPE_STATIC)
         {
-            const std::string cmds = std::string("")
-                + " bridge fdb replace" + " " + mac + " dev "
-                + port_name + " master static vlan " + to_string(vlan);
-
-            std::string res;
-            int ret = swss::exec(cmds, res);
-            if (ret != 0)
-            {
-                SWSS_LOG_NOTICE("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-                return;
-            }
-
-            SWSS_LOG_NOTICE("Update cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+            kernelFdbUpdate("replace", mac, port_name, "static", to_string(vlan), "MCLAG remote port update");
         }
     }
     return;
@@ -518,18 +591,7 @@ void FdbSync::macRefreshStateDB(int vlan, string kmac)
             type = "static";
         }
 
-        const std::string cmds = std::string("")
-            + " bridge fdb " + "replace" + " " + kmac + " dev "
-            + port_name + " master " + type  + " vlan " + to_string(vlan);
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret != 0)
-        {
-            SWSS_LOG_INFO("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-        }
-
-        SWSS_LOG_INFO("Refreshing cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+        kernelFdbUpdate("replace", kmac, port_name, type, to_string(vlan), "Refreshing");
     }
     return;
 }
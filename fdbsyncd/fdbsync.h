@@ -7,6 +7,7 @@
 #include "producerstatetable.h"
 #include "subscriberstatetable.h"
 #include "netmsg.h"
+#include "netlinkbatch.h"
 #include "warmRestartAssist.h"
 
 /*
@@ -80,6 +81,9 @@ public:
 
     void processCfgEvpnNvo();
 
+    /* Send the queued kernel FDB updates */
+    void flushKernelFdb();
+
     bool m_reconcileDone = false;
 
     bool m_isEvpnNvoExist = false;
@@ -91,6 +95,7 @@ private:
     SubscriberStateTable m_mclagRemoteFdbStateTable;
     AppRestartAssist  *m_AppRestartAssist;
     SubscriberStateTable m_cfgEvpnNvoTable;
+    NetlinkBatch m_kernelFdbBatch;
 
     struct m_local_fdb_info
     {
@@ -103,6 +108,9 @@ private:
 
     void macDelVxlanEntry(std::string auxkey, struct m_fdb_info *info);
 
+    int kernelFdbUpdate(const std::string &op, const std::string &mac, const std::string &port,
+                        const std::string &type, const std::string &vlan, const char *context);
+
     void macUpdateCache(struct m_fdb_info *info);
 
     bool macCheckSrcDB(struct m_fdb_info *info);
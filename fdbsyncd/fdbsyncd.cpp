@@ -6,6 +6,7 @@
 #include "select.h"
 #include "netdispatcher.h"
 #include "netlink.h"
+#include "netlinkbatch.h"
 #include "fdbsyncd/fdbsync.h"
 #include "warm_restart.h"
 
@@ -21,6 +22,9 @@ int main(int argc, char **argv)
     DBConnector stateDb(STATE_DB, DBConnector::DEFAULT_UNIXSOCKET, 0);
     DBConnector config_db(CONFIG_DB, DBConnector::DEFAULT_UNIXSOCKET, 0);
 
+    /* Program kernel FDB entries over netlink, falls back to bridge commands */
+    NetlinkBatch::enable();
+
     FdbSync sync(&pipelineAppDB, &stateDb, &config_db);
 
     NetDispatcher::getInstance().registerMessageHandler(RTM_NEWNEIGH, &sync);
@@ -91,6 +95,9 @@ int main(int argc, char **argv)
             {
                 s.select(&temps);
 
+                /* Kernel FDB updates triggered by netlink messages */
+                sync.flushKernelFdb();
+
                 if (temps == (Selectable *)sync.getFdbStateTable())
                 {
                     sync.processStateFdb();
@@ -22,6 +22,15 @@ public:
      * @return True on success, otherwise false is returned
      */
     virtual bool send(nlmsghdr* nl_hdr) = 0;
+
+    /**
+     * @brief Send the messages still held by the interface, if it coalesces them
+     * @return True on success, otherwise false is returned
+     */
+    virtual bool flush()
+    {
+        return true;
+    }
 };
 
 }
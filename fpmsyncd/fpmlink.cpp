@@ -115,6 +115,7 @@ FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
     m_bufSize(FPM_MAX_MSG_LEN * MSG_BATCH_SIZE),
     m_messageBuffer(NULL),
     m_pos(0),
+    m_sendPos(0),
     m_connected(false),
     m_server_up(false),
     m_routesync(rsync)
@@ -188,6 +189,10 @@ void FpmLink::accept()
     if (m_connection_socket < 0)
         throw system_error(errno, system_category());
 
+    /* Drop what is left from the previous connection, partial messages and unsent routes */
+    m_pos = 0;
+    m_sendPos = 0;
+
     SWSS_LOG_INFO("New connection accepted from: %s\n", inet_ntoa(client_addr.sin_addr));
 }
 
@@ -295,24 +300,40 @@ bool FpmLink::send(nlmsghdr* nl_hdr)
         SWSS_LOG_THROW("Message length %zu is greater than the send buffer size %d", len, m_bufSize);
     }
 
+    if (m_sendPos + len > m_bufSize && !flush())
+    {
+        return false;
+    }
+
     hdr.version = FPM_PROTO_VERSION;
     hdr.msg_type = FPM_MSG_TYPE_NETLINK;
     hdr.msg_len = htons(static_cast<uint16_t>(len));
 
-    memcpy(m_sendBuffer, &hdr, sizeof(hdr));
-    memcpy(m_sendBuffer + sizeof(hdr), nl_hdr, nl_hdr->nlmsg_len);
+    char *msg = m_sendBuffer + m_sendPos;
+    memcpy(msg, &hdr, sizeof(hdr));
+    memcpy(msg + sizeof(hdr), nl_hdr, nl_hdr->nlmsg_len);
+    memset(msg + sizeof(hdr) + nl_hdr->nlmsg_len, 0, len - sizeof(hdr) - nl_hdr->nlmsg_len);
+    m_sendPos += static_cast<unsigned int>(len);
 
+    return true;
+}
+
+bool FpmLink::flush()
+{
     size_t sent = 0;
-    while (sent != len)
+    while (sent != m_sendPos)
     {
-        auto rc = ::send(m_connection_socket, m_sendBuffer + sent, len - sent, 0);
+        auto rc = ::send(m_connection_socket, m_sendBuffer + sent, m_sendPos - sent, 0);
         if (rc == -1)
         {
-            SWSS_LOG_ERROR("Failed to send FPM message: %s", strerror(errno));
+            SWSS_LOG_ERROR("Failed to send FPM messages: %s", strerror(errno));
+            m_sendPos = 0;
             return false;
         }
         sent += rc;
     }
 
+    m_sendPos = 0;
+
     return true;
 }
@@ -41,7 +41,12 @@ public:
 
     void processFpmMessage(fpm_msg_hdr_t* hdr);
 
+    /*
+     * Messages are coalesced in the send buffer, which is written to the socket
+     * when it is full or when flush() is called.
+     */
     bool send(nlmsghdr* nl_hdr) override;
+    bool flush() override;
 
 private:
     RouteSync *m_routesync;
@@ -49,6 +54,7 @@ private:
     char *m_messageBuffer;
     char *m_sendBuffer;
     unsigned int m_pos;
+    unsigned int m_sendPos;
 
     bool m_connected;
     bool m_server_up;
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <inttypes.h>
+#include <getopt.h>
 #include "logger.h"
 #include "select.h"
 #include "selectabletimer.h"
@@ -27,6 +28,20 @@ const uint32_t DEFAULT_ROUTING_RESTART_INTERVAL = 120;
 // TODO: support eoiu hold interval config
 const uint32_t DEFAULT_EOIU_HOLD_INTERVAL = 3;
 
+// Interval (in seconds) of the offload reply statistics update in STATE_DB
+const uint32_t OFFLOAD_STATS_INTERVAL = 10;
+
+#define STATE_FPMSYNCD_STATS_TABLE_NAME "FPMSYNCD_STATS"
+
+void usage()
+{
+    cout << "Usage: fpmsyncd [-w coalescing_window] [-n max_pending_routes]" << endl;
+    cout << "       coalescing_window: time (in milliseconds) the latest update of a route is held" << endl;
+    cout << "                          before it is written to ROUTE_TABLE, default 0 (disabled)" << endl;
+    cout << "       max_pending_routes: number of held routes that triggers the write, default "
+         << ROUTE_COALESCE_MAX_PENDING << endl;
+}
+
 // Check if eoiu state reached by both ipv4 and ipv6
 static bool eoiuFlagsSet(Table &bgpStateTable)
 {
@@ -52,6 +67,29 @@ int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
 
+    uint32_t coalesceWindowMs = 0;
+    size_t coalesceMaxPending = ROUTE_COALESCE_MAX_PENDING;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "w:n:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'w':
+            coalesceWindowMs = static_cast<uint32_t>(atoi(optarg));
+            break;
+        case 'n':
+            coalesceMaxPending = static_cast<size_t>(atoi(optarg));
+            break;
+        case 'h':
+            usage();
+            return EXIT_SUCCESS;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
     const auto routeResponseChannelName = std::string("APPL_DB_") + APP_ROUTE_TABLE_NAME + "_RESPONSE_CHANNEL";
 
     DBConnector db("APPL_DB", 0);
@@ -63,9 +101,11 @@ int main(int argc, char **argv)
 
     RedisPipeline pipeline(&db);
     RouteSync sync(&pipeline);
+    sync.setRouteCoalescing(coalesceWindowMs, coalesceMaxPending);
 
     DBConnector stateDb("STATE_DB", 0);
     Table bgpStateTable(&stateDb, STATE_BGP_TABLE_NAME);
+    Table fpmStatsTable(&stateDb, STATE_FPMSYNCD_STATS_TABLE_NAME);
 
     NetLink netlink;
 
@@ -98,6 +138,8 @@ int main(int argc, char **argv)
             SelectableTimer eoiuCheckTimer(timespec{0, 0});
             // After eoiu flags are detected, start a hold timer before starting reconciliation.
             SelectableTimer eoiuHoldTimer(timespec{0, 0});
+            SelectableTimer offloadStatsTimer(timespec{OFFLOAD_STATS_INTERVAL, 0});
+            SelectableTimer coalesceTimer(timespec{coalesceWindowMs / 1000, (coalesceWindowMs % 1000) * 1000000L});
            
             /*
              * Pipeline should be flushed right away to deal with state pending
@@ -112,6 +154,14 @@ int main(int argc, char **argv)
             s.addSelectable(&fpm);
             s.addSelectable(&netlink);
             s.addSelectable(&deviceMetadataTableSubscriber);
+            s.addSelectable(&offloadStatsTimer);
+            offloadStatsTimer.start();
+
+            if (sync.getRouteCoalescingWindow())
+            {
+                s.addSelectable(&coalesceTimer);
+                coalesceTimer.start();
+            }
 
             if (sync.isSuppressionEnabled())
             {
@@ -156,6 +206,9 @@ int main(int argc, char **argv)
             {
                 Selectable *temps;
 
+                /* Offload replies are coalesced, send them before waiting for more work */
+                sync.flushOffloadReplies();
+
                 /* Reading FPM messages forever (and calling "readMe" to read them) */
                 s.select(&temps);
 
@@ -216,6 +269,16 @@ int main(int argc, char **argv)
                         s.removeSelectable(&eoiuCheckTimer);
                     }
                 }
+                else if (temps == &offloadStatsTimer)
+                {
+                    sync.publishStats(fpmStatsTable);
+                }
+                else if (temps == &coalesceTimer)
+                {
+                    sync.flushPendingRoutes();
+                    pipeline.flush();
+                    SWSS_LOG_DEBUG("Coalesced routes flushed");
+                }
                 else if (temps == &deviceMetadataTableSubscriber)
                 {
                     std::deque<KeyOpFieldsValuesTuple> keyOpFvsQueue;
@@ -11,6 +11,7 @@
 #include "fpmsyncd/routesync.h"
 #include "macaddress.h"
 #include "converter.h"
+#include "tablereader.h"
 #include <string.h>
 #include <arpa/inet.h>
 
@@ -480,7 +481,7 @@ void RouteSync::onEvpnRouteMsg(struct nlmsghdr *h, int len)
     {
         if (!warmRestartInProgress)
         {
-            m_routeTable.del(destipprefix);
+            delRoute(destipprefix);
             return;
         }
         else
@@ -561,7 +562,7 @@ void RouteSync::onEvpnRouteMsg(struct nlmsghdr *h, int len)
 
     if (!warmRestartInProgress)
     {
-        m_routeTable.set(destipprefix, fvVector);
+        setRoute(destipprefix, fvVector);
         SWSS_LOG_DEBUG("RouteTable set msg: %s vtep:%s vni:%s mac:%s intf:%s protocol:%s",
                        destipprefix, nexthops.c_str(), vni_list.c_str(), mac_list.c_str(), intf_list.c_str(),
                        proto_str.c_str());
@@ -706,7 +707,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     {
         if (!warmRestartInProgress)
         {
-            m_routeTable.del(destipprefix);
+            delRoute(destipprefix);
             return;
         }
         else
@@ -740,7 +741,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
             vector<FieldValueTuple> fvVector;
             FieldValueTuple fv("blackhole", "true");
             fvVector.push_back(fv);
-            m_routeTable.set(destipprefix, fvVector);
+            setRoute(destipprefix, fvVector);
             return;
         }
         case RTN_UNICAST:
@@ -793,7 +794,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
                     SWSS_LOG_NOTICE("RouteTable del msg for route with only one nh on eth0/docker0: %s %s %s %s",
                             destipprefix, gw_list.c_str(), intf_list.c_str(), mpls_list.c_str());
 
-                    m_routeTable.del(destipprefix);
+                    delRoute(destipprefix);
                 }
                 else
                 {
@@ -835,7 +836,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
 
     if (!warmRestartInProgress)
     {
-        m_routeTable.set(destipprefix, fvVector);
+        setRoute(destipprefix, fvVector);
         SWSS_LOG_DEBUG("RouteTable set msg: %s %s %s %s", destipprefix,
                        gw_list.c_str(), intf_list.c_str(), mpls_list.c_str());
     }
@@ -1348,6 +1349,8 @@ bool RouteSync::sendOffloadReply(struct nlmsghdr* hdr)
         return false;
     }
 
+    m_offloadReplies++;
+
     return true;
 }
 
@@ -1363,6 +1366,57 @@ bool RouteSync::sendOffloadReply(struct rtnl_route* route_obj)
     return sendOffloadReply(nlmsg_hdr(nlMsg.get()));
 }
 
+static void addOffloadReplyAttr(nlmsghdr* hdr, unsigned short type, const void* data, size_t len)
+{
+    rtattr *rta = reinterpret_cast<rtattr*>(reinterpret_cast<char*>(hdr) + NLMSG_ALIGN(hdr->nlmsg_len));
+
+    rta->rta_type = type;
+    rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(len));
+    memcpy(RTA_DATA(rta), data, len);
+
+    hdr->nlmsg_len = NLMSG_ALIGN(hdr->nlmsg_len) + RTA_ALIGN(rta->rta_len);
+}
+
+/*
+ * Same message as rtnl_route_build_add_request() builds for a route with only
+ * a destination, a protocol and a table.
+ */
+bool RouteSync::sendOffloadReply(const IpPrefix& prefix, uint8_t protocol, uint32_t table)
+{
+    SWSS_LOG_ENTER();
+
+    memset(m_offloadReplyBuffer, 0, sizeof(m_offloadReplyBuffer));
+
+    nlmsghdr *hdr = reinterpret_cast<nlmsghdr*>(m_offloadReplyBuffer);
+    hdr->nlmsg_len = NLMSG_LENGTH(sizeof(rtmsg));
+    hdr->nlmsg_type = RTM_NEWROUTE;
+    hdr->nlmsg_flags = NLM_F_CREATE;
+
+    rtmsg *rtm = static_cast<rtmsg*>(NLMSG_DATA(hdr));
+    rtm->rtm_family = prefix.isV4() ? AF_INET : AF_INET6;
+    rtm->rtm_dst_len = static_cast<unsigned char>(prefix.getMaskLength());
+    rtm->rtm_table = static_cast<unsigned char>(table < 256 ? table : RT_TABLE_COMPAT);
+    rtm->rtm_protocol = protocol;
+    rtm->rtm_scope = RT_SCOPE_LINK;
+    rtm->rtm_type = RTN_UNICAST;
+
+    uint32_t priority = 0;
+    ip_addr_t dst = prefix.getIp().getIp();
+
+    addOffloadReplyAttr(hdr, RTA_TABLE, &table, sizeof(table));
+    if (prefix.isV4())
+    {
+        addOffloadReplyAttr(hdr, RTA_DST, &dst.ip_addr.ipv4_addr, sizeof(dst.ip_addr.ipv4_addr));
+    }
+    else
+    {
+        addOffloadReplyAttr(hdr, RTA_DST, dst.ip_addr.ipv6_addr, sizeof(dst.ip_addr.ipv6_addr));
+    }
+    addOffloadReplyAttr(hdr, RTA_PRIORITY, &priority, sizeof(priority));
+
+    return sendOffloadReply(hdr);
+}
+
 void RouteSync::setSuppressionEnabled(bool enabled)
 {
     SWSS_LOG_ENTER();
@@ -1427,23 +1481,16 @@ void RouteSync::onRouteResponse(const std::string& key, const std::vector<FieldV
     {
         SWSS_LOG_INFO("Received failure response for prefix %s(%s)",
             prefix.to_string().c_str(), vrfName.c_str());
+        m_lagSamples.erase(key);
         return;
     }
 
-    auto routeObject = makeUniqueWithDestructor(rtnl_route_alloc(), rtnl_route_put);
-    auto dstAddr = makeNlAddr(prefix);
-
-    rtnl_route_set_dst(routeObject.get(), dstAddr.get());
-
     auto proto = rtnl_route_str2proto(protocol.c_str());
     if (proto < 0)
     {
         proto = swss::to_uint<uint8_t>(protocol);
     }
 
-    rtnl_route_set_protocol(routeObject.get(), static_cast<uint8_t>(proto));
-    rtnl_route_set_family(routeObject.get(), prefix.isV4() ? AF_INET : AF_INET6);
-
     unsigned int vrfIfIndex = 0;
     if (!vrfName.empty())
     {
@@ -1458,15 +1505,28 @@ void RouteSync::onRouteResponse(const std::string& key, const std::vector<FieldV
         vrfIfIndex = rtnl_link_get_ifindex(link);
     }
 
-    rtnl_route_set_table(routeObject.get(), vrfIfIndex);
-
-    if (!sendOffloadReply(routeObject.get()))
+    if (!sendOffloadReply(prefix, static_cast<uint8_t>(proto), vrfIfIndex))
     {
         SWSS_LOG_ERROR("Failed to send RTM_NEWROUTE message to zebra on prefix %s(%s)",
             prefix.to_string().c_str(), vrfName.c_str());
         return;
     }
 
+    if (!m_lagSamples.empty())
+    {
+        auto sample = m_lagSamples.find(key);
+        if (sample != m_lagSamples.end())
+        {
+            auto lag = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - sample->second).count();
+
+            m_lagTotalUs += lag;
+            m_lagMaxUs = std::max(m_lagMaxUs, static_cast<uint64_t>(lag));
+            m_lagCount++;
+            m_lagSamples.erase(sample);
+        }
+    }
+
     SWSS_LOG_INFO("Sent response to zebra for prefix %s(%s)",
         prefix.to_string().c_str(), vrfName.c_str());
 }
@@ -1475,19 +1535,24 @@ void RouteSync::sendOffloadReply(DBConnector& db, const std::string& tableName)
 {
     SWSS_LOG_ENTER();
 
-    Table routeTable{&db, tableName};
-
-    std::vector<std::string> keys;
-    routeTable.getKeys(keys);
+    TableReader reader{&db, tableName};
+    std::deque<KeyOpFieldsValuesTuple> entries;
 
-    for (const auto& key: keys)
+    while (reader.next(entries))
     {
-        std::vector<FieldValueTuple> fieldValues;
-        routeTable.get(key, fieldValues);
-        fieldValues.emplace_back("err_str", "SWSS_RC_SUCCESS");
+        for (auto& entry: entries)
+        {
+            auto& fieldValues = kfvFieldsValues(entry);
+            fieldValues.emplace_back("err_str", "SWSS_RC_SUCCESS");
 
-        onRouteResponse(key, fieldValues);
+            onRouteResponse(kfvKey(entry), fieldValues);
+        }
+
+        flushOffloadReplies();
     }
+
+    SWSS_LOG_NOTICE("Sent offload replies for %zu routes of %s, %.0f routes/s",
+        reader.count(), tableName.c_str(), reader.rate());
 }
 
 void RouteSync::markRoutesOffloaded(swss::DBConnector& db)
@@ -1497,6 +1562,158 @@ void RouteSync::markRoutesOffloaded(swss::DBConnector& db)
     sendOffloadReply(db, APP_ROUTE_TABLE_NAME);
 }
 
+void RouteSync::flushOffloadReplies()
+{
+    if (m_fpmInterface && !m_fpmInterface->flush())
+    {
+        SWSS_LOG_ERROR("Failed to flush offload replies to zebra");
+    }
+}
+
+void RouteSync::sampleOffloadLag(const std::string& key)
+{
+    if (!isSuppressionEnabled() || (m_lagSampleCounter++ % ROUTE_OFFLOAD_LAG_SAMPLE) != 0)
+    {
+        return;
+    }
+
+    if (m_lagSamples.size() >= ROUTE_OFFLOAD_LAG_MAX_SAMPLES)
+    {
+        return;
+    }
+
+    m_lagSamples[key] = std::chrono::steady_clock::now();
+}
+
+void RouteSync::setRouteCoalescing(uint32_t windowMs, size_t maxPending)
+{
+    SWSS_LOG_ENTER();
+
+    if (!windowMs)
+    {
+        flushPendingRoutes();
+    }
+
+    m_coalesceWindowMs = windowMs;
+    m_coalesceMaxPending = maxPending ? maxPending : ROUTE_COALESCE_MAX_PENDING;
+
+    if (m_coalesceWindowMs)
+    {
+        SWSS_LOG_NOTICE("Route coalescing is enabled, window %u ms, max pending routes %zu",
+            m_coalesceWindowMs, m_coalesceMaxPending);
+    }
+    else
+    {
+        SWSS_LOG_NOTICE("Route coalescing is disabled");
+    }
+}
+
+void RouteSync::setRoute(const std::string& key, const std::vector<FieldValueTuple>& fvs)
+{
+    m_routeUpdatesReceived++;
+
+    if (!m_coalesceWindowMs)
+    {
+        writeRoute(KeyOpFieldsValuesTuple{key, SET_COMMAND, fvs});
+        return;
+    }
+
+    m_pendingRoutes[key] = KeyOpFieldsValuesTuple{key, SET_COMMAND, fvs};
+    if (m_pendingRoutes.size() >= m_coalesceMaxPending)
+    {
+        flushPendingRoutes();
+    }
+}
+
+void RouteSync::delRoute(const std::string& key)
+{
+    m_routeUpdatesReceived++;
+
+    if (!m_coalesceWindowMs)
+    {
+        writeRoute(KeyOpFieldsValuesTuple{key, DEL_COMMAND, {}});
+        return;
+    }
+
+    m_pendingRoutes[key] = KeyOpFieldsValuesTuple{key, DEL_COMMAND, {}};
+    if (m_pendingRoutes.size() >= m_coalesceMaxPending)
+    {
+        flushPendingRoutes();
+    }
+}
+
+void RouteSync::writeRoute(const KeyOpFieldsValuesTuple& kfv)
+{
+    const auto& key = kfvKey(kfv);
+
+    if (kfvOp(kfv) == SET_COMMAND)
+    {
+        m_routeTable.set(key, kfvFieldsValues(kfv));
+        sampleOffloadLag(key);
+    }
+    else
+    {
+        m_routeTable.del(key);
+        m_lagSamples.erase(key);
+    }
+
+    m_routeUpdatesWritten++;
+}
+
+void RouteSync::flushPendingRoutes()
+{
+    if (m_pendingRoutes.empty())
+    {
+        return;
+    }
+
+    SWSS_LOG_INFO("Flushing %zu coalesced routes", m_pendingRoutes.size());
+
+    /*
+     * Only the latest state of a route is written. With suppression enabled,
+     * zebra is answered from the orchagent response to this state, so the
+     * intermediate updates don't need an offload reply.
+     */
+    for (const auto& pending: m_pendingRoutes)
+    {
+        writeRoute(pending.second);
+    }
+    m_pendingRoutes.clear();
+}
+
+void RouteSync::publishStats(swss::Table& statsTable)
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - m_offloadStatsTime).count();
+    uint64_t replies = m_offloadReplies - m_offloadRepliesPublished;
+    uint64_t rate = seconds > 0 ? static_cast<uint64_t>(static_cast<double>(replies) / seconds) : 0;
+    uint64_t lagAvgMs = m_lagCount ? (m_lagTotalUs / m_lagCount) / 1000 : 0;
+
+    std::vector<FieldValueTuple> offloadFvs = {
+        {"offload_replies", std::to_string(m_offloadReplies)},
+        {"offload_replies_per_sec", std::to_string(rate)},
+        {"offload_reply_lag_avg_ms", std::to_string(lagAvgMs)},
+        {"offload_reply_lag_max_ms", std::to_string(m_lagMaxUs / 1000)},
+        {"offload_reply_lag_pending", std::to_string(m_lagSamples.size())},
+    };
+    statsTable.set("offload", offloadFvs);
+
+    std::vector<FieldValueTuple> routeFvs = {
+        {"updates_received", std::to_string(m_routeUpdatesReceived)},
+        {"updates_written", std::to_string(m_routeUpdatesWritten)},
+        {"updates_pending", std::to_string(m_pendingRoutes.size())},
+    };
+    statsTable.set("routes", routeFvs);
+
+    m_offloadRepliesPublished = m_offloadReplies;
+    m_offloadStatsTime = now;
+    m_lagTotalUs = 0;
+    m_lagMaxUs = 0;
+    m_lagCount = 0;
+}
+
 void RouteSync::onWarmStartEnd(DBConnector& applStateDb)
 {
     SWSS_LOG_ENTER();
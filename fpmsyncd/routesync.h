@@ -3,6 +3,8 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "table.h"
+#include "ipprefix.h"
 #include "netmsg.h"
 #include "linkcache.h"
 #include "fpminterface.h"
@@ -18,6 +20,15 @@
 #define RTM_F_OFFLOAD 0x4000 /* route is offloaded */
 #endif
 
+// One route out of ROUTE_OFFLOAD_LAG_SAMPLE is timed from APPL_DB to the offload reply
+#define ROUTE_OFFLOAD_LAG_SAMPLE 64
+
+// Max number of routes waiting for their offload reply to be timed
+#define ROUTE_OFFLOAD_LAG_MAX_SAMPLES 16384
+
+// Default number of distinct prefixes pending in the coalescing stage before it is flushed
+#define ROUTE_COALESCE_MAX_PENDING 10000
+
 using namespace std;
 
 /* Parse the Raw netlink msg */
@@ -54,6 +65,27 @@ public:
     /* Mark all routes from DB with offloaded flag */
     void markRoutesOffloaded(swss::DBConnector& db);
 
+    /* Send the offload replies coalesced by the FPM interface */
+    void flushOffloadReplies();
+
+    /*
+     * Keep only the latest update of a route for up to windowMs milliseconds, or
+     * until maxPending routes are pending, before writing it to ROUTE_TABLE.
+     * A window of 0 disables the coalescing.
+     */
+    void setRouteCoalescing(uint32_t windowMs, size_t maxPending = ROUTE_COALESCE_MAX_PENDING);
+
+    uint32_t getRouteCoalescingWindow() const
+    {
+        return m_coalesceWindowMs;
+    }
+
+    /* Write the net changes of the coalesced routes to ROUTE_TABLE */
+    void flushPendingRoutes();
+
+    /* Write the offload reply and route update statistics since the last call into the table */
+    void publishStats(swss::Table& statsTable);
+
     void onFpmConnected(FpmInterface& fpm)
     {
         m_fpmInterface = &fpm;
@@ -81,6 +113,34 @@ private:
     bool                m_isSuppressionEnabled{false};
     FpmInterface*       m_fpmInterface {nullptr};
 
+    /* Offload replies are encoded in place, without building a route object */
+    alignas(nlmsghdr) char m_offloadReplyBuffer[NLMSG_SPACE(sizeof(rtmsg)) + 3 * RTA_SPACE(16)];
+
+    /* Offload reply statistics */
+    uint64_t            m_offloadReplies{0};
+    uint64_t            m_offloadRepliesPublished{0};
+    std::chrono::steady_clock::time_point m_offloadStatsTime{std::chrono::steady_clock::now()};
+    uint64_t            m_lagSampleCounter{0};
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> m_lagSamples;
+    uint64_t            m_lagTotalUs{0};
+    uint64_t            m_lagMaxUs{0};
+    uint64_t            m_lagCount{0};
+
+    /* Time the offload reply of a route written to APPL_DB, if it is sampled */
+    void sampleOffloadLag(const std::string& key);
+
+    /* Route coalescing stage, latest update of each (VRF, prefix) */
+    uint32_t            m_coalesceWindowMs{0};
+    size_t              m_coalesceMaxPending{ROUTE_COALESCE_MAX_PENDING};
+    std::unordered_map<std::string, KeyOpFieldsValuesTuple> m_pendingRoutes;
+    uint64_t            m_routeUpdatesReceived{0};
+    uint64_t            m_routeUpdatesWritten{0};
+
+    /* Write or delete a regular route in ROUTE_TABLE, through the coalescing stage if enabled */
+    void setRoute(const std::string& key, const std::vector<FieldValueTuple>& fvs);
+    void delRoute(const std::string& key);
+    void writeRoute(const KeyOpFieldsValuesTuple& kfv);
+
     /* Handle regular route (include VRF route) */
     void onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf);
 
@@ -138,6 +198,9 @@ private:
     /* Sends FPM message with RTM_F_OFFLOAD flag set to zebra */
     bool sendOffloadReply(struct rtnl_route* route_obj);
 
+    /* Sends FPM message with RTM_F_OFFLOAD flag set to zebra */
+    bool sendOffloadReply(const IpPrefix& prefix, uint8_t protocol, uint32_t table);
+
     /* Sends FPM message with RTM_F_OFFLOAD flag set for all routes in the table */
     void sendOffloadReply(swss::DBConnector& db, const std::string& table);
 };
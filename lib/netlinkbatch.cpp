@@ -0,0 +1,939 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <arpa/inet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <linux/if_bridge.h>
+#include <linux/if_link.h>
+#include <linux/if_tunnel.h>
+#include <linux/neighbour.h>
+#include <linux/rtnetlink.h>
+#include <netlink/netlink.h>
+#include <netlink/attr.h>
+#include <netlink/msg.h>
+#include <netlink/socket.h>
+
+#include "logger.h"
+#include "netlinkbatch.h"
+
+using namespace std;
+using namespace swss;
+
+#ifndef SOL_NETLINK
+#define SOL_NETLINK 270
+#endif
+
+/* Maximum bytes of requests packed into a single sendmsg() */
+#define NETLINK_BATCH_SEND_SIZE     (32 * 1024)
+#define NETLINK_BATCH_RECV_BUF_SIZE (1024 * 1024)
+
+struct nl_sock *NetlinkBatch::m_sock = NULL;
+uint32_t NetlinkBatch::m_seq = 0;
+
+static struct nl_msg *allocLinkMsg(int type, int flags, int family, int ifindex,
+                                   unsigned int ifiFlags = 0, unsigned int ifiChange = 0)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = static_cast<unsigned char>(family);
+    ifi.ifi_index = ifindex;
+    ifi.ifi_flags = ifiFlags;
+    ifi.ifi_change = ifiChange;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+static struct nl_msg *allocAddrMsg(int type, int flags, int ifindex, const IpPrefix &prefix)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    auto ip = prefix.getIp().getIp();
+    bool isV4 = prefix.isV4();
+
+    struct ifaddrmsg ifa;
+    memset(&ifa, 0, sizeof(ifa));
+    ifa.ifa_family = static_cast<unsigned char>(isV4 ? AF_INET : AF_INET6);
+    ifa.ifa_prefixlen = static_cast<unsigned char>(prefix.getMaskLength());
+    ifa.ifa_index = static_cast<uint32_t>(ifindex);
+
+    const void *addr = isV4 ? static_cast<const void *>(&ip.ip_addr.ipv4_addr) : static_cast<const void *>(&ip.ip_addr.ipv6_addr);
+    int addrLen = isV4 ? static_cast<int>(sizeof(ip.ip_addr.ipv4_addr)) : static_cast<int>(sizeof(ip.ip_addr.ipv6_addr));
+
+    if (nlmsg_append(msg, &ifa, sizeof(ifa), NLMSG_ALIGNTO) < 0
+        || nla_put(msg, IFA_LOCAL, addrLen, addr) < 0
+        || nla_put(msg, IFA_ADDRESS, addrLen, addr) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+static struct nl_msg *allocNeighMsg(int type, int flags, int family, int ifindex, uint16_t state, uint8_t ntfFlags)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    struct ndmsg ndm;
+    memset(&ndm, 0, sizeof(ndm));
+    ndm.ndm_family = static_cast<unsigned char>(family);
+    ndm.ndm_ifindex = ifindex;
+    ndm.ndm_state = state;
+    ndm.ndm_flags = ntfFlags;
+
+    if (nlmsg_append(msg, &ndm, sizeof(ndm), NLMSG_ALIGNTO) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+static struct nl_msg *allocBridgeVlanMsg(int type, int ifindex, uint16_t vlanId, uint16_t vlanFlags, bool self)
+{
+    struct nl_msg *msg = allocLinkMsg(type, 0, AF_BRIDGE, ifindex);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    struct bridge_vlan_info vinfo;
+    memset(&vinfo, 0, sizeof(vinfo));
+    vinfo.flags = vlanFlags;
+    vinfo.vid = vlanId;
+
+    struct nlattr *afspec = nla_nest_start(msg, IFLA_AF_SPEC);
+    if (!afspec
+        || (self && nla_put_u16(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF) < 0)
+        || nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+    nla_nest_end(msg, afspec);
+
+    return msg;
+}
+
+static struct nl_msg *allocNewLinkMsg(const string &name, const string &kind, unsigned int ifiFlags,
+                                      const function<bool(struct nl_msg *)> &putAttrs,
+                                      const function<bool(struct nl_msg *)> &putInfoData)
+{
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, ifiFlags, ifiFlags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    if (nla_put_string(msg, IFLA_IFNAME, name.c_str()) < 0 || (putAttrs && !putAttrs(msg)))
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    struct nlattr *linkinfo = nla_nest_start(msg, IFLA_LINKINFO);
+    if (!linkinfo || nla_put_string(msg, IFLA_INFO_KIND, kind.c_str()) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    if (putInfoData)
+    {
+        struct nlattr *infodata = nla_nest_start(msg, IFLA_INFO_DATA);
+        if (!infodata || !putInfoData(msg))
+        {
+            nlmsg_free(msg);
+            return NULL;
+        }
+        nla_nest_end(msg, infodata);
+    }
+    nla_nest_end(msg, linkinfo);
+
+    return msg;
+}
+
+NetlinkBatch::~NetlinkBatch()
+{
+    if (!m_ops.empty() || !m_handlers.empty())
+    {
+        SWSS_LOG_WARN("%zu netlink operations and %zu result handlers dropped without being committed",
+                      m_ops.size(), m_handlers.size());
+    }
+}
+
+bool NetlinkBatch::enable()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sock)
+    {
+        return true;
+    }
+
+    struct nl_sock *sock = nl_socket_alloc();
+    if (!sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed, falling back to shell commands");
+        return false;
+    }
+
+    int err = nl_connect(sock, NETLINK_ROUTE);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s', falling back to shell commands", nl_geterror(err));
+        nl_socket_free(sock);
+        return false;
+    }
+
+    nl_socket_enable_msg_peek(sock);
+    nl_socket_set_buffer_size(sock, NETLINK_BATCH_RECV_BUF_SIZE, 0);
+
+    /* Don't echo the requests back in the acknowledgements */
+    int one = 1;
+    setsockopt(nl_socket_get_fd(sock), SOL_NETLINK, NETLINK_CAP_ACK, &one, sizeof(one));
+
+    m_sock = sock;
+    SWSS_LOG_NOTICE("Kernel interfaces are configured over netlink");
+
+    return true;
+}
+
+bool NetlinkBatch::isEnabled()
+{
+    return m_sock != NULL;
+}
+
+void NetlinkBatch::enqueue(const string &description, const vector<string> &ifnames, msg_builder_t build,
+                           const string &link)
+{
+    m_ops.push_back({description, ifnames, build, link});
+}
+
+void NetlinkBatch::onResult(result_handler_t handler)
+{
+    if (m_ops.empty() && m_handlers.empty())
+    {
+        handler(0, "");
+        return;
+    }
+
+    m_handlers.emplace_back(m_ops.size(), move(handler));
+}
+
+void NetlinkBatch::addVlanLink(const string &parent, const string &name, uint16_t vlanId, const MacAddress &mac, bool up)
+{
+    enqueue("link add link " + parent + " name " + name + " type vlan id " + to_string(vlanId),
+            {parent},
+            [=](const vector<int> &ifindexes) {
+                return allocNewLinkMsg(name, "vlan", up ? IFF_UP : 0,
+                                       [&](struct nl_msg *msg) {
+                                           return nla_put_u32(msg, IFLA_LINK, static_cast<uint32_t>(ifindexes[0])) >= 0
+                                               && (!mac || nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) >= 0);
+                                       },
+                                       [&](struct nl_msg *msg) {
+                                           return nla_put_u16(msg, IFLA_VLAN_ID, vlanId) >= 0;
+                                       });
+            },
+            name);
+}
+
+void NetlinkBatch::addVrfLink(const string &name, uint32_t table)
+{
+    enqueue("link add " + name + " type vrf table " + to_string(table),
+            {},
+            [=](const vector<int> &) {
+                return allocNewLinkMsg(name, "vrf", 0, nullptr,
+                                       [&](struct nl_msg *msg) {
+                                           return nla_put_u32(msg, IFLA_VRF_TABLE, table) >= 0;
+                                       });
+            },
+            name);
+}
+
+void NetlinkBatch::addDummyLink(const string &name, uint32_t mtu)
+{
+    enqueue("link add " + name + " type dummy",
+            {},
+            [=](const vector<int> &) {
+                return allocNewLinkMsg(name, "dummy", 0,
+                                       [&](struct nl_msg *msg) {
+                                           return mtu == 0 || nla_put_u32(msg, IFLA_MTU, mtu) >= 0;
+                                       },
+                                       nullptr);
+            },
+            name);
+}
+
+void NetlinkBatch::addBridgeLink(const string &name)
+{
+    enqueue("link add " + name + " type bridge",
+            {},
+            [=](const vector<int> &) {
+                return allocNewLinkMsg(name, "bridge", 0, nullptr, nullptr);
+            },
+            name);
+}
+
+void NetlinkBatch::addVxlanLink(const string &name, uint32_t vni, const IpAddress &local, const IpAddress &remote,
+                                uint16_t dstPort, bool learning, const MacAddress &mac)
+{
+    enqueue("link add " + name + " type vxlan id " + to_string(vni)
+                + (local.isZero() ? "" : " local " + local.to_string())
+                + (remote.isZero() ? "" : " remote " + remote.to_string())
+                + (learning ? "" : " nolearning") + " dstport " + to_string(dstPort),
+            {},
+            [=](const vector<int> &) {
+                return allocNewLinkMsg(name, "vxlan", 0,
+                                       [&](struct nl_msg *msg) {
+                                           return !mac || nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) >= 0;
+                                       },
+                                       [&](struct nl_msg *msg) {
+                                           auto putAddr = [msg](const IpAddress &ip, int attr4, int attr6) {
+                                               auto addr = ip.getIp();
+                                               if (ip.isZero())
+                                               {
+                                                   return true;
+                                               }
+                                               return ip.isV4()
+                                                   ? nla_put(msg, attr4, sizeof(addr.ip_addr.ipv4_addr), &addr.ip_addr.ipv4_addr) >= 0
+                                                   : nla_put(msg, attr6, sizeof(addr.ip_addr.ipv6_addr), &addr.ip_addr.ipv6_addr) >= 0;
+                                           };
+                                           return nla_put_u32(msg, IFLA_VXLAN_ID, vni) >= 0
+                                               && putAddr(local, IFLA_VXLAN_LOCAL, IFLA_VXLAN_LOCAL6)
+                                               && putAddr(remote, IFLA_VXLAN_GROUP, IFLA_VXLAN_GROUP6)
+                                               && nla_put_u16(msg, IFLA_VXLAN_PORT, htons(dstPort)) >= 0
+                                               && nla_put_u8(msg, IFLA_VXLAN_LEARNING, learning ? 1 : 0) >= 0;
+                                       });
+            },
+            name);
+}
+
+void NetlinkBatch::addIpipLink(const string &name, const IpAddress &local, const IpAddress &remote)
+{
+    enqueue("link add " + name + " type ipip local " + local.to_string() + " remote " + remote.to_string(),
+            {},
+            [=](const vector<int> &) {
+                if (!local.isV4() || !remote.isV4())
+                {
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return allocNewLinkMsg(name, "ipip", 0, nullptr,
+                                       [&](struct nl_msg *msg) {
+                                           return nla_put_u32(msg, IFLA_IPTUN_LOCAL, local.getV4Addr()) >= 0
+                                               && nla_put_u32(msg, IFLA_IPTUN_REMOTE, remote.getV4Addr()) >= 0;
+                                       });
+            },
+            name);
+}
+
+void NetlinkBatch::delLink(const string &name)
+{
+    enqueue("link del " + name,
+            {name},
+            [](const vector<int> &ifindexes) {
+                return allocLinkMsg(RTM_DELLINK, 0, AF_UNSPEC, ifindexes[0]);
+            },
+            name);
+}
+
+void NetlinkBatch::setLinkAdminState(const string &name, bool up)
+{
+    enqueue("link set " + name + (up ? " up" : " down"),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, ifindexes[0], up ? IFF_UP : 0, IFF_UP);
+            });
+}
+
+void NetlinkBatch::setLinkMtu(const string &name, uint32_t mtu)
+{
+    enqueue("link set " + name + " mtu " + to_string(mtu),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, ifindexes[0]);
+                if (msg && nla_put_u32(msg, IFLA_MTU, mtu) < 0)
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+void NetlinkBatch::setLinkMac(const string &name, const MacAddress &mac)
+{
+    enqueue("link set " + name + " address " + mac.to_string(),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, ifindexes[0]);
+                if (msg && nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) < 0)
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+void NetlinkBatch::setLinkMaster(const string &name, const string &master)
+{
+    enqueue("link set " + name + " master " + master,
+            {name, master},
+            [](const vector<int> &ifindexes) {
+                struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, ifindexes[0]);
+                if (msg && nla_put_u32(msg, IFLA_MASTER, static_cast<uint32_t>(ifindexes[1])) < 0)
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+void NetlinkBatch::setLinkNoMaster(const string &name)
+{
+    enqueue("link set " + name + " nomaster",
+            {name},
+            [](const vector<int> &ifindexes) {
+                struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, ifindexes[0]);
+                if (msg && nla_put_u32(msg, IFLA_MASTER, 0) < 0)
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+void NetlinkBatch::addBridgeVlan(const string &name, uint16_t vlanId, bool pvidUntagged, bool self)
+{
+    enqueue("bridge vlan add vid " + to_string(vlanId) + " dev " + name + (pvidUntagged ? " pvid untagged" : "") + (self ? " self" : ""),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                uint16_t flags = pvidUntagged ? (BRIDGE_VLAN_INFO_PVID | BRIDGE_VLAN_INFO_UNTAGGED) : 0;
+                return allocBridgeVlanMsg(RTM_SETLINK, ifindexes[0], vlanId, flags, self);
+            });
+}
+
+void NetlinkBatch::delBridgeVlan(const string &name, uint16_t vlanId, bool self)
+{
+    enqueue("bridge vlan del vid " + to_string(vlanId) + " dev " + name + (self ? " self" : ""),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocBridgeVlanMsg(RTM_DELLINK, ifindexes[0], vlanId, 0, self);
+            });
+}
+
+void NetlinkBatch::addAddress(const string &name, const IpPrefix &prefix)
+{
+    enqueue("address add " + prefix.to_string() + " dev " + name,
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocAddrMsg(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL, ifindexes[0], prefix);
+            });
+}
+
+void NetlinkBatch::delAddress(const string &name, const IpPrefix &prefix)
+{
+    enqueue("address del " + prefix.to_string() + " dev " + name,
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocAddrMsg(RTM_DELADDR, 0, ifindexes[0], prefix);
+            });
+}
+
+static struct nl_msg *allocRouteMsg(int type, int flags, int ifindex, const IpPrefix &prefix)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    auto ip = prefix.getIp().getIp();
+    bool isV4 = prefix.isV4();
+
+    struct rtmsg rtm;
+    memset(&rtm, 0, sizeof(rtm));
+    rtm.rtm_family = static_cast<unsigned char>(isV4 ? AF_INET : AF_INET6);
+    rtm.rtm_dst_len = static_cast<unsigned char>(prefix.getMaskLength());
+    rtm.rtm_table = RT_TABLE_MAIN;
+    /* Same defaults as "ip route", a deleted route matches any protocol, scope and type */
+    rtm.rtm_scope = RT_SCOPE_NOWHERE;
+    if (type != RTM_DELROUTE)
+    {
+        rtm.rtm_protocol = RTPROT_BOOT;
+        rtm.rtm_scope = static_cast<unsigned char>(isV4 ? RT_SCOPE_LINK : RT_SCOPE_UNIVERSE);
+        rtm.rtm_type = RTN_UNICAST;
+    }
+
+    const void *dst = isV4 ? static_cast<const void *>(&ip.ip_addr.ipv4_addr) : static_cast<const void *>(&ip.ip_addr.ipv6_addr);
+    int dstLen = isV4 ? static_cast<int>(sizeof(ip.ip_addr.ipv4_addr)) : static_cast<int>(sizeof(ip.ip_addr.ipv6_addr));
+
+    if (nlmsg_append(msg, &rtm, sizeof(rtm), NLMSG_ALIGNTO) < 0
+        || nla_put(msg, RTA_DST, dstLen, dst) < 0
+        || nla_put_u32(msg, RTA_OIF, static_cast<uint32_t>(ifindex)) < 0)
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+void NetlinkBatch::replaceRoute(const string &name, const IpPrefix &prefix)
+{
+    enqueue("route replace " + prefix.to_string() + " dev " + name,
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocRouteMsg(RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE, ifindexes[0], prefix);
+            });
+}
+
+void NetlinkBatch::delRoute(const string &name, const IpPrefix &prefix)
+{
+    enqueue("route del " + prefix.to_string() + " dev " + name,
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocRouteMsg(RTM_DELROUTE, 0, ifindexes[0], prefix);
+            });
+}
+
+void NetlinkBatch::addNeighbor(const string &name, const IpAddress &ip, const MacAddress &mac, uint16_t state)
+{
+    enqueue("neigh add " + ip.to_string() + " lladdr " + mac.to_string() + " dev " + name,
+            {name},
+            [=](const vector<int> &ifindexes) {
+                auto addr = ip.getIp();
+                bool isV4 = ip.isV4();
+                struct nl_msg *msg = allocNeighMsg(RTM_NEWNEIGH, NLM_F_CREATE | NLM_F_EXCL, isV4 ? AF_INET : AF_INET6,
+                                                   ifindexes[0], state, 0);
+                const void *dst = isV4 ? static_cast<const void *>(&addr.ip_addr.ipv4_addr) : static_cast<const void *>(&addr.ip_addr.ipv6_addr);
+                int dstLen = isV4 ? static_cast<int>(sizeof(addr.ip_addr.ipv4_addr)) : static_cast<int>(sizeof(addr.ip_addr.ipv6_addr));
+
+                if (msg && (nla_put(msg, NDA_DST, dstLen, dst) < 0
+                            || nla_put(msg, NDA_LLADDR, ETHER_ADDR_LEN, mac.getMac()) < 0))
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+static struct nl_msg *allocFdbMsg(int type, int flags, int ifindex, const MacAddress &mac, uint16_t vlanId,
+                                  uint16_t state, uint8_t ntfFlags)
+{
+    struct nl_msg *msg = allocNeighMsg(type, flags, AF_BRIDGE, ifindex, state, ntfFlags);
+    if (msg && (nla_put(msg, NDA_LLADDR, ETHER_ADDR_LEN, mac.getMac()) < 0
+                || (vlanId && nla_put_u16(msg, NDA_VLAN, vlanId) < 0)))
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+void NetlinkBatch::replaceFdb(const string &name, const MacAddress &mac, uint16_t vlanId, uint16_t state, uint8_t flags)
+{
+    enqueue("fdb replace " + mac.to_string() + " dev " + name + " vlan " + to_string(vlanId),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocFdbMsg(RTM_NEWNEIGH, NLM_F_CREATE | NLM_F_REPLACE, ifindexes[0], mac, vlanId, state, flags);
+            });
+}
+
+void NetlinkBatch::delFdb(const string &name, const MacAddress &mac, uint16_t vlanId, uint8_t flags)
+{
+    enqueue("fdb del " + mac.to_string() + " dev " + name + " vlan " + to_string(vlanId),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                return allocFdbMsg(RTM_DELNEIGH, 0, ifindexes[0], mac, vlanId, 0, flags);
+            });
+}
+
+void NetlinkBatch::delVxlanFdb(const string &name, const MacAddress &mac, uint16_t vlanId, const IpAddress &dst)
+{
+    enqueue("fdb del " + mac.to_string() + " dev " + name + " dst " + dst.to_string() + " vlan " + to_string(vlanId),
+            {name},
+            [=](const vector<int> &ifindexes) {
+                auto addr = dst.getIp();
+                bool isV4 = dst.isV4();
+                struct nl_msg *msg = allocFdbMsg(RTM_DELNEIGH, 0, ifindexes[0], mac, vlanId, 0, NTF_SELF);
+                const void *ip = isV4 ? static_cast<const void *>(&addr.ip_addr.ipv4_addr) : static_cast<const void *>(&addr.ip_addr.ipv6_addr);
+                int ipLen = isV4 ? static_cast<int>(sizeof(addr.ip_addr.ipv4_addr)) : static_cast<int>(sizeof(addr.ip_addr.ipv6_addr));
+
+                if (msg && nla_put(msg, NDA_DST, ipLen, ip) < 0)
+                {
+                    nlmsg_free(msg);
+                    return static_cast<struct nl_msg *>(NULL);
+                }
+                return msg;
+            });
+}
+
+bool NetlinkBatch::resolve(const operation_t &op, vector<int> &ifindexes)
+{
+    ifindexes.clear();
+    for (const auto &ifname : op.ifnames)
+    {
+        int ifindex = static_cast<int>(if_nametoindex(ifname.c_str()));
+        if (ifindex == 0)
+        {
+            return false;
+        }
+        ifindexes.push_back(ifindex);
+    }
+
+    return true;
+}
+
+/* Send the packed requests and collect one acknowledgement for each of them */
+void NetlinkBatch::flush()
+{
+    if (m_inflight.empty())
+    {
+        return;
+    }
+
+    int err = nl_sendto(m_sock, m_sendBuf.data(), m_sendBuf.size());
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Netlink send of %zu requests failed, error '%s'", m_inflight.size(), nl_geterror(err));
+        for (const auto &inflight : m_inflight)
+        {
+            m_results[inflight.second] = EIO;
+        }
+        m_inflight.clear();
+        m_inflightLinks.clear();
+        m_sendBuf.clear();
+        return;
+    }
+
+    size_t pending = m_inflight.size();
+    while (pending > 0)
+    {
+        struct sockaddr_nl nla;
+        unsigned char *buf = NULL;
+
+        int len = nl_recv(m_sock, &nla, &buf, NULL);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("Netlink receive failed with %zu requests unacknowledged, error '%s'",
+                           pending, len < 0 ? nl_geterror(len) : "EOF");
+            free(buf);
+            break;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(buf);
+        while (nlmsg_ok(hdr, len))
+        {
+            if (hdr->nlmsg_type == NLMSG_ERROR)
+            {
+                auto *nlerr = static_cast<struct nlmsgerr *>(nlmsg_data(hdr));
+                for (auto &inflight : m_inflight)
+                {
+                    if (inflight.first == hdr->nlmsg_seq)
+                    {
+                        m_results[inflight.second] = -nlerr->error;
+                        inflight.first = 0;
+                        pending--;
+                        break;
+                    }
+                }
+            }
+            hdr = nlmsg_next(hdr, &len);
+        }
+        free(buf);
+    }
+
+    /* Requests never acknowledged are reported as failed */
+    for (const auto &inflight : m_inflight)
+    {
+        if (inflight.first != 0)
+        {
+            m_results[inflight.second] = ETIMEDOUT;
+        }
+    }
+
+    m_inflight.clear();
+    m_inflightLinks.clear();
+    m_sendBuf.clear();
+}
+
+/* Send the queued operations, their results are appended to m_results */
+bool NetlinkBatch::send()
+{
+    size_t base = m_results.size();
+    m_results.resize(base + m_ops.size(), 0);
+
+    if (!m_sock)
+    {
+        fill(m_results.begin() + base, m_results.end(), ENOTCONN);
+        if (m_lastError.empty())
+        {
+            m_lastError = "netlink is not enabled";
+        }
+        return m_ops.empty();
+    }
+
+    vector<int> ifindexes;
+    for (size_t i = 0; i < m_ops.size(); i++)
+    {
+        auto &op = m_ops[i];
+
+        /* The index of a link added or deleted by a request which hasn't been sent yet is about to change */
+        for (const auto &ifname : op.ifnames)
+        {
+            if (m_inflightLinks.count(ifname))
+            {
+                flush();
+                break;
+            }
+        }
+
+        if (!resolve(op, ifindexes))
+        {
+            /* The interface may be created by a request which hasn't been sent yet */
+            flush();
+            if (!resolve(op, ifindexes))
+            {
+                m_results[base + i] = ENODEV;
+                continue;
+            }
+        }
+
+        struct nl_msg *msg = op.build(ifindexes);
+        if (!msg)
+        {
+            m_results[base + i] = ENOMEM;
+            continue;
+        }
+
+        struct nlmsghdr *hdr = nlmsg_hdr(msg);
+        /* Sequence number 0 marks acknowledged requests */
+        if (++m_seq == 0)
+        {
+            m_seq = 1;
+        }
+        hdr->nlmsg_seq = m_seq;
+
+        if (m_sendBuf.size() + NLMSG_ALIGN(hdr->nlmsg_len) > NETLINK_BATCH_SEND_SIZE)
+        {
+            flush();
+        }
+
+        auto *data = reinterpret_cast<uint8_t *>(hdr);
+        m_sendBuf.insert(m_sendBuf.end(), data, data + hdr->nlmsg_len);
+        m_sendBuf.resize(NLMSG_ALIGN(m_sendBuf.size()), 0);
+        m_inflight.emplace_back(hdr->nlmsg_seq, base + i);
+        if (!op.link.empty())
+        {
+            m_inflightLinks.insert(op.link);
+        }
+
+        nlmsg_free(msg);
+    }
+
+    flush();
+
+    bool success = true;
+    for (size_t i = 0; i < m_ops.size(); i++)
+    {
+        int error = m_results[base + i];
+        if (error == 0)
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("Netlink request '%s' failed: %s", m_ops[i].description.c_str(), strerror(error));
+        if (m_lastError.empty())
+        {
+            m_lastError = m_ops[i].description + " : " + strerror(error);
+        }
+        success = false;
+    }
+
+    return success;
+}
+
+bool NetlinkBatch::commit()
+{
+    SWSS_LOG_ENTER();
+
+    m_results.clear();
+    m_lastError.clear();
+
+    bool success = true;
+    do
+    {
+        size_t base = m_results.size();
+        success = send() && success;
+
+        /* Handlers may queue new operations, which are sent in the next round */
+        auto ops = move(m_ops);
+        auto handlers = move(m_handlers);
+        m_ops.clear();
+        m_handlers.clear();
+
+        size_t begin = 0;
+        for (auto &handler : handlers)
+        {
+            int error = 0;
+            string description;
+            for (size_t i = begin; i < handler.first; i++)
+            {
+                if (m_results[base + i] != 0)
+                {
+                    error = m_results[base + i];
+                    description = ops[i].description;
+                    break;
+                }
+            }
+            begin = handler.first;
+
+            handler.second(error, description);
+        }
+    } while (!m_ops.empty() || !m_handlers.empty());
+
+    return success;
+}
+
+bool NetlinkBatch::getBridgeVlans(const string &name, vector<uint16_t> &vlans)
+{
+    SWSS_LOG_ENTER();
+
+    vlans.clear();
+
+    int ifindex = static_cast<int>(if_nametoindex(name.c_str()));
+    if (!m_sock || ifindex == 0)
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc_simple(RTM_GETLINK, NLM_F_REQUEST | NLM_F_DUMP);
+    if (!msg)
+    {
+        return false;
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_BRIDGE;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0
+        || nla_put_u32(msg, IFLA_EXT_MASK, RTEXT_FILTER_BRVLAN) < 0)
+    {
+        nlmsg_free(msg);
+        return false;
+    }
+
+    /* The reply is matched by sequence number, messages left by earlier requests are skipped */
+    struct nlmsghdr *req = nlmsg_hdr(msg);
+    if (++m_seq == 0)
+    {
+        m_seq = 1;
+    }
+    uint32_t seq = req->nlmsg_seq = m_seq;
+
+    int err = nl_sendto(m_sock, req, req->nlmsg_len);
+    nlmsg_free(msg);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Netlink bridge VLAN dump request failed, error '%s'", nl_geterror(err));
+        return false;
+    }
+
+    /* The whole multipart reply is read, up to NLMSG_DONE, so nothing is left for the next request */
+    bool done = false, success = true;
+    while (!done)
+    {
+        struct sockaddr_nl nla;
+        unsigned char *buf = NULL;
+
+        int len = nl_recv(m_sock, &nla, &buf, NULL);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("Netlink bridge VLAN dump receive failed, error '%s'", len < 0 ? nl_geterror(len) : "EOF");
+            free(buf);
+            return false;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(buf);
+        for (; nlmsg_ok(hdr, len); hdr = nlmsg_next(hdr, &len))
+        {
+            if (hdr->nlmsg_seq != seq)
+            {
+                continue;
+            }
+            if (hdr->nlmsg_type == NLMSG_DONE)
+            {
+                done = true;
+                continue;
+            }
+            if (hdr->nlmsg_type == NLMSG_ERROR)
+            {
+                /* The request failed, no other message follows */
+                done = true;
+                success = false;
+                continue;
+            }
+            if (hdr->nlmsg_type != RTM_NEWLINK)
+            {
+                continue;
+            }
+
+            auto *info = static_cast<struct ifinfomsg *>(nlmsg_data(hdr));
+            if (info->ifi_index != ifindex)
+            {
+                continue;
+            }
+
+            struct nlattr *tb[IFLA_MAX + 1];
+            if (nlmsg_parse(hdr, sizeof(struct ifinfomsg), tb, IFLA_MAX, NULL) < 0 || !tb[IFLA_AF_SPEC])
+            {
+                continue;
+            }
+
+            struct nlattr *attr;
+            int rem;
+            nla_for_each_nested(attr, tb[IFLA_AF_SPEC], rem)
+            {
+                if (nla_type(attr) == IFLA_BRIDGE_VLAN_INFO)
+                {
+                    auto *vinfo = static_cast<struct bridge_vlan_info *>(nla_data(attr));
+                    vlans.push_back(vinfo->vid);
+                }
+            }
+        }
+        free(buf);
+    }
+
+    return success;
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "macaddress.h"
+#include "ipprefix.h"
+
+struct nl_msg;
+struct nl_sock;
+
+namespace swss {
+
+/*
+ * NetlinkBatch configures links, addresses, bridge VLANs and VRFs in the kernel
+ * over rtnetlink instead of forking "ip" and "bridge" command lines.
+ *
+ * Operations are queued and sent by commit(). Several requests are packed into a
+ * single sendmsg() and every request is acknowledged by the kernel, so the result
+ * of each operation is available separately. Interfaces are referenced by name and
+ * resolved when the batch is committed, which allows creating a link and
+ * configuring it in the same batch.
+ *
+ * A daemon opts in by calling NetlinkBatch::enable() once. Callers check
+ * NetlinkBatch::isEnabled() and keep the shell command as fallback.
+ *
+ * A batch may live across several tasks, e.g. for a whole Orch::doTask() pass, with
+ * onResult() handlers applying the outcome of each task once the batch is committed.
+ */
+class NetlinkBatch
+{
+public:
+    NetlinkBatch() = default;
+    ~NetlinkBatch();
+
+    NetlinkBatch(const NetlinkBatch&) = delete;
+    NetlinkBatch& operator=(const NetlinkBatch&) = delete;
+
+    static bool enable();
+    static bool isEnabled();
+
+    /* Links */
+    void addVlanLink(const std::string &parent, const std::string &name, uint16_t vlanId, const MacAddress &mac = MacAddress(), bool up = false);
+    void addVrfLink(const std::string &name, uint32_t table);
+    void addDummyLink(const std::string &name, uint32_t mtu = 0);
+    void addBridgeLink(const std::string &name);
+    /* A zero local or remote address is left out, like omitting "local" or "remote" in "ip link add type vxlan" */
+    void addVxlanLink(const std::string &name, uint32_t vni, const IpAddress &local, const IpAddress &remote,
+                      uint16_t dstPort, bool learning = true, const MacAddress &mac = MacAddress());
+    /* Like "ip tunnel add <name> mode ipip local <local> remote <remote>", IPv4 only */
+    void addIpipLink(const std::string &name, const IpAddress &local, const IpAddress &remote);
+    void delLink(const std::string &name);
+    void setLinkAdminState(const std::string &name, bool up);
+    void setLinkMtu(const std::string &name, uint32_t mtu);
+    void setLinkMac(const std::string &name, const MacAddress &mac);
+    void setLinkMaster(const std::string &name, const std::string &master);
+    void setLinkNoMaster(const std::string &name);
+
+    /* Bridge VLANs, self is for the VLANs of the bridge device itself */
+    void addBridgeVlan(const std::string &name, uint16_t vlanId, bool pvidUntagged, bool self = false);
+    void delBridgeVlan(const std::string &name, uint16_t vlanId, bool self = false);
+
+    /* Addresses */
+    void addAddress(const std::string &name, const IpPrefix &prefix);
+    void delAddress(const std::string &name, const IpPrefix &prefix);
+
+    /* Routes of the main table through a device, like "ip route replace|del <prefix> dev <name>" */
+    void replaceRoute(const std::string &name, const IpPrefix &prefix);
+    void delRoute(const std::string &name, const IpPrefix &prefix);
+
+    /* Neighbors, state is one of the NUD_* states */
+    void addNeighbor(const std::string &name, const IpAddress &ip, const MacAddress &mac, uint16_t state);
+
+    /* Bridge FDB entries, like "bridge fdb replace|del <mac> dev <name> vlan <vid>", flags are NTF_* flags */
+    void replaceFdb(const std::string &name, const MacAddress &mac, uint16_t vlanId, uint16_t state, uint8_t flags);
+    void delFdb(const std::string &name, const MacAddress &mac, uint16_t vlanId, uint8_t flags);
+    /* Remote FDB entry of a VXLAN device, like "bridge fdb del <mac> dev <name> dst <dst> vlan <vid>" */
+    void delVxlanFdb(const std::string &name, const MacAddress &mac, uint16_t vlanId, const IpAddress &dst);
+
+    size_t size() const { return m_ops.size(); }
+
+    /*
+     * Handler of the operations queued since the previous handler. error is 0 when all of
+     * them succeeded, otherwise the errno of the first failed one, which description names.
+     * Handlers run in order once the batch is committed, an empty batch runs the handler
+     * right away. Operations queued by a handler are committed right after the handlers.
+     */
+    typedef std::function<void(int error, const std::string &description)> result_handler_t;
+    void onResult(result_handler_t handler);
+
+    /*
+     * Send all queued operations to the kernel and wait for their acknowledgements,
+     * then run the result handlers. Returns true if all of them succeeded. The queue
+     * is emptied in any case.
+     */
+    bool commit();
+
+    /* Result of each operation of the last commit, 0 on success or a positive errno */
+    const std::vector<int> &results() const { return m_results; }
+    /* Description of the first failed operation of the last commit */
+    const std::string &getLastError() const { return m_lastError; }
+
+    /* Fetch the VLANs configured on a bridge port, like "bridge vlan show dev <name>" */
+    static bool getBridgeVlans(const std::string &name, std::vector<uint16_t> &vlans);
+
+private:
+    typedef std::function<struct nl_msg *(const std::vector<int> &ifindexes)> msg_builder_t;
+
+    struct operation_t
+    {
+        std::string description;
+        std::vector<std::string> ifnames;
+        msg_builder_t build;
+        /* Link added or deleted by the operation */
+        std::string link;
+    };
+
+    std::vector<operation_t> m_ops;
+    /* Handlers and the number of operations queued before each of them */
+    std::vector<std::pair<size_t, result_handler_t>> m_handlers;
+    std::vector<int> m_results;
+    std::string m_lastError;
+
+    /* Messages packed in the current send buffer and the index of their operations */
+    std::vector<uint8_t> m_sendBuf;
+    std::vector<std::pair<uint32_t, size_t>> m_inflight;
+    /* Links added or deleted by the messages in the current send buffer */
+    std::set<std::string> m_inflightLinks;
+
+    static struct nl_sock *m_sock;
+    static uint32_t m_seq;
+
+    void enqueue(const std::string &description, const std::vector<std::string> &ifnames, msg_builder_t build,
+                 const std::string &link = "");
+    bool resolve(const operation_t &op, std::vector<int> &ifindexes);
+    void flush();
+    bool send();
+};
+
+}
@@ -0,0 +1,203 @@
+#include <hiredis/hiredis.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "logger.h"
+#include "redisreply.h"
+#include "tablereader.h"
+
+using namespace std;
+using namespace swss;
+
+TableReader::TableReader(const DBConnector *db, const string &tableName, size_t batchSize) :
+    m_db(db->newConnector(0)),
+    m_table(db, tableName),
+    m_batchSize(batchSize ? batchSize : TABLE_READER_BATCH_SIZE),
+    m_start(chrono::steady_clock::now())
+{
+    string prefix = tableName + m_table.getTableNameSeparator();
+
+    m_pattern = prefix + "*";
+    m_prefixLen = prefix.length();
+}
+
+double TableReader::rate() const
+{
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - m_start).count();
+
+    return seconds > 0 ? (double)m_count / seconds : 0;
+}
+
+bool TableReader::next(deque<KeyOpFieldsValuesTuple> &entries)
+{
+    entries.clear();
+
+    if (m_fallback)
+    {
+        return nextFallback(entries);
+    }
+
+    while (!m_done && entries.empty())
+    {
+        vector<string> keys;
+
+        while (!m_done && keys.size() < m_batchSize)
+        {
+            if (!scan(keys))
+            {
+                /* Nothing has been returned yet when the first SCAN fails */
+                SWSS_LOG_NOTICE("SCAN is not available, read table %s by KEYS", m_table.getTableName().c_str());
+                m_fallback = true;
+                m_table.getKeys(m_keys);
+                return nextFallback(entries);
+            }
+        }
+
+        fetch(keys, entries);
+    }
+
+    return !entries.empty();
+}
+
+void TableReader::read(const vector<string> &keys, deque<KeyOpFieldsValuesTuple> &entries)
+{
+    entries.clear();
+
+    for (size_t begin = 0; begin < keys.size(); begin += m_batchSize)
+    {
+        size_t end = min(keys.size(), begin + m_batchSize);
+        fetch(vector<string>(keys.begin() + begin, keys.begin() + end), entries);
+    }
+}
+
+bool TableReader::scan(vector<string> &keys)
+{
+    RedisCommand command;
+    command.format("SCAN %s MATCH %s COUNT %zu", m_cursor.c_str(), m_pattern.c_str(), m_batchSize);
+
+    unique_ptr<RedisReply> r;
+    try
+    {
+        r = make_unique<RedisReply>(m_db.get(), command);
+    }
+    catch (const exception &e)
+    {
+        /* RedisReply throws on the error reply of a server without SCAN */
+        if (m_scanning)
+        {
+            throw;
+        }
+        SWSS_LOG_INFO("SCAN failed on table %s: %s", m_table.getTableName().c_str(), e.what());
+        return false;
+    }
+    redisReply *reply = r->getContext();
+
+    /* The reply is [cursor, [key, ...]] */
+    if (reply->type != REDIS_REPLY_ARRAY || reply->elements != 2 ||
+        reply->element[0]->type != REDIS_REPLY_STRING || reply->element[1]->type != REDIS_REPLY_ARRAY)
+    {
+        if (!m_scanning)
+        {
+            return false;
+        }
+        throw runtime_error("Unexpected SCAN reply on table " + m_table.getTableName());
+    }
+    m_scanning = true;
+
+    m_cursor = reply->element[0]->str;
+    m_done = (m_cursor == "0");
+
+    redisReply *found = reply->element[1];
+    for (size_t i = 0; i < found->elements; i++)
+    {
+        string key(found->element[i]->str, found->element[i]->len);
+        if (m_seen.insert(key).second)
+        {
+            keys.push_back(key.substr(m_prefixLen));
+        }
+    }
+
+    return true;
+}
+
+void TableReader::fetch(const vector<string> &keys, deque<KeyOpFieldsValuesTuple> &entries)
+{
+    redisContext *ctx = m_db->getContext();
+    string prefix = m_pattern.substr(0, m_prefixLen);
+    size_t fetched = entries.size();
+
+    for (const auto &key : keys)
+    {
+        RedisCommand hgetall;
+        hgetall.format("HGETALL %s", (prefix + key).c_str());
+
+        if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+        {
+            throw runtime_error("Failed to pipeline HGETALL on table " + m_table.getTableName());
+        }
+    }
+
+    /* All the replies must be consumed before an error is reported */
+    bool failed = false;
+    for (const auto &key : keys)
+    {
+        redisReply *raw = NULL;
+        if (redisGetReply(ctx, (void **)&raw) != REDIS_OK || raw == NULL)
+        {
+            throw runtime_error("Failed to get HGETALL reply on table " + m_table.getTableName());
+        }
+
+        RedisReply r(raw);
+        redisReply *reply = r.getContext();
+        if (reply->type != REDIS_REPLY_ARRAY)
+        {
+            failed = true;
+            continue;
+        }
+
+        /* The key has been deleted after it was scanned */
+        if (reply->elements == 0)
+        {
+            continue;
+        }
+
+        KeyOpFieldsValuesTuple kco;
+        kfvKey(kco) = key;
+        kfvOp(kco) = SET_COMMAND;
+        for (size_t i = 0; i + 1 < reply->elements; i += 2)
+        {
+            kfvFieldsValues(kco).emplace_back(reply->element[i]->str, reply->element[i + 1]->str);
+        }
+
+        entries.push_back(kco);
+    }
+
+    if (failed)
+    {
+        throw runtime_error("Unexpected HGETALL reply on table " + m_table.getTableName());
+    }
+
+    m_count += entries.size() - fetched;
+}
+
+bool TableReader::nextFallback(deque<KeyOpFieldsValuesTuple> &entries)
+{
+    while (m_keyIndex < m_keys.size() && entries.size() < m_batchSize)
+    {
+        KeyOpFieldsValuesTuple kco;
+
+        kfvKey(kco) = m_keys[m_keyIndex++];
+        kfvOp(kco) = SET_COMMAND;
+
+        if (!m_table.get(kfvKey(kco), kfvFieldsValues(kco)))
+        {
+            continue;
+        }
+        entries.push_back(kco);
+    }
+
+    m_count += entries.size();
+
+    return !entries.empty();
+}
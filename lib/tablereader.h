@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "dbconnector.h"
+#include "table.h"
+
+namespace swss {
+
+/* Number of entries fetched per round trip */
+#define TABLE_READER_BATCH_SIZE 1024
+
+/*
+ * TableReader reads all the entries of a table in batches.
+ *
+ * Keys are iterated with SCAN instead of KEYS, so a large table doesn't block the
+ * redis server, and the HGETALL of all the keys in a batch are pipelined into a
+ * single round trip. Each call to next() returns one batch, so the caller can
+ * start processing the table before it has been completely read.
+ *
+ * If the server doesn't support the SCAN command, the reader falls back to
+ * Table::getKeys() and Table::get().
+ */
+class TableReader
+{
+public:
+    TableReader(const DBConnector *db, const std::string &tableName, size_t batchSize = TABLE_READER_BATCH_SIZE);
+
+    /*
+     * Fetch the next batch of entries, with SET_COMMAND as operation.
+     * Returns false once the whole table has been read.
+     */
+    bool next(std::deque<KeyOpFieldsValuesTuple> &entries);
+
+    /*
+     * Fetch the given keys of the table, pipelining their HGETALL by batch.
+     * Keys which don't exist are skipped.
+     */
+    void read(const std::vector<std::string> &keys, std::deque<KeyOpFieldsValuesTuple> &entries);
+
+    /* Number of entries read so far */
+    size_t count() const { return m_count; }
+    /* Entries read per second since the reader was created */
+    double rate() const;
+
+private:
+    /* Dedicated connection, so pipelined replies never interleave with other users */
+    std::unique_ptr<DBConnector> m_db;
+    Table m_table;
+    std::string m_pattern;
+    size_t m_prefixLen;
+    size_t m_batchSize;
+
+    bool m_scanning = false;
+    bool m_fallback = false;
+    bool m_done = false;
+    std::string m_cursor = "0";
+    /* SCAN can return a key more than once */
+    std::unordered_set<std::string> m_seen;
+
+    /* Keys of the fallback mode and the position of the next batch in them */
+    std::vector<std::string> m_keys;
+    size_t m_keyIndex = 0;
+
+    size_t m_count = 0;
+    std::chrono::steady_clock::time_point m_start;
+
+    bool scan(std::vector<std::string> &keys);
+    void fetch(const std::vector<std::string> &keys, std::deque<KeyOpFieldsValuesTuple> &entries);
+    bool nextFallback(std::deque<KeyOpFieldsValuesTuple> &entries);
+};
+
+}
@@ -61,6 +61,12 @@ enum MCLAG_DOMAIN_CFG_ATTR_BMAP_FLAGS {
 #define MCLAG_MAX_MSG_LEN 4096
 #define MCLAG_MAX_SEND_MSG_LEN 4096
 
+/*
+ * FDB updates are sent to the MCLAG when the send buffer is full, or at most
+ * this long after the first update of the buffer.
+ */
+#define MCLAG_FDB_FLUSH_INTERVAL_MS 50
+
 typedef struct mclag_msg_hdr_t_ {
     /*
      * Protocol version.
@@ -61,58 +61,6 @@ void MclagLink::delVlanMbr(std::string vlan, std::string mbr_port)
 }
 
 
-void MclagLink::getOidToPortNameMap(std::unordered_map<std::string, std:: string> & port_map)
-{
-    auto hash = p_counters_db->hgetall("COUNTERS_PORT_NAME_MAP");
-
-    for (auto it = hash.begin(); it != hash.end(); ++it)
-        port_map.insert(pair<string, string>(it->second, it->first));
-
-    return;
-}
-
-void MclagLink::getBridgePortIdToAttrPortIdMap(std::map<std::string, std:: string> *oid_map)
-{
-    std::string bridge_port_id;
-    size_t pos1 = 0;
-
-    auto keys = p_asic_db->keys("ASIC_STATE:SAI_OBJECT_TYPE_BRIDGE_PORT:*");
-
-    for (auto& key : keys)
-    {
-        pos1 = key.find("oid:", 0);
-        bridge_port_id = key.substr(pos1);
-
-        auto hash = p_asic_db->hgetall(key);
-        auto attr_port_id = hash.find("SAI_BRIDGE_PORT_ATTR_PORT_ID");
-        if (attr_port_id == hash.end())
-        {
-            attr_port_id = hash.find("SAI_BRIDGE_PORT_ATTR_TUNNEL_ID");
-            if (attr_port_id == hash.end())
-                continue;
-        }
-
-        oid_map->insert(pair<string, string>(bridge_port_id, attr_port_id->second));
-    }
-
-    return;
-}
-
-void MclagLink::getVidByBvid(std::string &bvid, std::string &vlanid)
-{
-    std::string pre = "ASIC_STATE:SAI_OBJECT_TYPE_VLAN:";
-    std::string key = pre + bvid;
-
-    auto hash = p_asic_db->hgetall(key.c_str());
-
-    auto attr_vlan_id = hash.find("SAI_VLAN_ATTR_VLAN_ID");
-    if (attr_vlan_id == hash.end())
-        return;
-
-    vlanid = attr_vlan_id->second;
-    return;
-}
-
 void MclagLink::mclagsyncdFetchSystemMacFromConfigdb()
 {
     vector<FieldValueTuple> fvs; 
@@ -519,13 +467,7 @@ void MclagLink::setFdbEntry(char *msg, int msg_len)
 
 void MclagLink::mclagsyncdSendFdbEntries(std::deque<KeyOpFieldsValuesTuple> &entries)
 {
-    size_t infor_len = sizeof(mclag_msg_hdr_t);
     struct mclag_fdb_info info;
-    mclag_msg_hdr_t * msg_head = NULL;
-    int count = 0;
-    ssize_t write = 0;
-
-    char *infor_start = m_messageBuffer_send;
 
     /* Nothing popped */
     if (entries.empty())
@@ -536,7 +478,6 @@ void MclagLink::mclagsyncdSendFdbEntries(std::deque<KeyOpFieldsValuesTuple> &ent
     for (auto entry: entries)
     {
         memset(&info, 0, sizeof(struct mclag_fdb_info));
-        count++;
         std::string key = kfvKey(entry);
         std::string op = kfvOp(entry);
 
@@ -574,48 +515,54 @@ void MclagLink::mclagsyncdSendFdbEntries(std::deque<KeyOpFieldsValuesTuple> &ent
         SWSS_LOG_NOTICE("MCLAGSYNCD STATE FDB updates key=%s, operation=%s, type: %d, port: %s \n",
                 key.c_str(), op.c_str(), info.type, info.port_name);
 
-        if (MCLAG_MAX_SEND_MSG_LEN - infor_len < sizeof(struct mclag_fdb_info))
+        if (MCLAG_MAX_SEND_MSG_LEN - m_fdbBufferLen < sizeof(struct mclag_fdb_info))
         {
-            msg_head = reinterpret_cast<mclag_msg_hdr_t *>(static_cast<void *>(infor_start));
-            msg_head->version = 1;
-            msg_head->msg_len = (unsigned short)infor_len;
-            msg_head ->msg_type = MCLAG_SYNCD_MSG_TYPE_FDB_OPERATION;
-
-            SWSS_LOG_DEBUG("mclagsycnd buffer full send msg to iccpd, msg_len =%d, msg_type =%d count : %d",
-                    msg_head->msg_len, msg_head->msg_type, count);
-            write = ::write(m_connection_socket, infor_start, msg_head->msg_len);
-
-            if (write <= 0)
-            {
-                SWSS_LOG_ERROR("mclagsycnd update FDB to ICCPD Buffer full, write to m_connection_socket failed");
-            }
+            SWSS_LOG_DEBUG("mclagsycnd FDB buffer full");
+            mclagsyncdFlushFdbEntries();
+        }
 
-            infor_len = sizeof(mclag_msg_hdr_t);
-            count = 0;
+        /* The first update of the buffer starts the flush timer */
+        if (m_fdbCount == 0)
+        {
+            p_fdb_flush_timer->start();
         }
-        memcpy((char*)(infor_start + infor_len), (char*)&info, sizeof(struct mclag_fdb_info));
-        infor_len = infor_len +  sizeof(struct mclag_fdb_info);
+
+        memcpy((char*)(m_fdbBuffer_send + m_fdbBufferLen), (char*)&info, sizeof(struct mclag_fdb_info));
+        m_fdbBufferLen = m_fdbBufferLen +  sizeof(struct mclag_fdb_info);
+        m_fdbCount++;
     }
 
+    return;
+}
 
-    if (infor_len <= sizeof(mclag_msg_hdr_t)) /*no fdb entry need notifying iccpd*/
+void MclagLink::mclagsyncdFlushFdbEntries()
+{
+    mclag_msg_hdr_t * msg_head = NULL;
+    ssize_t write = 0;
+
+    if (m_fdbCount == 0) /*no fdb entry need notifying iccpd*/
         return;
 
-    msg_head = reinterpret_cast<mclag_msg_hdr_t *>(static_cast<void *>(infor_start));
+    p_fdb_flush_timer->stop();
+
+    msg_head = reinterpret_cast<mclag_msg_hdr_t *>(static_cast<void *>(m_fdbBuffer_send));
 
     msg_head->version = 1;
-    msg_head->msg_len = (unsigned short)infor_len;
+    msg_head->msg_len = (unsigned short)m_fdbBufferLen;
     msg_head ->msg_type = MCLAG_SYNCD_MSG_TYPE_FDB_OPERATION;
 
     SWSS_LOG_DEBUG("mclagsycnd send msg to iccpd, msg_len =%d, msg_type =%d count : %d",
-            msg_head->msg_len, msg_head->msg_type, count);
-    write = ::write(m_connection_socket, infor_start, msg_head->msg_len);
+            msg_head->msg_len, msg_head->msg_type, m_fdbCount);
+    write = ::write(m_connection_socket, m_fdbBuffer_send, msg_head->msg_len);
 
     if (write <= 0)
     {
         SWSS_LOG_ERROR("mclagsycnd update FDB to ICCPD, write to m_connection_socket failed");
     }
 
+    m_fdbBufferLen = sizeof(mclag_msg_hdr_t);
+    m_fdbCount = 0;
+
     return;
 }
 
@@ -639,6 +586,9 @@ void MclagLink::processMclagDomainCfg(std::deque<KeyOpFieldsValuesTuple> &entrie
         return;
     }
 
+    /* Keep the order of the buffered FDB updates and this update */
+    mclagsyncdFlushFdbEntries();
+
     MacAddress::parseMacString(m_system_mac, system_mac);
 
     for (auto entry: entries)
@@ -922,6 +872,9 @@ void MclagLink::addDomainCfgDependentSelectables()
     {
         m_select->addSelectable(p_state_fdb_tbl);
         SWSS_LOG_INFO(" MCLAGSYNCD Add state_fdb_tbl to selectable");
+
+        m_select->addSelectable(p_fdb_flush_timer.get());
+        SWSS_LOG_INFO(" MCLAGSYNCD Add fdb_flush_timer to selectable");
     }
 
 
@@ -966,6 +919,10 @@ void MclagLink::delDomainCfgDependentSelectables()
 
     if (p_state_fdb_tbl)
     {
+        mclagsyncdFlushFdbEntries();
+        m_select->removeSelectable(p_fdb_flush_timer.get());
+        SWSS_LOG_INFO(" MCLAGSYNCD remove fdb_flush_timer from selectable");
+
         m_select->removeSelectable(p_state_fdb_tbl);
         SWSS_LOG_INFO(" MCLAGSYNCD remove state_fdb_tbl from selectable");
         delete p_state_fdb_tbl;
@@ -1000,6 +957,9 @@ void MclagLink::mclagsyncdSendMclagIfaceCfg(std::deque<KeyOpFieldsValuesTuple> &
         return;
     }
 
+    /* Keep the order of the buffered FDB updates and this update */
+    mclagsyncdFlushFdbEntries();
+
     for (auto entry: entries)
     {
         std::string key = kfvKey(entry);
@@ -1098,6 +1058,9 @@ void MclagLink::mclagsyncdSendMclagUniqueIpCfg(std::deque<KeyOpFieldsValuesTuple
         return;
     }
 
+    /* Keep the order of the buffered FDB updates and this update */
+    mclagsyncdFlushFdbEntries();
+
     for (auto entry: entries)
     {
         std::string key = kfvKey(entry);
@@ -1193,6 +1156,9 @@ void MclagLink::processVlanMemberTableUpdates(std::deque<KeyOpFieldsValuesTuple>
         return;
     }
 
+    /* Keep the order of the buffered FDB updates and this update */
+    mclagsyncdFlushFdbEntries();
+
     for (auto entry: entries)
     {
         std::string key = kfvKey(entry);
@@ -1472,6 +1438,12 @@ void MclagLink::processStateFdb(SubscriberStateTable *stateFdbTbl)
     mclagsyncdSendFdbEntries(entries);
 }
 
+void MclagLink::processFdbFlushTimer()
+{
+    SWSS_LOG_INFO("MCLAGSYNCD: Flush FDB updates to iccpd");
+    mclagsyncdFlushFdbEntries();
+}
+
 void MclagLink::processStateVlanMember(SubscriberStateTable *stateVlanMemberTbl)
 {
     SWSS_LOG_INFO("MCLAGSYNCD: Process State Vlan Member events ");
@@ -1785,14 +1757,15 @@ MclagLink::MclagLink(Select *select, int port) :
     m_server_up = true;
     m_messageBuffer = new char[m_bufSize];
     m_messageBuffer_send = new char[MCLAG_MAX_SEND_MSG_LEN];
+    m_fdbBuffer_send = new char[MCLAG_MAX_SEND_MSG_LEN];
+    m_fdbBufferLen = sizeof(mclag_msg_hdr_t);
+    m_fdbCount = 0;
 
     p_learn = NULL;
 
     p_state_db    = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     p_appl_db     = unique_ptr<DBConnector>(new DBConnector("APPL_DB", 0));
     p_config_db   = unique_ptr<DBConnector>(new DBConnector("CONFIG_DB", 0));
-    p_asic_db     = unique_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
-    p_counters_db = unique_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     p_notificationsDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
 
     p_device_metadata_tbl          = unique_ptr<Table>(new Table(p_config_db.get(), CFG_DEVICE_METADATA_TABLE_NAME));
@@ -1816,12 +1789,16 @@ MclagLink::MclagLink(Select *select, int port) :
     p_state_vlan_mbr_subscriber_table = NULL;
     p_mclag_intf_cfg_tbl              = NULL;
     p_mclag_unique_ip_cfg_tbl         = NULL;
+
+    timespec fdb_flush_interval = { .tv_sec = 0, .tv_nsec = MCLAG_FDB_FLUSH_INTERVAL_MS * 1000000 };
+    p_fdb_flush_timer = unique_ptr<SelectableTimer>(new SelectableTimer(fdb_flush_interval));
 }
 
 MclagLink::~MclagLink()
 {
     delete[] m_messageBuffer;
     delete[] m_messageBuffer_send;
+    delete[] m_fdbBuffer_send;
     if (m_connected)
         close(m_connection_socket);
     if (m_server_up)
@@ -38,6 +38,7 @@
 
 #include "producerstatetable.h"
 #include "subscriberstatetable.h"
+#include "selectabletimer.h"
 #include "select.h"
 #include "selectable.h"
 #include "mclagsyncd/mclag.h"
@@ -199,6 +200,10 @@ namespace swss {
             char *m_messageBuffer_send;
             unsigned int m_pos;
 
+            char *m_fdbBuffer_send;
+            size_t m_fdbBufferLen;
+            int m_fdbCount;
+
             bool m_connected;
             bool m_server_up;
             int m_server_socket;
@@ -215,8 +220,6 @@ namespace swss {
             unique_ptr<DBConnector> p_state_db;
             unique_ptr<DBConnector> p_appl_db;
             unique_ptr<DBConnector> p_config_db;
-            unique_ptr<DBConnector> p_asic_db;
-            unique_ptr<DBConnector> p_counters_db;
             unique_ptr<DBConnector> p_notificationsDb;
 
             unique_ptr<Table> p_mclag_tbl;
@@ -240,6 +243,8 @@ namespace swss {
             SubscriberStateTable *p_state_fdb_tbl;
             SubscriberStateTable *p_state_vlan_mbr_subscriber_table;
 
+            unique_ptr<SelectableTimer> p_fdb_flush_timer;
+
             std::map<mclagDomainEntry, mclagDomainData> m_mclag_domains;
 
 
@@ -249,6 +254,7 @@ namespace swss {
             uint64_t readData() override; 
 
             void mclagsyncdSendFdbEntries(std::deque<KeyOpFieldsValuesTuple> &entries);
+            void mclagsyncdFlushFdbEntries();
 
 
             void mclagsyncdSetTrafficDisable(char *msg_buf, uint8_t msg_type);
@@ -266,9 +272,6 @@ namespace swss {
 
             void delDomainCfgDependentSelectables();
 
-            void getOidToPortNameMap(std::unordered_map<std::string, std:: string> & port_map);
-            void getBridgePortIdToAttrPortIdMap(std::map<std::string, std:: string> *oid_map);
-            void getVidByBvid(std::string &bvid, std::string &vlanid);
             void getFdbSet(std::set<mclag_fdb> *fdb_set);
             void setLocalIfPortIsolate(std::string mclag_if, bool is_enable);
             void deleteLocalIfPortIsolate(std::string mclag_if);
@@ -322,12 +325,18 @@ namespace swss {
                 return p_mclag_unique_ip_cfg_tbl;
             }
 
+            SelectableTimer *getFdbFlushTimer()
+            {
+                return p_fdb_flush_timer.get();
+            }
+
 
             void processMclagDomainCfg(std::deque<KeyOpFieldsValuesTuple> &entries);
             void processVlanMemberTableUpdates(std::deque<KeyOpFieldsValuesTuple> &entries);
 
             void processStateFdb(SubscriberStateTable *stateFdbTbl);
             void processStateVlanMember(SubscriberStateTable *stateVlanMemberTbl);
+            void processFdbFlushTimer();
 
             void mclagsyncdSendMclagIfaceCfg(std::deque<KeyOpFieldsValuesTuple> &entries);
             void mclagsyncdSendMclagUniqueIpCfg(std::deque<KeyOpFieldsValuesTuple> &entries);
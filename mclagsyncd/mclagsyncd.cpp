@@ -76,6 +76,10 @@ int main(int argc, char **argv)
                     SWSS_LOG_INFO(" MCLAGSYNCD Matching state_fdb_tbl selectable");
                     mclag.processStateFdb((SubscriberStateTable *)temps);
                 }
+                else if (temps == (Selectable *)mclag.getFdbFlushTimer())
+                {
+                    mclag.processFdbFlushTimer();
+                }
                 else if ( temps == (Selectable *)&mclag_cfg_tbl ) //Reading MCLAG Domain Config Table
                 {
                     SWSS_LOG_DEBUG("MCLAGSYNCD processing mclag_cfg_tbl notifications");
@@ -38,19 +38,25 @@ using namespace swss;
 #define CT_UDP_EXPIRY_TIMEOUT   600 /* Max conntrack timeout in the user configurable range */
 
 NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *stateDb, NfNetlink *nfnl) :
-    m_natTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptTable(appDb, APP_NAPT_TABLE_NAME),
-    m_natTwiceTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_naptTwiceTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-    m_natCheckTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptCheckTable(appDb, APP_NAPT_TABLE_NAME),
-    m_twiceNatCheckTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_twiceNaptCheckTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-    m_naptPoolCheckTable(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
+    m_natTable(pipelineAppDB, APP_NAT_TABLE_NAME, true),
+    m_naptTable(pipelineAppDB, APP_NAPT_TABLE_NAME, true),
+    m_natTwiceTable(pipelineAppDB, APP_NAT_TWICE_TABLE_NAME, true),
+    m_naptTwiceTable(pipelineAppDB, APP_NAPT_TWICE_TABLE_NAME, true),
+    m_natShadowTable(appDb, APP_NAT_TABLE_NAME),
+    m_naptShadowTable(appDb, APP_NAPT_TABLE_NAME),
+    m_twiceNatShadowTable(appDb, APP_NAT_TWICE_TABLE_NAME),
+    m_twiceNaptShadowTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
+    m_naptPoolShadowTable(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
     m_stateNatRestoreTable(stateDb, STATE_NAT_RESTORE_TABLE_NAME)
 {
     nfsock = nfnl;
 
+    /* Load the current content of the tables, the changes are then processed from the select loop */
+    for (auto table : getShadowTables())
+    {
+        processShadowTable(table);
+    }
+
     m_AppRestartAssist = new AppRestartAssist(pipelineAppDB, "natsyncd", "nat", DEFAULT_NATSYNC_WARMSTART_TIMER);
     if (m_AppRestartAssist)
     {
@@ -292,6 +298,68 @@ void NatSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
 }
 
+void NatSync::processShadowTable(SubscriberStateTable *table)
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    table->pops(entries);
+
+    for (const auto &entry: entries)
+    {
+        const string &key = kfvKey(entry);
+        bool isSet = (kfvOp(entry) == SET_COMMAND);
+
+        if (table == &m_naptPoolShadowTable)
+        {
+            if (isSet)
+            {
+                m_naptPoolIps.insert(key);
+            }
+            else
+            {
+                m_naptPoolIps.erase(key);
+            }
+            continue;
+        }
+
+        NatEntryCache &cache = (table == &m_natShadowTable)      ? m_natEntries :
+                               (table == &m_naptShadowTable)     ? m_naptEntries :
+                               (table == &m_twiceNatShadowTable) ? m_twiceNatEntries : m_twiceNaptEntries;
+
+        if (!isSet)
+        {
+            cache.erase(key);
+            continue;
+        }
+
+        bool isStatic = false;
+        for (const auto &fv : kfvFieldsValues(entry))
+        {
+            if ((fvField(fv) == "entry_type") && (fvValue(fv) == "static"))
+            {
+                isStatic = true;
+                break;
+            }
+        }
+        cache[key] = isStatic;
+    }
+
+    SWSS_LOG_INFO("Shadow of %s updated with %zu changes", table->getTableName().c_str(), entries.size());
+}
+
+bool NatSync::findEntry(const NatEntryCache &cache, const string &key, bool &isStatic)
+{
+    auto it = cache.find(key);
+
+    if (it == cache.end())
+    {
+        return false;
+    }
+    isStatic = it->second;
+    return true;
+}
+
 /* Conntrack notifications from the kernel don't have a flag to indicate if the
  * NAT is NAPT or basic NAT. The original L4 port and the translated L4 port may 
  * be the same and still can be the NAPT (can happen if the original L4 port is
@@ -302,9 +370,8 @@ void NatSync::onMsg(int nlmsg_type, struct nl_object *obj)
 bool NatSync::matchingSnaptPoolExists(const IpAddress &natIp)
 {
     string key             = natIp.to_string();
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptPoolCheckTable.get(key, values))
+    if (m_naptPoolIps.find(key) != m_naptPoolIps.end())
     {
         SWSS_LOG_INFO("Matching pool IP exists for NAT IP %s", key.c_str());
         return true;
@@ -317,9 +384,8 @@ bool NatSync::matchingSnaptEntryExists(const naptEntry &entry)
 {
     string key             = entry.orig_src_ip.to_string() + ":" + to_string(entry.orig_src_l4_port);
     string reverseEntryKey = entry.nat_src_ip.to_string() + ":" + to_string(entry.nat_src_l4_port);
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptCheckTable.get(key, values) || m_naptCheckTable.get(reverseEntryKey, values))
+    if (m_naptEntries.count(key) || m_naptEntries.count(reverseEntryKey))
     {
         SWSS_LOG_INFO("Matching SNAPT entry exists for key %s or reverse key %s",
                        key.c_str(), reverseEntryKey.c_str());
@@ -332,9 +398,8 @@ bool NatSync::matchingDnaptEntryExists(const naptEntry &entry)
 {
     string key             = entry.orig_dest_ip.to_string() + ":" + to_string(entry.orig_dst_l4_port);
     string reverseEntryKey = entry.nat_dest_ip.to_string() + ":" + to_string(entry.nat_dst_l4_port);
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptCheckTable.get(key, values) || m_naptCheckTable.get(reverseEntryKey, values))
+    if (m_naptEntries.count(key) || m_naptEntries.count(reverseEntryKey))
     {
         SWSS_LOG_INFO("Matching DNAPT entry exists for key %s or reverse key %s",
                        key.c_str(), reverseEntryKey.c_str());
@@ -400,25 +465,22 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
         string tmpKey             = key + entry.orig_src_ip.to_string() + ":" + entry.orig_dest_ip.to_string();
         string tmpReverseEntryKey = reverseEntryKey + entry.nat_dest_ip.to_string() + ":" + entry.nat_src_ip.to_string();
 
-        std::vector<FieldValueTuple> values;
-        if (m_twiceNatCheckTable.get(tmpKey, values))
+        bool isStatic = false;
+        if (findEntry(m_twiceNatEntries, tmpKey, isStatic))
         {
             src_port_natted = dst_port_natted = false;
 
-            for (auto iter : values)
+            /* If a matching Static Twice NAT entry exists in the APP_DB,
+             * it has higher priority than the dynamic twice nat entry. */
+            if (isStatic)
             {
-                /* If a matching Static Twice NAT entry exists in the APP_DB,
-                 * it has higher priority than the dynamic twice nat entry. */
-                if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
+                SWSS_LOG_INFO("Static Twice NAT %s: entry exists, not processing twice NAT entry notification", opStr.c_str());
+                if (m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    SWSS_LOG_INFO("Static Twice NAT %s: entry exists, not processing twice NAT entry notification", opStr.c_str());
-                    if (m_AppRestartAssist->isWarmStartInProgress())
-                    {
-                       m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpKey, fvVector, (!addFlag));
-                       m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpReverseEntryKey, reverseFvVector, (!addFlag));
-                    }
-                    return 1;
+                   m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpKey, fvVector, (!addFlag));
+                   m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpReverseEntryKey, reverseFvVector, (!addFlag));
                 }
+                return 1;
             }
             if (addFlag)
             {
@@ -446,23 +508,19 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
             reverseEntryKey += ":" + nat_dst_l4_port + ":" + entry.nat_src_ip.to_string()
                           + ":" + nat_src_l4_port;
 
-            std::vector<FieldValueTuple> values;
             /* If a matching Static Twice NAPT entry exists in the APP_DB,
              * it has higher priority than the dynamic twice napt entry. */
-            if (m_twiceNaptCheckTable.get(key, values))
+            if (findEntry(m_twiceNaptEntries, key, isStatic))
             {
-                for (auto iter : values)
+                if (isStatic)
                 {
-                    if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
+                    SWSS_LOG_INFO("Static Twice NAPT %s: entry exists, not processing dynamic twice NAPT entry", opStr.c_str());
+                    if (m_AppRestartAssist->isWarmStartInProgress())
                     {
-                        SWSS_LOG_INFO("Static Twice NAPT %s: entry exists, not processing dynamic twice NAPT entry", opStr.c_str());
-                        if (m_AppRestartAssist->isWarmStartInProgress())
-                        {
-                            m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, key, fvVector, (!addFlag));
-                            m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, reverseEntryKey, reverseFvVector, (!addFlag));
-                        }
-                        return 1;
+                        m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, key, fvVector, (!addFlag));
+                        m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, reverseEntryKey, reverseFvVector, (!addFlag));
                     }
+                    return 1;
                 }
                 if (addFlag)
                 {
@@ -587,23 +645,20 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += ":" + src_l4_port;
                 reverseEntryKey += ":" + nat_src_l4_port;
 
-                std::vector<FieldValueTuple> values;
+                bool isStatic = false;
                 /* We check for existence of reverse nat entry in the app-db because the same dnat static entry
                  * would be reported as snat entry from the kernel if a packet that is forwarded in the kernel
                  * is matched by the iptables rules corresponding to the dnat static entry */
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_naptCheckTable.get(key, values)))
+                    if ((entryExists = findEntry(m_naptEntries, key, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -626,17 +681,14 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             }
                         }
                     }
-                    if ((reverseEntryExists = m_naptCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = findEntry(m_naptEntries, reverseEntryKey, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAPT %s: static reverse entry exists, not processing dynamic NAPT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAPT %s: static reverse entry exists, not processing dynamic NAPT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -701,20 +753,17 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += entry.orig_src_ip.to_string();
                 reverseEntryKey += entry.nat_src_ip.to_string();
 
-                std::vector<FieldValueTuple> values;
+                bool isStatic = false;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_natCheckTable.get(key, values)))
+                    if ((entryExists = findEntry(m_natEntries, key, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -737,17 +786,14 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             }
                         }
                     }
-                    if ((reverseEntryExists = m_natCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = findEntry(m_natEntries, reverseEntryKey, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -829,20 +875,17 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += ":" + dst_l4_port;
                 reverseEntryKey += ":" + nat_dst_l4_port;
 
-                std::vector<FieldValueTuple> values;
+                bool isStatic = false;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_naptCheckTable.get(key, values)))
+                    if ((entryExists = findEntry(m_naptEntries, key, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -855,17 +898,14 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             SWSS_LOG_NOTICE("DNAPT entry with key %s deleted from APP_DB", key.c_str());
                         }
                      }
-                     if ((reverseEntryExists = m_naptCheckTable.get(reverseEntryKey, values)))
+                     if ((reverseEntryExists = findEntry(m_naptEntries, reverseEntryKey, isStatic)))
                      {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAPT %s: static reverse entry exists, not adding dynamic NAPT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAPT %s: static reverse entry exists, not adding dynamic NAPT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -909,20 +949,17 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += entry.orig_dest_ip.to_string();
                 reverseEntryKey += entry.nat_dest_ip.to_string();
 
-                std::vector<FieldValueTuple> values;
+                bool isStatic = false;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_natCheckTable.get(key, values)))
+                    if ((entryExists = findEntry(m_natEntries, key, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -935,17 +972,14 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             SWSS_LOG_NOTICE("DNAT entry with key %s deleted from APP_DB", key.c_str());
                         }
                     }
-                    if ((reverseEntryExists = m_natCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = findEntry(m_natEntries, reverseEntryKey, isStatic)))
                     {
-                        for (auto iter : values)
+                        if (isStatic)
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -19,6 +19,7 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
 #include "notificationproducer.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
@@ -27,6 +28,8 @@
 #include <linux/netfilter/nfnetlink_conntrack.h>
 #include <linux/netfilter/nf_conntrack_common.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
 
 // The timeout value (in seconds) for natsyncd reconcilation logic
 #define DEFAULT_NATSYNC_WARMSTART_TIMER 30
@@ -56,7 +59,21 @@ public:
         return m_AppRestartAssist;
     }
 
+    std::vector<SubscriberStateTable *> getShadowTables()
+    {
+        return { &m_natShadowTable, &m_naptShadowTable, &m_twiceNatShadowTable,
+                 &m_twiceNaptShadowTable, &m_naptPoolShadowTable };
+    }
+
+    /* Update the in-memory shadow from the changes of an APP_DB NAT table */
+    void processShadowTable(SubscriberStateTable *table);
+
 private:
+    /* Shadow of an APP_DB NAT table, maps the entry key to whether it is static */
+    typedef std::unordered_map<std::string, bool> NatEntryCache;
+
+    static bool findEntry(const NatEntryCache &cache, const std::string &key, bool &isStatic);
+
     static int  parseConnTrackMsg(const struct nfnl_ct *ct, struct naptEntry &entry);
     void        updateConnTrackEntry(struct nfnl_ct *ct);
     void        deleteConnTrackEntry(struct nfnl_ct *ct);
@@ -73,11 +90,18 @@ private:
     ProducerStateTable m_natTwiceTable;
     ProducerStateTable m_naptTwiceTable;
 
-    Table              m_natCheckTable;
-    Table              m_naptCheckTable;
-    Table              m_naptPoolCheckTable;
-    Table              m_twiceNatCheckTable;
-    Table              m_twiceNaptCheckTable;
+    /* The conntrack notifications are checked against the shadows instead of APP_DB */
+    SubscriberStateTable m_natShadowTable;
+    SubscriberStateTable m_naptShadowTable;
+    SubscriberStateTable m_twiceNatShadowTable;
+    SubscriberStateTable m_twiceNaptShadowTable;
+    SubscriberStateTable m_naptPoolShadowTable;
+
+    NatEntryCache      m_natEntries;
+    NatEntryCache      m_naptEntries;
+    NatEntryCache      m_twiceNatEntries;
+    NatEntryCache      m_twiceNaptEntries;
+    std::unordered_set<std::string> m_naptPoolIps;
 
     Table              m_stateNatRestoreTable;
     AppRestartAssist  *m_AppRestartAssist;
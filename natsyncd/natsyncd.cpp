@@ -71,10 +71,26 @@ int main(int argc, char **argv)
             nfnl.dumpRequest(IPCTNL_MSG_CT_GET);
 
             s.addSelectable(&nfnl);
+            auto shadowTables = sync.getShadowTables();
+            for (auto table : shadowTables)
+            {
+                s.addSelectable(table);
+            }
+
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                for (auto table : shadowTables)
+                {
+                    if (temps == (Selectable *)table)
+                    {
+                        sync.processShadowTable(table);
+                        break;
+                    }
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -87,6 +103,9 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* The APP_DB NAT tables are written through the pipeline, flush them once per select */
+                pipelineAppDB.flush();
             }
         }
         catch (const std::exception& e)
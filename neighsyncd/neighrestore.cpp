@@ -0,0 +1,514 @@
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/ip6.h>
+#include <netpacket/packet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/neighbour.h>
+
+#include "logger.h"
+#include "schema.h"
+#include "netlinkbatch.h"
+#include "tablereader.h"
+#include "neighrestore.h"
+
+using namespace std;
+using namespace swss;
+
+#define ETH_HDR_LEN     14
+#define ARP_PKT_LEN     28
+#define NS_PAYLOAD_LEN  (sizeof(struct nd_neighbor_solicit) + 8)
+
+/* Addresses of an interface used as source of the probes */
+struct IntfAddresses
+{
+    MacAddress mac;
+    bool hasMac = false;
+    bool hasV4 = false;
+    bool hasV6 = false;
+    IpAddress v4;
+    IpAddress v6;
+};
+
+/* Fetch the MAC and the first IPv4 and IPv6 addresses (link local included) of an interface */
+static IntfAddresses getIntfAddresses(const string &intf)
+{
+    IntfAddresses addrs;
+    struct ifaddrs *ifaddr = NULL;
+
+    if (getifaddrs(&ifaddr) == -1)
+    {
+        SWSS_LOG_ERROR("Failed to get interface addresses: %s", strerror(errno));
+        return addrs;
+    }
+
+    for (struct ifaddrs *ifa = ifaddr; ifa != NULL; ifa = ifa->ifa_next)
+    {
+        if (ifa->ifa_addr == NULL || intf != ifa->ifa_name)
+        {
+            continue;
+        }
+
+        int family = ifa->ifa_addr->sa_family;
+        if (family == AF_PACKET && !addrs.hasMac)
+        {
+            auto *sll = reinterpret_cast<struct sockaddr_ll *>(ifa->ifa_addr);
+            if (sll->sll_halen == ETHER_ADDR_LEN)
+            {
+                addrs.mac = MacAddress(sll->sll_addr);
+                addrs.hasMac = true;
+            }
+        }
+        else if (family == AF_INET && !addrs.hasV4)
+        {
+            ip_addr_t ip;
+            ip.family = AF_INET;
+            ip.ip_addr.ipv4_addr = reinterpret_cast<struct sockaddr_in *>(ifa->ifa_addr)->sin_addr.s_addr;
+            addrs.v4 = IpAddress(ip);
+            addrs.hasV4 = true;
+        }
+        else if (family == AF_INET6 && !addrs.hasV6)
+        {
+            ip_addr_t ip;
+            ip.family = AF_INET6;
+            memcpy(ip.ip_addr.ipv6_addr, &reinterpret_cast<struct sockaddr_in6 *>(ifa->ifa_addr)->sin6_addr, sizeof(ip.ip_addr.ipv6_addr));
+            addrs.v6 = IpAddress(ip);
+            addrs.hasV6 = true;
+        }
+    }
+
+    freeifaddrs(ifaddr);
+    return addrs;
+}
+
+static uint16_t checksum(const uint8_t *data, size_t len, uint32_t sum)
+{
+    for (size_t i = 0; i + 1 < len; i += 2)
+    {
+        sum += static_cast<uint32_t>((data[i] << 8) | data[i + 1]);
+    }
+    if (len & 1)
+    {
+        sum += static_cast<uint32_t>(data[len - 1] << 8);
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return static_cast<uint16_t>(~sum);
+}
+
+NeighRestore::NeighRestore(DBConnector *appDb, DBConnector *stateDb, uint32_t probeRate) :
+    m_appDb(appDb),
+    m_stateDb(stateDb),
+    m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
+    m_probeRate(probeRate ? probeRate : NEIGH_RESTORE_PROBE_RATE),
+    m_membersSettled(false)
+{
+    m_packetSock = socket(AF_PACKET, SOCK_RAW, 0);
+    if (m_packetSock < 0)
+    {
+        SWSS_LOG_ERROR("Failed to open packet socket, ARP/NS probes won't be sent: %s", strerror(errno));
+    }
+}
+
+NeighRestore::~NeighRestore()
+{
+    if (m_packetSock >= 0)
+    {
+        close(m_packetSock);
+    }
+}
+
+size_t NeighRestore::readNeighTable()
+{
+    SWSS_LOG_ENTER();
+
+    /* Key format: "<intf>:<ip>", fields "neigh" and "family" */
+    TableReader reader(m_appDb, APP_NEIGH_TABLE_NAME);
+    deque<KeyOpFieldsValuesTuple> entries;
+    size_t count = 0;
+
+    while (reader.next(entries))
+    {
+        for (const auto &entry : entries)
+        {
+            const string &key = kfvKey(entry);
+            size_t pos = key.find(':');
+            if (pos == string::npos)
+            {
+                SWSS_LOG_ERROR("Invalid neighbor key %s", key.c_str());
+                continue;
+            }
+
+            string intf = key.substr(0, pos);
+            if (intf == "lo")
+            {
+                continue;
+            }
+
+            string mac, family;
+            for (const auto &fv : kfvFieldsValues(entry))
+            {
+                if (fvField(fv) == "neigh")
+                {
+                    mac = fvValue(fv);
+                }
+                else if (fvField(fv) == "family")
+                {
+                    family = fvValue(fv);
+                }
+            }
+
+            if (mac.empty() || (family != IPV4_NAME && family != IPV6_NAME))
+            {
+                SWSS_LOG_ERROR("Invalid neighbor entry %s", key.c_str());
+                continue;
+            }
+
+            try
+            {
+                Neighbor neigh = { IpAddress(key.substr(pos + 1)), MacAddress(mac) };
+                auto &intfNeighbors = m_intfs[intf];
+                (neigh.ip.isV4() ? intfNeighbors.v4 : intfNeighbors.v6).push_back(neigh);
+                count++;
+            }
+            catch (const exception &e)
+            {
+                SWSS_LOG_ERROR("Invalid neighbor entry %s: %s", key.c_str(), e.what());
+            }
+        }
+    }
+
+    for (auto &it : m_intfs)
+    {
+        it.second.v4Done = it.second.v4.empty();
+        it.second.v6Done = it.second.v6.empty();
+    }
+
+    SWSS_LOG_NOTICE("Read %zu neighbors on %zu interfaces", count, m_intfs.size());
+    return count;
+}
+
+bool NeighRestore::hasMembers(const string &table, const string &intf)
+{
+    auto keys = m_stateDb->keys(table + "|" + intf + "|*");
+    if (keys.empty())
+    {
+        SWSS_LOG_INFO("Members of %s are not yet created", intf.c_str());
+        return false;
+    }
+
+    /* Give the members of the first VLAN or LAG some time to be programmed */
+    if (!m_membersSettled)
+    {
+        this_thread::sleep_for(chrono::seconds(NEIGH_RESTORE_MEMBER_SETTLE_TIME));
+        m_membersSettled = true;
+    }
+
+    return true;
+}
+
+bool NeighRestore::isIntfUp(const string &intf)
+{
+    ifstream carrier("/sys/class/net/" + intf + "/carrier");
+    string state;
+
+    if (!carrier.is_open() || !getline(carrier, state) || state != "1")
+    {
+        return false;
+    }
+
+    if (!intf.compare(0, strlen("Vlan"), "Vlan"))
+    {
+        return hasMembers(STATE_VLAN_MEMBER_TABLE_NAME, intf);
+    }
+    if (!intf.compare(0, strlen("PortChannel"), "PortChannel"))
+    {
+        return hasMembers(STATE_LAG_MEMBER_TABLE_NAME, intf);
+    }
+
+    return true;
+}
+
+void NeighRestore::installNeighbors(const string &intf, const vector<Neighbor> &neighbors, IntfNeighbors &counters)
+{
+    NetlinkBatch batch;
+
+    /*
+     * Neighbors are added as STALE, so the ones which answer the probe become REACHABLE
+     * and the others age out. Existing neighbors are not overwritten.
+     */
+    for (const auto &neigh : neighbors)
+    {
+        batch.addNeighbor(intf, neigh.ip, neigh.mac, NUD_STALE);
+    }
+    batch.commit();
+
+    const auto &results = batch.results();
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (results[i] == 0)
+        {
+            counters.installed++;
+        }
+        else if (results[i] == EEXIST)
+        {
+            counters.existing++;
+        }
+        else
+        {
+            counters.failed++;
+            SWSS_LOG_ERROR("Failed to add neighbor %s on %s: %s", neighbors[i].ip.to_string().c_str(),
+                           intf.c_str(), strerror(results[i]));
+        }
+    }
+}
+
+void NeighRestore::restoreIntf(const string &intf, IntfNeighbors &neighbors, vector<vector<Probe>> &probes)
+{
+    IntfAddresses addrs = getIntfAddresses(intf);
+    int ifindex = static_cast<int>(if_nametoindex(intf.c_str()));
+    if (!addrs.hasMac || ifindex == 0)
+    {
+        return;
+    }
+
+    vector<Probe> intfProbes;
+
+    /* A family is restored once the interface has an address of the family */
+    if (!neighbors.v4Done && addrs.hasV4)
+    {
+        installNeighbors(intf, neighbors.v4, neighbors);
+        for (const auto &neigh : neighbors.v4)
+        {
+            intfProbes.push_back({ ifindex, buildArpRequest(addrs.mac, addrs.v4, neigh.ip), &neighbors });
+        }
+        neighbors.v4Done = true;
+    }
+
+    if (!neighbors.v6Done && addrs.hasV6)
+    {
+        installNeighbors(intf, neighbors.v6, neighbors);
+        for (const auto &neigh : neighbors.v6)
+        {
+            intfProbes.push_back({ ifindex, buildNeighSolicitation(addrs.mac, addrs.v6, neigh.ip), &neighbors });
+        }
+        neighbors.v6Done = true;
+    }
+
+    if (!intfProbes.empty())
+    {
+        probes.push_back(move(intfProbes));
+    }
+}
+
+void NeighRestore::sendProbes(vector<vector<Probe>> &probes)
+{
+    if (m_packetSock < 0)
+    {
+        return;
+    }
+
+    /* Interleave the interfaces, so a large VLAN doesn't delay the others */
+    auto interval = chrono::nanoseconds(1000000000 / m_probeRate);
+    auto next = chrono::steady_clock::now();
+    bool sent = true;
+
+    for (size_t round = 0; sent; round++)
+    {
+        sent = false;
+        for (auto &intfProbes : probes)
+        {
+            if (round >= intfProbes.size())
+            {
+                continue;
+            }
+            sent = true;
+
+            auto now = chrono::steady_clock::now();
+            if (now < next)
+            {
+                this_thread::sleep_until(next);
+                next += interval;
+            }
+            else
+            {
+                next = now + interval;
+            }
+
+            const Probe &probe = intfProbes[round];
+            struct sockaddr_ll sll;
+            memset(&sll, 0, sizeof(sll));
+            sll.sll_family = AF_PACKET;
+            sll.sll_ifindex = probe.ifindex;
+            sll.sll_halen = ETHER_ADDR_LEN;
+            memcpy(sll.sll_addr, probe.frame.data(), ETHER_ADDR_LEN);
+
+            if (sendto(m_packetSock, probe.frame.data(), probe.frame.size(), 0,
+                       reinterpret_cast<struct sockaddr *>(&sll), sizeof(sll)) < 0)
+            {
+                SWSS_LOG_INFO("Failed to send probe on ifindex %d: %s", probe.ifindex, strerror(errno));
+                continue;
+            }
+            probe.counters->probed++;
+        }
+    }
+}
+
+bool NeighRestore::restore(uint32_t timeout)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = chrono::steady_clock::now();
+    size_t pending = m_intfs.size();
+    bool done = (pending == 0);
+
+    while (!done)
+    {
+        vector<vector<Probe>> probes;
+
+        pending = 0;
+        for (auto &it : m_intfs)
+        {
+            auto &neighbors = it.second;
+            if (neighbors.v4Done && neighbors.v6Done)
+            {
+                continue;
+            }
+
+            /* Only restore to kernel when the link is up */
+            if (isIntfUp(it.first))
+            {
+                restoreIntf(it.first, neighbors, probes);
+            }
+
+            if (!neighbors.v4Done || !neighbors.v6Done)
+            {
+                pending++;
+            }
+        }
+
+        sendProbes(probes);
+
+        done = (pending == 0);
+        if (done || chrono::steady_clock::now() - start >= chrono::seconds(timeout))
+        {
+            break;
+        }
+        this_thread::sleep_for(chrono::seconds(NEIGH_RESTORE_CHECK_INTERVAL));
+    }
+
+    double duration = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (const auto &it : m_intfs)
+    {
+        const auto &neighbors = it.second;
+        SWSS_LOG_NOTICE("Neighbor restore on %s: %zu neighbors, %zu installed, %zu existing, %zu failed, %zu probed%s",
+                        it.first.c_str(), neighbors.v4.size() + neighbors.v6.size(), neighbors.installed,
+                        neighbors.existing, neighbors.failed, neighbors.probed,
+                        (neighbors.v4Done && neighbors.v6Done) ? "" : ", not restored");
+    }
+
+    if (!done)
+    {
+        SWSS_LOG_ERROR("Neighbor restore timed out after %.1f seconds, %zu interfaces not restored", duration, pending);
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("Neighbor restore of %zu interfaces done in %.1f seconds", m_intfs.size(), duration);
+    return true;
+}
+
+void NeighRestore::setRestoreDone()
+{
+    m_stateNeighRestoreTable.hset("Flags", "restored", "true");
+}
+
+vector<uint8_t> NeighRestore::buildArpRequest(const MacAddress &srcMac, const IpAddress &srcIp, const IpAddress &dstIp)
+{
+    vector<uint8_t> frame(ETH_HDR_LEN + ARP_PKT_LEN, 0);
+    uint8_t *p = frame.data();
+    uint32_t spa = srcIp.getV4Addr();
+    uint32_t tpa = dstIp.getV4Addr();
+
+    /* Ethernet header, broadcast */
+    memset(p, 0xff, ETHER_ADDR_LEN);
+    memcpy(p + 6, srcMac.getMac(), ETHER_ADDR_LEN);
+    p[12] = 0x08;
+    p[13] = 0x06;
+    p += ETH_HDR_LEN;
+
+    /* ARP who-has: Ethernet/IPv4, request */
+    p[1] = 0x01;
+    p[2] = 0x08;
+    p[4] = ETHER_ADDR_LEN;
+    p[5] = 4;
+    p[7] = 0x01;
+    memcpy(p + 8, srcMac.getMac(), ETHER_ADDR_LEN);
+    memcpy(p + 14, &spa, 4);
+    memcpy(p + 24, &tpa, 4);
+
+    return frame;
+}
+
+vector<uint8_t> NeighRestore::buildNeighSolicitation(const MacAddress &srcMac, const IpAddress &srcIp, const IpAddress &dstIp)
+{
+    vector<uint8_t> frame(ETH_HDR_LEN + sizeof(struct ip6_hdr) + NS_PAYLOAD_LEN, 0);
+    /* getIp() returns a copy, keep it alive while pointing into it */
+    const ip_addr_t dstAddr = dstIp.getIp();
+    const ip_addr_t srcAddr = srcIp.getIp();
+    const uint8_t *target = dstAddr.ip_addr.ipv6_addr;
+    const uint8_t *src = srcAddr.ip_addr.ipv6_addr;
+
+    /* Solicited-node multicast address ff02::1:ffXX:XXXX and its MAC 33:33:ff:XX:XX:XX */
+    uint8_t mcastIp[16] = { 0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0xff, target[13], target[14], target[15] };
+    uint8_t mcastMac[ETHER_ADDR_LEN] = { 0x33, 0x33, 0xff, target[13], target[14], target[15] };
+
+    uint8_t *p = frame.data();
+    memcpy(p, mcastMac, ETHER_ADDR_LEN);
+    memcpy(p + 6, srcMac.getMac(), ETHER_ADDR_LEN);
+    p[12] = 0x86;
+    p[13] = 0xdd;
+    p += ETH_HDR_LEN;
+
+    auto *ip6 = reinterpret_cast<struct ip6_hdr *>(p);
+    ip6->ip6_flow = htonl(6 << 28);
+    ip6->ip6_plen = htons(NS_PAYLOAD_LEN);
+    ip6->ip6_nxt = IPPROTO_ICMPV6;
+    ip6->ip6_hlim = 255;
+    memcpy(&ip6->ip6_src, src, 16);
+    memcpy(&ip6->ip6_dst, mcastIp, 16);
+    p += sizeof(struct ip6_hdr);
+
+    auto *ns = reinterpret_cast<struct nd_neighbor_solicit *>(p);
+    ns->nd_ns_type = ND_NEIGHBOR_SOLICIT;
+    memcpy(&ns->nd_ns_target, target, 16);
+
+    /* Source link-layer address option */
+    uint8_t *opt = p + sizeof(struct nd_neighbor_solicit);
+    opt[0] = ND_OPT_SOURCE_LINKADDR;
+    opt[1] = 1;
+    memcpy(opt + 2, srcMac.getMac(), ETHER_ADDR_LEN);
+
+    /* Checksum over the pseudo header and the ICMPv6 message */
+    uint32_t sum = 0;
+    for (int i = 0; i < 16; i += 2)
+    {
+        sum += static_cast<uint32_t>((src[i] << 8) | src[i + 1]);
+        sum += static_cast<uint32_t>((mcastIp[i] << 8) | mcastIp[i + 1]);
+    }
+    sum += static_cast<uint32_t>(NS_PAYLOAD_LEN);
+    sum += IPPROTO_ICMPV6;
+    ns->nd_ns_cksum = htons(checksum(p, NS_PAYLOAD_LEN, sum));
+
+    return frame;
+}
@@ -0,0 +1,103 @@
+#ifndef __NEIGHRESTORE__
+#define __NEIGHRESTORE__
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "dbconnector.h"
+#include "table.h"
+#include "ipaddress.h"
+#include "macaddress.h"
+
+/*
+ * Timeout (in seconds) of the restore, mostly to wait for interfaces to be created and up
+ * after system warm-reboot. Shorter than RESTORE_NEIGH_WAIT_TIME_OUT of neighsyncd.
+ */
+#define NEIGH_RESTORE_TIME_OUT 110
+
+// Interval (in seconds) of checking the state of interfaces
+#define NEIGH_RESTORE_CHECK_INTERVAL 5
+
+// Wait time (in seconds) after the members of the first VLAN or LAG are created
+#define NEIGH_RESTORE_MEMBER_SETTLE_TIME 15
+
+// Default rate (packets per second) of ARP/NS probes, across all interfaces
+#define NEIGH_RESTORE_PROBE_RATE 2000
+
+namespace swss {
+
+/*
+ * NeighRestore restores the neighbor table saved in APPL_DB into the kernel during
+ * system warm reboot, replacing restore_neighbors.py.
+ *
+ * Once an interface is operationally up and has an address of a family, all the
+ * neighbors of this family are installed as STALE with a batch of rtnetlink
+ * requests. An ARP request or neighbor solicitation is then sent to each of them,
+ * so the active ones become REACHABLE and the others age out. Probes of all the
+ * ready interfaces are interleaved and sent from a raw socket at a limited rate.
+ */
+class NeighRestore
+{
+public:
+    NeighRestore(DBConnector *appDb, DBConnector *stateDb, uint32_t probeRate = NEIGH_RESTORE_PROBE_RATE);
+    ~NeighRestore();
+
+    /* Restore all the neighbors, or until the timeout expires. Returns false on timeout. */
+    bool restore(uint32_t timeout = NEIGH_RESTORE_TIME_OUT);
+
+    /* Set the STATE_DB flag checked by neighsyncd before its reconciliation */
+    void setRestoreDone();
+
+    /* Read NEIGH_TABLE, returns the number of neighbors to restore */
+    size_t readNeighTable();
+
+private:
+    struct Neighbor
+    {
+        IpAddress ip;
+        MacAddress mac;
+    };
+
+    struct IntfNeighbors
+    {
+        std::vector<Neighbor> v4;
+        std::vector<Neighbor> v6;
+        bool v4Done = false;
+        bool v6Done = false;
+
+        size_t installed = 0;
+        size_t existing = 0;
+        size_t failed = 0;
+        size_t probed = 0;
+    };
+
+    struct Probe
+    {
+        int ifindex;
+        std::vector<uint8_t> frame;
+        IntfNeighbors *counters;
+    };
+
+    DBConnector *m_appDb;
+    DBConnector *m_stateDb;
+    Table m_stateNeighRestoreTable;
+    uint32_t m_probeRate;
+    int m_packetSock;
+    bool m_membersSettled;
+
+    std::map<std::string, IntfNeighbors> m_intfs;
+
+    bool isIntfUp(const std::string &intf);
+    bool hasMembers(const std::string &table, const std::string &intf);
+    void restoreIntf(const std::string &intf, IntfNeighbors &neighbors, std::vector<std::vector<Probe>> &probes);
+    void installNeighbors(const std::string &intf, const std::vector<Neighbor> &neighbors, IntfNeighbors &counters);
+    void sendProbes(std::vector<std::vector<Probe>> &probes);
+
+    static std::vector<uint8_t> buildArpRequest(const MacAddress &srcMac, const IpAddress &srcIp, const IpAddress &dstIp);
+    static std::vector<uint8_t> buildNeighSolicitation(const MacAddress &srcMac, const IpAddress &srcIp, const IpAddress &dstIp);
+};
+
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include <string>
+#include <inttypes.h>
 #include <netinet/in.h>
 #include <netlink/route/link.h>
 #include <netlink/route/neighbour.h>
@@ -19,18 +20,25 @@ using namespace std;
 using namespace swss;
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
-    m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
-    m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
+    m_cfgPeerSwitchTable(cfgDb, CFG_PEER_SWITCH_TABLE_NAME),
     m_cfgVlanInterfaceTable(cfgDb, CFG_VLAN_INTF_TABLE_NAME),
-    m_cfgPeerSwitchTable(cfgDb, CFG_PEER_SWITCH_TABLE_NAME)
+    m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
+    m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
+    m_lastReport(chrono::steady_clock::now())
 {
     m_AppRestartAssist = new AppRestartAssist(pipelineAppDB, "neighsyncd", "swss", DEFAULT_NEIGHSYNC_WARMSTART_TIMER);
     if (m_AppRestartAssist)
     {
         m_AppRestartAssist->registerAppTable(APP_NEIGH_TABLE_NAME, &m_neighTable);
     }
+
+    /* Load the existing configuration before the first netlink message is handled */
+    for (auto table : getCfgTables())
+    {
+        processCfgTable(table);
+    }
 }
 
 NeighSync::~NeighSync()
@@ -63,14 +71,14 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
         return;
 
+    countEvent();
+
     if (rtnl_neigh_get_family(neigh) == AF_INET)
         family = IPV4_NAME;
     else if (rtnl_neigh_get_family(neigh) == AF_INET6)
@@ -178,49 +186,80 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
 }
 
-/* To check the ipv6 link local is enabled on a given port */
-bool NeighSync::isLinkLocalEnabled(const string &port)
+void NeighSync::processCfgTable(SubscriberStateTable *table)
 {
-    vector<FieldValueTuple> values;
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    table->pops(entries);
 
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
+    for (const auto &entry: entries)
     {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
+        const string &key = kfvKey(entry);
+        bool isSet = (kfvOp(entry) == SET_COMMAND);
+
+        if (table == &m_cfgPeerSwitchTable)
         {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
+            if (isSet)
+            {
+                m_peerSwitches.insert(key);
+            }
+            else
+            {
+                m_peerSwitches.erase(key);
+            }
+            SWSS_LOG_NOTICE("Peer switch %s %s, dualtor %s", key.c_str(), isSet ? "set" : "removed",
+                            m_peerSwitches.empty() ? "disabled" : "enabled");
+            continue;
         }
-    }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
-    {
-        if (!m_cfgLagInterfaceTable.get(port, values))
+
+        /* Only the interface entry has the ipv6_use_link_local_only attribute, not the IP entries */
+        if (key.find(table->getTableNameSeparator()) != string::npos)
         {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
+            continue;
         }
-    }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
-    {
-        if (!m_cfgInterfaceTable.get(port, values))
+
+        const auto &values = kfvFieldsValues(entry);
+        auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
+        if (isSet && it != values.end() && it->second == "enable")
+        {
+            m_linkLocalOnlyIntfs.insert(key);
+        }
+        else
         {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
+            m_linkLocalOnlyIntfs.erase(key);
         }
     }
-    else
+}
+
+void NeighSync::countEvent()
+{
+    m_eventCount++;
+
+    auto now = chrono::steady_clock::now();
+    double seconds = chrono::duration<double>(now - m_lastReport).count();
+    if (seconds >= NEIGHSYNC_EVENT_RATE_INTERVAL)
+    {
+        SWSS_LOG_NOTICE("Processed %" PRIu64 " neighbor events, %.0f events/s",
+                        m_eventCount, (double)(m_eventCount - m_reportedEventCount) / seconds);
+        m_reportedEventCount = m_eventCount;
+        m_lastReport = now;
+    }
+}
+
+/* To check the ipv6 link local is enabled on a given port */
+bool NeighSync::isLinkLocalEnabled(const string &port)
+{
+    if (port.compare(0, strlen("Vlan"), "Vlan") &&
+        port.compare(0, strlen("PortChannel"), "PortChannel") &&
+        port.compare(0, strlen("Ethernet"), "Ethernet"))
     {
         SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    if (m_linkLocalOnlyIntfs.find(port) != m_linkLocalOnlyIntfs.end())
     {
-        if (it->second == "enable")
-        {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
-        }
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
@@ -1,8 +1,13 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <chrono>
+#include <set>
+#include <vector>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
@@ -11,11 +16,14 @@
 
 /*
  * This is the timer value (in seconds) that the neighsyncd waits for restore_neighbors
- * service to finish, should be longer than the restore_neighbors timeout value (110)
+ * service to finish, should be longer than the restore_neighbors timeout value (NEIGH_RESTORE_TIME_OUT)
  * This should not happen, if happens, system is in a unknown state, we should exit.
  */
 #define RESTORE_NEIGH_WAIT_TIME_OUT 180
 
+// Interval (in seconds) of logging the rate of processed neighbor events
+#define NEIGHSYNC_EVENT_RATE_INTERVAL 60
+
 namespace swss {
 
 class NeighSync : public NetMsg
@@ -35,13 +43,36 @@ public:
         return m_AppRestartAssist;
     }
 
+    /* CONFIG_DB tables whose content is cached, to be added to the Select */
+    std::vector<SubscriberStateTable *> getCfgTables()
+    {
+        return { &m_cfgPeerSwitchTable, &m_cfgInterfaceTable, &m_cfgLagInterfaceTable, &m_cfgVlanInterfaceTable };
+    }
+
+    void processCfgTable(SubscriberStateTable *table);
+
+    uint64_t getEventCount() const
+    {
+        return m_eventCount;
+    }
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable;
+    Table m_stateNeighRestoreTable;
     ProducerStateTable m_neighTable;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberStateTable m_cfgPeerSwitchTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+
+    /* Cached CONFIG_DB state, so netlink messages are handled without any database read */
+    std::set<std::string> m_peerSwitches;
+    std::set<std::string> m_linkLocalOnlyIntfs;
+
+    uint64_t m_eventCount = 0;
+    uint64_t m_reportedEventCount = 0;
+    std::chrono::steady_clock::time_point m_lastReport;
 
     bool isLinkLocalEnabled(const std::string &port);
+    void countEvent();
 };
 
 }
@@ -67,10 +67,26 @@ int main(int argc, char **argv)
             netlink.dumpRequest(RTM_GETNEIGH);
 
             s.addSelectable(&netlink);
+            auto cfgTables = sync.getCfgTables();
+            for (auto table : cfgTables)
+            {
+                s.addSelectable(table);
+            }
+
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                for (auto table : cfgTables)
+                {
+                    if (temps == (Selectable *)table)
+                    {
+                        sync.processCfgTable(table);
+                        break;
+                    }
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -0,0 +1,95 @@
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+#include "logger.h"
+#include "dbconnector.h"
+#include "warm_restart.h"
+#include "netlinkbatch.h"
+#include "neighsyncd/neighrestore.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+    cout << "Usage: restore_neighbors [-r probe_rate] [-t timeout]" << endl;
+    cout << "       probe_rate: ARP/NS probes sent per second, default " << NEIGH_RESTORE_PROBE_RATE << endl;
+    cout << "       timeout: seconds to wait for the interfaces, default " << NEIGH_RESTORE_TIME_OUT << endl;
+}
+
+/*
+ * Restore the neighbor table into kernel during system warm reboot, then set the
+ * STATE_DB flag so neighsyncd can start its reconciliation.
+ */
+int main(int argc, char **argv)
+{
+    Logger::linkToDbNative("restore_neighbors");
+
+    uint32_t probeRate = NEIGH_RESTORE_PROBE_RATE;
+    uint32_t timeout = NEIGH_RESTORE_TIME_OUT;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:t:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            probeRate = static_cast<uint32_t>(atoi(optarg));
+            break;
+        case 't':
+            timeout = static_cast<uint32_t>(atoi(optarg));
+            break;
+        case 'h':
+            usage();
+            return EXIT_SUCCESS;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    SWSS_LOG_NOTICE("restore_neighbors service is started");
+
+    WarmStart::initialize("neighsyncd", "swss");
+    WarmStart::checkWarmStart("neighsyncd", "swss", false);
+
+    if (!WarmStart::isWarmStart())
+    {
+        SWSS_LOG_NOTICE("restore_neighbors service is skipped as warm restart not enabled");
+        return EXIT_SUCCESS;
+    }
+
+    try
+    {
+        DBConnector appDb("APPL_DB", 0);
+        DBConnector stateDb("STATE_DB", 0);
+        NeighRestore restore(&appDb, &stateDb, probeRate);
+
+        /* swss restart, not system warm reboot, the neighbors are still in kernel */
+        if (!WarmStart::isSystemWarmRebootEnabled())
+        {
+            restore.setRestoreDone();
+            SWSS_LOG_NOTICE("restore_neighbors service is done as system warm reboot not enabled");
+            return EXIT_SUCCESS;
+        }
+
+        if (!NetlinkBatch::enable())
+        {
+            SWSS_LOG_ERROR("Failed to open netlink socket, neighbors can't be restored");
+            return EXIT_FAILURE;
+        }
+
+        restore.readNeighTable();
+        restore.restore(timeout);
+
+        restore.setRestoreDone();
+        SWSS_LOG_NOTICE("restore_neighbors service is done for system warm reboot");
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Runtime error: %s", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
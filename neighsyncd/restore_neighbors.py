@@ -12,6 +12,7 @@ Description: restore_neighbors.py -- restoring neighbor table into kernel during
     reconciliation process.
 """
 
+import os
 import sys
 import netifaces
 import time
@@ -56,6 +57,9 @@ DEF_TIME_OUT = 110
 # every 5 seconds to check interfaces states
 CHECK_INTERVAL = 5
 
+# native implementation, which batches the kernel updates and the probes
+NATIVE_RESTORE = '/usr/bin/restore_neighbors'
+
 ip_family = {"IPv4": AF_INET, "IPv6": AF_INET6}
 
 # return the first ipv4/ipv6 address assigned on intf
@@ -277,6 +281,9 @@ def restore_update_kernel_neighbors(intf_neigh_map, timeout=DEF_TIME_OUT):
 
 def main():
 
+    if os.access(NATIVE_RESTORE, os.X_OK):
+        os.execv(NATIVE_RESTORE, [NATIVE_RESTORE])
+
     log_info ("restore_neighbors service is started")
     # Use warmstart python binding to check warmstart information
     warmstart = swsscommon.WarmStart()
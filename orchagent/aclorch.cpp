@@ -28,6 +28,7 @@ extern sai_switch_api_t* sai_switch_api;
 extern sai_object_id_t   gSwitchId;
 extern PortsOrch*        gPortsOrch;
 extern CrmOrch *gCrmOrch;
+extern size_t gMaxBulkSize;
 extern string gMySwitchType;
 
 #define MIN_VLAN_ID 1    // 0 is a reserved VLAN ID
@@ -1093,11 +1094,40 @@ bool AclRule::createRule()
     SWSS_LOG_ENTER();
 
     vector<sai_attribute_t> rule_attrs;
-    sai_object_id_t range_objects[2];
-    sai_object_list_t range_object_list = {0, range_objects};
+    sai_status_t status;
+
+    if (!getRuleAttrs(rule_attrs))
+    {
+        return false;
+    }
+
+    status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        {
+            SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
+            return true;
+        }
+        SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
+                m_id.c_str(), status);
+        AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
+        decreaseNextHopRefCount();
+    }
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
+    }
+
+    return (status == SAI_STATUS_SUCCESS);
+}
+
+bool AclRule::getRuleAttrs(vector<sai_attribute_t>& rule_attrs)
+{
+    SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
-    sai_status_t status;
 
     // store table oid this rule belongs to
     attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
@@ -1121,6 +1151,7 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
+    m_rangeOids.clear();
     if (!m_rangeConfig.empty())
     {
         for (const auto& rangeConfig: m_rangeConfig)
@@ -1131,17 +1162,18 @@ bool AclRule::createRule()
             if (!range)
             {
                 // release already created range if any
-                AclRange::remove(range_objects, range_object_list.count);
+                AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
                 return false;
             }
 
             m_ranges.push_back(range);
-            range_objects[range_object_list.count++] = range->getOid();
+            m_rangeOids.push_back(range->getOid());
         }
 
+        // the range list must outlive the attributes, it is stored in the rule
         attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
         attr.value.aclfield.enable = true;
-        attr.value.aclfield.data.objlist = range_object_list;
+        attr.value.aclfield.data.objlist = {(uint32_t)m_rangeOids.size(), m_rangeOids.data()};
         rule_attrs.push_back(attr);
     }
 
@@ -1159,26 +1191,7 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
-    status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
-        {
-            SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
-            return true;
-        }
-        SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
-                m_id.c_str(), status);
-        AclRange::remove(range_objects, range_object_list.count);
-        decreaseNextHopRefCount();
-    }
-
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
-    }
-
-    return (status == SAI_STATUS_SUCCESS);
+    return true;
 }
 
 void AclRule::decreaseNextHopRefCount()
@@ -1262,6 +1275,155 @@ bool AclRule::remove()
     return res;
 }
 
+bool AclRule::isBulkSupported() const
+{
+    return true;
+}
+
+bool AclRule::bulkCreateCounter(ObjectBulker<sai_acl_api_t>& bulker)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_createCounter || m_counterOid != SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    auto counter_attrs = getCounterAttrs();
+    bulker.create_entry(&m_counterOid, (uint32_t)counter_attrs.size(), counter_attrs.data());
+
+    return true;
+}
+
+bool AclRule::bulkCreateRule(ObjectBulker<sai_acl_api_t>& bulker)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_createCounter && m_counterOid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_INFO("Counter for the rule %s in table %s is not created", m_id.c_str(), m_pTable->getId().c_str());
+        return false;
+    }
+
+    vector<sai_attribute_t> rule_attrs;
+    if (!getRuleAttrs(rule_attrs))
+    {
+        return false;
+    }
+
+    bulker.create_entry(&m_ruleOid, (uint32_t)rule_attrs.size(), rule_attrs.data());
+
+    return true;
+}
+
+bool AclRule::onBulkCreated(bool counterQueued, bool ruleQueued)
+{
+    SWSS_LOG_ENTER();
+
+    if (counterQueued && m_counterOid != SAI_NULL_OBJECT_ID)
+    {
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, m_pTable->getOid());
+    }
+
+    if (ruleQueued && m_ruleOid != SAI_NULL_OBJECT_ID)
+    {
+        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
+        return true;
+    }
+
+    // Roll back what the bulk created, the next hop references are kept
+    // since the rule is created again by create()
+    if (ruleQueued)
+    {
+        removeRanges();
+    }
+    removeCounter();
+
+    return false;
+}
+
+bool AclRule::bulkRemoveRule(ObjectBulker<sai_acl_api_t>& bulker, sai_status_t *status)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_ruleOid == SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    bulker.remove_entry(status, m_ruleOid);
+
+    return true;
+}
+
+bool AclRule::onBulkRuleRemoved(sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status == SAI_STATUS_ITEM_NOT_FOUND)
+    {
+        SWSS_LOG_NOTICE("ACL rule already deleted");
+        m_ruleOid = SAI_NULL_OBJECT_ID;
+        return true;
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_INFO("Failed to delete ACL rule %s in bulk, status %s", m_id.c_str(), sai_serialize_status(status).c_str());
+        return false;
+    }
+
+    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
+
+    m_ruleOid = SAI_NULL_OBJECT_ID;
+
+    decreaseNextHopRefCount();
+
+    return true;
+}
+
+bool AclRule::bulkRemoveCounter(ObjectBulker<sai_acl_api_t>& bulker, sai_status_t *status)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_counterOid == SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    bulker.remove_entry(status, m_counterOid);
+
+    return true;
+}
+
+bool AclRule::onBulkRemoved(bool counterQueued, sai_status_t counterStatus)
+{
+    SWSS_LOG_ENTER();
+
+    auto res = removeRanges();
+
+    if (!counterQueued)
+    {
+        return res;
+    }
+
+    if (counterStatus != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_INFO("Failed to remove ACL counter for rule %s in table %s in bulk, status %s",
+                m_id.c_str(), m_pTable->getId().c_str(), sai_serialize_status(counterStatus).c_str());
+        res &= removeCounter();
+        return res;
+    }
+
+    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, m_pTable->getOid());
+
+    m_counterOid = SAI_NULL_OBJECT_ID;
+
+    SWSS_LOG_INFO("Removed counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
+
+    return res;
+}
+
 void AclRule::updateInPorts()
 {
     SWSS_LOG_ENTER();
@@ -1711,24 +1873,12 @@ bool AclRule::createCounter()
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attr;
-    vector<sai_attribute_t> counter_attrs;
-
     if (m_counterOid != SAI_NULL_OBJECT_ID)
     {
         return true;
     }
 
-    attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
-    attr.value.oid = m_pTable->getOid();
-    counter_attrs.push_back(attr);
-
-    for (const auto& counterAttrPair: aclCounterLookup)
-    {
-        tie(attr.id, std::ignore) = counterAttrPair;
-        attr.value.booldata = true;
-        counter_attrs.push_back(attr);
-    }
+    auto counter_attrs = getCounterAttrs();
 
     if (sai_acl_api->create_acl_counter(&m_counterOid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data()) != SAI_STATUS_SUCCESS)
     {
@@ -1743,6 +1893,25 @@ bool AclRule::createCounter()
     return true;
 }
 
+vector<sai_attribute_t> AclRule::getCounterAttrs() const
+{
+    sai_attribute_t attr;
+    vector<sai_attribute_t> counter_attrs;
+
+    attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
+    attr.value.oid = m_pTable->getOid();
+    counter_attrs.push_back(attr);
+
+    for (const auto& counterAttrPair: aclCounterLookup)
+    {
+        tie(attr.id, std::ignore) = counterAttrPair;
+        attr.value.booldata = true;
+        counter_attrs.push_back(attr);
+    }
+
+    return counter_attrs;
+}
+
 bool AclRule::removeRanges()
 {
     SWSS_LOG_ENTER();
@@ -2016,6 +2185,11 @@ bool AclRuleMirror::removeRule()
     return deactivate();
 }
 
+bool AclRuleMirror::isBulkSupported() const
+{
+    return false;
+}
+
 bool AclRuleMirror::activate()
 {
     SWSS_LOG_ENTER();
@@ -2638,6 +2812,152 @@ bool AclTable::remove(string rule_id)
     }
 }
 
+void AclTable::bulkAdd(const vector<shared_ptr<AclRule>>& newRules, vector<bool>& created)
+{
+    SWSS_LOG_ENTER();
+
+    // If ACL rules already exist, delete them first
+    vector<string> existingIds;
+    for (const auto& newRule: newRules)
+    {
+        if (rules.find(newRule->getId()) != rules.end())
+        {
+            existingIds.push_back(newRule->getId());
+        }
+    }
+
+    if (!existingIds.empty())
+    {
+        vector<bool> removed;
+        bulkRemove(existingIds, removed);
+    }
+
+    // The counters are created first since the rules refer to them
+    ObjectBulker<sai_acl_api_t> counterBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_COUNTER);
+    ObjectBulker<sai_acl_api_t> ruleBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_ENTRY);
+    vector<bool> counterQueued(newRules.size());
+    vector<bool> ruleQueued(newRules.size());
+
+    for (size_t i = 0; i < newRules.size(); i++)
+    {
+        counterQueued[i] = newRules[i]->bulkCreateCounter(counterBulker);
+    }
+    counterBulker.flush();
+
+    for (size_t i = 0; i < newRules.size(); i++)
+    {
+        ruleQueued[i] = newRules[i]->bulkCreateRule(ruleBulker);
+    }
+    ruleBulker.flush();
+
+    created.assign(newRules.size(), false);
+    for (size_t i = 0; i < newRules.size(); i++)
+    {
+        const auto& newRule = newRules[i];
+        string rule_id = newRule->getId();
+
+        created[i] = newRule->onBulkCreated(counterQueued[i], ruleQueued[i]);
+        if (!created[i])
+        {
+            SWSS_LOG_INFO("Failed to create ACL rule %s in table %s in bulk, creating it alone",
+                    rule_id.c_str(), id.c_str());
+            created[i] = newRule->create();
+        }
+
+        if (created[i])
+        {
+            rules[rule_id] = newRule;
+            SWSS_LOG_NOTICE("Successfully created ACL rule %s in table %s",
+                    rule_id.c_str(), id.c_str());
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule_id.c_str(), id.c_str());
+        }
+    }
+}
+
+void AclTable::bulkRemove(const vector<string>& ruleIds, vector<bool>& removed)
+{
+    SWSS_LOG_ENTER();
+
+    ObjectBulker<sai_acl_api_t> ruleBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_ENTRY);
+    ObjectBulker<sai_acl_api_t> counterBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_COUNTER);
+    vector<shared_ptr<AclRule>> toRemove(ruleIds.size());
+    vector<sai_status_t> ruleStatuses(ruleIds.size(), SAI_STATUS_SUCCESS);
+    vector<sai_status_t> counterStatuses(ruleIds.size(), SAI_STATUS_SUCCESS);
+    vector<bool> counterQueued(ruleIds.size());
+    vector<bool> ruleQueued(ruleIds.size());
+    vector<bool> bulked(ruleIds.size());
+
+    removed.assign(ruleIds.size(), true);
+
+    for (size_t i = 0; i < ruleIds.size(); i++)
+    {
+        auto ruleIter = rules.find(ruleIds[i]);
+        if (ruleIter == rules.end())
+        {
+            SWSS_LOG_WARN("Skip deleting unknown ACL rule %s in table %s",
+                    ruleIds[i].c_str(), id.c_str());
+            continue;
+        }
+
+        toRemove[i] = ruleIter->second;
+        if (toRemove[i]->isBulkSupported())
+        {
+            ruleQueued[i] = toRemove[i]->bulkRemoveRule(ruleBulker, &ruleStatuses[i]);
+        }
+    }
+    ruleBulker.flush();
+
+    // The counters are removed once the rules referring to them are removed
+    for (size_t i = 0; i < ruleIds.size(); i++)
+    {
+        if (!toRemove[i])
+        {
+            continue;
+        }
+
+        bulked[i] = toRemove[i]->isBulkSupported() &&
+                (!ruleQueued[i] || toRemove[i]->onBulkRuleRemoved(ruleStatuses[i]));
+        if (bulked[i])
+        {
+            counterQueued[i] = toRemove[i]->bulkRemoveCounter(counterBulker, &counterStatuses[i]);
+        }
+    }
+    counterBulker.flush();
+
+    for (size_t i = 0; i < ruleIds.size(); i++)
+    {
+        if (!toRemove[i])
+        {
+            continue;
+        }
+
+        if (bulked[i])
+        {
+            removed[i] = toRemove[i]->onBulkRemoved(counterQueued[i], counterStatuses[i]);
+        }
+        else
+        {
+            removed[i] = toRemove[i]->remove();
+        }
+
+        if (removed[i])
+        {
+            rules.erase(ruleIds[i]);
+            SWSS_LOG_NOTICE("Successfully deleted ACL rule %s in table %s",
+                    ruleIds[i].c_str(), id.c_str());
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to delete ACL rule %s in table %s",
+                    ruleIds[i].c_str(), id.c_str());
+        }
+    }
+}
+
 bool AclTable::updateRule(shared_ptr<AclRule> updatedRule)
 {
     SWSS_LOG_ENTER();
@@ -2810,6 +3130,11 @@ bool AclRuleDTelWatchListEntry::removeRule()
     return deactivate();
 }
 
+bool AclRuleDTelWatchListEntry::isBulkSupported() const
+{
+    return false;
+}
+
 bool AclRuleDTelWatchListEntry::activate()
 {
     SWSS_LOG_ENTER();
@@ -4521,6 +4846,10 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    // The rules supporting bulk are created and removed per table after the pass
+    map<sai_object_id_t, vector<AclRuleBulkEntry>> rulesToAdd;
+    map<sai_object_id_t, vector<AclRuleBulkEntry>> rulesToRemove;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -4581,7 +4910,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
-                return;
+                break;
             }
             bool bHasTCPFlag = false;
             bool bHasIPProtocol = false;
@@ -4665,7 +4994,12 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             // validate and create ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                if (newRule->isBulkSupported())
+                {
+                    rulesToAdd[table_oid].push_back({it, table_id, rule_id, newRule});
+                    it++;
+                }
+                else if (addAclRule(newRule, table_id))
                 {
                     setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
                     it = consumer.m_toSync.erase(it);
@@ -4686,7 +5020,13 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
         }
         else if (op == DEL_COMMAND)
         {
-            if (removeAclRule(table_id, rule_id))
+            auto rule = getAclRule(table_id, rule_id);
+            if (rule && rule->isBulkSupported())
+            {
+                rulesToRemove[getTableById(table_id)].push_back({it, table_id, rule_id, nullptr});
+                it++;
+            }
+            else if (removeAclRule(table_id, rule_id))
             {
                 removeAclRuleStatus(table_id, rule_id);
                 it = consumer.m_toSync.erase(it);
@@ -4704,6 +5044,98 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    // A rule may be both removed and created again, remove first
+    for (const auto& tableRules: rulesToRemove)
+    {
+        bulkRemoveAclRules(consumer, tableRules.first, tableRules.second);
+    }
+
+    for (const auto& tableRules: rulesToAdd)
+    {
+        bulkAddAclRules(consumer, tableRules.first, tableRules.second);
+    }
+}
+
+void AclOrch::bulkAddAclRules(Consumer &consumer, sai_object_id_t table_oid, const vector<AclRuleBulkEntry>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    auto& aclTable = m_AclTables[table_oid];
+    vector<shared_ptr<AclRule>> newRules;
+    vector<bool> created;
+
+    for (const auto& entry: entries)
+    {
+        // The counter of a rule being overwritten is not polled anymore
+        auto ruleIter = aclTable.rules.find(entry.rule_id);
+        if (ruleIter != aclTable.rules.end() && ruleIter->second->hasCounter())
+        {
+            deregisterFlexCounter(*ruleIter->second);
+        }
+
+        newRules.push_back(entry.rule);
+    }
+
+    aclTable.bulkAdd(newRules, created);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const auto& entry = entries[i];
+
+        if (created[i])
+        {
+            if (entry.rule->hasCounter())
+            {
+                registerFlexCounter(*entry.rule);
+            }
+
+            setAclRuleStatus(entry.table_id, entry.rule_id, AclObjectStatus::ACTIVE);
+            consumer.m_toSync.erase(entry.it);
+        }
+        else
+        {
+            setAclRuleStatus(entry.table_id, entry.rule_id, AclObjectStatus::PENDING_CREATION);
+        }
+    }
+}
+
+void AclOrch::bulkRemoveAclRules(Consumer &consumer, sai_object_id_t table_oid, const vector<AclRuleBulkEntry>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    auto& aclTable = m_AclTables[table_oid];
+    vector<string> ruleIds;
+    vector<bool> removed;
+
+    for (const auto& entry: entries)
+    {
+        auto ruleIter = aclTable.rules.find(entry.rule_id);
+        if (ruleIter != aclTable.rules.end() && ruleIter->second->hasCounter())
+        {
+            deregisterFlexCounter(*ruleIter->second);
+        }
+
+        ruleIds.push_back(entry.rule_id);
+    }
+
+    aclTable.bulkRemove(ruleIds, removed);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const auto& entry = entries[i];
+
+        if (removed[i])
+        {
+            removeAclRuleStatus(entry.table_id, entry.rule_id);
+            consumer.m_toSync.erase(entry.it);
+        }
+        else
+        {
+            // Mark pending removal status if the rule removal fails
+            setAclRuleStatus(entry.table_id, entry.rule_id, AclObjectStatus::PENDING_REMOVAL);
+        }
+    }
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
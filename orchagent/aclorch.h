@@ -16,6 +16,7 @@
 #include "dtelorch.h"
 #include "observer.h"
 #include "flex_counter_manager.h"
+#include "bulker.h"
 
 #include "acltable.h"
 
@@ -269,6 +270,16 @@ public:
     virtual bool enableCounter();
     virtual bool disableCounter();
 
+    // Bulk creation and removal of the rule counter and entry, see AclTable::bulkAdd()
+    virtual bool isBulkSupported() const;
+    bool bulkCreateCounter(ObjectBulker<sai_acl_api_t>& bulker);
+    bool bulkCreateRule(ObjectBulker<sai_acl_api_t>& bulker);
+    bool onBulkCreated(bool counterQueued, bool ruleQueued);
+    bool bulkRemoveRule(ObjectBulker<sai_acl_api_t>& bulker, sai_status_t *status);
+    bool onBulkRuleRemoved(sai_status_t status);
+    bool bulkRemoveCounter(ObjectBulker<sai_acl_api_t>& bulker, sai_status_t *status);
+    bool onBulkRemoved(bool counterQueued, sai_status_t counterStatus);
+
     string getId() const;
     string getTableId() const;
     sai_object_id_t getOid() const;
@@ -299,6 +310,9 @@ protected:
 
     virtual bool setAttribute(sai_attribute_t attr);
 
+    vector<sai_attribute_t> getCounterAttrs() const;
+    bool getRuleAttrs(vector<sai_attribute_t>& rule_attrs);
+
     void decreaseNextHopRefCount();
 
     bool isActionSupported(sai_acl_entry_attr_t) const;
@@ -318,6 +332,7 @@ protected:
 
     vector<AclRangeConfig> m_rangeConfig;
     vector<AclRange*> m_ranges;
+    vector<sai_object_id_t> m_rangeOids;
 
 private:
     bool m_createCounter;
@@ -344,6 +359,7 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool isBulkSupported() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -364,6 +380,7 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool isBulkSupported() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -430,6 +447,11 @@ public:
     bool updateRule(shared_ptr<AclRule> updatedRule);
     // Remove a rule from the ACL table
     bool remove(string rule_id);
+    // Add or overwrite rules into the ACL table with bulk SAI calls, the
+    // rules the bulk fails to create are created one by one
+    void bulkAdd(const vector<shared_ptr<AclRule>>& newRules, vector<bool>& created);
+    // Remove rules from the ACL table with bulk SAI calls
+    void bulkRemove(const vector<string>& ruleIds, vector<bool>& removed);
     // Remove all rules from the ACL table
     bool clear();
     // Update table subject to changes
@@ -456,6 +478,15 @@ private:
     AclOrch *m_pAclOrch = nullptr;
 };
 
+// ACL rule task done in bulk with the other rules of its table
+struct AclRuleBulkEntry
+{
+    SyncMap::iterator it;
+    string table_id;
+    string rule_id;
+    shared_ptr<AclRule> rule;
+};
+
 class AclOrch : public Orch, public Observer
 {
 public:
@@ -528,6 +559,8 @@ private:
     void doTask(Consumer &consumer);
     void doAclTableTask(Consumer &consumer);
     void doAclRuleTask(Consumer &consumer);
+    void bulkAddAclRules(Consumer &consumer, sai_object_id_t table_oid, const vector<AclRuleBulkEntry>& entries);
+    void bulkRemoveAclRules(Consumer &consumer, sai_object_id_t table_oid, const vector<AclRuleBulkEntry>& entries);
     void doAclTableTypeTask(Consumer &consumer);
     void init(vector<TableConnector>& connectors, PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch);
     void initDefaultTableTypes();
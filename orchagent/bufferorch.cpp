@@ -870,15 +870,11 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
         if (doesObjectExist(m_buffer_type_maps, APP_BUFFER_QUEUE_TABLE_NAME, key, buffer_profile_field_name, old_buffer_profile_name)
             && (old_buffer_profile_name == buffer_profile_name))
         {
-            if (m_partiallyAppliedQueues.find(key) == m_partiallyAppliedQueues.end())
+            if (!clearPartiallyApplied(APP_BUFFER_QUEUE_TABLE_NAME, key))
             {
                 SWSS_LOG_INFO("Skip setting buffer queue %s to %s since it is not changed", key.c_str(), buffer_profile_name.c_str());
                 return task_process_status::task_success;
             }
-            else
-            {
-                m_partiallyAppliedQueues.erase(key);
-            }
         }
 
         SWSS_LOG_NOTICE("Set buffer queue %s to %s", key.c_str(), buffer_profile_name.c_str());
@@ -888,7 +884,8 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
     else if (op == DEL_COMMAND)
     {
         auto &typemap = (*m_buffer_type_maps[APP_BUFFER_QUEUE_TABLE_NAME]);
-        if (typemap.find(key) == typemap.end())
+        bool partially_applied = clearPartiallyApplied(APP_BUFFER_QUEUE_TABLE_NAME, key);
+        if (typemap.find(key) == typemap.end() && !partially_applied)
         {
             SWSS_LOG_INFO("%s doesn't not exist, don't need to notfiy SAI", key.c_str());
             need_update_sai = false;
@@ -896,7 +893,6 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
         sai_buffer_profile = SAI_NULL_OBJECT_ID;
         SWSS_LOG_NOTICE("Remove buffer queue %s", key.c_str());
         removeObject(m_buffer_type_maps, APP_BUFFER_QUEUE_TABLE_NAME, key);
-        m_partiallyAppliedQueues.erase(key);
     }
     else
     {
@@ -907,6 +903,9 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
     sai_attribute_t attr;
     attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
     attr.value.oid = sai_buffer_profile;
+    // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
+    // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
+    size_t task = need_update_sai ? addBufferTask(tuple, gMySwitchType != "voq" ? tokens[1] : "") : 0;
     for (string port_name : port_names)
     {
         Port port;
@@ -947,7 +946,7 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
                 if (port.m_queue_lock[ind])
                 {
                     SWSS_LOG_WARN("Queue %zd on port %s is locked, will retry", ind, port_name.c_str());
-                    m_partiallyAppliedQueues.insert(key);
+                    m_partiallyAppliedObjects[APP_BUFFER_QUEUE_TABLE_NAME].insert(key);
                     return task_process_status::task_need_retry;
                 }
                 queue_id = port.m_queue_ids[ind];
@@ -956,74 +955,25 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
             if (need_update_sai)
             {
                 SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to queue index:%zd, queue sai_id:0x%" PRIx64, sai_buffer_profile, ind, queue_id);
-                sai_status_t sai_status = sai_queue_api->set_queue_attribute(queue_id, &attr);
-                if (sai_status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("Failed to set queue's buffer profile attribute, status:%d", sai_status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, sai_status);
-                    if (handle_status != task_process_status::task_success)
-                    {
-                        return handle_status;
-                    }
-                }
-                // create/remove a port queue counter for the queue buffer.
-                // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
-                // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
-                else if (gMySwitchType != "voq")
-                {
-                    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                    auto queues = tokens[1];
-                    if (op == SET_COMMAND &&
-                        (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
-                    {
-                        gPortsOrch->createPortBufferQueueCounters(port, queues);
-                    }
-                    else if (op == DEL_COMMAND &&
-                             (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
-                    {
-                        gPortsOrch->removePortBufferQueueCounters(port, queues);
-                    }
-                }
-            }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
-            {
-                if (queue_port_flags[port_name][ind] != SET_COMMAND)
-                {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
-                }
-            }
-            else if (op == DEL_COMMAND)
-            {
-                if (queue_port_flags[port_name][ind] == SET_COMMAND)
-		{
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
-                }
+                addBufferUpdate(task, port_name, ind, queue_id, attr);
             }
             else
             {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
+                updatePortRefCount(queue_port_flags, port_name, ind, op);
             }
-            /* save the last command (set or delete) */
-            queue_port_flags[port_name][ind] = op;
-
         }
     }
 
     if (m_ready_list.find(key) != m_ready_list.end())
     {
-        m_ready_list[key] = true;
+        if (need_update_sai)
+        {
+            m_bufferTasks[task].ready = true;
+        }
+        else
+        {
+            m_ready_list[key] = true;
+        }
     }
     else
     {
@@ -1103,8 +1053,11 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
         if (doesObjectExist(m_buffer_type_maps, APP_BUFFER_PG_TABLE_NAME, key, buffer_profile_field_name, old_buffer_profile_name)
             && (old_buffer_profile_name == buffer_profile_name))
         {
-            SWSS_LOG_INFO("Skip setting buffer priority group %s to %s since it is not changed", key.c_str(), buffer_profile_name.c_str());
-            return task_process_status::task_success;
+            if (!clearPartiallyApplied(APP_BUFFER_PG_TABLE_NAME, key))
+            {
+                SWSS_LOG_INFO("Skip setting buffer priority group %s to %s since it is not changed", key.c_str(), buffer_profile_name.c_str());
+                return task_process_status::task_success;
+            }
         }
 
         SWSS_LOG_NOTICE("Set buffer PG %s to %s", key.c_str(), buffer_profile_name.c_str());
@@ -1114,7 +1067,8 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
     else if (op == DEL_COMMAND)
     {
         auto &typemap = (*m_buffer_type_maps[APP_BUFFER_PG_TABLE_NAME]);
-        if (typemap.find(key) == typemap.end())
+        bool partially_applied = clearPartiallyApplied(APP_BUFFER_PG_TABLE_NAME, key);
+        if (typemap.find(key) == typemap.end() && !partially_applied)
         {
             SWSS_LOG_INFO("%s doesn't not exist, don't need to notfiy SAI", key.c_str());
             need_update_sai = false;
@@ -1132,6 +1086,7 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
     sai_attribute_t attr;
     attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
     attr.value.oid = sai_buffer_profile;
+    size_t task = need_update_sai ? addBufferTask(tuple, tokens[1]) : 0;
     for (string port_name : port_names)
     {
         Port port;
@@ -1156,73 +1111,26 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
                     sai_object_id_t pg_id;
                     pg_id = port.m_priority_group_ids[ind];
                     SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to port:%s pg index:%zd, pg sai_id:0x%" PRIx64, sai_buffer_profile, port_name.c_str(), ind, pg_id);
-                    sai_status_t sai_status = sai_buffer_api->set_ingress_priority_group_attribute(pg_id, &attr);
-                    if (sai_status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to set port:%s pg:%zd buffer profile attribute, status:%d", port_name.c_str(), ind, sai_status);
-                        task_process_status handle_status = handleSaiSetStatus(SAI_API_BUFFER, sai_status);
-                        if (handle_status != task_process_status::task_success)
-                        {
-                            return handle_status;
-                        }
-                    }
-                    // create or remove a port PG counter for the PG buffer
-                    else
-                    {
-                        auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                        auto pgs = tokens[1];
-                        if (op == SET_COMMAND &&
-                            (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->createPortBufferPgCounters(port, pgs);
-                        }
-                        else if (op == DEL_COMMAND &&
-                                 (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->removePortBufferPgCounters(port, pgs);
-                        }
-                    }
+                    addBufferUpdate(task, port_name, ind, pg_id, attr);
                 }
-            }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
-            {
-                if (pg_port_flags[port_name][ind] != SET_COMMAND)
-                {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
-                }
-            }
-            else if (op == DEL_COMMAND)
-            {
-                if (pg_port_flags[port_name][ind] == SET_COMMAND)
+                else
                 {
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
+                    updatePortRefCount(pg_port_flags, port_name, ind, op);
                 }
             }
-            else
-            {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
-            }
-            /* save the last command (set or delete) */
-            pg_port_flags[port_name][ind] = op;
-
         }
     }
 
     if (m_ready_list.find(key) != m_ready_list.end())
     {
-        m_ready_list[key] = true;
+        if (need_update_sai)
+        {
+            m_bufferTasks[task].ready = true;
+        }
+        else
+        {
+            m_ready_list[key] = true;
+        }
     }
     else
     {
@@ -1282,8 +1190,11 @@ task_process_status BufferOrch::processIngressBufferProfileList(KeyOpFieldsValue
         if (doesObjectExist(m_buffer_type_maps, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, key, buffer_profile_list_field_name, old_profile_name_list)
             && (old_profile_name_list == profile_name_list))
         {
-            SWSS_LOG_INFO("Skip setting buffer ingress profile list %s to %s since it is not changed", key.c_str(), profile_name_list.c_str());
-            return task_process_status::task_success;
+            if (!clearPartiallyApplied(APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, key))
+            {
+                SWSS_LOG_INFO("Skip setting buffer ingress profile list %s to %s since it is not changed", key.c_str(), profile_name_list.c_str());
+                return task_process_status::task_success;
+            }
         }
 
         setObjectReference(m_buffer_type_maps, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, key, buffer_profile_list_field_name, profile_name_list);
@@ -1295,6 +1206,7 @@ task_process_status BufferOrch::processIngressBufferProfileList(KeyOpFieldsValue
     {
         SWSS_LOG_NOTICE("%s has been removed from BUFFER_PORT_INGRESS_PROFILE_LIST_TABLE", key.c_str());
         removeObject(m_buffer_type_maps, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, key);
+        clearPartiallyApplied(APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, key);
         attr.value.objlist.count = 0;
         attr.value.objlist.list = profile_list.data();
     }
@@ -1303,6 +1215,7 @@ task_process_status BufferOrch::processIngressBufferProfileList(KeyOpFieldsValue
         SWSS_LOG_ERROR("Unknown command %s when handling BUFFER_PORT_INGRESS_PROFILE_LIST_TABLE key %s", op.c_str(), key.c_str());
     }
 
+    size_t task = addBufferTask(tuple, "");
     for (string port_name : port_names)
     {
         if (!gPortsOrch->getPort(port_name, port))
@@ -1310,16 +1223,7 @@ task_process_status BufferOrch::processIngressBufferProfileList(KeyOpFieldsValue
             SWSS_LOG_ERROR("Port with alias:%s not found", port_name.c_str());
             return task_process_status::task_invalid_entry;
         }
-        sai_status_t sai_status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-        if (sai_status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to set ingress buffer profile list on port, status:%d, key:%s", sai_status, port_name.c_str());
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_status);
-            if (handle_status != task_process_status::task_success)
-            {
-                return handle_status;
-            }
-        }
+        addBufferUpdate(task, port_name, 0, port.m_port_id, attr, profile_list);
     }
 
     return task_process_status::task_success;
@@ -1361,8 +1265,11 @@ task_process_status BufferOrch::processEgressBufferProfileList(KeyOpFieldsValues
         if (doesObjectExist(m_buffer_type_maps, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, key, buffer_profile_list_field_name, old_profile_name_list)
             && (old_profile_name_list == profile_name_list))
         {
-            SWSS_LOG_INFO("Skip setting buffer egress profile list %s to %s since it is not changed", key.c_str(), profile_name_list.c_str());
-            return task_process_status::task_success;
+            if (!clearPartiallyApplied(APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, key))
+            {
+                SWSS_LOG_INFO("Skip setting buffer egress profile list %s to %s since it is not changed", key.c_str(), profile_name_list.c_str());
+                return task_process_status::task_success;
+            }
         }
 
         setObjectReference(m_buffer_type_maps, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, key, buffer_profile_list_field_name, profile_name_list);
@@ -1374,6 +1281,7 @@ task_process_status BufferOrch::processEgressBufferProfileList(KeyOpFieldsValues
     {
         SWSS_LOG_NOTICE("%s has been removed from BUFFER_PORT_EGRESS_PROFILE_LIST_TABLE", key.c_str());
         removeObject(m_buffer_type_maps, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, key);
+        clearPartiallyApplied(APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, key);
         attr.value.objlist.count = 0;
         attr.value.objlist.list = profile_list.data();
     }
@@ -1382,6 +1290,7 @@ task_process_status BufferOrch::processEgressBufferProfileList(KeyOpFieldsValues
         SWSS_LOG_ERROR("Unknown command %s when handling BUFFER_PORT_EGRESS_PROFILE_LIST_TABLE key %s", op.c_str(), key.c_str());
     }
 
+    size_t task = addBufferTask(tuple, "");
     for (string port_name : port_names)
     {
         if (!gPortsOrch->getPort(port_name, port))
@@ -1389,19 +1298,242 @@ task_process_status BufferOrch::processEgressBufferProfileList(KeyOpFieldsValues
             SWSS_LOG_ERROR("Port with alias:%s not found", port_name.c_str());
             return task_process_status::task_invalid_entry;
         }
-        sai_status_t sai_status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-        if (sai_status != SAI_STATUS_SUCCESS)
+        addBufferUpdate(task, port_name, 0, port.m_port_id, attr, profile_list);
+    }
+
+    return task_process_status::task_success;
+}
+
+size_t BufferOrch::addBufferTask(const KeyOpFieldsValuesTuple &tuple, const string &counterIndexes)
+{
+    m_bufferTasks.push_back({ tuple, counterIndexes, false });
+    return m_bufferTasks.size() - 1;
+}
+
+void BufferOrch::addBufferUpdate(size_t task, const string &portName, size_t index, sai_object_id_t oid, const sai_attribute_t &attr,
+                                 const vector<sai_object_id_t> &profileList)
+{
+    m_bufferUpdates.push_back({ task, portName, index, oid, attr, profileList });
+}
+
+void BufferOrch::updatePortRefCount(map<string, map<size_t, string>> &portFlags, const string &portName, size_t index, const string &op)
+{
+    /* when we apply buffer configuration we need to increase the ref counter of this port
+     * or decrease the ref counter for this port when we remove buffer cfg
+     * so for each priority cfg in each port we will increase/decrease the ref counter
+     * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
+     * we need to increase ref counter only on create flow.
+     * so we added a map that will help us to know what was the last command for this port and priority -
+     * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
+     * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
+    if (op == SET_COMMAND)
+    {
+        if (portFlags[portName][index] != SET_COMMAND)
+        {
+            /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
+            gPortsOrch->increasePortRefCount(portName);
+        }
+    }
+    else
+    {
+        if (portFlags[portName][index] == SET_COMMAND)
+        {
+            /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
+            gPortsOrch->decreasePortRefCount(portName);
+        }
+    }
+    /* save the last command (set or delete) */
+    portFlags[portName][index] = op;
+}
+
+bool BufferOrch::clearPartiallyApplied(const string &table, const string &key)
+{
+    return m_partiallyAppliedObjects[table].erase(key) > 0;
+}
+
+void BufferOrch::flushBufferUpdates(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bufferUpdates.empty())
+    {
+        for (const auto &buffer_task : m_bufferTasks)
+        {
+            if (buffer_task.ready)
+            {
+                m_ready_list[kfvKey(buffer_task.tuple)] = true;
+            }
+        }
+        m_bufferTasks.clear();
+        return;
+    }
+
+    const string table = consumer.getTableName();
+    sai_object_type_t object_type = SAI_OBJECT_TYPE_PORT;
+    sai_api_t api = SAI_API_PORT;
+    if (table == APP_BUFFER_QUEUE_TABLE_NAME)
+    {
+        object_type = SAI_OBJECT_TYPE_QUEUE;
+        api = SAI_API_QUEUE;
+    }
+    else if (table == APP_BUFFER_PG_TABLE_NAME)
+    {
+        object_type = SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP;
+        api = SAI_API_BUFFER;
+    }
+
+    size_t count = m_bufferUpdates.size();
+    vector<sai_object_key_t> object_keys(count);
+    vector<sai_attribute_t> attrs(count);
+    vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &update = m_bufferUpdates[i];
+        object_keys[i].key.object_id = update.oid;
+        attrs[i] = update.attr;
+        if (object_type == SAI_OBJECT_TYPE_PORT)
         {
-            SWSS_LOG_ERROR("Failed to set egress buffer profile list on port, status:%d, key:%s", sai_status, port_name.c_str());
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, sai_status);
-            if (handle_status != task_process_status::task_success)
+            attrs[i].value.objlist.count = (uint32_t)update.profileList.size();
+            attrs[i].value.objlist.list = update.profileList.data();
+        }
+    }
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+    if (count > 1)
+    {
+        status = sai_bulk_object_set_attribute(gSwitchId, object_type, (uint32_t)count, object_keys.data(), attrs.data(),
+                                               SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        SWSS_LOG_INFO("Set %zu buffer attributes of %s in bulk, status:%d", count, table.c_str(), status);
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        /* A single update, or a SAI without bulk set, is applied object by object */
+        for (size_t i = 0; i < count; i++)
+        {
+            sai_object_id_t oid = object_keys[i].key.object_id;
+            if (object_type == SAI_OBJECT_TYPE_QUEUE)
+            {
+                statuses[i] = sai_queue_api->set_queue_attribute(oid, &attrs[i]);
+            }
+            else if (object_type == SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP)
             {
-                return handle_status;
+                statuses[i] = sai_buffer_api->set_ingress_priority_group_attribute(oid, &attrs[i]);
+            }
+            else
+            {
+                statuses[i] = sai_port_api->set_port_attribute(oid, &attrs[i]);
             }
         }
     }
 
-    return task_process_status::task_success;
+    vector<sai_status_t> task_statuses(m_bufferTasks.size(), SAI_STATUS_SUCCESS);
+    set<pair<size_t, string>> failed_ports;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &update = m_bufferUpdates[i];
+        if (statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            /* The port references to the queue or PG follow the sets which succeed */
+            if (object_type == SAI_OBJECT_TYPE_QUEUE)
+            {
+                updatePortRefCount(queue_port_flags, update.portName, update.index, kfvOp(m_bufferTasks[update.task].tuple));
+            }
+            else if (object_type == SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP)
+            {
+                updatePortRefCount(pg_port_flags, update.portName, update.index, kfvOp(m_bufferTasks[update.task].tuple));
+            }
+            continue;
+        }
+
+        SWSS_LOG_ERROR("Failed to set buffer attribute of %s on port %s, status:%d",
+                       kfvKey(m_bufferTasks[update.task].tuple).c_str(), update.portName.c_str(), statuses[i]);
+        if (task_statuses[update.task] == SAI_STATUS_SUCCESS)
+        {
+            task_statuses[update.task] = statuses[i];
+        }
+        failed_ports.insert({ update.task, update.portName });
+    }
+
+    /* Create or remove the queue and PG counters of the ports which are updated */
+    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+    set<pair<size_t, string>> counted_ports;
+    for (const auto &update : m_bufferUpdates)
+    {
+        const auto &buffer_task = m_bufferTasks[update.task];
+        pair<size_t, string> task_port = { update.task, update.portName };
+        if (buffer_task.counterIndexes.empty() || failed_ports.count(task_port) || !counted_ports.insert(task_port).second)
+        {
+            continue;
+        }
+
+        Port port;
+        if (!gPortsOrch->getPort(update.portName, port))
+        {
+            continue;
+        }
+
+        bool is_set = kfvOp(buffer_task.tuple) == SET_COMMAND;
+        if (object_type == SAI_OBJECT_TYPE_QUEUE)
+        {
+            if (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState())
+            {
+                if (is_set)
+                {
+                    gPortsOrch->createPortBufferQueueCounters(port, buffer_task.counterIndexes);
+                }
+                else
+                {
+                    gPortsOrch->removePortBufferQueueCounters(port, buffer_task.counterIndexes);
+                }
+            }
+        }
+        else if (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState())
+        {
+            if (is_set)
+            {
+                gPortsOrch->createPortBufferPgCounters(port, buffer_task.counterIndexes);
+            }
+            else
+            {
+                gPortsOrch->removePortBufferPgCounters(port, buffer_task.counterIndexes);
+            }
+        }
+    }
+
+    /* Retry the entries which failed, only their sets which succeeded are counted in the port references */
+    for (size_t task = 0; task < m_bufferTasks.size(); task++)
+    {
+        const auto &tuple = m_bufferTasks[task].tuple;
+        const string &key = kfvKey(tuple);
+        if (task_statuses[task] == SAI_STATUS_SUCCESS)
+        {
+            if (m_bufferTasks[task].ready)
+            {
+                m_ready_list[key] = true;
+            }
+            continue;
+        }
+
+        /* The sets not executed by the bulk call are simply retried */
+        task_process_status handle_status = task_statuses[task] == SAI_STATUS_NOT_EXECUTED ?
+                                            task_process_status::task_need_retry : handleSaiSetStatus(api, task_statuses[task]);
+        if (handle_status == task_process_status::task_need_retry)
+        {
+            m_partiallyAppliedObjects[table].insert(key);
+            if (consumer.m_toSync.find(key) == consumer.m_toSync.end())
+            {
+                consumer.m_toSync.emplace(key, tuple);
+            }
+        }
+        else if (handle_status != task_process_status::task_success)
+        {
+            SWSS_LOG_ERROR("Failed to process buffer task %s, drop it", key.c_str());
+        }
+    }
+
+    m_bufferTasks.clear();
+    m_bufferUpdates.clear();
 }
 
 void BufferOrch::doTask()
@@ -1482,6 +1614,7 @@ void BufferOrch::doTask(Consumer &consumer)
             case task_process_status::task_failed:
                 SWSS_LOG_ERROR("Failed to process buffer task, drop it");
                 it = consumer.m_toSync.erase(it);
+                flushBufferUpdates(consumer);
                 return;
             case task_process_status::task_need_retry:
                 SWSS_LOG_INFO("Failed to process buffer task, retry it");
@@ -1493,4 +1626,6 @@ void BufferOrch::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    flushBufferUpdates(consumer);
 }
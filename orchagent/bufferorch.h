@@ -59,6 +59,40 @@ private:
     task_process_status processIngressBufferProfileList(KeyOpFieldsValuesTuple &tuple);
     task_process_status processEgressBufferProfileList(KeyOpFieldsValuesTuple &tuple);
 
+    /*
+     * The queue, PG and port profile list attributes of a doTask pass are
+     * gathered and set in bulk once the pass is over. The ready list and the
+     * port reference counts follow the sets which succeed, and a table entry
+     * whose sets failed is the only one retried.
+     */
+    struct BufferTask
+    {
+        KeyOpFieldsValuesTuple tuple;
+        /* Queue or PG indexes whose counters follow the entry, empty for none */
+        string counterIndexes;
+        /* The entry is in m_ready_list, and is ready once all its sets succeed */
+        bool ready;
+    };
+
+    struct BufferObjectUpdate
+    {
+        size_t task;
+        string portName;
+        /* Queue or PG index, whose port reference is counted once its set succeeds */
+        size_t index;
+        sai_object_id_t oid;
+        sai_attribute_t attr;
+        /* Backs attr.value.objlist of the port profile lists */
+        vector<sai_object_id_t> profileList;
+    };
+
+    size_t addBufferTask(const KeyOpFieldsValuesTuple &tuple, const string &counterIndexes);
+    void addBufferUpdate(size_t task, const string &portName, size_t index, sai_object_id_t oid, const sai_attribute_t &attr,
+                         const vector<sai_object_id_t> &profileList = {});
+    void updatePortRefCount(map<string, map<size_t, string>> &portFlags, const string &portName, size_t index, const string &op);
+    void flushBufferUpdates(Consumer &consumer);
+    bool clearPartiallyApplied(const string &table, const string &key);
+
     buffer_table_handler_map m_bufferHandlerMap;
     std::unordered_map<std::string, bool> m_ready_list;
     std::unordered_map<std::string, std::vector<std::string>> m_port_ready_list_ref;
@@ -72,7 +106,11 @@ private:
     unique_ptr<DBConnector> m_countersDb;
 
     bool m_isBufferPoolWatermarkCounterIdListGenerated = false;
-    set<string> m_partiallyAppliedQueues;
+    /* Table entries which must be applied again even if they are not changed, per table */
+    map<string, set<string>> m_partiallyAppliedObjects;
+
+    vector<BufferTask> m_bufferTasks;
+    vector<BufferObjectUpdate> m_bufferUpdates;
 };
 #endif /* SWSS_BUFFORCH_H */
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <assert.h>
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +40,88 @@ typedef sai_status_t (*sai_bulk_set_inbound_routing_entry_attribute_fn) (
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+// The ACL API has no bulk functions, ACL entries and counters are bulked with the generic bulk API, through
+// these pointers to sai_bulk_object_create/remove, which the SAI profiler hooks per object type
+extern sai_bulk_object_create_fn sai_bulk_create_acl_entries;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_entries;
+extern sai_bulk_object_create_fn sai_bulk_create_acl_counters;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_counters;
+
+// Platforms without the generic bulk API get the objects created one at a time, with the create function of
+// the ACL API table and the semantics of the bulk error modes
+static inline sai_status_t sai_bulk_create_acl_objects(
+        _In_ sai_bulk_object_create_fn bulk_create,
+        _In_ sai_create_acl_entry_fn create,
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    sai_status_t status = bulk_create(switch_id, object_type, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = create ? create(&object_id[i], switch_id, attr_count[i], attr_list[i]) : SAI_STATUS_NOT_IMPLEMENTED;
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+static inline sai_status_t sai_bulk_remove_acl_objects(
+        _In_ sai_bulk_object_remove_fn bulk_remove,
+        _In_ sai_remove_acl_entry_fn remove,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    sai_status_t status = bulk_remove(object_type, object_count, object_id, mode, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = remove ? remove(object_id[i]) : SAI_STATUS_NOT_IMPLEMENTED;
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
 static inline bool operator==(const sai_ip_prefix_t& a, const sai_ip_prefix_t& b)
 {
     if (a.addr_family != b.addr_family) return false;
@@ -342,6 +425,20 @@ struct SaiBulkerTraits<sai_next_hop_group_api_t>
     //using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_acl_api_t;
+    using create_entry_fn = sai_create_acl_entry_fn;
+    using remove_entry_fn = sai_remove_acl_entry_fn;
+    using set_entry_attribute_fn = sai_set_acl_entry_attribute_fn;
+    // Bound to the generic bulk functions and the object type, see sai_bulk_create_acl_objects()
+    using bulk_create_entry_fn = std::function<sai_status_t(sai_object_id_t, uint32_t, const uint32_t *, const sai_attribute_t **,
+                                                            sai_bulk_op_error_mode_t, sai_object_id_t *, sai_status_t *)>;
+    using bulk_remove_entry_fn = std::function<sai_status_t(uint32_t, const sai_object_id_t *, sai_bulk_op_error_mode_t, sai_status_t *)>;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -898,6 +995,12 @@ public:
         throw std::logic_error("Not implemented");
     }
 
+    ObjectBulker(typename Ts::api_t* api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_t object_type) :
+        max_bulk_size(max_bulk_size)
+    {
+        throw std::logic_error("Not implemented");
+    }
+
     sai_status_t create_entry(
         _Out_ sai_object_id_t *object_id,
         _In_ uint32_t attr_count,
@@ -1102,6 +1205,7 @@ private:
 
     typename Ts::bulk_create_entry_fn                       create_entries;
     typename Ts::bulk_remove_entry_fn                       remove_entries;
+    sai_bulk_op_error_mode_t                                error_mode = SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR;
     // TODO: wait until available in SAI
     //typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
 
@@ -1114,7 +1218,7 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        sai_status_t status = remove_entries((uint32_t)count, rs.data(), error_mode, statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush removing_entries %zu rc=%d statuses[0]=%d\n", removing_entries.size(), status, statuses[0]);
@@ -1149,8 +1253,8 @@ private:
         size_t count = rs.size();
         std::vector<sai_object_id_t> object_ids(count);
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+        sai_status_t status = create_entries(switch_id, (uint32_t)count, cs.data(), tss.data()
+            , error_mode, object_ids.data(), statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush creating_entries %zu\n", count);
@@ -1225,3 +1329,46 @@ inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
 }
+
+template <>
+inline ObjectBulker<sai_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_t object_type) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    sai_bulk_object_create_fn bulk_create;
+    sai_bulk_object_remove_fn bulk_remove;
+    sai_create_acl_entry_fn create;
+    sai_remove_acl_entry_fn remove;
+
+    switch (object_type)
+    {
+        case SAI_OBJECT_TYPE_ACL_ENTRY:
+            bulk_create = sai_bulk_create_acl_entries;
+            bulk_remove = sai_bulk_remove_acl_entries;
+            create = api->create_acl_entry;
+            remove = api->remove_acl_entry;
+            break;
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+            bulk_create = sai_bulk_create_acl_counters;
+            bulk_remove = sai_bulk_remove_acl_counters;
+            create = api->create_acl_counter;
+            remove = api->remove_acl_counter;
+            break;
+        default:
+            throw std::invalid_argument("object_type is not an ACL entry or counter");
+    }
+
+    create_entries = [bulk_create, create, object_type](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+                                                        const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                                                        sai_object_id_t *object_id, sai_status_t *object_statuses) {
+        return sai_bulk_create_acl_objects(bulk_create, create, object_type, switch_id, object_count, attr_count, attr_list,
+                                           mode, object_id, object_statuses);
+    };
+    remove_entries = [bulk_remove, remove, object_type](uint32_t object_count, const sai_object_id_t *object_id,
+                                                        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses) {
+        return sai_bulk_remove_acl_objects(bulk_remove, remove, object_type, object_count, object_id, mode, object_statuses);
+    };
+
+    // The rules which fail in bulk are rolled back and handled alone by AclTable, the others must not be left out
+    error_mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+}
@@ -58,18 +58,18 @@ void CounterCheckOrch::mcCounterCheck()
         auto mcCounters = i.second;
         uint8_t pfcMask = 0;
 
-        Port port;
-        if (!gPortsOrch->getPort(oid, port))
+        const Port *port = gPortsOrch->findPort(oid);
+        if (port == nullptr)
         {
             SWSS_LOG_ERROR("Invalid port oid 0x%" PRIx64, oid);
             continue;
         }
 
-        auto newMcCounters = getQueueMcCounters(port);
+        auto newMcCounters = getQueueMcCounters(*port);
 
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &pfcMask))
+        if (!gPortsOrch->getPortPfc(port->m_port_id, &pfcMask))
         {
-            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port.m_alias.c_str());
+            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port->m_alias.c_str());
             continue;
         }
 
@@ -80,14 +80,14 @@ void CounterCheckOrch::mcCounterCheck()
             {
                 SWSS_LOG_WARN("Could not retreive MC counters on queue %zu port %s",
                         prio,
-                        port.m_alias.c_str());
+                        port->m_alias.c_str());
             }
             else if (!isLossy && mcCounters[prio] < newMcCounters[prio])
             {
                 SWSS_LOG_WARN("Got Multicast %" PRIu64 " frame(s) on lossless queue %zu port %s",
                         newMcCounters[prio] - mcCounters[prio],
                         prio,
-                        port.m_alias.c_str());
+                        port->m_alias.c_str());
             }
         }
 
@@ -106,16 +106,16 @@ void CounterCheckOrch::pfcFrameCounterCheck()
         auto newCounters = getPfcFrameCounters(oid);
         uint8_t pfcMask = 0;
 
-        Port port;
-        if (!gPortsOrch->getPort(oid, port))
+        const Port *port = gPortsOrch->findPort(oid);
+        if (port == nullptr)
         {
             SWSS_LOG_ERROR("Invalid port oid 0x%" PRIx64, oid);
             continue;
         }
 
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &pfcMask))
+        if (!gPortsOrch->getPortPfc(port->m_port_id, &pfcMask))
         {
-            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port.m_alias.c_str());
+            SWSS_LOG_ERROR("Failed to get PFC mask on port %s", port->m_alias.c_str());
             continue;
         }
 
@@ -126,14 +126,14 @@ void CounterCheckOrch::pfcFrameCounterCheck()
             {
                 SWSS_LOG_WARN("Could not retreive PFC frame count on queue %zu port %s",
                         prio,
-                        port.m_alias.c_str());
+                        port->m_alias.c_str());
             }
             else if (isLossy && counters[prio] < newCounters[prio])
             {
                 SWSS_LOG_WARN("Got PFC %" PRIu64 " frame(s) on lossy queue %zu port %s",
                         newCounters[prio] - counters[prio],
                         prio,
-                        port.m_alias.c_str());
+                        port->m_alias.c_str());
             }
         }
 
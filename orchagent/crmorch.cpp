@@ -7,6 +7,7 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_ADAPTIVE_POLLING "adaptive_polling"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
@@ -16,6 +17,13 @@
 #define CRM_EXCEEDED_MSG_MAX 10
 #define CRM_ACL_RESOURCE_COUNT 256
 
+// With adaptive polling the timer ticks CRM_ADAPTIVE_POLLING_FACTOR times per
+// polling interval. Resources above the low threshold are polled every tick,
+// resources under half of the low threshold are polled every
+// CRM_ADAPTIVE_POLLING_FACTOR * CRM_ADAPTIVE_POLLING_SLOWDOWN ticks.
+#define CRM_ADAPTIVE_POLLING_FACTOR 4
+#define CRM_ADAPTIVE_POLLING_SLOWDOWN 2
+
 extern sai_object_id_t gSwitchId;
 extern sai_switch_api_t *sai_switch_api;
 extern sai_acl_api_t *sai_acl_api;
@@ -283,6 +291,13 @@ const map<string, CrmThresholdType> crmThreshTypeMap =
     { "free", CrmThresholdType::CRM_FREE }
 };
 
+const map<CrmThresholdType, string> crmThreshTypeNameMap =
+{
+    { CrmThresholdType::CRM_PERCENTAGE, "TH_PERCENTAGE" },
+    { CrmThresholdType::CRM_USED, "TH_USED" },
+    { CrmThresholdType::CRM_FREE, "TH_FREE" }
+};
+
 const map<string, CrmResourceType> crmAvailCntsTableMap =
 {
     { "crm_stats_ipv4_route_available", CrmResourceType::CRM_IPV4_ROUTE },
@@ -371,6 +386,8 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
     m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipeline(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmPipeTable(new Table(m_countersPipeline.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
@@ -459,9 +476,22 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
             if (field == CRM_POLLING_INTERVAL)
             {
                 m_pollingInterval = chrono::seconds(to_uint<uint32_t>(value));
-                auto interv = timespec { .tv_sec = (time_t)m_pollingInterval.count(), .tv_nsec = 0 };
-                m_timer->setInterval(interv);
-                m_timer->reset();
+                setTimerInterval();
+            }
+            else if (field == CRM_ADAPTIVE_POLLING)
+            {
+                bool adaptivePolling = (value == "true");
+                if (m_adaptivePolling != adaptivePolling)
+                {
+                    m_adaptivePolling = adaptivePolling;
+
+                    for (auto &res : m_resourcesMap)
+                    {
+                        res.second.pollCountdown = 0;
+                    }
+
+                    setTimerInterval();
+                }
             }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
@@ -729,6 +759,106 @@ void CrmOrch::doTask(SelectableTimer &timer)
     checkCrmThresholds();
 }
 
+void CrmOrch::setTimerInterval()
+{
+    SWSS_LOG_ENTER();
+
+    auto interval = m_pollingInterval;
+
+    if (m_adaptivePolling)
+    {
+        interval = max(chrono::seconds(1), m_pollingInterval / CRM_ADAPTIVE_POLLING_FACTOR);
+    }
+
+    auto interv = timespec { .tv_sec = (time_t)interval.count(), .tv_nsec = 0 };
+    m_timer->setInterval(interv);
+    m_timer->reset();
+}
+
+bool CrmOrch::isResPollDue(CrmResourceEntry &res)
+{
+    if (res.pollCountdown == 0)
+    {
+        return true;
+    }
+
+    res.pollCountdown--;
+    return false;
+}
+
+void CrmOrch::updateResPollCountdown(CrmResourceEntry &res)
+{
+    if (!m_adaptivePolling)
+    {
+        res.pollCountdown = 0;
+        return;
+    }
+
+    bool nearThreshold = false;
+    bool farFromThreshold = true;
+
+    for (const auto &cnt : res.countersMap)
+    {
+        uint32_t percentageUtil = 0;
+        uint64_t utilization = getCrmUtilization(res, cnt.second, percentageUtil);
+
+        if (utilization >= res.lowThreshold)
+        {
+            nearThreshold = true;
+            break;
+        }
+
+        if (utilization * 2 >= res.lowThreshold)
+        {
+            farFromThreshold = false;
+        }
+    }
+
+    if (nearThreshold)
+    {
+        res.pollCountdown = 0;
+    }
+    else if (farFromThreshold)
+    {
+        res.pollCountdown = CRM_ADAPTIVE_POLLING_FACTOR * CRM_ADAPTIVE_POLLING_SLOWDOWN - 1;
+    }
+    else
+    {
+        res.pollCountdown = CRM_ADAPTIVE_POLLING_FACTOR - 1;
+    }
+}
+
+uint64_t CrmOrch::getCrmUtilization(const CrmResourceEntry &res, const CrmResourceCounter &cnt, uint32_t &percentageUtil)
+{
+    percentageUtil = 0;
+
+    if (cnt.usedCounter != 0)
+    {
+        uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
+        if (dvsr != 0)
+        {
+            percentageUtil = (cnt.usedCounter * 100) / dvsr;
+        }
+        else
+        {
+            SWSS_LOG_WARN("%s Exception occurred (div by Zero): Used count %u free count %u",
+                          res.name.c_str(), cnt.usedCounter, cnt.availableCounter);
+        }
+    }
+
+    switch (res.thresholdType)
+    {
+        case CrmThresholdType::CRM_PERCENTAGE:
+            return percentageUtil;
+        case CrmThresholdType::CRM_USED:
+            return cnt.usedCounter;
+        case CrmThresholdType::CRM_FREE:
+            return cnt.availableCounter;
+        default:
+            throw runtime_error("Unknown threshold type for CRM resource");
+    }
+}
+
 bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
 {
     sai_attribute_t attr;
@@ -799,6 +929,12 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
         }
 
         availCount = attr.value.u32;
+
+        // Query this resource through the bulk switch attribute get from now on
+        if (crmResSaiAvailAttrMap.find(type) != crmResSaiAvailAttrMap.end())
+        {
+            res.useSwitchAttr = true;
+        }
     }
 
     res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
@@ -806,6 +942,113 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
     return true;
 }
 
+void CrmOrch::getSwitchResAvailability(vector<CrmResourceType> &types)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_attribute_t> attrs(types.size());
+
+    for (size_t i = 0; i < types.size(); i++)
+    {
+        attrs[i].id = crmResSaiAvailAttrMap.at(types[i]);
+    }
+
+    sai_status_t status = sai_switch_api->get_switch_attribute(gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (size_t i = 0; i < types.size(); i++)
+        {
+            auto &res = m_resourcesMap.at(types[i]);
+            res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = attrs[i].value.u32;
+        }
+
+        return;
+    }
+
+    SWSS_LOG_INFO("Failed to get %zu CRM availability counters in bulk, rv:%d. Querying them one by one",
+                  types.size(), status);
+
+    // Per resource queries mark the unsupported ones and log the failures
+    for (auto type : types)
+    {
+        auto &res = m_resourcesMap.at(type);
+        res.useSwitchAttr = false;
+        getResAvailability(type, res);
+    }
+}
+
+bool CrmOrch::getAclTableResAvailability(CrmResourceType type, CrmResourceEntry &res, const set<string> &skipKeys)
+{
+    sai_attribute_t attr;
+    attr.id = crmResSaiAvailAttrMap.at(type);
+
+    for (auto &cnt : res.countersMap)
+    {
+        if (skipKeys.find(cnt.first) != skipKeys.end())
+        {
+            continue;
+        }
+
+        sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
+        if ((status == SAI_STATUS_NOT_SUPPORTED) ||
+            (status == SAI_STATUS_NOT_IMPLEMENTED) ||
+            SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
+            SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+        {
+            // mark unsupported resources
+            res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+            SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
+            return false;
+        }
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attr.id, status);
+            return false;
+        }
+
+        cnt.second.availableCounter = attr.value.u32;
+    }
+
+    return true;
+}
+
+void CrmOrch::getAclTableResAvailability(CrmResourceEntry &entryRes, CrmResourceEntry &counterRes)
+{
+    SWSS_LOG_ENTER();
+
+    set<string> polledKeys;
+
+    // Read both ACL entry and ACL counter availability of a table with one call
+    for (auto &cnt : entryRes.countersMap)
+    {
+        auto counterIt = counterRes.countersMap.find(cnt.first);
+        if (counterIt == counterRes.countersMap.end())
+        {
+            continue;
+        }
+
+        sai_attribute_t attrs[2];
+        attrs[0].id = crmResSaiAvailAttrMap.at(CrmResourceType::CRM_ACL_ENTRY);
+        attrs[1].id = crmResSaiAvailAttrMap.at(CrmResourceType::CRM_ACL_COUNTER);
+
+        sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 2, attrs);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get ACL table 0x%" PRIx64 " availability in bulk, rv:%d", cnt.second.id, status);
+            polledKeys.clear();
+            break;
+        }
+
+        cnt.second.availableCounter = attrs[0].value.u32;
+        counterIt->second.availableCounter = attrs[1].value.u32;
+        polledKeys.insert(cnt.first);
+    }
+
+    // Tables with a single tracked resource, or all of them if the bulk read failed
+    getAclTableResAvailability(CrmResourceType::CRM_ACL_ENTRY, entryRes, polledKeys);
+    getAclTableResAvailability(CrmResourceType::CRM_ACL_COUNTER, counterRes, polledKeys);
+}
+
 bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res)
 {
     sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
@@ -845,6 +1088,11 @@ void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    vector<CrmResourceType> polledTypes;
+    vector<CrmResourceType> switchAttrTypes;
+    bool pollAclEntry = false;
+    bool pollAclCounter = false;
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -853,6 +1101,20 @@ void CrmOrch::getResAvailableCounters()
             continue;
         }
 
+        if (!isResPollDue(res.second))
+        {
+            continue;
+        }
+
+        polledTypes.push_back(res.first);
+
+        // Resources backed by switch attributes are read with a single call below
+        if (res.second.useSwitchAttr)
+        {
+            switchAttrTypes.push_back(res.first);
+            continue;
+        }
+
         switch (res.first)
         {
             case CrmResourceType::CRM_IPV4_ROUTE:
@@ -940,33 +1202,14 @@ void CrmOrch::getResAvailableCounters()
             }
 
             case CrmResourceType::CRM_ACL_ENTRY:
-            case CrmResourceType::CRM_ACL_COUNTER:
             {
-                sai_attribute_t attr;
-                attr.id = crmResSaiAvailAttrMap.at(res.first);
-
-                for (auto &cnt : res.second.countersMap)
-                {
-                    sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
-                    if ((status == SAI_STATUS_NOT_SUPPORTED) ||
-                        (status == SAI_STATUS_NOT_IMPLEMENTED) ||
-                        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
-                        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
-                    {
-                        // mark unsupported resources
-                        res.second.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
-                        SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(res.first).c_str());
-                        break;
-                    }
-                    if (status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attr.id, status);
-                        break;
-                    }
-
-                    cnt.second.availableCounter = attr.value.u32;
-                }
+                pollAclEntry = true;
+                break;
+            }
 
+            case CrmResourceType::CRM_ACL_COUNTER:
+            {
+                pollAclCounter = true;
                 break;
             }
 
@@ -1006,31 +1249,75 @@ void CrmOrch::getResAvailableCounters()
 
             default:
                 SWSS_LOG_ERROR("Failed to get CRM resource type %u. Unknown resource type.\n", static_cast<uint32_t>(res.first));
-                return;
+                break;
         }
     }
+
+    if (!switchAttrTypes.empty())
+    {
+        getSwitchResAvailability(switchAttrTypes);
+    }
+
+    auto &aclEntryRes = m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY);
+    auto &aclCounterRes = m_resourcesMap.at(CrmResourceType::CRM_ACL_COUNTER);
+
+    if (pollAclEntry && pollAclCounter)
+    {
+        getAclTableResAvailability(aclEntryRes, aclCounterRes);
+    }
+    else if (pollAclEntry)
+    {
+        getAclTableResAvailability(CrmResourceType::CRM_ACL_ENTRY, aclEntryRes);
+    }
+    else if (pollAclCounter)
+    {
+        getAclTableResAvailability(CrmResourceType::CRM_ACL_COUNTER, aclCounterRes);
+    }
+
+    for (auto type : polledTypes)
+    {
+        updateResPollCountdown(m_resourcesMap.at(type));
+    }
 }
 
 void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Collect the changed counters per COUNTERS_DB key
+    map<string, vector<FieldValueTuple>> updates;
+
+    bool republish = (m_republishCountdown == 0);
+    if (republish)
+    {
+        m_republishCountdown = CRM_COUNTERS_REPUBLISH_PERIODS * (m_adaptivePolling ? CRM_ADAPTIVE_POLLING_FACTOR : 1) - 1;
+    }
+    else
+    {
+        m_republishCountdown--;
+    }
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!republish && cnt.second.usedPublished && (cnt.second.publishedUsedCounter == cnt.second.usedCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                cnt.second.publishedUsedCounter = cnt.second.usedCounter;
+                cnt.second.usedPublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1044,17 +1331,22 @@ void CrmOrch::updateCrmCountersTable()
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!republish && cnt.second.availablePublished && (cnt.second.publishedAvailableCounter == cnt.second.availableCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                cnt.second.publishedAvailableCounter = cnt.second.availableCounter;
+                cnt.second.availablePublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1062,6 +1354,20 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    if (updates.empty())
+    {
+        return;
+    }
+
+    for (const auto &update : updates)
+    {
+        m_countersCrmPipeTable->set(update.first, update.second);
+    }
+
+    m_countersCrmPipeTable->flush();
+
+    SWSS_LOG_DEBUG("Updated %zu CRM counters keys in COUNTERS_DB", updates.size());
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -1080,41 +1386,9 @@ void CrmOrch::checkCrmThresholds()
         for (auto &j : i.second.countersMap)
         {
             auto &cnt = j.second;
-            uint64_t utilization = 0;
             uint32_t percentageUtil = 0;
-            string threshType = "";
-
-            if (cnt.usedCounter != 0)
-            {
-                uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
-                if (dvsr != 0)
-                {
-                    percentageUtil = (cnt.usedCounter * 100) / dvsr;
-                }
-                else
-                {
-                    SWSS_LOG_WARN("%s Exception occurred (div by Zero): Used count %u free count %u",
-                                  res.name.c_str(), cnt.usedCounter, cnt.availableCounter);
-                }
-            }
-
-            switch (res.thresholdType)
-            {
-                case CrmThresholdType::CRM_PERCENTAGE:
-                    utilization = percentageUtil;
-                    threshType = "TH_PERCENTAGE";
-                    break;
-                case CrmThresholdType::CRM_USED:
-                    utilization = cnt.usedCounter;
-                    threshType = "TH_USED";
-                    break;
-                case CrmThresholdType::CRM_FREE:
-                    utilization = cnt.availableCounter;
-                    threshType = "TH_FREE";
-                    break;
-                default:
-                    throw runtime_error("Unknown threshold type for CRM resource");
-            }
+            uint64_t utilization = getCrmUtilization(res, cnt, percentageUtil);
+            string threshType = crmThreshTypeNameMap.at(res.thresholdType);
 
             if ((utilization >= res.highThreshold) && (cnt.exceededLogCounter < CRM_EXCEEDED_MSG_MAX))
             {
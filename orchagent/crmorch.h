@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <set>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -11,6 +12,11 @@ extern "C" {
 #include "sai.h"
 }
 
+// Only the changed counters are written to COUNTERS_DB, all of them are written
+// again every CRM_COUNTERS_REPUBLISH_PERIODS polling intervals in case
+// COUNTERS_DB has been flushed or has lost the writes, like on a reconnection
+#define CRM_COUNTERS_REPUBLISH_PERIODS 12
+
 enum class CrmResourceType
 {
     CRM_IPV4_ROUTE,
@@ -92,6 +98,8 @@ public:
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
+    std::shared_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
+    std::shared_ptr<swss::Table> m_countersCrmPipeTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
     struct CrmResourceCounter
@@ -100,6 +108,12 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // Last values written to COUNTERS_DB, used to publish deltas only
+        bool availablePublished = false;
+        bool usedPublished = false;
+        uint32_t publishedAvailableCounter = 0;
+        uint32_t publishedUsedCounter = 0;
     };
 
     struct CrmResourceEntry
@@ -115,16 +129,31 @@ private:
         std::map<std::string, CrmResourceCounter> countersMap;
 
         CrmResourceStatus resStatus = CrmResourceStatus::CRM_RES_SUPPORTED;
+
+        // Availability is read through the bulk switch attribute query
+        bool useSwitchAttr = false;
+        // Number of timer ticks to skip before the next availability poll
+        uint32_t pollCountdown = 0;
     };
 
     std::chrono::seconds m_pollingInterval;
+    bool m_adaptivePolling = false;
+    // Number of timer ticks before all the counters are written to COUNTERS_DB again
+    uint32_t m_republishCountdown = 0;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
+    void setTimerInterval();
+    bool isResPollDue(CrmResourceEntry &res);
+    void updateResPollCountdown(CrmResourceEntry &res);
+    uint64_t getCrmUtilization(const CrmResourceEntry &res, const CrmResourceCounter &cnt, uint32_t &percentageUtil);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    void getSwitchResAvailability(std::vector<CrmResourceType> &types);
+    bool getAclTableResAvailability(CrmResourceType type, CrmResourceEntry &res, const std::set<std::string> &skipKeys = {});
+    void getAclTableResAvailability(CrmResourceEntry &entryRes, CrmResourceEntry &counterRes);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
     void getResAvailableCounters();
     void updateCrmCountersTable();
@@ -24,6 +24,12 @@ extern Directory<Orch*> gDirectory;
 
 const int FdbOrch::fdborch_pri = 20;
 
+/* FDB updates of the same MAC and VLAN are coalesced within a batch */
+static string getFdbUpdateKey(const FdbEntry& entry)
+{
+    return entry.mac.to_string() + ":" + to_string(entry.bv_id);
+}
+
 FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> appFdbTables,
     TableConnector stateDbFdbConnector, TableConnector stateDbMclagFdbConnector, PortsOrch *port) :
     Orch(applDbConnector, appFdbTables),
@@ -73,10 +79,10 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     const Port& port = update.port;
     const MacAddress& mac = entry.mac;
     string portName = port.m_alias;
-    Port vlan;
 
     oldFdbData.origin = FDB_ORIGIN_INVALID;
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+    if (vlan == nullptr)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate \
                          vlan port from bv_id 0x%" PRIx64, entry.bv_id);
@@ -84,7 +90,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 
     // ref: https://github.com/Azure/sonic-swss/blob/master/doc/swss-schema.md#fdb_table
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + mac.to_string();
 
     if (update.add)
     {
@@ -185,10 +191,10 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
     update.add = false;
 
     /* Fetch Vlan and decrement the counter */
-    Port temp_vlan;
-    if (m_portsOrch->getPort(entry.bv_id, temp_vlan))
+    const Port *temp_vlan = m_portsOrch->findPort(entry.bv_id);
+    if (temp_vlan != nullptr)
     {
-        m_portsOrch->decrFdbCount(temp_vlan.m_alias, 1);
+        m_portsOrch->decrFdbCount(temp_vlan->m_alias, 1);
     }
 
     /* Decrement port fdb_counter */
@@ -196,7 +202,7 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
 
     /* Remove the FdbEntry from the internal cache, update state DB and CRM counter */
     storeFdbEntryState(update);
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
     SWSS_LOG_INFO("FdbEntry removed from internal cache, MAC: %s , port: %s, BVID: 0x%" PRIx64,
                    update.entry.mac.to_string().c_str(), update.entry.port_name.c_str(), update.entry.bv_id);
@@ -388,7 +394,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                     update.add = true;
                     update.type = "dynamic";
                     storeFdbEntryState(update);
-                    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+                    notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
                     return;
                 }
@@ -412,7 +418,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         m_portsOrch->setPort(vlan.m_alias, vlan);
 
         storeFdbEntryState(update);
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
         break;
     }
@@ -541,7 +547,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         }
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
         notifyTunnelOrch(update.port);
         break;
@@ -616,7 +622,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         storeFdbEntryState(update);
 
-        notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+        notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
         notifyTunnelOrch(port_old);
 
@@ -668,7 +674,7 @@ void FdbOrch::update(SubjectType type, void *cntx)
             break;
     }
 
-    return;
+    flushNotifications();
 }
 
 bool FdbOrch::getPort(const MacAddress& mac, uint16_t vlan, Port& port)
@@ -910,6 +916,8 @@ void FdbOrch::doTask(Consumer& consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    flushNotifications();
 }
 
 void FdbOrch::doTask(NotificationConsumer& consumer)
@@ -1065,6 +1073,8 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
         }
 
         sai_deserialize_free_fdb_event_ntf(count, fdbevent);
+
+        flushNotifications();
     }
 }
 
@@ -1181,14 +1191,14 @@ void FdbOrch::updatePortOperState(const PortOperStateUpdate& update)
         m_portsOrch->getPortVlanMembers(p, vlan_members);
         for (const auto& vlan_member: vlan_members)
         {
-            swss::Port vlan;
             string vlan_alias = VLAN_PREFIX + to_string(vlan_member.first);
-            if (!m_portsOrch->getPort(vlan_alias, vlan))
+            const Port *vlan = m_portsOrch->findPort(vlan_alias);
+            if (vlan == nullptr)
             {
                 SWSS_LOG_INFO("Failed to locate VLAN %s", vlan_alias.c_str());
                 continue;
             }
-            notifyObserversFDBFlush(p, vlan.m_vlan_info.vlan_oid);
+            notifyObserversFDBFlush(p, vlan->m_vlan_info.vlan_oid);
         }
 
     }
@@ -1579,7 +1589,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
     update.type = fdbData.type;
     update.add = true;
 
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
     return true;
 }
@@ -1689,7 +1699,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
     update.type = fdbData.type;
     update.add = false;
 
-    notify(SUBJECT_TYPE_FDB_CHANGE, &update);
+    notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, getFdbUpdateKey(update.entry), update);
 
     notifyTunnelOrch(update.port);
 
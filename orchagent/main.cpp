@@ -29,6 +29,7 @@ extern "C" {
 #include <signal.h>
 #include "warm_restart.h"
 #include "gearboxutils.h"
+#include "tokenize.h"
 
 using namespace std;
 using namespace swss;
@@ -50,7 +51,9 @@ MacAddress gVxlanMacAddress;
 extern size_t gMaxBulkSize;
 
 #define DEFAULT_BATCH_SIZE  128
+#define DEFAULT_SLOW_DRAIN_THRESHOLD_MS 1000
 extern int gBatchSize;
+extern int gSlowDrainThresholdMs;
 
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
@@ -71,7 +74,7 @@ string gMyAsicName = "";
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-Q zmq_tables] [-p sai_profiler_interval] [-t slow_drain_ms]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -90,6 +93,11 @@ void usage()
     cout << "    -j sairedis_rec_filename: sairedis record log filename(default sairedis.rec)" << endl;
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
     cout << "    -q zmq_server_address: ZMQ server address (default disable ZMQ)" << endl;
+    cout << "    -Q zmq_tables: comma separated list of the APPL_DB tables to also consume over ZMQ, next to redis, requires -q" << endl;
+    cout << "                   supported tables: " << APP_ROUTE_TABLE_NAME << ", " << APP_NEIGH_TABLE_NAME << ", " << APP_VNET_RT_TUNNEL_TABLE_NAME << " (default none)" << endl;
+    cout << "    -p sai_profiler_interval: time the SAI calls and export the latency histograms to COUNTERS_DB" << endl;
+    cout << "                              every sai_profiler_interval seconds (default disabled)" << endl;
+    cout << "    -t slow_drain_ms: log the consumer drains which take longer than slow_drain_ms, 0 to disable (default 1000)" << endl;
 }
 
 void sighup_handler(int signo)
@@ -102,6 +110,14 @@ void sighup_handler(int signo)
     Recorder::Instance().respub.setRotate(true);
 }
 
+void sigusr1_handler(int signo)
+{
+    /*
+     * Don't do any logging since they are using mutexes.
+     */
+    SaiProfiler::requestDump();
+}
+
 void syncd_apply_view()
 {
     SWSS_LOG_NOTICE("Notify syncd APPLY_VIEW");
@@ -332,19 +348,27 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    if (signal(SIGUSR1, sigusr1_handler) == SIG_ERR)
+    {
+        SWSS_LOG_ERROR("failed to setup SIGUSR1 action");
+        exit(1);
+    }
+
     int opt;
     sai_status_t status;
 
     gBatchSize = DEFAULT_BATCH_SIZE;
+    gSlowDrainThresholdMs = DEFAULT_SLOW_DRAIN_THRESHOLD_MS;
     string record_location = Recorder::DEFAULT_DIR;
     string swss_rec_filename = Recorder::SWSS_FNAME;
     string sairedis_rec_filename = Recorder::SAIREDIS_FNAME;
     string zmq_server_address = "tcp://127.0.0.1:" + to_string(ORCH_ZMQ_PORT);
     bool   enable_zmq = false;
+    set<string> zmq_tables;
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:Q:p:t:")) != -1)
     {
         switch (opt)
         {
@@ -429,6 +453,23 @@ int main(int argc, char **argv)
                 enable_zmq = true;
             }
             break;
+        case 'Q':
+            for (const auto &table : tokenize(optarg, ','))
+            {
+                if (table != APP_ROUTE_TABLE_NAME && table != APP_NEIGH_TABLE_NAME && table != APP_VNET_RT_TUNNEL_TABLE_NAME)
+                {
+                    SWSS_LOG_ERROR("Table %s can't be consumed over ZMQ. Ignoring.", table.c_str());
+                    continue;
+                }
+                zmq_tables.insert(table);
+            }
+            break;
+        case 'p':
+            SaiProfiler::enable(atoi(optarg));
+            break;
+        case 't':
+            gSlowDrainThresholdMs = atoi(optarg);
+            break;
         default: /* '?' */
             exit(EXIT_FAILURE);
         }
@@ -478,6 +519,12 @@ int main(int argc, char **argv)
     else
     {
         SWSS_LOG_NOTICE("ZMQ disabled");
+
+        if (!zmq_tables.empty())
+        {
+            SWSS_LOG_WARN("ZMQ tables are ignored, the ZMQ server is not enabled");
+            zmq_tables.clear();
+        }
     }
 
     // Get switch_type
@@ -739,6 +786,7 @@ int main(int argc, char **argv)
     if (gMySwitchType != "fabric")
     {
         orchDaemon = make_shared<OrchDaemon>(&appl_db, &config_db, &state_db, chassis_app_db.get(), zmq_server.get());
+        orchDaemon->setZmqTables(zmq_tables);
         if (gMySwitchType == "voq")
         {
             orchDaemon->setFabricEnabled(true);
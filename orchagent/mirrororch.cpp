@@ -199,6 +199,43 @@ void MirrorOrch::update(SubjectType type, void *cntx)
     }
 }
 
+void MirrorOrch::updateBatch(SubjectType type, const vector<void *> &cntxs)
+{
+    SWSS_LOG_ENTER();
+
+    if (type != SUBJECT_TYPE_FDB_CHANGE)
+    {
+        Observer::updateBatch(type, cntxs);
+        return;
+    }
+
+    // Match the sessions once against the whole batch of FDB updates
+    map<pair<sai_object_id_t, MacAddress>, const FdbUpdate *> updates;
+    for (auto cntx : cntxs)
+    {
+        const FdbUpdate *update = static_cast<const FdbUpdate *>(cntx);
+        updates[make_pair(update->entry.bv_id, update->entry.mac)] = update;
+    }
+
+    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    {
+        auto& session = it->second;
+
+        if (session.neighborInfo.port.m_type != Port::VLAN)
+        {
+            continue;
+        }
+
+        auto update = updates.find(make_pair(session.neighborInfo.port.m_vlan_info.vlan_oid, session.neighborInfo.mac));
+        if (update == updates.end())
+        {
+            continue;
+        }
+
+        updateSessionFdb(it->first, session, *update->second);
+    }
+}
+
 bool MirrorOrch::sessionExists(const string& name)
 {
     SWSS_LOG_ENTER();
@@ -1406,34 +1443,46 @@ void MirrorOrch::updateFdb(const FdbUpdate& update)
             continue;
         }
 
-        SWSS_LOG_NOTICE("Updating mirror session %s with monitor port %s",
-                name.c_str(), update.port.m_alias.c_str());
+        updateSessionFdb(name, session, update);
+    }
+}
 
-        // Get the new monitor port
-        if (update.add)
+void MirrorOrch::updateSessionFdb(const string& name, MirrorEntry& session, const FdbUpdate& update)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("Updating mirror session %s with monitor port %s",
+            name.c_str(), update.port.m_alias.c_str());
+
+    // Get the new monitor port
+    if (update.add)
+    {
+        if (session.status)
         {
-            if (session.status)
-            {
-                // Update port if changed
-                if (session.neighborInfo.portId != update.port.m_port_id)
-                {
-                    session.neighborInfo.portId = update.port.m_port_id;
-                    updateSessionDstPort(name, session);
-                }
-            }
-            else
+            // Update port if changed
+            if (session.neighborInfo.portId != update.port.m_port_id)
             {
-                // Activate session
                 session.neighborInfo.portId = update.port.m_port_id;
-                activateSession(name, session);
+                updateSessionDstPort(name, session);
             }
         }
-        // Remove the monitor port
         else
+        {
+            // Activate session
+            session.neighborInfo.portId = update.port.m_port_id;
+            activateSession(name, session);
+        }
+    }
+    // Remove the monitor port
+    else
+    {
+        // The session may not be active when the FDB entry was learnt
+        // and removed within the same batch
+        if (session.status)
         {
             deactivateSession(name, session);
-            session.neighborInfo.portId = SAI_NULL_OBJECT_ID;
         }
+        session.neighborInfo.portId = SAI_NULL_OBJECT_ID;
     }
 }
 
@@ -81,6 +81,7 @@ public:
 
     bool bake() override;
     void update(SubjectType, void *);
+    void updateBatch(SubjectType, const vector<void *> &);
     bool sessionExists(const string&);
     bool getSessionStatus(const string&, bool&);
     bool getSessionOid(const string&, sai_object_id_t&);
@@ -128,6 +129,7 @@ private:
     void updateNextHop(const NextHopUpdate&);
     void updateNeighbor(const NeighborUpdate&);
     void updateFdb(const FdbUpdate&);
+    void updateSessionFdb(const string&, MirrorEntry&, const FdbUpdate&);
     void updateLagMember(const LagMemberUpdate&);
     void updateVlanMember(const VlanMemberUpdate&);
 
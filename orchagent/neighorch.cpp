@@ -8,6 +8,7 @@
 #include "muxorch.h"
 #include "subscriberstatetable.h"
 #include "nhgorch.h"
+#include "zmqorch.h"
 
 extern sai_neighbor_api_t*         sai_neighbor_api;
 extern sai_next_hop_api_t*         sai_next_hop_api;
@@ -25,7 +26,7 @@ extern BfdOrch *gBfdOrch;
 
 const int neighorch_pri = 30;
 
-NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch, FdbOrch *fdbOrch, PortsOrch *portsOrch, DBConnector *chassisAppDb) :
+NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch, FdbOrch *fdbOrch, PortsOrch *portsOrch, DBConnector *chassisAppDb, ZmqServer *zmqServer) :
         Orch(appDb, tableName, neighorch_pri),
         m_intfsOrch(intfsOrch),
         m_fdbOrch(fdbOrch),
@@ -34,6 +35,11 @@ NeighOrch::NeighOrch(DBConnector *appDb, string tableName, IntfsOrch *intfsOrch,
 {
     SWSS_LOG_ENTER();
 
+    if (zmqServer != nullptr)
+    {
+        addExecutor(ZmqConsumer::createAlongsideRedis(appDb, tableName, neighorch_pri, *zmqServer, this));
+    }
+
     m_fdbOrch->attach(this);
 
     // Some UTs instantiate NeighOrch but gBfdOrch is null, it is not null in orchagent
@@ -120,22 +126,22 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
     for (auto entry : update.entries)
     {
         // Get Vlan object
-        Port vlan;
-        if (!m_portsOrch->getPort(entry.bv_id, vlan))
+        const Port *vlan = m_portsOrch->findPort(entry.bv_id);
+        if (vlan == nullptr)
         {
             SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port \
                              from bv_id 0x%" PRIx64 ".", entry.bv_id);
             continue;
         }
         SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s",
-                      vlan.m_alias.c_str(), update.port.m_alias.c_str());
+                      vlan->m_alias.c_str(), update.port.m_alias.c_str());
 
         // If the FDB entry MAC matches with neighbor/ARP entry MAC,
         // and ARP entry incoming interface matches with VLAN name,
         // flush neighbor/arp entry.
         for (const auto &neighborEntry : m_syncdNeighbors)
         {
-            if (neighborEntry.first.alias == vlan.m_alias &&
+            if (neighborEntry.first.alias == vlan->m_alias &&
                 neighborEntry.second.mac == entry.mac)
             {
                 resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
@@ -198,16 +204,17 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
 {
     SWSS_LOG_ENTER();
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    const Port *p = gPortsOrch->findPort(nh.alias);
+    if (p == nullptr)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        p = gPortsOrch->findPort(p->m_parent_port_id);
+        if (p == nullptr)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -322,7 +329,7 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -730,6 +737,11 @@ bool NeighOrch::getNeighborEntry(const IpAddress &ipAddress, NeighborEntry &neig
 }
 
 void NeighOrch::doTask(Consumer &consumer)
+{
+    doTask((ConsumerBase &)consumer);
+}
+
+void NeighOrch::doTask(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
@@ -791,15 +803,15 @@ void NeighOrch::doTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->findPort(alias);
+            if (p == nullptr)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -1316,7 +1328,7 @@ bool NeighOrch::removeTunnelNextHop(const NextHopKey& nh)
     return true;
 }
 
-void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
+void NeighOrch::doVoqSystemNeighTask(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
@@ -1370,15 +1382,15 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->findPort(alias);
+            if (p == nullptr)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -46,7 +46,7 @@ struct NeighborUpdate
 class NeighOrch : public Orch, public Subject, public Observer
 {
 public:
-    NeighOrch(DBConnector *db, string tableName, IntfsOrch *intfsOrch, FdbOrch *fdbOrch, PortsOrch *portsOrch, DBConnector *chassisAppDb);
+    NeighOrch(DBConnector *db, string tableName, IntfsOrch *intfsOrch, FdbOrch *fdbOrch, PortsOrch *portsOrch, DBConnector *chassisAppDb, ZmqServer *zmqServer = nullptr);
     ~NeighOrch();
 
     bool hasNextHop(const NextHopKey&);
@@ -104,7 +104,8 @@ private:
     void processFDBFlushUpdate(const FdbFlushUpdate &);
 
     void doTask(Consumer &consumer);
-    void doVoqSystemNeighTask(Consumer &consumer);
+    void doTask(ConsumerBase &consumer);
+    void doVoqSystemNeighTask(ConsumerBase &consumer);
 
     unique_ptr<Table> m_tableVoqSystemNeighTable;
     unique_ptr<Table> m_stateSystemNeighTable;
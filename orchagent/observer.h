@@ -1,7 +1,19 @@
 #ifndef SWSS_OBSERVER_H
 #define SWSS_OBSERVER_H
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
 #include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "logger.h"
 
 using namespace std;
 using namespace swss;
@@ -31,9 +43,31 @@ class Observer
 {
 public:
     virtual void update(SubjectType, void *) = 0;
+
+    /*
+     * Receives the updates queued with Subject::notifyDeferred(). Observers
+     * which can handle a batch in one pass override it, the default passes
+     * the updates one by one to update().
+     */
+    virtual void updateBatch(SubjectType type, const vector<void *> &cntxs)
+    {
+        for (auto cntx: cntxs)
+        {
+            update(type, cntx);
+        }
+    }
+
     virtual ~Observer() {}
 };
 
+struct ObserverStats
+{
+    uint64_t batches = 0;
+    uint64_t updates = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
 class Subject
 {
 public:
@@ -45,6 +79,12 @@ public:
     virtual void detach(Observer *observer)
     {
         m_observers.remove(observer);
+        m_observerStats.erase(observer);
+    }
+
+    const map<Observer *, ObserverStats> &getObserverStats() const
+    {
+        return m_observerStats;
     }
 
     virtual ~Subject() {}
@@ -59,6 +99,79 @@ protected:
             iter->update(type, cntx);
         }
     }
+
+    /*
+     * Queue an update until the next flushNotifications(). An update replaces
+     * the queued update of the same key, so the observers only get the latest
+     * state of each key of a batch.
+     */
+    template <typename T>
+    void notifyDeferred(SubjectType type, const string &key, const T &update)
+    {
+        auto &queue = m_pendingNotifications[type];
+        assert(queue.updates.empty() || queue.updateType == type_index(typeid(T)));
+        queue.updateType = type_index(typeid(T));
+
+        auto it = queue.keys.find(key);
+        if (it != queue.keys.end())
+        {
+            queue.updates[it->second] = make_shared<T>(update);
+            return;
+        }
+
+        queue.keys.emplace(key, queue.updates.size());
+        queue.updates.push_back(make_shared<T>(update));
+    }
+
+    /* Deliver the queued updates to the observers, one batch per subject type */
+    void flushNotifications()
+    {
+        while (!m_pendingNotifications.empty())
+        {
+            /* Observers may queue new updates while handling the batch */
+            auto pending = std::move(m_pendingNotifications);
+            m_pendingNotifications.clear();
+
+            for (const auto &it: pending)
+            {
+                vector<void *> cntxs;
+                cntxs.reserve(it.second.updates.size());
+                for (const auto &update: it.second.updates)
+                {
+                    cntxs.push_back(update.get());
+                }
+
+                auto observers = m_observers;
+                for (auto observer: observers)
+                {
+                    auto start = chrono::steady_clock::now();
+                    observer->updateBatch(it.first, cntxs);
+                    uint64_t us = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+                            chrono::steady_clock::now() - start).count());
+
+                    auto &stats = m_observerStats[observer];
+                    stats.batches++;
+                    stats.updates += cntxs.size();
+                    stats.totalUs += us;
+                    stats.maxUs = max(stats.maxUs, us);
+
+                    SWSS_LOG_INFO("Observer %p handled %zu updates of subject type %d in %" PRIu64 " us",
+                            static_cast<void *>(observer), cntxs.size(), it.first, us);
+                }
+            }
+        }
+    }
+
+private:
+    struct PendingNotifications
+    {
+        type_index updateType = type_index(typeid(void));
+        unordered_map<string, size_t> keys;
+        vector<shared_ptr<void>> updates;
+    };
+
+    map<SubjectType, PendingNotifications> m_pendingNotifications;
+    map<Observer *, ObserverStats> m_observerStats;
 };
 
 #endif /* SWSS_OBSERVER_H */
@@ -12,10 +12,12 @@
 #include "zmqserver.h"
 #include "zmqconsumerstatetable.h"
 #include "sai_serialize.h"
+#include "tablereader.h"
 
 using namespace swss;
 
 int gBatchSize = 0;
+int gSlowDrainThresholdMs = 0;
 
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
@@ -61,6 +63,11 @@ vector<Selectable *> Orch::getSelectables()
 }
 
 void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
+{
+    addToSync(KeyOpFieldsValuesTuple(entry));
+}
+
+void ConsumerBase::addToSync(KeyOpFieldsValuesTuple &&entry)
 {
     SWSS_LOG_ENTER();
 
@@ -79,14 +86,14 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
     if (m_toSync.find(key) == m_toSync.end())
     {
-        m_toSync.emplace(key, entry);
+        m_toSync.emplace(key, std::move(entry));
     }
 
     /* if a DEL task comes, we overwrite the old key */
     else if (op == DEL_COMMAND)
     {
         m_toSync.erase(key);
-        m_toSync.emplace(key, entry);
+        m_toSync.emplace(key, std::move(entry));
     }
     else
     {
@@ -111,7 +118,7 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
         }
         if (iter == ret.second)
         {
-            m_toSync.emplace(key, entry);
+            m_toSync.emplace(key, std::move(entry));
         }
         else
         {
@@ -155,6 +162,18 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
     return entries.size();
 }
 
+size_t ConsumerBase::addToSync(std::deque<KeyOpFieldsValuesTuple> &&entries)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& entry: entries)
+    {
+        addToSync(std::move(entry));
+    }
+
+    return entries.size();
+}
+
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
@@ -178,6 +197,24 @@ size_t ConsumerBase::refillToSync(Table* table)
     return addToSync(entries);
 }
 
+size_t ConsumerBase::refillToSync(const DBConnector* db, const string &tableName)
+{
+    TableReader reader(db, tableName);
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    size_t total_size = 0;
+
+    // Hand each batch to m_toSync as soon as it is fetched
+    while (reader.next(entries))
+    {
+        total_size += addToSync(entries);
+    }
+
+    SWSS_LOG_NOTICE("Refilled %zu entries of %s from %zu entries in table, %.0f entries/s",
+                    total_size, tableName.c_str(), reader.count(), reader.rate());
+
+    return total_size;
+}
+
 size_t ConsumerBase::refillToSync()
 {
     auto subTable = dynamic_cast<SubscriberStateTable *>(getSelectable());
@@ -200,15 +237,13 @@ size_t ConsumerBase::refillToSync()
     {
         // consumerTable is either ConsumerStateTable or ConsumerTable
         auto db = consumerTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(db, tableName);
     }
     auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
     if (zmqTable != NULL)
     {
         auto db = zmqTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(db, tableName);
     }
     return 0;
 }
@@ -248,7 +283,7 @@ void Consumer::execute()
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
         table->pops(entries);
-        update_size = addToSync(entries);
+        update_size = addToSync(std::move(entries));
     } while (update_size != 0);
 
     drain();
@@ -257,7 +292,52 @@ void Consumer::execute()
 void Consumer::drain()
 {
     if (!m_toSync.empty())
-        ((Orch *)m_orch)->doTask((Consumer&)*this);
+        accountDrain([this]() { ((Orch *)m_orch)->doTask((Consumer&)*this); });
+}
+
+void ConsumerBase::recordDrain(uint64_t us, size_t pending, const vector<string> &keys)
+{
+    size_t remaining = m_toSync.size();
+
+    m_stats.executions++;
+    m_stats.tuples += pending > remaining ? pending - remaining : 0;
+    m_stats.retries += remaining;
+    m_stats.totalUs += us;
+    m_stats.maxUs = std::max(m_stats.maxUs, us);
+
+    if (gSlowDrainThresholdMs > 0 && us >= static_cast<uint64_t>(gSlowDrainThresholdMs) * 1000)
+    {
+        m_stats.slowDrains++;
+
+        string keyList;
+        for (const auto &key: keys)
+        {
+            keyList += (keyList.empty() ? "" : ", ") + key;
+        }
+
+        SWSS_LOG_WARN("Slow drain of %s: %" PRIu64 " ms for %zu tuples, %zu left to retry, first keys: %s",
+                getName().c_str(), us / 1000, pending, remaining, keyList.c_str());
+    }
+}
+
+void ConsumerBase::exportStats(Table &table)
+{
+    if (m_stats.executions == m_exportedExecutions)
+    {
+        return;
+    }
+
+    vector<FieldValueTuple> fvs = {
+        { "executions", to_string(m_stats.executions) },
+        { "tuples", to_string(m_stats.tuples) },
+        { "retries", to_string(m_stats.retries) },
+        { "slow_drains", to_string(m_stats.slowDrains) },
+        { "total_us", to_string(m_stats.totalUs) },
+        { "max_us", to_string(m_stats.maxUs) },
+    };
+    table.set(getName(), fvs);
+
+    m_exportedExecutions = m_stats.executions;
 }
 
 size_t Orch::addExistingData(const string& tableName)
@@ -542,6 +622,20 @@ void Orch::doTask()
     }
 }
 
+void Orch::exportConsumerStats(Table &table)
+{
+    for (auto &it : m_consumerMap)
+    {
+        ConsumerBase* consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer == NULL)
+        {
+            continue;
+        }
+
+        consumer->exportStats(table);
+    }
+}
+
 void Orch::dumpPendingTasks(vector<string> &ts)
 {
     for (auto &it : m_consumerMap)
@@ -818,6 +912,11 @@ Executor *Orch::getExecutor(string executorName)
 }
 
 void Orch2::doTask(Consumer &consumer)
+{
+    doTask((ConsumerBase &)consumer);
+}
+
+void Orch2::doTask(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
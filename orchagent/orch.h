@@ -7,6 +7,7 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <chrono>
 
 extern "C" {
 #include <sai.h>
@@ -51,6 +52,11 @@ const char state_db_key_delimiter  = '|';
 
 const int default_orch_pri = 0;
 
+/* Number of keys logged for a slow drain */
+#define CONSUMER_SLOW_DRAIN_KEYS 3
+
+extern int gSlowDrainThresholdMs;
+
 typedef enum
 {
     task_success,
@@ -135,6 +141,16 @@ protected:
     swss::Selectable *getSelectable() const { return m_selectable; }
 };
 
+struct ConsumerStats
+{
+    uint64_t executions = 0;    // drains with tasks to do
+    uint64_t tuples = 0;        // tuples consumed by the orch
+    uint64_t retries = 0;       // tuples left in m_toSync after a drain
+    uint64_t slowDrains = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
 class ConsumerBase : public Executor {
 public:
     ConsumerBase(swss::Selectable *selectable, Orch *orch, const std::string &name)
@@ -160,12 +176,50 @@ public:
     void recordTuple(const swss::KeyOpFieldsValuesTuple &tuple);
 
     void addToSync(const swss::KeyOpFieldsValuesTuple &entry);
+    void addToSync(swss::KeyOpFieldsValuesTuple &&entry);
 
     // Returns: the number of entries added to m_toSync
     size_t addToSync(const std::deque<swss::KeyOpFieldsValuesTuple> &entries);
+    // Same as above, but moves the entries into m_toSync instead of copying them
+    size_t addToSync(std::deque<swss::KeyOpFieldsValuesTuple> &&entries);
 
-    size_t refillToSync();
+    virtual size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+    // Read the table in pipelined batches, feeding m_toSync batch by batch
+    size_t refillToSync(const swss::DBConnector* db, const std::string &tableName);
+
+    const ConsumerStats &getStats() const
+    {
+        return m_stats;
+    }
+
+    /* Write the stats to table, if they changed since the last export */
+    void exportStats(swss::Table &table);
+
+protected:
+    /* Run doTask on m_toSync, accounting for the time and the tuples */
+    template <typename DoTask>
+    void accountDrain(DoTask doTask)
+    {
+        std::vector<std::string> keys;
+        for (auto it = m_toSync.begin(); it != m_toSync.end() && keys.size() < CONSUMER_SLOW_DRAIN_KEYS; it++)
+        {
+            keys.push_back(it->first);
+        }
+
+        size_t pending = m_toSync.size();
+        auto start = std::chrono::steady_clock::now();
+        doTask();
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        recordDrain(static_cast<uint64_t>(us), pending, keys);
+    }
+
+private:
+    void recordDrain(uint64_t us, size_t pending, const std::vector<std::string> &keys);
+
+    ConsumerStats m_stats;
+    uint64_t m_exportedExecutions = 0;
 };
 
 class Consumer : public ConsumerBase {
@@ -240,11 +294,16 @@ public:
 
     /* Run doTask against a specific executor */
     virtual void doTask(Consumer &consumer) { };
+    /* Run doTask against a consumer which is not a Consumer, e.g. a ZmqConsumer */
+    virtual void doTask(ConsumerBase &consumer) { };
     virtual void doTask(swss::NotificationConsumer &consumer) { }
     virtual void doTask(swss::SelectableTimer &timer) { }
 
     void dumpPendingTasks(std::vector<std::string> &ts);
 
+    /* Write the execution stats of the consumers to table */
+    void exportConsumerStats(swss::Table &table);
+
     /**
      * @brief Flush pending responses
      */
@@ -293,6 +352,7 @@ public:
 
 protected:
     virtual void doTask(Consumer& consumer);
+    virtual void doTask(ConsumerBase& consumer);
 
     virtual bool addOperation(const Request& request)=0;
     virtual bool delOperation(const Request& request)=0;
@@ -22,6 +22,10 @@ using namespace swss;
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS 10 * 1000
 
+/* consumer execution stats export interval */
+#define CONSUMER_STATS_INTERVAL_MSECS 10 * 1000
+#define CONSUMER_STATS_TABLE "ORCH_CONSUMER_STATS"
+
 extern sai_switch_api_t*           sai_switch_api;
 extern sai_object_id_t             gSwitchId;
 extern string                      gMySwitchType;
@@ -77,6 +81,7 @@ OrchDaemon::OrchDaemon(DBConnector *applDb, DBConnector *configDb, DBConnector *
     SWSS_LOG_ENTER();
     m_select = new Select();
     m_lastHeartBeat = std::chrono::high_resolution_clock::now();
+    m_lastConsumerStats = m_lastHeartBeat;
 }
 
 OrchDaemon::~OrchDaemon()
@@ -176,7 +181,7 @@ bool OrchDaemon::init()
     gDirectory.set(vnet_orch);
     VNetCfgRouteOrch *cfg_vnet_rt_orch = new VNetCfgRouteOrch(m_configDb, m_applDb, cfg_vnet_tables);
     gDirectory.set(cfg_vnet_rt_orch);
-    VNetRouteOrch *vnet_rt_orch = new VNetRouteOrch(m_applDb, vnet_tables, vnet_orch);
+    VNetRouteOrch *vnet_rt_orch = new VNetRouteOrch(m_applDb, vnet_tables, vnet_orch, getZmqServer(APP_VNET_RT_TUNNEL_TABLE_NAME));
     gDirectory.set(vnet_rt_orch);
     VRFOrch *vrf_orch = new VRFOrch(m_applDb, APP_VRF_TABLE_NAME, m_stateDb, STATE_VRF_OBJECT_TABLE_NAME);
     gDirectory.set(vrf_orch);
@@ -190,7 +195,7 @@ bool OrchDaemon::init()
     gDirectory.set(chassis_frontend_orch);
 
     gIntfsOrch = new IntfsOrch(m_applDb, APP_INTF_TABLE_NAME, vrf_orch, m_chassisAppDb);
-    gNeighOrch = new NeighOrch(m_applDb, APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassisAppDb);
+    gNeighOrch = new NeighOrch(m_applDb, APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassisAppDb, getZmqServer(APP_NEIGH_TABLE_NAME));
 
     const int fgnhgorch_pri = 15;
 
@@ -215,7 +220,7 @@ bool OrchDaemon::init()
         { APP_ROUTE_TABLE_NAME,        routeorch_pri },
         { APP_LABEL_ROUTE_TABLE_NAME,  routeorch_pri }
     };
-    gRouteOrch = new RouteOrch(m_applDb, route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, vrf_orch, gFgNhgOrch, gSrv6Orch);
+    gRouteOrch = new RouteOrch(m_applDb, route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, vrf_orch, gFgNhgOrch, gSrv6Orch, getZmqServer(APP_ROUTE_TABLE_NAME));
     gNhgOrch = new NhgOrch(m_applDb, APP_NEXTHOP_GROUP_TABLE_NAME);
     gCbfNhgOrch = new CbfNhgOrch(m_applDb, APP_CLASS_BASED_NEXT_HOP_GROUP_TABLE_NAME);
 
@@ -732,6 +737,12 @@ bool OrchDaemon::init()
     TwampOrch *twamp_orch = new TwampOrch(confDbTwampTable, stateDbTwampTable, gSwitchOrch, gPortsOrch, vrf_orch);
     m_orchList.push_back(twamp_orch);
 
+    if (SaiProfiler::isEnabled())
+    {
+        m_saiProfilerOrch = new SaiProfilerOrch(new DBConnector("COUNTERS_DB", 0), SaiProfiler::getInterval());
+        m_orchList.push_back(m_saiProfilerOrch);
+    }
+
     if (WarmStart::isWarmStart())
     {
         bool suc = warmRestoreAndSyncUp();
@@ -764,6 +775,16 @@ void OrchDaemon::flush()
     }
 }
 
+ZmqServer *OrchDaemon::getZmqServer(const string &tableName) const
+{
+    if (m_zmqServer == nullptr || m_zmqTables.find(tableName) == m_zmqTables.end())
+    {
+        return nullptr;
+    }
+
+    return m_zmqServer;
+}
+
 /* Release the file handle so the log can be rotated */
 void OrchDaemon::logRotate() {
     SWSS_LOG_ENTER();
@@ -800,6 +821,7 @@ void OrchDaemon::start()
 
         auto tend = std::chrono::high_resolution_clock::now();
         heartBeat(tend);
+        exportConsumerStats(tend);
 
         auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(tend - tstart);
 
@@ -816,6 +838,13 @@ void OrchDaemon::start()
             continue;
         }
 
+        // check if SAI profiler dump is requested
+        if (SaiProfiler::isDumpRequested() && m_saiProfilerOrch)
+        {
+            SWSS_LOG_NOTICE("Performing SAI profiler dump");
+            m_saiProfilerOrch->dump();
+        }
+
         if (ret == Select::TIMEOUT)
         {
             /* Let sairedis to flush all SAI function call to ASIC DB.
@@ -1045,6 +1074,30 @@ void OrchDaemon::heartBeat(std::chrono::time_point<std::chrono::high_resolution_
     }
 }
 
+void OrchDaemon::exportConsumerStats(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent)
+{
+    auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(tcurrent - m_lastConsumerStats);
+    if (diff.count() < CONSUMER_STATS_INTERVAL_MSECS)
+    {
+        return;
+    }
+
+    m_lastConsumerStats = tcurrent;
+
+    if (!m_consumerStatsTable)
+    {
+        m_countersDb = make_unique<DBConnector>("COUNTERS_DB", 0);
+        m_countersPipeline = make_unique<RedisPipeline>(m_countersDb.get());
+        m_consumerStatsTable = make_unique<Table>(m_countersPipeline.get(), CONSUMER_STATS_TABLE, true);
+    }
+
+    for (auto *o : m_orchList)
+    {
+        o->exportConsumerStats(*m_consumerStatsTable);
+    }
+    m_countersPipeline->flush();
+}
+
 void OrchDaemon::freezeAndHeartBeat(unsigned int duration)
 {
     while (duration > 0)
@@ -47,6 +47,8 @@
 #include "srv6orch.h"
 #include "nvgreorch.h"
 #include "twamporch.h"
+#include "saiprofiler.h"
+#include "redispipeline.h"
 #include "dash/dashaclorch.h"
 #include "dash/dashorch.h"
 #include "dash/dashrouteorch.h"
@@ -82,6 +84,11 @@ public:
     {
         m_fabricQueueStatEnabled = enabled;
     }
+    /* The APPL_DB tables also consumed over ZMQ, next to redis, must be set before init() */
+    void setZmqTables(const std::set<std::string> &tables)
+    {
+        m_zmqTables = tables;
+    }
     void logRotate();
 private:
     DBConnector *m_applDb;
@@ -89,6 +96,7 @@ private:
     DBConnector *m_stateDb;
     DBConnector *m_chassisAppDb;
     ZmqServer *m_zmqServer;
+    std::set<std::string> m_zmqTables;
 
     bool m_fabricEnabled = false;
     bool m_fabricPortStatEnabled = true;
@@ -96,13 +104,25 @@ private:
 
     std::vector<Orch *> m_orchList;
     Select *m_select;
+
+    SaiProfilerOrch *m_saiProfilerOrch = nullptr;
     
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
+    std::unique_ptr<DBConnector> m_countersDb;
+    std::unique_ptr<RedisPipeline> m_countersPipeline;
+    std::unique_ptr<Table> m_consumerStatsTable;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastConsumerStats;
+
     void flush();
 
+    /* The ZMQ server when tableName is consumed over ZMQ, nullptr otherwise */
+    ZmqServer *getZmqServer(const std::string &tableName) const;
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
 
+    void exportConsumerStats(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
+
     void freezeAndHeartBeat(unsigned int duration);
 };
 
@@ -1,6 +1,5 @@
 #include "p4orch/acl_rule_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -556,41 +555,38 @@ ReturnCodeOr<P4AclRuleAppDbEntry> AclRuleManager::deserializeAclRuleAppDbEntry(
     app_db_entry.acl_table_name = acl_table_name;
     app_db_entry.db_key = concatTableNameAndRuleKey(acl_table_name, key);
     // Parse rule key : match fields and priority
-    try
+    const auto key_fields = decodeP4RTKey(key);
+    if (key_fields == nullptr)
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
+    }
+    for (const auto &key_field : *key_fields)
     {
-        const auto &rule_key_json = nlohmann::json::parse(key);
-        if (!rule_key_json.is_object())
+        if (key_field.name == kPriority)
         {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid ACL rule key: should be a JSON object.";
+            if (!key_field.is_unsigned)
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Invalid ACL rule priority type: should be uint32_t";
+            }
+            app_db_entry.priority = static_cast<sai_uint32_t>(std::stoull(key_field.value));
+            continue;
         }
-        for (auto rule_key_it = rule_key_json.begin(); rule_key_it != rule_key_json.end(); ++rule_key_it)
+        else
         {
-            if (rule_key_it.key() == kPriority)
+            const auto &tokenized_match_field = tokenize(key_field.name, kFieldDelimiter);
+            if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
             {
-                if (!rule_key_it.value().is_number_unsigned())
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Invalid ACL rule priority type: should be uint32_t";
-                }
-                app_db_entry.priority = rule_key_it.value();
-                continue;
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Unknown ACL match field string " << QuotedVar(key_field.name);
             }
-            else
+            if (!key_field.is_string)
             {
-                const auto &tokenized_match_field = tokenize(rule_key_it.key(), kFieldDelimiter);
-                if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Unknown ACL match field string " << QuotedVar(rule_key_it.key());
-                }
-                app_db_entry.match_fvs[tokenized_match_field[1]] = rule_key_it.value();
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
             }
+            app_db_entry.match_fvs[tokenized_match_field[1]] = key_field.value;
         }
     }
-    catch (std::exception &e)
-    {
-        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
-    }
 
     for (const auto &it : attributes)
     {
@@ -2100,7 +2096,7 @@ std::string AclRuleManager::verifyState(const std::string &key, const std::vecto
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, acl_rule);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, acl_rule);
     std::string asic_db_result = verifyStateAsicDb(acl_rule);
     if (cache_result.empty())
     {
@@ -2443,9 +2439,6 @@ std::string AclRuleManager::verifyStateCache(const P4AclRuleAppDbEntry &app_db_e
 
 std::string AclRuleManager::verifyStateAsicDb(const P4AclRule *acl_rule)
 {
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
-
     // Verify rule.
     auto attrs = getRuleSaiAttrs(*acl_rule);
     std::vector<swss::FieldValueTuple> exp =
@@ -2454,7 +2447,7 @@ std::string AclRuleManager::verifyStateAsicDb(const P4AclRule *acl_rule)
     std::string key =
         sai_serialize_object_type(SAI_OBJECT_TYPE_ACL_ENTRY) + ":" + sai_serialize_object_id(acl_rule->acl_entry_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -2475,7 +2468,7 @@ std::string AclRuleManager::verifyStateAsicDb(const P4AclRule *acl_rule)
         key = sai_serialize_object_type(SAI_OBJECT_TYPE_ACL_COUNTER) + ":" +
               sai_serialize_object_id(acl_rule->counter.counter_oid);
         values.clear();
-        if (!table.get(key, values))
+        if (!getAsicDbEntry(key, values))
         {
             return std::string("ASIC DB key not found ") + key;
         }
@@ -2497,7 +2490,7 @@ std::string AclRuleManager::verifyStateAsicDb(const P4AclRule *acl_rule)
         key = sai_serialize_object_type(SAI_OBJECT_TYPE_POLICER) + ":" +
               sai_serialize_object_id(acl_rule->meter.meter_oid);
         values.clear();
-        if (!table.get(key, values))
+        if (!getAsicDbEntry(key, values))
         {
             return std::string("ASIC DB key not found ") + key;
         }
@@ -999,7 +999,7 @@ std::string AclTableManager::verifyState(const std::string &key, const std::vect
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, acl_table_definition);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, acl_table_definition);
     std::string asic_db_result = verifyStateAsicDb(acl_table_definition);
     if (cache_result.empty())
     {
@@ -1172,9 +1172,6 @@ std::string AclTableManager::verifyStateCache(const P4AclTableDefinitionAppDbEnt
 
 std::string AclTableManager::verifyStateAsicDb(const P4AclTableDefinition *acl_table)
 {
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
-
     // Verify table.
     auto attrs_or = getTableSaiAttrs(*acl_table);
     if (!attrs_or.ok())
@@ -1188,7 +1185,7 @@ std::string AclTableManager::verifyStateAsicDb(const P4AclTableDefinition *acl_t
     std::string key =
         sai_serialize_object_type(SAI_OBJECT_TYPE_ACL_TABLE) + ":" + sai_serialize_object_id(acl_table->table_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -1206,7 +1203,7 @@ std::string AclTableManager::verifyStateAsicDb(const P4AclTableDefinition *acl_t
     key = sai_serialize_object_type(SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER) + ":" +
           sai_serialize_object_id(acl_table->group_member_oid);
     values.clear();
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -1239,7 +1236,7 @@ std::string AclTableManager::verifyStateAsicDb(const P4AclTableDefinition *acl_t
                                                                  /*countOnly=*/false);
             key = sai_serialize_object_type(SAI_OBJECT_TYPE_UDF_GROUP) + ":" + sai_serialize_object_id(udf_group_oid);
             values.clear();
-            if (!table.get(key, values))
+            if (!getAsicDbEntry(key, values))
             {
                 return std::string("ASIC DB key not found ") + key;
             }
@@ -1262,7 +1259,7 @@ std::string AclTableManager::verifyStateAsicDb(const P4AclTableDefinition *acl_t
                                                                  /*countOnly=*/false);
             key = sai_serialize_object_type(SAI_OBJECT_TYPE_UDF) + ":" + sai_serialize_object_id(udf_oid);
             values.clear();
-            if (!table.get(key, values))
+            if (!getAsicDbEntry(key, values))
             {
                 return std::string("ASIC DB key not found ") + key;
             }
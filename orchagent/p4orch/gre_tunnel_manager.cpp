@@ -1,7 +1,6 @@
 #include "p4orch/gre_tunnel_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -220,15 +219,14 @@ ReturnCodeOr<P4GreTunnelAppDbEntry> GreTunnelManager::deserializeP4GreTunnelAppD
     app_db_entry.encap_src_ip = swss::IpAddress("0.0.0.0");
     app_db_entry.encap_dst_ip = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.tunnel_id = j[prependMatchField(p4orch::kTunnelId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *tunnel_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kTunnelId));
+    if (tunnel_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize GRE tunnel id";
     }
+    app_db_entry.tunnel_id = *tunnel_id;
 
     for (const auto &it : attributes)
     {
@@ -511,7 +509,7 @@ std::string GreTunnelManager::verifyState(const std::string &key, const std::vec
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, gre_tunnel_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, gre_tunnel_entry);
     std::string asic_db_result = verifyStateAsicDb(gre_tunnel_entry);
     if (cache_result.empty())
     {
@@ -592,14 +590,11 @@ std::string GreTunnelManager::verifyStateCache(const P4GreTunnelAppDbEntry &app_
 
 std::string GreTunnelManager::verifyStateAsicDb(const P4GreTunnelEntry *gre_tunnel_entry)
 {
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
-
     // Verify Overlay router interface ASIC DB attributes
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTER_INTERFACE) + ":" +
                       sai_serialize_object_id(gre_tunnel_entry->overlay_if_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -625,7 +620,7 @@ std::string GreTunnelManager::verifyStateAsicDb(const P4GreTunnelEntry *gre_tunn
     key =
         sai_serialize_object_type(SAI_OBJECT_TYPE_TUNNEL) + ":" + sai_serialize_object_id(gre_tunnel_entry->tunnel_oid);
     values.clear();
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -1,7 +1,6 @@
 #include "p4orch/l3_admit_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -160,13 +159,23 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
 
     P4L3AdmitAppDbEntry app_db_entry = {};
 
+    const auto key_fields = decodeP4RTKey(key);
+    if (key_fields == nullptr)
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+    }
+
     try
     {
-        nlohmann::json j = nlohmann::json::parse(key);
         // "match/dst_mac":"00:02:03:04:00:00&ff:ff:ff:ff:00:00"
-        if (j.find(prependMatchField(p4orch::kDstMac)) != j.end())
+        const auto *dst_mac_field = getP4RTKeyField(*key_fields, prependMatchField(p4orch::kDstMac));
+        if (dst_mac_field != nullptr)
         {
-            std::string dst_mac_data_and_mask = j[prependMatchField(p4orch::kDstMac)];
+            if (!dst_mac_field->is_string)
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+            }
+            const std::string &dst_mac_data_and_mask = dst_mac_field->value;
             const auto &data_and_mask = swss::tokenize(dst_mac_data_and_mask, p4orch::kDataMaskDelimiter);
             app_db_entry.mac_address_data = swss::MacAddress(trim(data_and_mask[0]));
             if (data_and_mask.size() > 1)
@@ -186,18 +195,23 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
         }
 
         // "priority":2030
-        auto priority_j = j[p4orch::kPriority];
-        if (!priority_j.is_number_unsigned())
+        const auto *priority_field = getP4RTKeyField(*key_fields, p4orch::kPriority);
+        if (priority_field == nullptr || !priority_field->is_unsigned)
         {
             return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                    << "Invalid l3 admit entry priority type: should be uint32_t";
         }
-        app_db_entry.priority = static_cast<uint32_t>(priority_j);
+        app_db_entry.priority = static_cast<uint32_t>(std::stoull(priority_field->value));
 
         // "match/in_port":"Ethernet0"
-        if (j.find(prependMatchField(p4orch::kInPort)) != j.end())
+        const auto *in_port_field = getP4RTKeyField(*key_fields, prependMatchField(p4orch::kInPort));
+        if (in_port_field != nullptr)
         {
-            app_db_entry.port_name = j[prependMatchField(p4orch::kInPort)];
+            if (!in_port_field->is_string)
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+            }
+            app_db_entry.port_name = in_port_field->value;
         }
     }
     catch (std::exception &ex)
@@ -386,7 +400,7 @@ std::string L3AdmitManager::verifyState(const std::string &key, const std::vecto
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, l3_admit_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, l3_admit_entry);
     std::string asic_db_result = verifyStateAsicDb(l3_admit_entry);
     if (cache_result.empty())
     {
@@ -451,12 +465,10 @@ std::string L3AdmitManager::verifyStateAsicDb(const P4L3AdmitEntry *l3_admit_ent
         saimeta::SaiAttributeList::serialize_attr_list(SAI_OBJECT_TYPE_MY_MAC, (uint32_t)attrs.size(), attrs.data(),
                                                        /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key =
         sai_serialize_object_type(SAI_OBJECT_TYPE_MY_MAC) + ":" + sai_serialize_object_id(l3_admit_entry->l3_admit_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
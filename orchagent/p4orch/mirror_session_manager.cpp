@@ -1,7 +1,6 @@
 #include "p4orch/mirror_session_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 
 #include "SaiAttributeList.h"
 #include "dbconnector.h"
@@ -24,29 +23,23 @@ namespace p4orch
 ReturnCode MirrorSessionManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                               std::string &object_key)
 {
-    std::string value;
-
-    try
+    const auto key_fields = decodeP4RTKey(json_key);
+    if (key_fields == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kMirrorSessionId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kMirrorSessionId)).get<std::string>();
-            object_key = KeyGenerator::generateMirrorSessionKey(value);
-            object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
-    catch (std::exception &ex)
+
+    const auto *value = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kMirrorSessionId));
+    if (value == nullptr)
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
 
-    return StatusCode::SWSS_RC_INVALID_PARAM;
+    object_key = KeyGenerator::generateMirrorSessionKey(*value);
+    object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
+    return ReturnCode();
 }
 
 void MirrorSessionManager::enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry)
@@ -187,15 +180,14 @@ ReturnCodeOr<P4MirrorSessionAppDbEntry> MirrorSessionManager::deserializeP4Mirro
 
     P4MirrorSessionAppDbEntry app_db_entry = {};
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.mirror_session_id = j[prependMatchField(p4orch::kMirrorSessionId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *mirror_session_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kMirrorSessionId));
+    if (mirror_session_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize mirror session id";
     }
+    app_db_entry.mirror_session_id = *mirror_session_id;
 
     for (const auto &it : attributes)
     {
@@ -807,7 +799,7 @@ std::string MirrorSessionManager::verifyState(const std::string &key, const std:
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, mirror_session_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, mirror_session_entry);
     std::string asic_db_result = verifyStateAsicDb(mirror_session_entry);
     if (cache_result.empty())
     {
@@ -910,12 +902,10 @@ std::string MirrorSessionManager::verifyStateAsicDb(const P4MirrorSessionEntry *
         SAI_OBJECT_TYPE_MIRROR_SESSION, (uint32_t)attrs.size(), attrs.data(),
         /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_MIRROR_SESSION) + ":" +
                       sai_serialize_object_id(mirror_session_entry->mirror_session_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -1,8 +1,8 @@
 #include "p4orch/neighbor_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -47,6 +47,89 @@ std::vector<sai_attribute_t> getSaiAttrs(const P4NeighborEntry &neighbor_entry)
     return attrs;
 }
 
+// Creates SAI neighbor entries with one bulk call, or one by one for a single
+// entry or when the bulk API is not supported. Returns the status of each.
+std::vector<sai_status_t> createSaiNeighborEntries(const std::vector<sai_neighbor_entry_t> &neighbor_entries,
+                                                   const std::vector<std::vector<sai_attribute_t>> &attrs_list)
+{
+    const size_t count = neighbor_entries.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count > 1 && sai_neighbor_api->create_neighbor_entries != nullptr)
+    {
+        std::vector<uint32_t> attr_counts(count);
+        std::vector<const sai_attribute_t *> attr_lists(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            attr_counts[i] = static_cast<uint32_t>(attrs_list[i].size());
+            attr_lists[i] = attrs_list[i].data();
+        }
+        sai_status_t status = sai_neighbor_api->create_neighbor_entries(
+            static_cast<uint32_t>(count), neighbor_entries.data(), attr_counts.data(), attr_lists.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] = sai_neighbor_api->create_neighbor_entry(
+            &neighbor_entries[i], static_cast<uint32_t>(attrs_list[i].size()), attrs_list[i].data());
+    }
+    return statuses;
+}
+
+// Removes SAI neighbor entries like createSaiNeighborEntries().
+std::vector<sai_status_t> removeSaiNeighborEntries(const std::vector<sai_neighbor_entry_t> &neighbor_entries)
+{
+    const size_t count = neighbor_entries.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count > 1 && sai_neighbor_api->remove_neighbor_entries != nullptr)
+    {
+        sai_status_t status =
+            sai_neighbor_api->remove_neighbor_entries(static_cast<uint32_t>(count), neighbor_entries.data(),
+                                                      SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] = sai_neighbor_api->remove_neighbor_entry(&neighbor_entries[i]);
+    }
+    return statuses;
+}
+
+// Sets attrs[i] on SAI neighbor entry i like createSaiNeighborEntries().
+std::vector<sai_status_t> setSaiNeighborEntriesAttribute(const std::vector<sai_neighbor_entry_t> &neighbor_entries,
+                                                         const std::vector<sai_attribute_t> &attrs)
+{
+    const size_t count = neighbor_entries.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count > 1 && sai_neighbor_api->set_neighbor_entries_attribute != nullptr)
+    {
+        sai_status_t status = sai_neighbor_api->set_neighbor_entries_attribute(
+            static_cast<uint32_t>(count), neighbor_entries.data(), attrs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+            statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] = sai_neighbor_api->set_neighbor_entry_attribute(&neighbor_entries[i], &attrs[i]);
+    }
+    return statuses;
+}
+
 } // namespace
 
 P4NeighborEntry::P4NeighborEntry(const std::string &router_interface_id, const swss::IpAddress &ip_address,
@@ -88,16 +171,17 @@ ReturnCodeOr<P4NeighborAppDbEntry> NeighborManager::deserializeNeighborEntry(
 
     P4NeighborAppDbEntry app_db_entry = {};
     std::string ip_address;
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_intf_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-        ip_address = j[prependMatchField(p4orch::kNeighborId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *router_intf_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kRouterInterfaceId));
+    const std::string *neighbor_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kNeighborId));
+    if (router_intf_id == nullptr || neighbor_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize key";
     }
+    app_db_entry.router_intf_id = *router_intf_id;
+    ip_address = *neighbor_id;
     try
     {
         app_db_entry.neighbor_id = swss::IpAddress(ip_address);
@@ -172,6 +256,16 @@ ReturnCode NeighborManager::createNeighbor(P4NeighborEntry &neighbor_entry)
 {
     SWSS_LOG_ENTER();
 
+    std::vector<P4NeighborEntry> neighbor_entries{neighbor_entry};
+    auto statuses = createNeighbors(neighbor_entries);
+    neighbor_entry = neighbor_entries[0];
+    return statuses[0];
+}
+
+ReturnCode NeighborManager::prepareNeighborCreation(P4NeighborEntry &neighbor_entry)
+{
+    SWSS_LOG_ENTER();
+
     const std::string &neighbor_key = neighbor_entry.neighbor_key;
     if (getNeighborEntry(neighbor_key) != nullptr)
     {
@@ -186,31 +280,72 @@ ReturnCode NeighborManager::createNeighbor(P4NeighborEntry &neighbor_entry)
     }
 
     ASSIGN_OR_RETURN(neighbor_entry.neigh_entry, getSaiEntry(neighbor_entry));
-    auto attrs = getSaiAttrs(neighbor_entry);
+    return ReturnCode();
+}
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_neighbor_api->create_neighbor_entry(
-                                       &neighbor_entry.neigh_entry, static_cast<uint32_t>(attrs.size()), attrs.data()),
-                                   "Failed to create neighbor with key " << QuotedVar(neighbor_key));
+std::vector<ReturnCode> NeighborManager::createNeighbors(std::vector<P4NeighborEntry> &neighbor_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(neighbor_entries.size());
+    std::vector<sai_neighbor_entry_t> sai_neighbor_entries;
+    std::vector<std::vector<sai_attribute_t>> attrs_list;
+    std::vector<size_t> indice;
 
-    m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key);
-    if (neighbor_entry.neighbor_id.isV4())
+    for (size_t i = 0; i < neighbor_entries.size(); ++i)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        statuses[i] = prepareNeighborCreation(neighbor_entries[i]);
+        if (!statuses[i].ok())
+        {
+            continue;
+        }
+        sai_neighbor_entries.push_back(neighbor_entries[i].neigh_entry);
+        attrs_list.push_back(getSaiAttrs(neighbor_entries[i]));
+        indice.push_back(i);
     }
-    else
+
+    auto object_statuses = createSaiNeighborEntries(sai_neighbor_entries, attrs_list);
+
+    for (size_t j = 0; j < indice.size(); ++j)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        const auto &neighbor_entry = neighbor_entries[indice[j]];
+        const std::string &neighbor_key = neighbor_entry.neighbor_key;
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to create neighbor with key " << QuotedVar(neighbor_key));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to create neighbor with key " << QuotedVar(neighbor_key);
+            continue;
+        }
+
+        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key);
+        if (neighbor_entry.neighbor_id.isV4())
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        }
+        else
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        }
+
+        m_neighborTable[neighbor_key] = neighbor_entry;
+        m_p4OidMapper->setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
     }
 
-    m_neighborTable[neighbor_key] = neighbor_entry;
-    m_p4OidMapper->setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    return ReturnCode();
+    return statuses;
 }
 
 ReturnCode NeighborManager::removeNeighbor(const std::string &neighbor_key)
 {
     SWSS_LOG_ENTER();
 
+    return removeNeighbors({neighbor_key})[0];
+}
+
+ReturnCode NeighborManager::validateNeighborRemoval(const std::string &neighbor_key)
+{
+    SWSS_LOG_ENTER();
+
     auto *neighbor_entry = getNeighborEntry(neighbor_key);
     if (neighbor_entry == nullptr)
     {
@@ -231,41 +366,109 @@ ReturnCode NeighborManager::removeNeighbor(const std::string &neighbor_key)
                              << " referenced by other objects (ref_count = " << ref_count << ")");
     }
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_neighbor_api->remove_neighbor_entry(&neighbor_entry->neigh_entry),
-                                   "Failed to remove neighbor with key " << QuotedVar(neighbor_key));
+    return ReturnCode();
+}
 
-    m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry->router_intf_key);
-    if (neighbor_entry->neighbor_id.isV4())
+std::vector<ReturnCode> NeighborManager::removeNeighbors(const std::vector<std::string> &neighbor_keys)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(neighbor_keys.size());
+    std::vector<sai_neighbor_entry_t> sai_neighbor_entries;
+    std::vector<size_t> indice;
+
+    for (size_t i = 0; i < neighbor_keys.size(); ++i)
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        statuses[i] = validateNeighborRemoval(neighbor_keys[i]);
+        if (!statuses[i].ok())
+        {
+            continue;
+        }
+        sai_neighbor_entries.push_back(getNeighborEntry(neighbor_keys[i])->neigh_entry);
+        indice.push_back(i);
     }
-    else
+
+    auto object_statuses = removeSaiNeighborEntries(sai_neighbor_entries);
+
+    for (size_t j = 0; j < indice.size(); ++j)
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        const std::string &neighbor_key = neighbor_keys[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to remove neighbor with key " << QuotedVar(neighbor_key));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to remove neighbor with key " << QuotedVar(neighbor_key);
+            continue;
+        }
+
+        auto *neighbor_entry = getNeighborEntry(neighbor_key);
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry->router_intf_key);
+        if (neighbor_entry->neighbor_id.isV4())
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        }
+        else
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        }
+
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
+        m_neighborTable.erase(neighbor_key);
     }
 
-    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    m_neighborTable.erase(neighbor_key);
-    return ReturnCode();
+    return statuses;
 }
 
 ReturnCode NeighborManager::setDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address)
 {
     SWSS_LOG_ENTER();
 
-    if (neighbor_entry->dst_mac_address == mac_address)
-        return ReturnCode();
+    return setDstMacAddresses({neighbor_entry}, {mac_address})[0];
+}
 
-    sai_attribute_t neigh_attr;
-    neigh_attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
-    memcpy(neigh_attr.value.mac, mac_address.getMac(), sizeof(sai_mac_t));
-    CHECK_ERROR_AND_LOG_AND_RETURN(
-        sai_neighbor_api->set_neighbor_entry_attribute(&neighbor_entry->neigh_entry, &neigh_attr),
-        "Failed to set mac address " << QuotedVar(mac_address.to_string()) << " for neighbor with key "
-                                     << QuotedVar(neighbor_entry->neighbor_key));
+std::vector<ReturnCode> NeighborManager::setDstMacAddresses(const std::vector<P4NeighborEntry *> &neighbor_entries,
+                                                            const std::vector<swss::MacAddress> &mac_addresses)
+{
+    SWSS_LOG_ENTER();
 
-    neighbor_entry->dst_mac_address = mac_address;
-    return ReturnCode();
+    std::vector<ReturnCode> statuses(neighbor_entries.size());
+    std::vector<sai_neighbor_entry_t> sai_neighbor_entries;
+    std::vector<sai_attribute_t> neigh_attrs;
+    std::vector<size_t> indice;
+
+    for (size_t i = 0; i < neighbor_entries.size(); ++i)
+    {
+        if (neighbor_entries[i]->dst_mac_address == mac_addresses[i])
+            continue;
+
+        sai_attribute_t neigh_attr;
+        neigh_attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+        memcpy(neigh_attr.value.mac, mac_addresses[i].getMac(), sizeof(sai_mac_t));
+        sai_neighbor_entries.push_back(neighbor_entries[i]->neigh_entry);
+        neigh_attrs.push_back(neigh_attr);
+        indice.push_back(i);
+    }
+
+    auto object_statuses = setSaiNeighborEntriesAttribute(sai_neighbor_entries, neigh_attrs);
+
+    for (size_t j = 0; j < indice.size(); ++j)
+    {
+        auto *neighbor_entry = neighbor_entries[indice[j]];
+        const auto &mac_address = mac_addresses[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to set mac address "
+                                                    << QuotedVar(mac_address.to_string()) << " for neighbor with key "
+                                                    << QuotedVar(neighbor_entry->neighbor_key));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to set mac address " << QuotedVar(mac_address.to_string())
+                                  << " for neighbor with key " << QuotedVar(neighbor_entry->neighbor_key);
+            continue;
+        }
+        neighbor_entry->dst_mac_address = mac_address;
+    }
+
+    return statuses;
 }
 
 ReturnCode NeighborManager::processAddRequest(const P4NeighborAppDbEntry &app_db_entry, const std::string &neighbor_key)
@@ -327,40 +530,40 @@ ReturnCode NeighborManager::processDeleteRequest(const std::string &neighbor_key
 ReturnCode NeighborManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                          std::string &object_key)
 {
-    std::string router_intf_id, neighbor_id;
-    swss::IpAddress neighbor;
+    const auto key_fields = decodeP4RTKey(json_key);
+    if (key_fields == nullptr)
+    {
+        SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
+    }
+
+    const auto *router_intf_id = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kRouterInterfaceId));
+    if (router_intf_id == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kRouterInterfaceId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
+    }
+    const auto *neighbor_id = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kNeighborId));
+    if (neighbor_id == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
+    }
 
+    swss::IpAddress neighbor;
     try
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
-        {
-            router_intf_id = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            if (j.find(prependMatchField(p4orch::kNeighborId)) != j.end())
-            {
-                neighbor_id = j.at(prependMatchField(p4orch::kNeighborId)).get<std::string>();
-                neighbor = swss::IpAddress(neighbor_id);
-                object_key = KeyGenerator::generateNeighborKey(router_intf_id, neighbor);
-                object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
-                return ReturnCode();
-            }
-            else
-            {
-                SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
-            }
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
-        }
+        neighbor = swss::IpAddress(*neighbor_id);
     }
     catch (std::exception &ex)
     {
         SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
 
-    return StatusCode::SWSS_RC_INVALID_PARAM;
+    object_key = KeyGenerator::generateNeighborKey(*router_intf_id, neighbor);
+    object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
+    return ReturnCode();
 }
 
 void NeighborManager::enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry)
@@ -372,6 +575,45 @@ void NeighborManager::drain()
 {
     SWSS_LOG_ENTER();
 
+    // Consecutive creates, updates or deletes of distinct neighbors are
+    // programmed with one bulk SAI call. The pending batch is flushed before
+    // any other operation, and before a neighbor shows up twice, so entries
+    // are still applied in order.
+    std::vector<P4NeighborEntry> create_list;
+    std::vector<P4NeighborEntry *> update_list;
+    std::vector<swss::MacAddress> update_mac_list;
+    std::vector<std::string> delete_list;
+    std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+    std::unordered_set<std::string> neighbor_keys;
+
+    auto flush = [&]() {
+        std::vector<ReturnCode> statuses;
+        if (!create_list.empty())
+        {
+            statuses = createNeighbors(create_list);
+        }
+        else if (!update_list.empty())
+        {
+            statuses = setDstMacAddresses(update_list, update_mac_list);
+        }
+        else if (!delete_list.empty())
+        {
+            statuses = removeNeighbors(delete_list);
+        }
+        for (size_t i = 0; i < statuses.size(); ++i)
+        {
+            m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]), kfvFieldsValues(tuple_list[i]),
+                                 statuses[i],
+                                 /*replace=*/true);
+        }
+        create_list.clear();
+        update_list.clear();
+        update_mac_list.clear();
+        delete_list.clear();
+        tuple_list.clear();
+        neighbor_keys.clear();
+    };
+
     for (const auto &key_op_fvs_tuple : m_entries)
     {
         std::string table_name;
@@ -386,6 +628,7 @@ void NeighborManager::drain()
             status = app_db_entry_or.status();
             SWSS_LOG_ERROR("Unable to deserialize APP DB entry with key %s: %s",
                            QuotedVar(table_name + ":" + db_key).c_str(), status.message().c_str());
+            flush();
             m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                  status,
                                  /*replace=*/true);
@@ -398,6 +641,7 @@ void NeighborManager::drain()
         {
             SWSS_LOG_ERROR("Validation failed for Neighbor APP DB entry with key %s: %s",
                            QuotedVar(table_name + ":" + db_key).c_str(), status.message().c_str());
+            flush();
             m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                  status,
                                  /*replace=*/true);
@@ -406,6 +650,10 @@ void NeighborManager::drain()
 
         const std::string neighbor_key =
             KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id);
+        if (neighbor_keys.count(neighbor_key) != 0)
+        {
+            flush();
+        }
 
         const std::string &operation = kfvOp(key_op_fvs_tuple);
         if (operation == SET_COMMAND)
@@ -414,27 +662,61 @@ void NeighborManager::drain()
             if (neighbor_entry == nullptr)
             {
                 // Create neighbor
-                status = processAddRequest(app_db_entry, neighbor_key);
+                if (!app_db_entry.is_set_dst_mac)
+                {
+                    flush();
+                    status = processAddRequest(app_db_entry, neighbor_key);
+                }
+                else
+                {
+                    if (!update_list.empty() || !delete_list.empty())
+                    {
+                        flush();
+                    }
+                    create_list.emplace_back(app_db_entry.router_intf_id, app_db_entry.neighbor_id,
+                                             app_db_entry.dst_mac_address);
+                    tuple_list.push_back(key_op_fvs_tuple);
+                    neighbor_keys.insert(neighbor_key);
+                    continue;
+                }
             }
             else
             {
                 // Modify existing neighbor
-                status = processUpdateRequest(app_db_entry, neighbor_entry);
+                if (!create_list.empty() || !delete_list.empty())
+                {
+                    flush();
+                }
+                update_list.push_back(neighbor_entry);
+                update_mac_list.push_back(app_db_entry.is_set_dst_mac ? app_db_entry.dst_mac_address
+                                                                      : neighbor_entry->dst_mac_address);
+                tuple_list.push_back(key_op_fvs_tuple);
+                neighbor_keys.insert(neighbor_key);
+                continue;
             }
         }
         else if (operation == DEL_COMMAND)
         {
             // Delete neighbor
-            status = processDeleteRequest(neighbor_key);
+            if (!create_list.empty() || !update_list.empty())
+            {
+                flush();
+            }
+            delete_list.push_back(neighbor_key);
+            tuple_list.push_back(key_op_fvs_tuple);
+            neighbor_keys.insert(neighbor_key);
+            continue;
         }
         else
         {
+            flush();
             status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Unknown operation type " << QuotedVar(operation);
             SWSS_LOG_ERROR("%s", status.message().c_str());
         }
         m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple), status,
                              /*replace=*/true);
     }
+    flush();
     m_entries.clear();
 }
 
@@ -482,7 +764,7 @@ std::string NeighborManager::verifyState(const std::string &key, const std::vect
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, neighbor_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, neighbor_entry);
     std::string asic_db_result = verifyStateAsicDb(neighbor_entry);
     if (cache_result.empty())
     {
@@ -562,12 +844,10 @@ std::string NeighborManager::verifyStateAsicDb(const P4NeighborEntry *neighbor_e
         SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, (uint32_t)attrs.size(), attrs.data(),
         /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key =
         sai_serialize_object_type(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY) + ":" + sai_serialize_neighbor_entry(sai_entry);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -61,8 +61,16 @@ class NeighborManager : public ObjectManagerInterface
     ReturnCode validateNeighborAppDbEntry(const P4NeighborAppDbEntry &app_db_entry);
     P4NeighborEntry *getNeighborEntry(const std::string &neighbor_key);
     ReturnCode createNeighbor(P4NeighborEntry &neighbor_entry);
+    ReturnCode prepareNeighborCreation(P4NeighborEntry &neighbor_entry);
+    // Creates a batch of neighbors with one bulk SAI call. Returns the status of
+    // each neighbor.
+    std::vector<ReturnCode> createNeighbors(std::vector<P4NeighborEntry> &neighbor_entries);
     ReturnCode removeNeighbor(const std::string &neighbor_key);
+    ReturnCode validateNeighborRemoval(const std::string &neighbor_key);
+    std::vector<ReturnCode> removeNeighbors(const std::vector<std::string> &neighbor_keys);
     ReturnCode setDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address);
+    std::vector<ReturnCode> setDstMacAddresses(const std::vector<P4NeighborEntry *> &neighbor_entries,
+                                               const std::vector<swss::MacAddress> &mac_addresses);
     ReturnCode processAddRequest(const P4NeighborAppDbEntry &app_db_entry, const std::string &neighbor_key);
     ReturnCode processUpdateRequest(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry *neighbor_entry);
     ReturnCode processDeleteRequest(const std::string &neighbor_key);
@@ -1,8 +1,8 @@
 #include "p4orch/next_hop_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -150,29 +150,23 @@ ReturnCodeOr<std::vector<sai_attribute_t>> NextHopManager::getSaiAttrs(const P4N
 ReturnCode NextHopManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                         std::string &object_key)
 {
-    std::string value;
-
-    try
+    const auto key_fields = decodeP4RTKey(json_key);
+    if (key_fields == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kNexthopId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kNexthopId)).get<std::string>();
-            object_key = KeyGenerator::generateNextHopKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
-    catch (std::exception &ex)
+
+    const auto *value = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kNexthopId));
+    if (value == nullptr)
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
 
-    return StatusCode::SWSS_RC_INVALID_PARAM;
+    object_key = KeyGenerator::generateNextHopKey(*value);
+    object_type = SAI_OBJECT_TYPE_NEXT_HOP;
+    return ReturnCode();
 }
 
 void NextHopManager::enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry)
@@ -184,6 +178,37 @@ void NextHopManager::drain()
 {
     SWSS_LOG_ENTER();
 
+    // Consecutive creates, or consecutive deletes, of distinct next hops are
+    // programmed with one bulk SAI call. The pending batch is flushed before
+    // any other operation, and before a next hop shows up twice, so entries
+    // are still applied in order.
+    std::vector<P4NextHopEntry> create_list;
+    std::vector<std::string> delete_list;
+    std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+    std::unordered_set<std::string> next_hop_keys;
+
+    auto flush = [&]() {
+        std::vector<ReturnCode> statuses;
+        if (!create_list.empty())
+        {
+            statuses = createNextHops(create_list);
+        }
+        else if (!delete_list.empty())
+        {
+            statuses = removeNextHops(delete_list);
+        }
+        for (size_t i = 0; i < statuses.size(); ++i)
+        {
+            m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]), kfvFieldsValues(tuple_list[i]),
+                                 statuses[i],
+                                 /*replace=*/true);
+        }
+        create_list.clear();
+        delete_list.clear();
+        tuple_list.clear();
+        next_hop_keys.clear();
+    };
+
     for (const auto &key_op_fvs_tuple : m_entries)
     {
         std::string table_name;
@@ -198,6 +223,7 @@ void NextHopManager::drain()
             status = app_db_entry_or.status();
             SWSS_LOG_ERROR("Unable to deserialize APP DB entry with key %s: %s",
                            QuotedVar(table_name + ":" + key).c_str(), status.message().c_str());
+            flush();
             m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                  status,
                                  /*replace=*/true);
@@ -206,6 +232,10 @@ void NextHopManager::drain()
         auto &app_db_entry = *app_db_entry_or;
 
         const std::string next_hop_key = KeyGenerator::generateNextHopKey(app_db_entry.next_hop_id);
+        if (next_hop_keys.count(next_hop_key) != 0)
+        {
+            flush();
+        }
 
         // Fulfill the operation.
         const std::string &operation = kfvOp(key_op_fvs_tuple);
@@ -216,6 +246,7 @@ void NextHopManager::drain()
             {
                 SWSS_LOG_ERROR("Validation failed for Nexthop APP DB entry with key %s: %s",
                                QuotedVar(kfvKey(key_op_fvs_tuple)).c_str(), status.message().c_str());
+                flush();
                 m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                      status,
                                      /*replace=*/true);
@@ -225,27 +256,45 @@ void NextHopManager::drain()
             if (next_hop_entry == nullptr)
             {
                 // Create new next hop.
-                status = processAddRequest(app_db_entry);
+                if (!delete_list.empty())
+                {
+                    flush();
+                }
+                create_list.emplace_back(app_db_entry.next_hop_id, app_db_entry.router_interface_id,
+                                         app_db_entry.gre_tunnel_id, app_db_entry.neighbor_id);
+                tuple_list.push_back(key_op_fvs_tuple);
+                next_hop_keys.insert(next_hop_key);
+                continue;
             }
             else
             {
                 // Modify existing next hop.
+                flush();
                 status = processUpdateRequest(app_db_entry, next_hop_entry);
             }
         }
         else if (operation == DEL_COMMAND)
         {
             // Delete next hop.
-            status = processDeleteRequest(next_hop_key);
+            if (!create_list.empty())
+            {
+                flush();
+            }
+            delete_list.push_back(next_hop_key);
+            tuple_list.push_back(key_op_fvs_tuple);
+            next_hop_keys.insert(next_hop_key);
+            continue;
         }
         else
         {
+            flush();
             status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Unknown operation type " << QuotedVar(operation);
             SWSS_LOG_ERROR("%s", status.message().c_str());
         }
         m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple), status,
                              /*replace=*/true);
     }
+    flush();
     m_entries.clear();
 }
 
@@ -273,15 +322,14 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     P4NextHopAppDbEntry app_db_entry = {};
     app_db_entry.neighbor_id = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.next_hop_id = j[prependMatchField(p4orch::kNexthopId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *next_hop_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kNexthopId));
+    if (next_hop_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize next hop id";
     }
+    app_db_entry.next_hop_id = *next_hop_id;
 
     for (const auto &it : attributes)
     {
@@ -339,6 +387,16 @@ ReturnCode NextHopManager::createNextHop(P4NextHopEntry &next_hop_entry)
 {
     SWSS_LOG_ENTER();
 
+    std::vector<P4NextHopEntry> next_hop_entries{next_hop_entry};
+    auto statuses = createNextHops(next_hop_entries);
+    next_hop_entry = next_hop_entries[0];
+    return statuses[0];
+}
+
+ReturnCodeOr<std::vector<sai_attribute_t>> NextHopManager::prepareNextHopCreation(P4NextHopEntry &next_hop_entry)
+{
+    SWSS_LOG_ENTER();
+
     // Check the existence of the next hop in next hop manager and centralized
     // mapper.
     if (getNextHopEntry(next_hop_entry.next_hop_key) != nullptr)
@@ -381,43 +439,80 @@ ReturnCode NextHopManager::createNextHop(P4NextHopEntry &next_hop_entry)
                              << " does not exist in centralized mapper");
     }
 
-    ASSIGN_OR_RETURN(std::vector<sai_attribute_t> attrs, getSaiAttrs(next_hop_entry));
+    return getSaiAttrs(next_hop_entry);
+}
 
-    // Call SAI API.
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_next_hop_api->create_next_hop(&next_hop_entry.next_hop_oid, gSwitchId,
-                                                                     (uint32_t)attrs.size(), attrs.data()),
-                                   "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key));
+std::vector<ReturnCode> NextHopManager::createNextHops(std::vector<P4NextHopEntry> &next_hop_entries)
+{
+    SWSS_LOG_ENTER();
 
-    if (!next_hop_entry.gre_tunnel_id.empty())
-    {
-        // On successful creation, increment ref count for tunnel object
-        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
-                                        KeyGenerator::generateTunnelKey(next_hop_entry.gre_tunnel_id));
-    }
-    else
-    {
-        // On successful creation, increment ref count for router intf object
-        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
-                                        KeyGenerator::generateRouterInterfaceKey(next_hop_entry.router_interface_id));
-    }
+    std::vector<ReturnCode> statuses(next_hop_entries.size());
+    std::vector<std::vector<sai_attribute_t>> attrs_list;
+    std::vector<size_t> indice;
 
-    m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    if (next_hop_entry.neighbor_id.isV4())
+    for (size_t i = 0; i < next_hop_entries.size(); ++i)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        auto attrs_or = prepareNextHopCreation(next_hop_entries[i]);
+        if (!attrs_or.ok())
+        {
+            statuses[i] = attrs_or.status();
+            continue;
+        }
+        attrs_list.push_back(*attrs_or);
+        indice.push_back(i);
     }
-    else
+
+    // Call SAI API.
+    std::vector<sai_object_id_t> next_hop_oids;
+    auto object_statuses = createSaiObjects(SAI_OBJECT_TYPE_NEXT_HOP, gSwitchId, attrs_list, next_hop_oids,
+                                            sai_next_hop_api->create_next_hop);
+
+    for (size_t j = 0; j < indice.size(); ++j)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
-    }
+        auto &next_hop_entry = next_hop_entries[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key);
+            continue;
+        }
+        next_hop_entry.next_hop_oid = next_hop_oids[j];
 
-    // Add created entry to internal table.
-    m_nextHopTable.emplace(next_hop_entry.next_hop_key, next_hop_entry);
+        if (!next_hop_entry.gre_tunnel_id.empty())
+        {
+            // On successful creation, increment ref count for tunnel object
+            m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
+                                            KeyGenerator::generateTunnelKey(next_hop_entry.gre_tunnel_id));
+        }
+        else
+        {
+            // On successful creation, increment ref count for router intf object
+            m_p4OidMapper->increaseRefCount(
+                SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                KeyGenerator::generateRouterInterfaceKey(next_hop_entry.router_interface_id));
+        }
 
-    // Add the key to OID map to centralized mapper.
-    m_p4OidMapper->setOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_entry.next_hop_key, next_hop_entry.next_hop_oid);
+        m_p4OidMapper->increaseRefCount(
+            SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+            KeyGenerator::generateNeighborKey(next_hop_entry.router_interface_id, next_hop_entry.neighbor_id));
+        if (next_hop_entry.neighbor_id.isV4())
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        }
+        else
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
+        }
 
-    return ReturnCode();
+        // Add created entry to internal table.
+        m_nextHopTable.emplace(next_hop_entry.next_hop_key, next_hop_entry);
+
+        // Add the key to OID map to centralized mapper.
+        m_p4OidMapper->setOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_entry.next_hop_key, next_hop_entry.next_hop_oid);
+    }
+
+    return statuses;
 }
 
 ReturnCode NextHopManager::processUpdateRequest(const P4NextHopAppDbEntry &app_db_entry, P4NextHopEntry *next_hop_entry)
@@ -448,6 +543,13 @@ ReturnCode NextHopManager::removeNextHop(const std::string &next_hop_key)
 {
     SWSS_LOG_ENTER();
 
+    return removeNextHops({next_hop_key})[0];
+}
+
+ReturnCode NextHopManager::validateNextHopRemoval(const std::string &next_hop_key)
+{
+    SWSS_LOG_ENTER();
+
     // Check the existence of the next hop in next hop manager and centralized
     // mapper.
     auto *next_hop_entry = getNextHopEntry(next_hop_key);
@@ -472,10 +574,14 @@ ReturnCode NextHopManager::removeNextHop(const std::string &next_hop_key)
                              << " referenced by other objects (ref_count = " << ref_count);
     }
 
-    // Call SAI API.
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_next_hop_api->remove_next_hop(next_hop_entry->next_hop_oid),
-                                   "Failed to remove next hop " << QuotedVar(next_hop_entry->next_hop_key));
+    return ReturnCode();
+}
 
+ReturnCode NextHopManager::finishNextHopRemoval(const std::string &next_hop_key)
+{
+    SWSS_LOG_ENTER();
+
+    auto *next_hop_entry = getNextHopEntry(next_hop_key);
     if (!next_hop_entry->gre_tunnel_id.empty())
     {
         // On successful deletion, decrement ref count for tunnel object
@@ -523,6 +629,45 @@ ReturnCode NextHopManager::removeNextHop(const std::string &next_hop_key)
     return ReturnCode();
 }
 
+std::vector<ReturnCode> NextHopManager::removeNextHops(const std::vector<std::string> &next_hop_keys)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(next_hop_keys.size());
+    std::vector<sai_object_id_t> next_hop_oids;
+    std::vector<size_t> indice;
+
+    for (size_t i = 0; i < next_hop_keys.size(); ++i)
+    {
+        statuses[i] = validateNextHopRemoval(next_hop_keys[i]);
+        if (!statuses[i].ok())
+        {
+            continue;
+        }
+        next_hop_oids.push_back(getNextHopEntry(next_hop_keys[i])->next_hop_oid);
+        indice.push_back(i);
+    }
+
+    // Call SAI API.
+    auto object_statuses =
+        removeSaiObjects(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_oids, sai_next_hop_api->remove_next_hop);
+
+    for (size_t j = 0; j < indice.size(); ++j)
+    {
+        const auto &next_hop_key = next_hop_keys[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to remove next hop " << QuotedVar(next_hop_key));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to remove next hop " << QuotedVar(next_hop_key);
+            continue;
+        }
+        statuses[indice[j]] = finishNextHopRemoval(next_hop_key);
+    }
+
+    return statuses;
+}
+
 std::string NextHopManager::verifyState(const std::string &key, const std::vector<swss::FieldValueTuple> &tuple)
 {
     SWSS_LOG_ENTER();
@@ -565,7 +710,7 @@ std::string NextHopManager::verifyState(const std::string &key, const std::vecto
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, next_hop_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, next_hop_entry);
     std::string asic_db_result = verifyStateAsicDb(next_hop_entry);
     if (cache_result.empty())
     {
@@ -671,12 +816,10 @@ std::string NextHopManager::verifyStateAsicDb(const P4NextHopEntry *next_hop_ent
         saimeta::SaiAttributeList::serialize_attr_list(SAI_OBJECT_TYPE_NEXT_HOP, (uint32_t)attrs.size(), attrs.data(),
                                                        /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_NEXT_HOP) + ":" +
                       sai_serialize_object_id(next_hop_entry->next_hop_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ipaddress.h"
 #include "orch.h"
@@ -78,6 +79,13 @@ class NextHopManager : public ObjectManagerInterface
     // Creates an next hop in the next hop table. Return true on success.
     ReturnCode createNextHop(P4NextHopEntry &next_hop_entry);
 
+    // Creates a batch of next hops with one bulk SAI call. Returns the status
+    // of each next hop.
+    std::vector<ReturnCode> createNextHops(std::vector<P4NextHopEntry> &next_hop_entries);
+
+    // Validates a next hop to create and returns its SAI attributes.
+    ReturnCodeOr<std::vector<sai_attribute_t>> prepareNextHopCreation(P4NextHopEntry &next_hop_entry);
+
     // Processes update operation for an entry.
     ReturnCode processUpdateRequest(const P4NextHopAppDbEntry &app_db_entry, P4NextHopEntry *next_hop_entry);
 
@@ -87,6 +95,16 @@ class NextHopManager : public ObjectManagerInterface
     // Deletes an next hop in the next hop table. Return true on success.
     ReturnCode removeNextHop(const std::string &next_hop_key);
 
+    // Deletes a batch of next hops with one bulk SAI call. Returns the status
+    // of each next hop.
+    std::vector<ReturnCode> removeNextHops(const std::vector<std::string> &next_hop_keys);
+
+    // Validates a next hop to delete.
+    ReturnCode validateNextHopRemoval(const std::string &next_hop_key);
+
+    // Releases the references and the cache of a next hop removed from SAI.
+    ReturnCode finishNextHopRemoval(const std::string &next_hop_key);
+
     // Verifies internal cache for an entry.
     std::string verifyStateCache(const P4NextHopAppDbEntry &app_db_entry, const P4NextHopEntry *next_hop_entry);
 
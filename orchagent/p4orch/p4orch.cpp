@@ -1,5 +1,8 @@
 #include "p4orch.h"
 
+#include <chrono>
+#include <cinttypes>
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -22,6 +25,7 @@
 #include "portsorch.h"
 #include "return_code.h"
 #include "sai_serialize.h"
+#include "tablereader.h"
 #include "timer.h"
 
 extern PortsOrch *gPortsOrch;
@@ -30,7 +34,7 @@ extern PortsOrch *gPortsOrch;
 #define APP_P4RT_EXT_TABLES_MANAGER "EXT_TABLES_MANAGER"
 
 P4Orch::P4Orch(swss::DBConnector *db, std::vector<std::string> tableNames, VRFOrch *vrfOrch, CoppOrch *coppOrch)
-    : Orch(db, tableNames)
+    : Orch(db, tableNames), m_applDb(db)
 {
     SWSS_LOG_ENTER();
 
@@ -156,6 +160,117 @@ void P4Orch::doTask(Consumer &consumer)
     }
 }
 
+ObjectManagerInterface *P4Orch::getManager(const std::string &table_name)
+{
+    auto it = m_p4TableToManagerMap.find(table_name);
+    if (it != m_p4TableToManagerMap.end())
+    {
+        return it->second;
+    }
+    if (table_name.rfind(p4orch::kTablePrefixEXT, 0) != std::string::npos)
+    {
+        return m_p4TableToManagerMap[APP_P4RT_EXT_TABLES_MANAGER];
+    }
+    return nullptr;
+}
+
+P4StateVerificationReport P4Orch::verifyStates(const std::vector<swss::KeyOpFieldsValuesTuple> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    // A first pass collects the ASIC DB keys which the verifications look up,
+    // without comparing anything, so that exactly those entries are read
+    // before the verifications run.
+    const auto start = std::chrono::steady_clock::now();
+    AsicDbStateBatch asic_db_batch(/*load_object_types=*/false);
+    asic_db_batch.collectKeys();
+    verifyEntries(entries, asic_db_batch);
+    asic_db_batch.loadCollectedKeys();
+
+    auto report = verifyEntries(entries, asic_db_batch);
+    report.duration_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    SWSS_LOG_NOTICE("Verified %zu P4RT entries in %" PRIu64 " us, %zu mismatches, %zu ASIC DB entries read",
+                    report.verified_count, report.duration_us, report.mismatches.size(), report.asic_db_entry_count);
+    return report;
+}
+
+P4StateVerificationReport P4Orch::verifyEntries(const std::vector<swss::KeyOpFieldsValuesTuple> &entries,
+                                                const AsicDbStateBatch &asic_db_batch)
+{
+    SWSS_LOG_ENTER();
+
+    P4StateVerificationReport report;
+    for (const auto &entry : entries)
+    {
+        const std::string &key = kfvKey(entry);
+        std::string p4rt_table;
+        std::string p4rt_key;
+        parseP4RTKey(key, &p4rt_table, &p4rt_key);
+        std::string table_name;
+        std::string key_content;
+        parseP4RTKey(p4rt_key, &table_name, &key_content);
+
+        std::string result;
+        auto *manager = p4rt_table == APP_P4RT_TABLE_NAME ? getManager(table_name) : nullptr;
+        if (manager == nullptr)
+        {
+            result = std::string("Invalid key: ") + key;
+        }
+        else
+        {
+            result = manager->verifyState(key, kfvFieldsValues(entry));
+        }
+
+        report.verified_count++;
+        if (!result.empty())
+        {
+            report.mismatches.emplace_back(key, result);
+        }
+    }
+
+    report.asic_db_entry_count = asic_db_batch.getEntryCount();
+    return report;
+}
+
+P4StateVerificationReport P4Orch::verifyTableState(const std::string &table_name)
+{
+    SWSS_LOG_ENTER();
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::string table_prefix = std::string(APP_P4RT_TABLE_NAME) + p4orch::kTableKeyDelimiter + table_name;
+    std::vector<swss::KeyOpFieldsValuesTuple> entries;
+    try
+    {
+        swss::TableReader reader(m_applDb, table_prefix);
+        std::deque<swss::KeyOpFieldsValuesTuple> batch;
+        while (reader.next(batch))
+        {
+            for (auto &entry : batch)
+            {
+                kfvKey(entry) = table_prefix + p4orch::kTableKeyDelimiter + kfvKey(entry);
+                entries.push_back(std::move(entry));
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        P4StateVerificationReport report;
+        report.mismatches.emplace_back(table_prefix, std::string("Failed to read APPL DB: ") + e.what());
+        SWSS_LOG_ERROR("Failed to read P4RT table %s: %s", table_name.c_str(), e.what());
+        return report;
+    }
+
+    // The whole table is verified, so each object type is read in one pass.
+    AsicDbStateBatch asic_db_batch;
+    auto report = verifyEntries(entries, asic_db_batch);
+    report.duration_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    SWSS_LOG_NOTICE("Verified P4RT table %s in %" PRIu64 " us, %zu mismatches, %zu ASIC DB entries read",
+                    table_name.c_str(), report.duration_us, report.mismatches.size(), report.asic_db_entry_count);
+    return report;
+}
+
 void P4Orch::doTask(swss::SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
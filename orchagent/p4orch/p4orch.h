@@ -20,6 +20,7 @@
 #include "p4orch/next_hop_manager.h"
 #include "p4orch/object_manager_interface.h"
 #include "p4orch/p4oidmapper.h"
+#include "p4orch/p4orch_util.h"
 #include "p4orch/route_manager.h"
 #include "p4orch/router_interface_manager.h"
 #include "p4orch/tables_definition_manager.h"
@@ -52,6 +53,14 @@ class P4Orch : public Orch
     GreTunnelManager *getGreTunnelManager();
     TablesInfo *tablesinfo = NULL;
 
+    // Verifies the state of a batch of P4RT entries, with keys and attributes
+    // as in ObjectManagerInterface::verifyState(). The ASIC DB entries which
+    // the batch looks up are read in one pipelined pass.
+    P4StateVerificationReport verifyStates(const std::vector<swss::KeyOpFieldsValuesTuple> &entries);
+    // Verifies all the entries of a P4RT table of APPL DB, e.g. FIXED_IPV4_TABLE.
+    // ASIC DB is read once per SAI object type for the whole table.
+    P4StateVerificationReport verifyTableState(const std::string &table_name);
+
     // m_p4TableToManagerMap: P4 APP DB table name, P4 Object Manager
     std::unordered_map<std::string, ObjectManagerInterface *> m_p4TableToManagerMap;
 
@@ -60,10 +69,16 @@ class P4Orch : public Orch
     void doTask(swss::SelectableTimer &timer);
     void doTask(swss::NotificationConsumer &consumer);
     void handlePortStatusChangeNotification(const std::string &op, const std::string &data);
+    // Returns the manager of a P4RT table, or nullptr.
+    ObjectManagerInterface *getManager(const std::string &table_name);
+    // Verifies the entries against the ASIC DB entries served by asic_db_batch.
+    P4StateVerificationReport verifyEntries(const std::vector<swss::KeyOpFieldsValuesTuple> &entries,
+                                            const AsicDbStateBatch &asic_db_batch);
 
     // P4 object manager request processing order.
     std::vector<ObjectManagerInterface *> m_p4ManagerPrecedence;
 
+    swss::DBConnector *m_applDb;
     swss::SelectableTimer *m_aclCounterStatsTimer;
     swss::SelectableTimer *m_extCounterStatsTimer;
     P4OidMapper m_p4OidMapper;
@@ -1,10 +1,23 @@
 #include "p4orch/p4orch_util.h"
 
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <nlohmann/json.hpp>
+
+#include "dbconnector.h"
+#include "logger.h"
 #include "p4orch/p4orch.h"
 #include "schema.h"
+#include "tablereader.h"
+extern "C"
+{
+#include "sai.h"
+}
 
 using ::p4orch::kTableKeyDelimiter;
 extern P4Orch *gP4Orch;
+extern int gBatchSize;
 
 // Prepends "match/" to the input string str to construct a new string.
 std::string prependMatchField(const std::string &str)
@@ -31,10 +44,305 @@ void parseP4RTKey(const std::string &key, std::string *table_name, std::string *
     *key_content = key.substr(pos + 1);
 }
 
+namespace
+{
+
+// A key is decoded again while its entry is in flight: on validation, on the
+// state verification and on retry, and when the entries of later batches
+// refer to it. The cache holds the keys of this many batches of gBatchSize
+// (orchagent -b) entries, 16384 keys with the default batch size.
+constexpr size_t kP4RTKeyCacheBatches = 128;
+// Longest unsigned integer which cannot overflow uint64_t.
+constexpr size_t kMaxFastUnsignedDigits = 19;
+
+// Least recently used cache of decoded P4RT keys.
+class P4RTKeyCache
+{
+  public:
+    std::shared_ptr<const P4RTKeyFields> find(const std::string &key_content)
+    {
+        auto it = m_entries.find(key_content);
+        if (it == m_entries.end())
+        {
+            return nullptr;
+        }
+        m_lru.splice(m_lru.begin(), m_lru, it->second.second);
+        return it->second.first;
+    }
+
+    void insert(const std::string &key_content, std::shared_ptr<const P4RTKeyFields> fields)
+    {
+        if (m_entries.size() >= kP4RTKeyCacheBatches * static_cast<size_t>(std::max(gBatchSize, 1)))
+        {
+            m_entries.erase(*m_lru.back());
+            m_lru.pop_back();
+        }
+        auto it = m_entries.emplace(key_content, std::make_pair(std::move(fields), m_lru.end())).first;
+        m_lru.push_front(&it->first);
+        it->second.second = m_lru.begin();
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_lru.clear();
+    }
+
+  private:
+    // Most recently used first, points to the keys of m_entries.
+    std::list<const std::string *> m_lru;
+    std::unordered_map<std::string,
+                       std::pair<std::shared_ptr<const P4RTKeyFields>, std::list<const std::string *>::iterator>>
+        m_entries;
+};
+
+P4RTKeyCache &getP4RTKeyCache()
+{
+    static P4RTKeyCache cache;
+    return cache;
+}
+
+// Adds a field to fields, a later field of the same name replaces the former
+// one as in the JSON parser.
+void addP4RTKeyField(P4RTKeyFields &fields, P4RTKeyField field)
+{
+    for (auto &f : fields)
+    {
+        if (f.name == field.name)
+        {
+            f = std::move(field);
+            return;
+        }
+    }
+    fields.push_back(std::move(field));
+}
+
+void skipWhitespace(const std::string &s, size_t &pos)
+{
+    while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t' || s[pos] == '\n' || s[pos] == '\r'))
+    {
+        ++pos;
+    }
+}
+
+// Reads a JSON string without escapes at s[pos].
+bool readFastString(const std::string &s, size_t &pos, std::string &out)
+{
+    if (pos >= s.size() || s[pos] != '"')
+    {
+        return false;
+    }
+    size_t start = ++pos;
+    while (pos < s.size())
+    {
+        unsigned char c = static_cast<unsigned char>(s[pos]);
+        if (c == '"')
+        {
+            out.assign(s, start, pos - start);
+            ++pos;
+            return true;
+        }
+        // Escapes, control characters and non-ASCII characters are left to
+        // the JSON parser.
+        if (c == '\\' || c < 0x20 || c >= 0x80)
+        {
+            return false;
+        }
+        ++pos;
+    }
+    return false;
+}
+
+// Single pass decoder of a flat JSON object of strings and unsigned integers.
+// Returns false if the content needs the JSON parser.
+bool decodeFastP4RTKey(const std::string &s, P4RTKeyFields &fields)
+{
+    size_t pos = 0;
+    skipWhitespace(s, pos);
+    if (pos >= s.size() || s[pos] != '{')
+    {
+        return false;
+    }
+    ++pos;
+    skipWhitespace(s, pos);
+    if (pos < s.size() && s[pos] == '}')
+    {
+        ++pos;
+    }
+    else
+    {
+        while (true)
+        {
+            P4RTKeyField field = {};
+            if (!readFastString(s, pos, field.name))
+            {
+                return false;
+            }
+            skipWhitespace(s, pos);
+            if (pos >= s.size() || s[pos] != ':')
+            {
+                return false;
+            }
+            ++pos;
+            skipWhitespace(s, pos);
+            if (pos < s.size() && s[pos] == '"')
+            {
+                if (!readFastString(s, pos, field.value))
+                {
+                    return false;
+                }
+                field.is_string = true;
+            }
+            else
+            {
+                size_t start = pos;
+                while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9')
+                {
+                    ++pos;
+                }
+                size_t digits = pos - start;
+                if (digits == 0 || digits > kMaxFastUnsignedDigits || (digits > 1 && s[start] == '0'))
+                {
+                    return false;
+                }
+                field.value.assign(s, start, digits);
+                field.is_unsigned = true;
+            }
+            addP4RTKeyField(fields, std::move(field));
+            skipWhitespace(s, pos);
+            if (pos >= s.size())
+            {
+                return false;
+            }
+            if (s[pos] == ',')
+            {
+                ++pos;
+                skipWhitespace(s, pos);
+                continue;
+            }
+            if (s[pos] != '}')
+            {
+                return false;
+            }
+            ++pos;
+            break;
+        }
+    }
+    skipWhitespace(s, pos);
+    return pos == s.size();
+}
+
+// Decodes any JSON object with the JSON parser.
+bool decodeP4RTKeyWithParser(const std::string &s, P4RTKeyFields &fields)
+{
+    try
+    {
+        const auto j = nlohmann::json::parse(s);
+        if (!j.is_object())
+        {
+            return false;
+        }
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            P4RTKeyField field = {};
+            field.name = it.key();
+            if (it.value().is_string())
+            {
+                field.value = it.value().get<std::string>();
+                field.is_string = true;
+            }
+            else if (it.value().is_number_unsigned())
+            {
+                field.value = std::to_string(it.value().get<uint64_t>());
+                field.is_unsigned = true;
+            }
+            else
+            {
+                field.value = it.value().dump();
+            }
+            addP4RTKeyField(fields, std::move(field));
+        }
+    }
+    catch (std::exception &ex)
+    {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<const P4RTKeyFields> decodeP4RTKey(const std::string &key_content)
+{
+    auto &cache = getP4RTKeyCache();
+    auto cached = cache.find(key_content);
+    if (cached != nullptr)
+    {
+        return cached;
+    }
+
+    auto fields = std::make_shared<P4RTKeyFields>();
+    if (!decodeFastP4RTKey(key_content, *fields))
+    {
+        fields->clear();
+        if (!decodeP4RTKeyWithParser(key_content, *fields))
+        {
+            return nullptr;
+        }
+    }
+    std::sort(fields->begin(), fields->end(),
+              [](const P4RTKeyField &a, const P4RTKeyField &b) { return a.name < b.name; });
+
+    cache.insert(key_content, fields);
+    return fields;
+}
+
+const P4RTKeyField *getP4RTKeyField(const P4RTKeyFields &fields, const std::string &name)
+{
+    auto it = std::lower_bound(fields.begin(), fields.end(), name,
+                               [](const P4RTKeyField &field, const std::string &n) { return field.name < n; });
+    if (it == fields.end() || it->name != name)
+    {
+        return nullptr;
+    }
+    return &*it;
+}
+
+const std::string *getP4RTKeyString(const P4RTKeyFields &fields, const std::string &name)
+{
+    const auto *field = getP4RTKeyField(fields, name);
+    if (field == nullptr || !field->is_string)
+    {
+        return nullptr;
+    }
+    return &field->value;
+}
+
+size_t getP4RTKeyCacheSize()
+{
+    return getP4RTKeyCache().size();
+}
+
+void clearP4RTKeyCache()
+{
+    getP4RTKeyCache().clear();
+}
+
 std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
                         const std::vector<swss::FieldValueTuple> &exp, const std::vector<swss::FieldValueTuple> &opt,
                         bool allow_unknown)
 {
+    // The values of the ASIC DB entries are not known yet.
+    if (isCollectingAsicDbKeys())
+    {
+        return "";
+    }
+
     std::map<std::string, std::string> exp_map;
     for (const auto &fv : exp)
     {
@@ -203,6 +511,282 @@ std::string KeyGenerator::generateExtTableKey(const std::string &table_name, con
     return key;
 }
 
+namespace
+{
+
+constexpr char kAsicStateTable[] = "ASIC_STATE";
+
+AsicDbStateBatch *gAsicDbStateBatch = nullptr;
+
+swss::DBConnector *getAsicDb()
+{
+    static swss::DBConnector db("ASIC_DB", 0);
+    return &db;
+}
+
+bool readAsicDbEntry(const std::string &key, std::vector<swss::FieldValueTuple> &values)
+{
+    swss::Table table(getAsicDb(), kAsicStateTable);
+    return table.get(key, values);
+}
+
+} // namespace
+
+bool getAsicDbEntry(const std::string &key, std::vector<swss::FieldValueTuple> &values)
+{
+    if (gAsicDbStateBatch != nullptr)
+    {
+        return gAsicDbStateBatch->get(key, values);
+    }
+    return readAsicDbEntry(key, values);
+}
+
+bool isCollectingAsicDbKeys()
+{
+    return gAsicDbStateBatch != nullptr && gAsicDbStateBatch->isCollecting();
+}
+
+AsicDbStateBatch::AsicDbStateBatch(bool load_object_types)
+    : m_previous(gAsicDbStateBatch), m_loadObjectTypes(load_object_types)
+{
+    gAsicDbStateBatch = this;
+}
+
+AsicDbStateBatch::~AsicDbStateBatch()
+{
+    gAsicDbStateBatch = m_previous;
+}
+
+bool AsicDbStateBatch::get(const std::string &key, std::vector<swss::FieldValueTuple> &values)
+{
+    if (m_collecting)
+    {
+        if (m_loadedKeys.insert(key).second)
+        {
+            m_collectedKeys.push_back(key);
+        }
+        values.clear();
+        return true;
+    }
+    if (m_loadedKeys.count(key))
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            return false;
+        }
+        values = it->second;
+        return true;
+    }
+    if (!m_loadObjectTypes)
+    {
+        return readAsicDbEntry(key, values);
+    }
+
+    const std::string object_type = key.substr(0, key.find(':'));
+    if (m_failedObjectTypes.count(object_type))
+    {
+        return readAsicDbEntry(key, values);
+    }
+    if (!m_loadedObjectTypes.count(object_type))
+    {
+        try
+        {
+            loadObjectType(object_type, m_entries);
+            m_loadedObjectTypes.insert(object_type);
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to read %s entries of ASIC DB, reading them one by one: %s", object_type.c_str(),
+                           e.what());
+            m_failedObjectTypes.insert(object_type);
+            return readAsicDbEntry(key, values);
+        }
+    }
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+    values = it->second;
+    return true;
+}
+
+void AsicDbStateBatch::collectKeys()
+{
+    m_collecting = true;
+}
+
+bool AsicDbStateBatch::isCollecting() const
+{
+    return m_collecting;
+}
+
+void AsicDbStateBatch::loadCollectedKeys()
+{
+    m_collecting = false;
+    if (m_collectedKeys.empty())
+    {
+        return;
+    }
+    try
+    {
+        loadKeys(m_collectedKeys, m_entries);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("Failed to read %zu entries of ASIC DB, reading them one by one: %s", m_collectedKeys.size(),
+                       e.what());
+        for (const auto &key : m_collectedKeys)
+        {
+            m_loadedKeys.erase(key);
+            m_entries.erase(key);
+        }
+    }
+    m_collectedKeys.clear();
+}
+
+size_t AsicDbStateBatch::getEntryCount() const
+{
+    return m_entries.size();
+}
+
+void AsicDbStateBatch::loadObjectType(const std::string &object_type,
+                                      std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries)
+{
+    // Reading the "ASIC_STATE:<object type>" table returns the entries of the
+    // object type, with the keys stripped of the table name.
+    swss::TableReader reader(getAsicDb(), std::string(kAsicStateTable) + ":" + object_type);
+    std::deque<swss::KeyOpFieldsValuesTuple> batch;
+    while (reader.next(batch))
+    {
+        for (auto &entry : batch)
+        {
+            entries[object_type + ":" + kfvKey(entry)] = std::move(kfvFieldsValues(entry));
+        }
+    }
+    SWSS_LOG_INFO("Read %zu %s entries of ASIC DB at %.0f entries/s", reader.count(), object_type.c_str(),
+                  reader.rate());
+}
+
+void AsicDbStateBatch::loadKeys(const std::vector<std::string> &keys,
+                                std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries)
+{
+    swss::TableReader reader(getAsicDb(), kAsicStateTable);
+    std::deque<swss::KeyOpFieldsValuesTuple> batch;
+    reader.read(keys, batch);
+    for (auto &entry : batch)
+    {
+        entries[kfvKey(entry)] = std::move(kfvFieldsValues(entry));
+    }
+    SWSS_LOG_INFO("Read %zu of %zu ASIC DB entries at %.0f entries/s", reader.count(), keys.size(), reader.rate());
+}
+
+bool isBulkUnsupported(sai_status_t status)
+{
+    return status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED;
+}
+
+std::vector<sai_status_t> createSaiObjects(sai_object_type_t object_type, sai_object_id_t switch_id,
+                                           const std::vector<std::vector<sai_attribute_t>> &attrs_list,
+                                           std::vector<sai_object_id_t> &object_ids,
+                                           sai_status_t (*create_fn)(sai_object_id_t *, sai_object_id_t, uint32_t,
+                                                                     const sai_attribute_t *))
+{
+    const size_t count = attrs_list.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+    object_ids.assign(count, SAI_NULL_OBJECT_ID);
+
+    if (count > 1)
+    {
+        std::vector<uint32_t> attr_counts(count);
+        std::vector<const sai_attribute_t *> attr_lists(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            attr_counts[i] = static_cast<uint32_t>(attrs_list[i].size());
+            attr_lists[i] = attrs_list[i].data();
+        }
+        sai_status_t status = sai_bulk_object_create(switch_id, object_type, static_cast<uint32_t>(count),
+                                                     attr_counts.data(), attr_lists.data(),
+                                                     SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, object_ids.data(),
+                                                     statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+        SWSS_LOG_INFO("Bulk create is not supported for object type %d, creating %zu objects one by one",
+                      object_type, count);
+        object_ids.assign(count, SAI_NULL_OBJECT_ID);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] =
+            create_fn(&object_ids[i], switch_id, static_cast<uint32_t>(attrs_list[i].size()), attrs_list[i].data());
+    }
+    return statuses;
+}
+
+std::vector<sai_status_t> removeSaiObjects(sai_object_type_t object_type,
+                                           const std::vector<sai_object_id_t> &object_ids,
+                                           sai_status_t (*remove_fn)(sai_object_id_t))
+{
+    const size_t count = object_ids.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count > 1)
+    {
+        sai_status_t status = sai_bulk_object_remove(object_type, static_cast<uint32_t>(count), object_ids.data(),
+                                                     SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+        SWSS_LOG_INFO("Bulk remove is not supported for object type %d, removing %zu objects one by one",
+                      object_type, count);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] = remove_fn(object_ids[i]);
+    }
+    return statuses;
+}
+
+std::vector<sai_status_t> setSaiObjectsAttribute(sai_object_type_t object_type, sai_object_id_t switch_id,
+                                                 const std::vector<sai_object_id_t> &object_ids,
+                                                 const std::vector<sai_attribute_t> &attrs,
+                                                 sai_status_t (*set_fn)(sai_object_id_t, const sai_attribute_t *))
+{
+    const size_t count = object_ids.size();
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count > 1)
+    {
+        std::vector<sai_object_key_t> object_keys(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            object_keys[i].key.object_id = object_ids[i];
+        }
+        sai_status_t status = sai_bulk_object_set_attribute(switch_id, object_type, static_cast<uint32_t>(count),
+                                                            object_keys.data(), attrs.data(),
+                                                            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (!isBulkUnsupported(status))
+        {
+            return statuses;
+        }
+        SWSS_LOG_INFO("Bulk set is not supported for object type %d, setting %zu objects one by one", object_type,
+                      count);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        statuses[i] = set_fn(object_ids[i], &attrs[i]);
+    }
+    return statuses;
+}
+
 std::string KeyGenerator::generateKey(const std::map<std::string, std::string> &fv_map)
 {
     std::string key;
@@ -2,10 +2,12 @@
 
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ipaddress.h"
@@ -317,6 +319,44 @@ ActionInfo *getTableActionInfo(TableInfo *table, const std::string &action_name)
 // Key content: {content}
 void parseP4RTKey(const std::string &key, std::string *table_name, std::string *key_content);
 
+// A field of a P4RT key content, e.g. "match/nexthop_id":"8" or "priority":10.
+struct P4RTKeyField
+{
+    std::string name;
+    // The string value, or the JSON text of a non-string value.
+    std::string value;
+    bool is_string;
+    // True if the value is a JSON unsigned integer.
+    bool is_unsigned;
+};
+
+// The fields of a decoded P4RT key content, sorted by name.
+using P4RTKeyFields = std::vector<P4RTKeyField>;
+
+// Decodes a P4RT key content, which must be a JSON object.
+// Example: {"match/router_interface_id":"16","match/neighbor_id":"10.0.0.1"}
+// Flat objects of strings and unsigned integers, which cover the exact, LPM
+// and ternary matches and the priority, are decoded in a single pass. Other
+// contents fall back to the JSON parser. Decoded keys are kept in a least
+// recently used cache shared by all managers, since a key is decoded again on
+// modify, delete, state verification and retry. The cache size is a multiple
+// of gBatchSize.
+// Returns nullptr if the key content is not a valid JSON object.
+std::shared_ptr<const P4RTKeyFields> decodeP4RTKey(const std::string &key_content);
+
+// Returns the field of the given name in a decoded P4RT key, or nullptr.
+const P4RTKeyField *getP4RTKeyField(const P4RTKeyFields &fields, const std::string &name);
+
+// Returns the string value of the field of the given name in a decoded P4RT
+// key, or nullptr if the field is absent or is not a string.
+const std::string *getP4RTKeyString(const P4RTKeyFields &fields, const std::string &name);
+
+// Returns the number of keys in the P4RT key cache.
+size_t getP4RTKeyCacheSize();
+
+// Drops all the keys of the P4RT key cache.
+void clearP4RTKeyCache();
+
 // State verification function that verifies the table attributes.
 // Returns a non-empty string if verification fails.
 //
@@ -330,6 +370,116 @@ std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
                         const std::vector<swss::FieldValueTuple> &exp, const std::vector<swss::FieldValueTuple> &opt,
                         bool allow_unknown);
 
+// Reads the ASIC_STATE entry of the given key for state verification.
+// Example: SAI_OBJECT_TYPE_ROUTE_ENTRY:{...}
+// The ASIC DB connection is reused across verifications. While an
+// AsicDbStateBatch is alive, the entry is served by the batch.
+// Returns false if the entry does not exist.
+bool getAsicDbEntry(const std::string &key, std::vector<swss::FieldValueTuple> &values);
+
+// Returns true while the innermost AsicDbStateBatch collects keys. The ASIC DB
+// lookups then succeed with no values, verifyAttrs() compares nothing and the
+// verifications skip their internal cache checks, so that a verification only
+// walks its ASIC DB keys.
+bool isCollectingAsicDbKeys();
+
+// Scope of a batch of state verifications. The first lookup of an object type
+// in the batch reads all the ASIC_STATE entries of that type in one pass, with
+// SCAN and pipelined HGETALL, and later lookups of the type are served from
+// memory. A full table verification thus reads each object type once instead
+// of one round trip per entry. Batches can be nested, the innermost one is used.
+//
+// When load_object_types is false, the batch only serves the keys collected
+// beforehand: the lookups between collectKeys() and loadCollectedKeys() record
+// their keys, which are then read with pipelined HGETALL. Other lookups are
+// read one by one. Lookups succeed while collecting, so a verification with
+// several ASIC DB entries looks up all of them.
+class AsicDbStateBatch
+{
+  public:
+    explicit AsicDbStateBatch(bool load_object_types = true);
+    virtual ~AsicDbStateBatch();
+
+    AsicDbStateBatch(const AsicDbStateBatch &) = delete;
+    AsicDbStateBatch &operator=(const AsicDbStateBatch &) = delete;
+
+    // Looks up an ASIC_STATE entry, as getAsicDbEntry().
+    bool get(const std::string &key, std::vector<swss::FieldValueTuple> &values);
+
+    // Records the keys of the following lookups, which return true with no
+    // values until loadCollectedKeys() is called.
+    void collectKeys();
+
+    // Returns true between collectKeys() and loadCollectedKeys().
+    bool isCollecting() const;
+
+    // Reads the entries of the collected keys.
+    void loadCollectedKeys();
+
+    // Returns the number of ASIC_STATE entries read by the batch.
+    size_t getEntryCount() const;
+
+  protected:
+    // Reads all the ASIC_STATE entries of an object type into entries, keyed
+    // as in get(). Throws on DB errors.
+    virtual void loadObjectType(const std::string &object_type,
+                                std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries);
+
+    // Reads the existing ASIC_STATE entries of keys into entries. Throws on DB
+    // errors.
+    virtual void loadKeys(const std::vector<std::string> &keys,
+                          std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries);
+
+  private:
+    AsicDbStateBatch *m_previous;
+    bool m_loadObjectTypes;
+    // Object types which have been read, or could not be read.
+    std::unordered_set<std::string> m_loadedObjectTypes;
+    std::unordered_set<std::string> m_failedObjectTypes;
+    // Keys which are collected, and which have been read.
+    bool m_collecting = false;
+    std::vector<std::string> m_collectedKeys;
+    std::unordered_set<std::string> m_loadedKeys;
+    std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> m_entries;
+};
+
+// Result of a batch of state verifications.
+struct P4StateVerificationReport
+{
+    size_t verified_count = 0;
+    // Key and error of each entry which failed the verification.
+    std::vector<std::pair<std::string, std::string>> mismatches;
+    // Number of ASIC_STATE entries read for the verification.
+    size_t asic_db_entry_count = 0;
+    uint64_t duration_us = 0;
+};
+
+// Returns true if a bulk SAI call failed because the bulk API is not supported.
+bool isBulkUnsupported(sai_status_t status);
+
+// Creates SAI objects of object_type with the generic bulk API, one object per
+// entry of attrs_list. Returns the status of each object and fills object_ids
+// with the OIDs of the created objects. A single object, or all objects when
+// the bulk API is not supported, is created one at a time with create_fn.
+std::vector<sai_status_t> createSaiObjects(sai_object_type_t object_type, sai_object_id_t switch_id,
+                                           const std::vector<std::vector<sai_attribute_t>> &attrs_list,
+                                           std::vector<sai_object_id_t> &object_ids,
+                                           sai_status_t (*create_fn)(sai_object_id_t *, sai_object_id_t, uint32_t,
+                                                                     const sai_attribute_t *));
+
+// Removes SAI objects of object_type with the generic bulk API. Returns the
+// status of each object. Falls back to remove_fn like createSaiObjects().
+std::vector<sai_status_t> removeSaiObjects(sai_object_type_t object_type,
+                                           const std::vector<sai_object_id_t> &object_ids,
+                                           sai_status_t (*remove_fn)(sai_object_id_t));
+
+// Sets attrs[i] on object_ids[i] with the generic bulk API. Returns the status
+// of each object. Falls back to set_fn like createSaiObjects().
+std::vector<sai_status_t> setSaiObjectsAttribute(sai_object_type_t object_type, sai_object_id_t switch_id,
+                                                 const std::vector<sai_object_id_t> &object_ids,
+                                                 const std::vector<sai_attribute_t> &attrs,
+                                                 sai_status_t (*set_fn)(sai_object_id_t, const sai_attribute_t *));
+
 // class KeyGenerator includes member functions to generate keys for entries
 // stored in P4 Orch managers.
 class KeyGenerator
@@ -1,7 +1,6 @@
 #include "p4orch/route_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -328,34 +327,26 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
 
     P4RouteEntry route_entry = {};
     std::string route_prefix;
-    try
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *vrf_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kVrfId));
+    if (vrf_id == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        route_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-        if (table_name == APP_P4RT_IPV4_TABLE_NAME)
-        {
-            if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv4Dst)];
-            }
-            else
-            {
-                route_prefix = "0.0.0.0/0";
-            }
-        }
-        else
-        {
-            if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv6Dst)];
-            }
-            else
-            {
-                route_prefix = "::/0";
-            }
-        }
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
-    catch (std::exception &ex)
+    route_entry.vrf_id = *vrf_id;
+    const bool is_ipv4 = table_name == APP_P4RT_IPV4_TABLE_NAME;
+    const auto *dst_field =
+        getP4RTKeyField(*key_fields, prependMatchField(is_ipv4 ? p4orch::kIpv4Dst : p4orch::kIpv6Dst));
+    if (dst_field == nullptr)
+    {
+        route_prefix = is_ipv4 ? "0.0.0.0/0" : "::/0";
+    }
+    else if (dst_field->is_string)
+    {
+        route_prefix = dst_field->value;
+    }
+    else
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
@@ -1000,7 +991,7 @@ std::string RouteManager::verifyState(const std::string &key, const std::vector<
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, route_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, route_entry);
     std::string asic_db_result = verifyStateAsicDb(route_entry);
     if (cache_result.empty())
     {
@@ -1158,12 +1149,10 @@ std::string RouteManager::verifyStateAsicDb(const P4RouteEntry *route_entry)
     std::vector<swss::FieldValueTuple> opt = saimeta::SaiAttributeList::serialize_attr_list(
         SAI_OBJECT_TYPE_ROUTE_ENTRY, (uint32_t)opt_attrs.size(), opt_attrs.data(), /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTE_ENTRY) + ":" +
                       sai_serialize_route_entry(getSaiEntry(*route_entry));
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -2,9 +2,9 @@
 
 #include <map>
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -126,15 +126,14 @@ ReturnCodeOr<P4RouterInterfaceAppDbEntry> RouterInterfaceManager::deserializeRou
     SWSS_LOG_ENTER();
 
     P4RouterInterfaceAppDbEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_interface_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *router_interface_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(p4orch::kRouterInterfaceId));
+    if (router_interface_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize router interface id";
     }
+    app_db_entry.router_interface_id = *router_interface_id;
 
     for (const auto &it : attributes)
     {
@@ -183,6 +182,17 @@ ReturnCode RouterInterfaceManager::createRouterInterface(const std::string &rout
 {
     SWSS_LOG_ENTER();
 
+    std::vector<P4RouterInterfaceEntry> router_intf_entries{router_intf_entry};
+    auto statuses = createRouterInterfaces({router_intf_key}, router_intf_entries);
+    router_intf_entry = router_intf_entries[0];
+    return statuses[0];
+}
+
+ReturnCodeOr<std::vector<sai_attribute_t>> RouterInterfaceManager::prepareRouterInterfaceCreation(
+    const std::string &router_intf_key, const P4RouterInterfaceEntry &router_intf_entry)
+{
+    SWSS_LOG_ENTER();
+
     if (getRouterInterfaceEntry(router_intf_key) != nullptr)
     {
         LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_EXISTS)
@@ -196,25 +206,71 @@ ReturnCode RouterInterfaceManager::createRouterInterface(const std::string &rout
                                                                      << " already exists in the centralized map");
     }
 
-    ASSIGN_OR_RETURN(std::vector<sai_attribute_t> attrs, getSaiAttrs(router_intf_entry));
+    return getSaiAttrs(router_intf_entry);
+}
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(
-        sai_router_intfs_api->create_router_interface(&router_intf_entry.router_interface_oid, gSwitchId,
-                                                      (uint32_t)attrs.size(), attrs.data()),
-        "Failed to create router interface " << QuotedVar(router_intf_entry.router_interface_id));
+std::vector<ReturnCode> RouterInterfaceManager::createRouterInterfaces(
+    const std::vector<std::string> &router_intf_keys, std::vector<P4RouterInterfaceEntry> &router_intf_entries)
+{
+    SWSS_LOG_ENTER();
 
-    gPortsOrch->increasePortRefCount(router_intf_entry.port_name);
-    gDirectory.get<VRFOrch *>()->increaseVrfRefCount(gVirtualRouterId);
+    std::vector<ReturnCode> statuses(router_intf_entries.size());
+    std::vector<std::vector<sai_attribute_t>> attrs_list;
+    std::vector<size_t> indice;
 
-    m_routerIntfTable[router_intf_key] = router_intf_entry;
-    m_p4OidMapper->setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_intf_key, router_intf_entry.router_interface_oid);
-    return ReturnCode();
+    for (size_t i = 0; i < router_intf_entries.size(); ++i)
+    {
+        auto attrs_or = prepareRouterInterfaceCreation(router_intf_keys[i], router_intf_entries[i]);
+        if (!attrs_or.ok())
+        {
+            statuses[i] = attrs_or.status();
+            continue;
+        }
+        attrs_list.push_back(*attrs_or);
+        indice.push_back(i);
+    }
+
+    std::vector<sai_object_id_t> router_intf_oids;
+    auto object_statuses = createSaiObjects(SAI_OBJECT_TYPE_ROUTER_INTERFACE, gSwitchId, attrs_list,
+                                            router_intf_oids, sai_router_intfs_api->create_router_interface);
+
+    for (size_t j = 0; j < indice.size(); ++j)
+    {
+        const auto &router_intf_key = router_intf_keys[indice[j]];
+        auto &router_intf_entry = router_intf_entries[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to create router interface "
+                                                    << QuotedVar(router_intf_entry.router_interface_id));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to create router interface "
+                                  << QuotedVar(router_intf_entry.router_interface_id);
+            continue;
+        }
+        router_intf_entry.router_interface_oid = router_intf_oids[j];
+
+        gPortsOrch->increasePortRefCount(router_intf_entry.port_name);
+        gDirectory.get<VRFOrch *>()->increaseVrfRefCount(gVirtualRouterId);
+
+        m_routerIntfTable[router_intf_key] = router_intf_entry;
+        m_p4OidMapper->setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_intf_key,
+                              router_intf_entry.router_interface_oid);
+    }
+
+    return statuses;
 }
 
 ReturnCode RouterInterfaceManager::removeRouterInterface(const std::string &router_intf_key)
 {
     SWSS_LOG_ENTER();
 
+    return removeRouterInterfaces({router_intf_key})[0];
+}
+
+ReturnCode RouterInterfaceManager::validateRouterInterfaceRemoval(const std::string &router_intf_key)
+{
+    SWSS_LOG_ENTER();
+
     auto *router_intf_entry = getRouterInterfaceEntry(router_intf_key);
     if (router_intf_entry == nullptr)
     {
@@ -235,16 +291,54 @@ ReturnCode RouterInterfaceManager::removeRouterInterface(const std::string &rout
                              << " referenced by other objects (ref_count = " << ref_count << ")");
     }
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(
-        sai_router_intfs_api->remove_router_interface(router_intf_entry->router_interface_oid),
-        "Failed to remove router interface " << QuotedVar(router_intf_entry->router_interface_id));
+    return ReturnCode();
+}
 
-    gPortsOrch->decreasePortRefCount(router_intf_entry->port_name);
-    gDirectory.get<VRFOrch *>()->decreaseVrfRefCount(gVirtualRouterId);
+std::vector<ReturnCode> RouterInterfaceManager::removeRouterInterfaces(
+    const std::vector<std::string> &router_intf_keys)
+{
+    SWSS_LOG_ENTER();
 
-    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_intf_key);
-    m_routerIntfTable.erase(router_intf_key);
-    return ReturnCode();
+    std::vector<ReturnCode> statuses(router_intf_keys.size());
+    std::vector<sai_object_id_t> router_intf_oids;
+    std::vector<size_t> indice;
+
+    for (size_t i = 0; i < router_intf_keys.size(); ++i)
+    {
+        statuses[i] = validateRouterInterfaceRemoval(router_intf_keys[i]);
+        if (!statuses[i].ok())
+        {
+            continue;
+        }
+        router_intf_oids.push_back(getRouterInterfaceEntry(router_intf_keys[i])->router_interface_oid);
+        indice.push_back(i);
+    }
+
+    auto object_statuses = removeSaiObjects(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_intf_oids,
+                                            sai_router_intfs_api->remove_router_interface);
+
+    for (size_t j = 0; j < indice.size(); ++j)
+    {
+        const auto &router_intf_key = router_intf_keys[indice[j]];
+        auto *router_intf_entry = getRouterInterfaceEntry(router_intf_key);
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to remove router interface "
+                                                    << QuotedVar(router_intf_entry->router_interface_id));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to remove router interface "
+                                  << QuotedVar(router_intf_entry->router_interface_id);
+            continue;
+        }
+
+        gPortsOrch->decreasePortRefCount(router_intf_entry->port_name);
+        gDirectory.get<VRFOrch *>()->decreaseVrfRefCount(gVirtualRouterId);
+
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_intf_key);
+        m_routerIntfTable.erase(router_intf_key);
+    }
+
+    return statuses;
 }
 
 ReturnCode RouterInterfaceManager::setSourceMacAddress(P4RouterInterfaceEntry *router_intf_entry,
@@ -252,19 +346,54 @@ ReturnCode RouterInterfaceManager::setSourceMacAddress(P4RouterInterfaceEntry *r
 {
     SWSS_LOG_ENTER();
 
-    if (router_intf_entry->src_mac_address == mac_address)
-        return ReturnCode();
+    return setSourceMacAddresses({router_intf_entry}, {mac_address})[0];
+}
 
-    sai_attribute_t attr;
-    attr.id = SAI_ROUTER_INTERFACE_ATTR_SRC_MAC_ADDRESS;
-    memcpy(attr.value.mac, mac_address.getMac(), sizeof(sai_mac_t));
-    CHECK_ERROR_AND_LOG_AND_RETURN(
-        sai_router_intfs_api->set_router_interface_attribute(router_intf_entry->router_interface_oid, &attr),
-        "Failed to set mac address " << QuotedVar(mac_address.to_string()) << " on router interface "
-                                     << QuotedVar(router_intf_entry->router_interface_id));
-
-    router_intf_entry->src_mac_address = mac_address;
-    return ReturnCode();
+std::vector<ReturnCode> RouterInterfaceManager::setSourceMacAddresses(
+    const std::vector<P4RouterInterfaceEntry *> &router_intf_entries,
+    const std::vector<swss::MacAddress> &mac_addresses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(router_intf_entries.size());
+    std::vector<sai_object_id_t> router_intf_oids;
+    std::vector<sai_attribute_t> attrs;
+    std::vector<size_t> indice;
+
+    for (size_t i = 0; i < router_intf_entries.size(); ++i)
+    {
+        if (router_intf_entries[i]->src_mac_address == mac_addresses[i])
+            continue;
+
+        sai_attribute_t attr;
+        attr.id = SAI_ROUTER_INTERFACE_ATTR_SRC_MAC_ADDRESS;
+        memcpy(attr.value.mac, mac_addresses[i].getMac(), sizeof(sai_mac_t));
+        router_intf_oids.push_back(router_intf_entries[i]->router_interface_oid);
+        attrs.push_back(attr);
+        indice.push_back(i);
+    }
+
+    auto object_statuses = setSaiObjectsAttribute(SAI_OBJECT_TYPE_ROUTER_INTERFACE, gSwitchId, router_intf_oids, attrs,
+                                                  sai_router_intfs_api->set_router_interface_attribute);
+
+    for (size_t j = 0; j < indice.size(); ++j)
+    {
+        auto *router_intf_entry = router_intf_entries[indice[j]];
+        const auto &mac_address = mac_addresses[indice[j]];
+        CHECK_ERROR_AND_LOG(object_statuses[j], "Failed to set mac address "
+                                                    << QuotedVar(mac_address.to_string()) << " on router interface "
+                                                    << QuotedVar(router_intf_entry->router_interface_id));
+        if (object_statuses[j] != SAI_STATUS_SUCCESS)
+        {
+            statuses[indice[j]] = ReturnCode(object_statuses[j])
+                                  << "Failed to set mac address " << QuotedVar(mac_address.to_string())
+                                  << " on router interface " << QuotedVar(router_intf_entry->router_interface_id);
+            continue;
+        }
+        router_intf_entry->src_mac_address = mac_address;
+    }
+
+    return statuses;
 }
 
 ReturnCode RouterInterfaceManager::processAddRequest(const P4RouterInterfaceAppDbEntry &app_db_entry,
@@ -340,30 +469,23 @@ ReturnCode RouterInterfaceManager::processDeleteRequest(const std::string &route
 ReturnCode RouterInterfaceManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                                 std::string &object_key)
 {
-    std::string value;
-
-    try
+    const auto key_fields = decodeP4RTKey(json_key);
+    if (key_fields == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            object_key = KeyGenerator::generateRouterInterfaceKey(value);
-            object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
-    catch (std::exception &ex)
+
+    const auto *value = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kRouterInterfaceId));
+    if (value == nullptr)
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kRouterInterfaceId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
 
-    return StatusCode::SWSS_RC_INVALID_PARAM;
+    object_key = KeyGenerator::generateRouterInterfaceKey(*value);
+    object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
+    return ReturnCode();
 }
 
 void RouterInterfaceManager::enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry)
@@ -375,6 +497,47 @@ void RouterInterfaceManager::drain()
 {
     SWSS_LOG_ENTER();
 
+    // Consecutive creates, updates or deletes of distinct router interfaces are
+    // programmed with one bulk SAI call. The pending batch is flushed before
+    // any other operation, and before a router interface shows up twice, so
+    // entries are still applied in order.
+    std::vector<std::string> create_key_list;
+    std::vector<P4RouterInterfaceEntry> create_list;
+    std::vector<P4RouterInterfaceEntry *> update_list;
+    std::vector<swss::MacAddress> update_mac_list;
+    std::vector<std::string> delete_list;
+    std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+    std::unordered_set<std::string> router_intf_keys;
+
+    auto flush = [&]() {
+        std::vector<ReturnCode> statuses;
+        if (!create_list.empty())
+        {
+            statuses = createRouterInterfaces(create_key_list, create_list);
+        }
+        else if (!update_list.empty())
+        {
+            statuses = setSourceMacAddresses(update_list, update_mac_list);
+        }
+        else if (!delete_list.empty())
+        {
+            statuses = removeRouterInterfaces(delete_list);
+        }
+        for (size_t i = 0; i < statuses.size(); ++i)
+        {
+            m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]), kfvFieldsValues(tuple_list[i]),
+                                 statuses[i],
+                                 /*replace=*/true);
+        }
+        create_key_list.clear();
+        create_list.clear();
+        update_list.clear();
+        update_mac_list.clear();
+        delete_list.clear();
+        tuple_list.clear();
+        router_intf_keys.clear();
+    };
+
     for (const auto &key_op_fvs_tuple : m_entries)
     {
         std::string table_name;
@@ -389,6 +552,7 @@ void RouterInterfaceManager::drain()
             status = app_db_entry_or.status();
             SWSS_LOG_ERROR("Unable to deserialize APP DB entry with key %s: %s",
                            QuotedVar(table_name + ":" + db_key).c_str(), status.message().c_str());
+            flush();
             m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                  status,
                                  /*replace=*/true);
@@ -401,6 +565,7 @@ void RouterInterfaceManager::drain()
         {
             SWSS_LOG_ERROR("Validation failed for Router Interface APP DB entry with key %s: %s",
                            QuotedVar(table_name + ":" + db_key).c_str(), status.message().c_str());
+            flush();
             m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple),
                                  status,
                                  /*replace=*/true);
@@ -408,6 +573,10 @@ void RouterInterfaceManager::drain()
         }
 
         const std::string router_intf_key = KeyGenerator::generateRouterInterfaceKey(app_db_entry.router_interface_id);
+        if (router_intf_keys.count(router_intf_key) != 0)
+        {
+            flush();
+        }
 
         const std::string &operation = kfvOp(key_op_fvs_tuple);
         if (operation == SET_COMMAND)
@@ -416,27 +585,68 @@ void RouterInterfaceManager::drain()
             if (router_intf_entry == nullptr)
             {
                 // Create router interface
-                status = processAddRequest(app_db_entry, router_intf_key);
+                if (!app_db_entry.is_set_port_name)
+                {
+                    flush();
+                    status = processAddRequest(app_db_entry, router_intf_key);
+                }
+                else
+                {
+                    if (!update_list.empty() || !delete_list.empty())
+                    {
+                        flush();
+                    }
+                    create_key_list.push_back(router_intf_key);
+                    create_list.emplace_back(app_db_entry.router_interface_id, app_db_entry.port_name,
+                                             app_db_entry.src_mac_address);
+                    tuple_list.push_back(key_op_fvs_tuple);
+                    router_intf_keys.insert(router_intf_key);
+                    continue;
+                }
+            }
+            else if (app_db_entry.is_set_port_name && router_intf_entry->port_name != app_db_entry.port_name)
+            {
+                // Updating the port name is not supported
+                flush();
+                status = processUpdateRequest(app_db_entry, router_intf_entry);
             }
             else
             {
                 // Modify existing router interface
-                status = processUpdateRequest(app_db_entry, router_intf_entry);
+                if (!create_list.empty() || !delete_list.empty())
+                {
+                    flush();
+                }
+                update_list.push_back(router_intf_entry);
+                update_mac_list.push_back(app_db_entry.is_set_src_mac ? app_db_entry.src_mac_address
+                                                                      : router_intf_entry->src_mac_address);
+                tuple_list.push_back(key_op_fvs_tuple);
+                router_intf_keys.insert(router_intf_key);
+                continue;
             }
         }
         else if (operation == DEL_COMMAND)
         {
             // Delete router interface
-            status = processDeleteRequest(router_intf_key);
+            if (!create_list.empty() || !update_list.empty())
+            {
+                flush();
+            }
+            delete_list.push_back(router_intf_key);
+            tuple_list.push_back(key_op_fvs_tuple);
+            router_intf_keys.insert(router_intf_key);
+            continue;
         }
         else
         {
+            flush();
             status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Unknown operation type " << QuotedVar(operation);
             SWSS_LOG_ERROR("%s", status.message().c_str());
         }
         m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple), kfvFieldsValues(key_op_fvs_tuple), status,
                              /*replace=*/true);
     }
+    flush();
     m_entries.clear();
 }
 
@@ -482,7 +692,7 @@ std::string RouterInterfaceManager::verifyState(const std::string &key, const st
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, router_intf_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, router_intf_entry);
     std::string asic_db_result = verifyStateAsicDb(router_intf_entry);
     if (cache_result.empty())
     {
@@ -544,12 +754,10 @@ std::string RouterInterfaceManager::verifyStateAsicDb(const P4RouterInterfaceEnt
     std::vector<swss::FieldValueTuple> exp = saimeta::SaiAttributeList::serialize_attr_list(
         SAI_OBJECT_TYPE_ROUTER_INTERFACE, (uint32_t)attrs.size(), attrs.data(), /*countOnly=*/false);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTER_INTERFACE) + ":" +
                       sai_serialize_object_id(router_intf_entry->router_interface_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -60,8 +60,18 @@ class RouterInterfaceManager : public ObjectManagerInterface
         const std::string &key, const std::vector<swss::FieldValueTuple> &attributes);
     P4RouterInterfaceEntry *getRouterInterfaceEntry(const std::string &router_intf_key);
     ReturnCode createRouterInterface(const std::string &router_intf_key, P4RouterInterfaceEntry &router_intf_entry);
+    ReturnCodeOr<std::vector<sai_attribute_t>> prepareRouterInterfaceCreation(
+        const std::string &router_intf_key, const P4RouterInterfaceEntry &router_intf_entry);
+    // Creates a batch of router interfaces with one bulk SAI call. Returns the
+    // status of each router interface.
+    std::vector<ReturnCode> createRouterInterfaces(const std::vector<std::string> &router_intf_keys,
+                                                   std::vector<P4RouterInterfaceEntry> &router_intf_entries);
     ReturnCode removeRouterInterface(const std::string &router_intf_key);
+    ReturnCode validateRouterInterfaceRemoval(const std::string &router_intf_key);
+    std::vector<ReturnCode> removeRouterInterfaces(const std::vector<std::string> &router_intf_keys);
     ReturnCode setSourceMacAddress(P4RouterInterfaceEntry *router_intf_entry, const swss::MacAddress &mac_address);
+    std::vector<ReturnCode> setSourceMacAddresses(const std::vector<P4RouterInterfaceEntry *> &router_intf_entries,
+                                                  const std::vector<swss::MacAddress> &mac_addresses);
     ReturnCode processAddRequest(const P4RouterInterfaceAppDbEntry &app_db_entry, const std::string &router_intf_key);
     ReturnCode processUpdateRequest(const P4RouterInterfaceAppDbEntry &app_db_entry,
                                     P4RouterInterfaceEntry *router_intf_entry);
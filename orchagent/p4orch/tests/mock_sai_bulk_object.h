@@ -0,0 +1,37 @@
+// Define classes and functions to mock the SAI generic bulk object functions.
+#pragma once
+
+#include <gmock/gmock.h>
+
+extern "C"
+{
+#include "sai.h"
+}
+
+// Mock class including mock functions mapping to the SAI generic bulk object
+// functions.
+class MockSaiBulkObject
+{
+  public:
+    MOCK_METHOD8(bulk_object_create,
+                 sai_status_t(_In_ sai_object_id_t switch_id, _In_ sai_object_type_t object_type,
+                              _In_ uint32_t object_count, _In_ const uint32_t *attr_count,
+                              _In_ const sai_attribute_t **attr_list, _In_ sai_bulk_op_error_mode_t mode,
+                              _Out_ sai_object_id_t *object_id, _Out_ sai_status_t *object_statuses));
+
+    MOCK_METHOD5(bulk_object_remove,
+                 sai_status_t(_In_ sai_object_type_t object_type, _In_ uint32_t object_count,
+                              _In_ const sai_object_id_t *object_id, _In_ sai_bulk_op_error_mode_t mode,
+                              _Out_ sai_status_t *object_statuses));
+
+    MOCK_METHOD7(bulk_object_set_attribute,
+                 sai_status_t(_In_ sai_object_id_t switch_id, _In_ sai_object_type_t object_type,
+                              _In_ uint32_t object_count, _In_ const sai_object_key_t *object_key,
+                              _In_ const sai_attribute_t *attr_list, _In_ sai_bulk_op_error_mode_t mode,
+                              _Out_ sai_status_t *object_statuses));
+};
+
+// The generic bulk object functions of the test binary forward to
+// mock_sai_bulk_object when it is set, and report the bulk API as not
+// implemented otherwise.
+extern MockSaiBulkObject *mock_sai_bulk_object;
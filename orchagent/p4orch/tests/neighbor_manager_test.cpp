@@ -17,8 +17,11 @@
 using ::p4orch::kTableKeyDelimiter;
 
 using ::testing::_;
+using ::testing::DoAll;
 using ::testing::Eq;
+using ::testing::InSequence;
 using ::testing::Return;
+using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
 using ::testing::Truly;
 
@@ -126,6 +129,16 @@ class NeighborManagerTest : public ::testing::Test
         sai_neighbor_api->remove_neighbor_entry = mock_remove_neighbor_entry;
         sai_neighbor_api->set_neighbor_entry_attribute = mock_set_neighbor_entry_attribute;
         sai_neighbor_api->get_neighbor_entry_attribute = mock_get_neighbor_entry_attribute;
+        sai_neighbor_api->create_neighbor_entries = mock_create_neighbor_entries;
+        sai_neighbor_api->remove_neighbor_entries = mock_remove_neighbor_entries;
+        sai_neighbor_api->set_neighbor_entries_attribute = mock_set_neighbor_entries_attribute;
+    }
+
+    void TearDown() override
+    {
+        sai_neighbor_api->create_neighbor_entries = nullptr;
+        sai_neighbor_api->remove_neighbor_entries = nullptr;
+        sai_neighbor_api->set_neighbor_entries_attribute = nullptr;
     }
 
     void Enqueue(const swss::KeyOpFieldsValuesTuple &entry)
@@ -757,6 +770,165 @@ TEST_F(NeighborManagerTest, DrainValidAttributes)
     ValidateNeighborEntryNotPresent(neighbor_entry, /*check_ref_count=*/true);
 }
 
+TEST_F(NeighborManagerTest, DrainProgramsNeighborsInBulk)
+{
+    ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                                      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1),
+                                      kRouterInterfaceOid1));
+
+    const std::string appl_db_key1 = std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+                                     CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId1);
+    const std::string appl_db_key2 = std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+                                     CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId2);
+    const sai_status_t statuses[] = {SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+
+    // Consecutive creates are programmed with one bulk call.
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key1, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key2, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress2.to_string()}}));
+
+    EXPECT_CALL(mock_sai_neighbor_,
+                create_neighbor_entries(Eq(2u), _, _, _, Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<5>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    P4NeighborEntry neighbor_entry1(kRouterInterfaceId1, kNeighborId1, kMacAddress1);
+    neighbor_entry1.neigh_entry.switch_id = gSwitchId;
+    copy(neighbor_entry1.neigh_entry.ip_address, neighbor_entry1.neighbor_id);
+    neighbor_entry1.neigh_entry.rif_id = kRouterInterfaceOid1;
+    P4NeighborEntry neighbor_entry2(kRouterInterfaceId1, kNeighborId2, kMacAddress2);
+    neighbor_entry2.neigh_entry.switch_id = gSwitchId;
+    copy(neighbor_entry2.neigh_entry.ip_address, neighbor_entry2.neighbor_id);
+    neighbor_entry2.neigh_entry.rif_id = kRouterInterfaceOid1;
+    ValidateNeighborEntry(neighbor_entry1, /*router_intf_ref_count=*/2);
+    ValidateNeighborEntry(neighbor_entry2, /*router_intf_ref_count=*/2);
+
+    // Consecutive updates are programmed with one bulk call.
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key1, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress2.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key2, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()}}));
+
+    EXPECT_CALL(mock_sai_neighbor_,
+                set_neighbor_entries_attribute(Eq(2u), _, _, Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<4>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    neighbor_entry1.dst_mac_address = kMacAddress2;
+    neighbor_entry2.dst_mac_address = kMacAddress1;
+    ValidateNeighborEntry(neighbor_entry1, /*router_intf_ref_count=*/2);
+    ValidateNeighborEntry(neighbor_entry2, /*router_intf_ref_count=*/2);
+
+    // Consecutive deletes are programmed with one bulk call.
+    Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key1, DEL_COMMAND, {}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key2, DEL_COMMAND, {}));
+
+    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entries(Eq(2u), _, Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<3>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    ValidateNeighborEntryNotPresent(neighbor_entry1, /*check_ref_count=*/false);
+    ValidateNeighborEntryNotPresent(neighbor_entry2, /*check_ref_count=*/true);
+}
+
+TEST_F(NeighborManagerTest, DrainBulkCreatePartialFailure)
+{
+    ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                                      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1),
+                                      kRouterInterfaceOid1));
+
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+            CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId1),
+        SET_COMMAND, {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+            CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId2),
+        SET_COMMAND, {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress2.to_string()}}));
+
+    const sai_status_t statuses[] = {SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE};
+    EXPECT_CALL(mock_sai_neighbor_,
+                create_neighbor_entries(Eq(2u), _, _, _, Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<5>(statuses, statuses + 2), Return(SAI_STATUS_FAILURE)));
+    Drain();
+
+    P4NeighborEntry neighbor_entry1(kRouterInterfaceId1, kNeighborId1, kMacAddress1);
+    neighbor_entry1.neigh_entry.switch_id = gSwitchId;
+    copy(neighbor_entry1.neigh_entry.ip_address, neighbor_entry1.neighbor_id);
+    neighbor_entry1.neigh_entry.rif_id = kRouterInterfaceOid1;
+    ValidateNeighborEntry(neighbor_entry1, /*router_intf_ref_count=*/1);
+
+    P4NeighborEntry neighbor_entry2(kRouterInterfaceId1, kNeighborId2, kMacAddress2);
+    ValidateNeighborEntryNotPresent(neighbor_entry2, /*check_ref_count=*/false);
+}
+
+TEST_F(NeighborManagerTest, DrainFallsBackWhenBulkIsNotSupported)
+{
+    ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                                      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1),
+                                      kRouterInterfaceOid1));
+
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+            CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId1),
+        SET_COMMAND, {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+            CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId2),
+        SET_COMMAND, {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress2.to_string()}}));
+
+    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entries(Eq(2u), _, _, _, _, _))
+        .WillOnce(Return(SAI_STATUS_NOT_IMPLEMENTED));
+    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entry(_, _, _)).Times(2).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+    Drain();
+
+    P4NeighborEntry neighbor_entry1(kRouterInterfaceId1, kNeighborId1, kMacAddress1);
+    neighbor_entry1.neigh_entry.switch_id = gSwitchId;
+    copy(neighbor_entry1.neigh_entry.ip_address, neighbor_entry1.neighbor_id);
+    neighbor_entry1.neigh_entry.rif_id = kRouterInterfaceOid1;
+    ValidateNeighborEntry(neighbor_entry1, /*router_intf_ref_count=*/2);
+}
+
+TEST_F(NeighborManagerTest, DrainPublishesResponsesInOrder)
+{
+    ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                                      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1),
+                                      kRouterInterfaceOid1));
+
+    const std::string appl_db_key1 = std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+                                     CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId1);
+    const std::string appl_db_key2 = std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+                                     CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId2);
+    const std::string invalid_appl_db_key =
+        std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter + R"({"match/neighbor_id:10.0.0.22"})";
+    const sai_status_t statuses[] = {SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+
+    // The invalid entry is answered after the batched entries before it.
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key1, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(
+        appl_db_key2, SET_COMMAND,
+        {swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress2.to_string()}}));
+    Enqueue(swss::KeyOpFieldsValuesTuple(invalid_appl_db_key, SET_COMMAND, {}));
+
+    EXPECT_CALL(mock_sai_neighbor_,
+                create_neighbor_entries(Eq(2u), _, _, _, Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<5>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    {
+        InSequence s;
+        EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key1), _, _, Eq(true)));
+        EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key2), _, _, Eq(true)));
+        EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(invalid_appl_db_key), _, _, Eq(true)));
+    }
+    Drain();
+}
+
 TEST_F(NeighborManagerTest, DrainInvalidAppDbEntryKey)
 {
     ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
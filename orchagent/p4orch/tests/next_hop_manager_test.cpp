@@ -10,6 +10,7 @@
 
 #include "ipaddress.h"
 #include "mock_response_publisher.h"
+#include "mock_sai_bulk_object.h"
 #include "mock_sai_hostif.h"
 #include "mock_sai_next_hop.h"
 #include "mock_sai_serialize.h"
@@ -30,6 +31,7 @@ using ::testing::DoAll;
 using ::testing::Eq;
 using ::testing::Return;
 using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
 using ::testing::Truly;
 
@@ -263,6 +265,7 @@ class NextHopManagerTest : public ::testing::Test
     void TearDown() override
     {
         gP4Orch->getGreTunnelManager()->m_greTunnelTable.clear();
+        mock_sai_bulk_object = nullptr;
     }
 
     void Enqueue(const swss::KeyOpFieldsValuesTuple &entry)
@@ -1021,6 +1024,86 @@ TEST_F(NextHopManagerTest, DrainDeleteRequestShouldSucceedForExistingNextHop)
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 0));
 }
 
+TEST_F(NextHopManagerTest, DrainProgramsNextHopsInBulk)
+{
+    StrictMock<MockSaiBulkObject> mock_sai_bulk_object_;
+    mock_sai_bulk_object = &mock_sai_bulk_object_;
+
+    P4NextHopAppDbEntry app_db_entry2 = kP4NextHopAppDbEntry2;
+    app_db_entry2.next_hop_id = "9";
+    EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry1, kRouterInterfaceOid1));
+    EXPECT_TRUE(ResolveNextHopEntryDependency(app_db_entry2, kRouterInterfaceOid2));
+
+    std::vector<std::string> app_db_keys;
+    for (const auto *app_db_entry : {&kP4NextHopAppDbEntry1, &app_db_entry2})
+    {
+        nlohmann::json j;
+        j[prependMatchField(p4orch::kNexthopId)] = app_db_entry->next_hop_id;
+        app_db_keys.push_back(std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump());
+        std::vector<swss::FieldValueTuple> fvs{
+            {p4orch::kAction, p4orch::kSetIpNexthop},
+            {prependParamField(p4orch::kNeighborId), app_db_entry->neighbor_id.to_string()},
+            {prependParamField(p4orch::kRouterInterfaceId), app_db_entry->router_interface_id}};
+        Enqueue(swss::KeyOpFieldsValuesTuple(app_db_keys.back(), SET_COMMAND, fvs));
+    }
+
+    const sai_object_id_t next_hop_oids[] = {kNextHopOid, kNextHopOid + 1};
+    const sai_status_t statuses[] = {SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+    EXPECT_CALL(mock_sai_bulk_object_, bulk_object_create(Eq(gSwitchId), Eq(SAI_OBJECT_TYPE_NEXT_HOP), Eq(2u), _, _,
+                                                          Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _, _))
+        .WillOnce(DoAll(SetArrayArgument<6>(next_hop_oids, next_hop_oids + 2),
+                        SetArrayArgument<7>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    EXPECT_TRUE(ValidateNextHopEntryAdd(kP4NextHopAppDbEntry1, kNextHopOid));
+    EXPECT_TRUE(ValidateNextHopEntryAdd(app_db_entry2, kNextHopOid + 1));
+
+    for (const auto &app_db_key : app_db_keys)
+    {
+        Enqueue(swss::KeyOpFieldsValuesTuple(app_db_key, DEL_COMMAND, {}));
+    }
+    EXPECT_CALL(mock_sai_bulk_object_, bulk_object_remove(Eq(SAI_OBJECT_TYPE_NEXT_HOP), Eq(2u), _,
+                                                          Eq(SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR), _))
+        .WillOnce(DoAll(SetArrayArgument<4>(statuses, statuses + 2), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)), nullptr);
+    EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(app_db_entry2.next_hop_id)), nullptr);
+    EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                               KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1), 0));
+    EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                               KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId2), 0));
+}
+
+TEST_F(NextHopManagerTest, DrainFallsBackWhenBulkIsNotSupported)
+{
+    // Without a bulk mock, the generic bulk object API reports not implemented.
+    P4NextHopAppDbEntry app_db_entry2 = kP4NextHopAppDbEntry2;
+    app_db_entry2.next_hop_id = "9";
+    EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry1, kRouterInterfaceOid1));
+    EXPECT_TRUE(ResolveNextHopEntryDependency(app_db_entry2, kRouterInterfaceOid2));
+
+    for (const auto *app_db_entry : {&kP4NextHopAppDbEntry1, &app_db_entry2})
+    {
+        nlohmann::json j;
+        j[prependMatchField(p4orch::kNexthopId)] = app_db_entry->next_hop_id;
+        std::vector<swss::FieldValueTuple> fvs{
+            {p4orch::kAction, p4orch::kSetIpNexthop},
+            {prependParamField(p4orch::kNeighborId), app_db_entry->neighbor_id.to_string()},
+            {prependParamField(p4orch::kRouterInterfaceId), app_db_entry->router_interface_id}};
+        Enqueue(swss::KeyOpFieldsValuesTuple(std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+                                             SET_COMMAND, fvs));
+    }
+
+    EXPECT_CALL(mock_sai_next_hop_, create_next_hop(_, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)))
+        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid + 1), Return(SAI_STATUS_SUCCESS)));
+    Drain();
+
+    EXPECT_TRUE(ValidateNextHopEntryAdd(kP4NextHopAppDbEntry1, kNextHopOid));
+    EXPECT_TRUE(ValidateNextHopEntryAdd(app_db_entry2, kNextHopOid + 1));
+}
+
 TEST_F(NextHopManagerTest, VerifyIpNextHopStateTest)
 {
     auto *p4_next_hop_entry = AddNextHopEntry1();
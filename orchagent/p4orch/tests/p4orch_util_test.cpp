@@ -2,14 +2,67 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ipprefix.h"
 #include "swssnet.h"
 
+extern int gBatchSize;
+
 namespace
 {
 
+// Serves the next hops from memory and fails to read the other object types.
+class TestAsicDbStateBatch : public AsicDbStateBatch
+{
+  public:
+    std::vector<std::string> loaded_object_types;
+
+  protected:
+    void loadObjectType(const std::string &object_type,
+                        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries) override
+    {
+        loaded_object_types.push_back(object_type);
+        if (object_type != "SAI_OBJECT_TYPE_NEXT_HOP")
+        {
+            throw std::runtime_error("Failed to read " + object_type);
+        }
+        entries["SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1"] = {{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.1"}};
+        entries["SAI_OBJECT_TYPE_NEXT_HOP:oid:0x2"] = {{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.2"}};
+    }
+};
+
+// Serves the collected keys from memory, where only oid:0x1 exists.
+class TestAsicDbKeyBatch : public AsicDbStateBatch
+{
+  public:
+    TestAsicDbKeyBatch() : AsicDbStateBatch(/*load_object_types=*/false)
+    {
+    }
+
+    std::vector<std::vector<std::string>> loaded_keys;
+
+  protected:
+    void loadObjectType(const std::string &object_type,
+                        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries) override
+    {
+        throw std::runtime_error("Unexpected read of " + object_type);
+    }
+
+    void loadKeys(const std::vector<std::string> &keys,
+                  std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> &entries) override
+    {
+        loaded_keys.push_back(keys);
+        entries["SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1"] = {{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.1"}};
+    }
+};
+
 TEST(P4OrchUtilTest, KeyGeneratorTest)
 {
     std::string intf_key = KeyGenerator::generateRouterInterfaceKey("intf-qe-3/7");
@@ -57,6 +110,238 @@ TEST(P4OrchUtilTest, ParseP4RTKeyTest)
     EXPECT_TRUE(key.empty());
 }
 
+TEST(P4OrchUtilTest, DecodeP4RTKeyShouldSucceed)
+{
+    auto fields = decodeP4RTKey(R"({"match/vrf_id":"b4-traffic","match/ipv4_dst":"10.11.12.0/24"})");
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(fields->size(), 2);
+    EXPECT_EQ((*fields)[0].name, "match/ipv4_dst");
+    EXPECT_EQ((*fields)[1].name, "match/vrf_id");
+    ASSERT_NE(getP4RTKeyString(*fields, "match/vrf_id"), nullptr);
+    EXPECT_EQ(*getP4RTKeyString(*fields, "match/vrf_id"), "b4-traffic");
+    ASSERT_NE(getP4RTKeyString(*fields, "match/ipv4_dst"), nullptr);
+    EXPECT_EQ(*getP4RTKeyString(*fields, "match/ipv4_dst"), "10.11.12.0/24");
+    EXPECT_EQ(getP4RTKeyField(*fields, "match/ipv6_dst"), nullptr);
+
+    // Ternary match, priority and whitespaces.
+    fields = decodeP4RTKey(R"( { "match/dst_mac" : "00:02:03:04:00:00&ff:ff:ff:ff:00:00" , "priority" : 2030 } )");
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(fields->size(), 2);
+    EXPECT_EQ(*getP4RTKeyString(*fields, "match/dst_mac"), "00:02:03:04:00:00&ff:ff:ff:ff:00:00");
+    const auto *priority = getP4RTKeyField(*fields, "priority");
+    ASSERT_NE(priority, nullptr);
+    EXPECT_TRUE(priority->is_unsigned);
+    EXPECT_FALSE(priority->is_string);
+    EXPECT_EQ(priority->value, "2030");
+    EXPECT_EQ(getP4RTKeyString(*fields, "priority"), nullptr);
+
+    // A later field of the same name replaces the former one.
+    fields = decodeP4RTKey(R"({"match/nexthop_id":"8","match/nexthop_id":"9"})");
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(fields->size(), 1);
+    EXPECT_EQ(*getP4RTKeyString(*fields, "match/nexthop_id"), "9");
+
+    fields = decodeP4RTKey("{}");
+    ASSERT_NE(fields, nullptr);
+    EXPECT_TRUE(fields->empty());
+}
+
+TEST(P4OrchUtilTest, DecodeP4RTKeyWithJsonParserShouldSucceed)
+{
+    // Escapes, negative numbers and nested values are left to the JSON parser.
+    auto fields = decodeP4RTKey(R"({"match/nexthop_id":"a\"bA","priority":-1,"match/x":[1,2]})");
+    ASSERT_NE(fields, nullptr);
+    ASSERT_EQ(fields->size(), 3);
+    EXPECT_EQ(*getP4RTKeyString(*fields, "match/nexthop_id"), "a\"bA");
+    const auto *priority = getP4RTKeyField(*fields, "priority");
+    ASSERT_NE(priority, nullptr);
+    EXPECT_FALSE(priority->is_unsigned);
+    EXPECT_FALSE(priority->is_string);
+    const auto *x = getP4RTKeyField(*fields, "match/x");
+    ASSERT_NE(x, nullptr);
+    EXPECT_EQ(x->value, "[1,2]");
+
+    fields = decodeP4RTKey(R"({"priority":18446744073709551615})");
+    ASSERT_NE(fields, nullptr);
+    EXPECT_TRUE(getP4RTKeyField(*fields, "priority")->is_unsigned);
+    EXPECT_EQ(getP4RTKeyField(*fields, "priority")->value, "18446744073709551615");
+}
+
+TEST(P4OrchUtilTest, DecodeP4RTKeyShouldFailOnInvalidKey)
+{
+    EXPECT_EQ(decodeP4RTKey(""), nullptr);
+    EXPECT_EQ(decodeP4RTKey("invalid"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"("match/nexthop_id")"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"(["match/nexthop_id","8"])"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"({"match/nexthop_id":"8")"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"({"match/nexthop_id":"8"} x)"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"({"match/nexthop_id":"8",})"), nullptr);
+    EXPECT_EQ(decodeP4RTKey(R"({"priority":01})"), nullptr);
+}
+
+TEST(P4OrchUtilTest, DecodeP4RTKeyShouldUseCache)
+{
+    clearP4RTKeyCache();
+    const std::string key = R"({"match/router_interface_id":"16","match/neighbor_id":"10.0.0.1"})";
+    auto fields = decodeP4RTKey(key);
+    ASSERT_NE(fields, nullptr);
+    EXPECT_EQ(getP4RTKeyCacheSize(), 1);
+    EXPECT_EQ(decodeP4RTKey(key), fields);
+    EXPECT_EQ(getP4RTKeyCacheSize(), 1);
+
+    // Invalid keys are not cached.
+    EXPECT_EQ(decodeP4RTKey("invalid"), nullptr);
+    EXPECT_EQ(getP4RTKeyCacheSize(), 1);
+
+    clearP4RTKeyCache();
+    EXPECT_EQ(getP4RTKeyCacheSize(), 0);
+    EXPECT_NE(decodeP4RTKey(key), fields);
+}
+
+TEST(P4OrchUtilTest, P4RTKeyCacheShouldEvictLeastRecentlyUsedKey)
+{
+    const auto batch_size = gBatchSize;
+    gBatchSize = 1;
+    clearP4RTKeyCache();
+
+    // The cache holds 128 batches of gBatchSize keys.
+    auto key = [](int i) { return R"({"match/nexthop_id":")" + std::to_string(i) + R"("})"; };
+    auto first = decodeP4RTKey(key(0));
+    auto second = decodeP4RTKey(key(1));
+    for (int i = 2; i < 128; i++)
+    {
+        decodeP4RTKey(key(i));
+    }
+    EXPECT_EQ(getP4RTKeyCacheSize(), 128);
+    EXPECT_EQ(decodeP4RTKey(key(0)), first);
+
+    decodeP4RTKey(key(128));
+    EXPECT_EQ(getP4RTKeyCacheSize(), 128);
+    EXPECT_EQ(decodeP4RTKey(key(0)), first);
+    EXPECT_NE(decodeP4RTKey(key(1)), second);
+
+    clearP4RTKeyCache();
+    gBatchSize = batch_size;
+}
+
+// Times the decoding of distinct route keys, which all miss the cache, against
+// the JSON parser the managers used before, and the decoding of cached keys.
+TEST(P4OrchUtilTest, DecodeP4RTKeyParseRate)
+{
+    const int keys = 100000;
+    std::vector<std::string> route_keys;
+    for (int i = 0; i < keys; i++)
+    {
+        route_keys.push_back(R"({"match/vrf_id":"b4-traffic","match/ipv4_dst":"10.)" + std::to_string(i >> 16) + "." +
+                             std::to_string((i >> 8) & 0xff) + "." + std::to_string(i & 0xff) + R"(/32"})");
+    }
+    clearP4RTKeyCache();
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &route_key : route_keys)
+    {
+        ASSERT_NE(decodeP4RTKey(route_key), nullptr);
+    }
+    auto decoder_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (const auto &route_key : route_keys)
+    {
+        const auto &key_json = nlohmann::json::parse(route_key);
+        ASSERT_EQ(key_json.size(), 2);
+    }
+    auto parser_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < keys; i++)
+    {
+        ASSERT_NE(decodeP4RTKey(route_keys.back()), nullptr);
+    }
+    auto cached_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << keys << " route keys: decoder " << decoder_ns / keys << " ns/key, JSON parser " << parser_ns / keys
+              << " ns/key, cached " << cached_ns / keys << " ns/key" << std::endl;
+    clearP4RTKeyCache();
+}
+
+TEST(P4OrchUtilTest, AsicDbStateBatchShouldReadObjectTypeOnce)
+{
+    swss::Table table(nullptr, "ASIC_STATE");
+    table.set("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", {{"SAI_ROUTER_INTERFACE_ATTR_MTU", "9100"}});
+    const std::vector<swss::FieldValueTuple> rif_values{{"SAI_ROUTER_INTERFACE_ATTR_MTU", "9100"}};
+
+    std::vector<swss::FieldValueTuple> values;
+    {
+        TestAsicDbStateBatch batch;
+        EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", values));
+        EXPECT_EQ(values, std::vector<swss::FieldValueTuple>({{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.1"}}));
+        EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x2", values));
+        EXPECT_EQ(values, std::vector<swss::FieldValueTuple>({{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.2"}}));
+        EXPECT_FALSE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x3", values));
+
+        // Object types which cannot be read in one pass are read entry by entry.
+        values.clear();
+        EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", values));
+        EXPECT_EQ(values, rif_values);
+        values.clear();
+        EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", values));
+        EXPECT_EQ(values, rif_values);
+
+        EXPECT_EQ(batch.loaded_object_types,
+                  std::vector<std::string>({"SAI_OBJECT_TYPE_NEXT_HOP", "SAI_OBJECT_TYPE_ROUTER_INTERFACE"}));
+        EXPECT_EQ(batch.getEntryCount(), 2);
+    }
+
+    // Outside of a batch, entries are read from ASIC DB.
+    values.clear();
+    EXPECT_FALSE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", values));
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", values));
+    EXPECT_EQ(values, rif_values);
+
+    table.del("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3");
+}
+
+TEST(P4OrchUtilTest, AsicDbStateBatchShouldReadCollectedKeysOnce)
+{
+    swss::Table table(nullptr, "ASIC_STATE");
+    table.set("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", {{"SAI_ROUTER_INTERFACE_ATTR_MTU", "9100"}});
+    const std::vector<swss::FieldValueTuple> rif_values{{"SAI_ROUTER_INTERFACE_ATTR_MTU", "9100"}};
+
+    std::vector<swss::FieldValueTuple> values;
+    TestAsicDbKeyBatch batch;
+    batch.collectKeys();
+    EXPECT_TRUE(isCollectingAsicDbKeys());
+    // Lookups succeed with no values and nothing is compared, so that a
+    // verification goes on to its next key.
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", values));
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(verifyAttrs(values, {{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.1"}}, {}, /*allow_unknown=*/false), "");
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x2", values));
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", values));
+    EXPECT_TRUE(batch.loaded_keys.empty());
+    batch.loadCollectedKeys();
+    EXPECT_FALSE(isCollectingAsicDbKeys());
+
+    // Exactly the collected keys are read, once.
+    EXPECT_EQ(batch.loaded_keys, std::vector<std::vector<std::string>>(
+                                     {{"SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", "SAI_OBJECT_TYPE_NEXT_HOP:oid:0x2"}}));
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x1", values));
+    EXPECT_EQ(values, std::vector<swss::FieldValueTuple>({{"SAI_NEXT_HOP_ATTR_IP", "10.0.0.1"}}));
+    EXPECT_FALSE(getAsicDbEntry("SAI_OBJECT_TYPE_NEXT_HOP:oid:0x2", values));
+    EXPECT_EQ(batch.getEntryCount(), 1);
+
+    // Keys which were not collected are read one by one, not by object type.
+    values.clear();
+    EXPECT_TRUE(getAsicDbEntry("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3", values));
+    EXPECT_EQ(values, rif_values);
+    EXPECT_EQ(batch.loaded_keys.size(), 1);
+
+    table.del("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x3");
+}
+
 TEST(P4OrchUtilTest, PrependMatchFieldShouldSucceed)
 {
     EXPECT_EQ(prependMatchField("str"), "match/str");
@@ -122,19 +122,14 @@ ReturnCodeOr<P4WcmpGroupEntry> WcmpManager::deserializeP4WcmpGroupAppDbEntry(
     const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
 {
     P4WcmpGroupEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        if (!j.is_object())
-        {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
-        }
-        app_db_entry.wcmp_group_id = j[prependMatchField(kWcmpGroupId)];
-    }
-    catch (std::exception &ex)
+    const auto key_fields = decodeP4RTKey(key);
+    const std::string *wcmp_group_id =
+        key_fields == nullptr ? nullptr : getP4RTKeyString(*key_fields, prependMatchField(kWcmpGroupId));
+    if (wcmp_group_id == nullptr)
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize WCMP group key";
     }
+    app_db_entry.wcmp_group_id = *wcmp_group_id;
 
     for (const auto &it : attributes)
     {
@@ -737,29 +732,23 @@ void WcmpManager::updatePortOperStatusMap(const std::string &port, const sai_por
 ReturnCode WcmpManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                      std::string &object_key)
 {
-    std::string value;
-
-    try
+    const auto key_fields = decodeP4RTKey(json_key);
+    if (key_fields == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kWcmpGroupId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kWcmpGroupId)).get<std::string>();
-            object_key = KeyGenerator::generateWcmpGroupKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
-    catch (std::exception &ex)
+
+    const auto *value = getP4RTKeyString(*key_fields, prependMatchField(p4orch::kWcmpGroupId));
+    if (value == nullptr)
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
+        return StatusCode::SWSS_RC_INVALID_PARAM;
     }
 
-    return StatusCode::SWSS_RC_INVALID_PARAM;
+    object_key = KeyGenerator::generateWcmpGroupKey(*value);
+    object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
+    return ReturnCode();
 }
 
 void WcmpManager::enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry)
@@ -878,7 +867,7 @@ std::string WcmpManager::verifyState(const std::string &key, const std::vector<s
         return msg.str();
     }
 
-    std::string cache_result = verifyStateCache(app_db_entry, wcmp_group_entry);
+    std::string cache_result = isCollectingAsicDbKeys() ? "" : verifyStateCache(app_db_entry, wcmp_group_entry);
     std::string asic_db_result = verifyStateAsicDb(wcmp_group_entry);
     if (cache_result.empty())
     {
@@ -981,16 +970,13 @@ std::string WcmpManager::verifyStateCache(const P4WcmpGroupEntry &app_db_entry,
 
 std::string WcmpManager::verifyStateAsicDb(const P4WcmpGroupEntry *wcmp_group_entry)
 {
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::Table table(&db, "ASIC_STATE");
-
     auto group_attrs = getSaiGroupAttrs(*wcmp_group_entry);
     std::vector<swss::FieldValueTuple> exp = saimeta::SaiAttributeList::serialize_attr_list(
         SAI_OBJECT_TYPE_NEXT_HOP_GROUP, (uint32_t)group_attrs.size(), group_attrs.data(), /*countOnly=*/false);
     std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_NEXT_HOP_GROUP) + ":" +
                       sai_serialize_object_id(wcmp_group_entry->wcmp_group_oid);
     std::vector<swss::FieldValueTuple> values;
-    if (!table.get(key, values))
+    if (!getAsicDbEntry(key, values))
     {
         return std::string("ASIC DB key not found ") + key;
     }
@@ -1014,7 +1000,7 @@ std::string WcmpManager::verifyStateAsicDb(const P4WcmpGroupEntry *wcmp_group_en
         std::string key = sai_serialize_object_type(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER) + ":" +
                           sai_serialize_object_id(member->member_oid);
         std::vector<swss::FieldValueTuple> values;
-        if (!table.get(key, values))
+        if (!getAsicDbEntry(key, values))
         {
             return std::string("ASIC DB key not found ") + key;
         }
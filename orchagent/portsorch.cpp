@@ -1177,36 +1177,106 @@ bool PortsOrch::getPort(string alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    const Port *port = findPort(alias);
+    if (port == nullptr)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    const Port *p = findPort(id);
+    if (p == nullptr)
+    {
+        return false;
+    }
+
+    port = *p;
+    return true;
+}
+
+const Port *PortsOrch::findPort(const string &alias) const
+{
+    auto it = m_portList.find(alias);
+    if (it == m_portList.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+const Port *PortsOrch::findPort(sai_object_id_t id)
+{
+    const Port *port = getPortFromOidCache(id);
+    if (port == nullptr && saiOidToAlias.find(id) != saiOidToAlias.end())
+    {
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
+    }
+
+    return port;
+}
+
+const Port *PortsOrch::findPortByBridgePortId(sai_object_id_t bridge_port_id)
+{
+    return getPortFromOidCache(bridge_port_id);
+}
+
+Port *PortsOrch::getPortFromOidCache(sai_object_id_t id)
+{
+    auto cached = m_portOidCache.find(id);
+    if (cached != m_portOidCache.end())
+    {
+        return cached->second;
+    }
+
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    auto it = m_portList.find(itr->second);
+    if (it == m_portList.end())
+    {
+        return nullptr;
+    }
+
+    m_portOidCache[id] = &it->second;
+    return &it->second;
+}
+
+void PortsOrch::removePortFromOidCache(const string &alias)
+{
+    auto port = m_portList.find(alias);
+    if (port == m_portList.end())
     {
-        if (!getPort(itr->second, port))
+        return;
+    }
+
+    for (auto it = m_portOidCache.begin(); it != m_portOidCache.end();)
+    {
+        if (it->second == &port->second)
         {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
+            it = m_portOidCache.erase(it);
+        }
+        else
+        {
+            it++;
         }
-        return true;
     }
+}
 
-    return false;
+void PortsOrch::removeSaiOidToAlias(sai_object_id_t id)
+{
+    saiOidToAlias.erase(id);
+    m_portOidCache.erase(id);
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -1243,18 +1313,14 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(bridge_port_id);
-    if (itr == saiOidToAlias.end())
+    const Port *p = findPortByBridgePortId(bridge_port_id);
+    if (p == nullptr)
     {
         return false;
     }
-    else
-    {
-        getPort(itr->second, port);
-        return true;
-    }
 
-    return false;
+    port = *p;
+    return true;
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -1387,6 +1453,7 @@ bool PortsOrch::removeSubPort(const string &alias)
     }
     m_portList[parentPort.m_alias] = parentPort;
 
+    removePortFromOidCache(alias);
     m_portList.erase(it);
 
     // Restore hostif vlan tag for the parent port when the last subport is removed
@@ -3563,6 +3630,12 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 addSystemPorts();
                 m_initDone = true;
                 SWSS_LOG_INFO("Got PortInitDone notification from portsyncd");
+
+                for (const auto &phase : m_portInitPhaseTime)
+                {
+                    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(phase.second).count();
+                    SWSS_LOG_NOTICE("Port initialization phase %s took %lld ms", phase.first.c_str(), static_cast<long long>(ms));
+                }
             }
 
             it = taskMap.erase(it);
@@ -3656,58 +3729,62 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     it++;
                 }
 
+                std::vector<PortConfig> portsToInitList;
+
                 // Bulk port remove
                 if (!portsToRemoveList.empty())
                 {
+                    auto start = std::chrono::steady_clock::now();
                     if (!removePortBulk(portsToRemoveList))
                     {
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
+                    m_portInitPhaseTime["port_remove"] += std::chrono::steady_clock::now() - start;
                 }
 
                 // Port add comparison logic
-                for (auto it = m_lanesAliasSpeedMap.begin(); it != m_lanesAliasSpeedMap.end();)
+                for (auto it = m_lanesAliasSpeedMap.begin(); it != m_lanesAliasSpeedMap.end(); it++)
                 {
                     if (m_portListLaneMap.find(it->first) == m_portListLaneMap.end())
                     {
                         portsToAddList.push_back(it->second);
-                        it++;
                         continue;
                     }
 
-                    if (!initPort(it->second))
-                    {
-                        // Failure has been recorded in initPort
-                        it++;
-                        continue;
-                    }
-
-                    initPortSupportedSpeeds(it->second.key, m_portListLaneMap[it->first]);
-                    initPortSupportedFecModes(it->second.key, m_portListLaneMap[it->first]);
-
-                    it++;
+                    portsToInitList.push_back(it->second);
                 }
 
                 // Bulk port add
                 if (!portsToAddList.empty())
                 {
+                    auto start = std::chrono::steady_clock::now();
                     if (!addPortBulk(portsToAddList))
                     {
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
+                    m_portInitPhaseTime["port_create"] += std::chrono::steady_clock::now() - start;
 
-                    for (const auto &cit : portsToAddList)
-                    {
-                        if (!initPort(cit))
-                        {
-                            // Failure has been recorded in initPort
-                            continue;
-                        }
+                    portsToInitList.insert(portsToInitList.end(), portsToAddList.begin(), portsToAddList.end());
+                }
 
-                        initPortSupportedSpeeds(cit.key, m_portListLaneMap[cit.lanes.value]);
-                        initPortSupportedFecModes(cit.key, m_portListLaneMap[cit.lanes.value]);
+                auto start = std::chrono::steady_clock::now();
+                prefetchPortQosObjects(portsToInitList);
+                m_portInitPhaseTime["qos_discovery"] += std::chrono::steady_clock::now() - start;
+
+                start = std::chrono::steady_clock::now();
+                for (const auto &cit : portsToInitList)
+                {
+                    if (!initPort(cit))
+                    {
+                        // Failure has been recorded in initPort
+                        continue;
                     }
+
+                    initPortSupportedSpeeds(cit.key, m_portListLaneMap[cit.lanes.value]);
+                    initPortSupportedFecModes(cit.key, m_portListLaneMap[cit.lanes.value]);
                 }
+                m_prefetchedQosObjects.clear();
+                m_portInitPhaseTime["port_init"] += std::chrono::steady_clock::now() - start;
 
                 setPortConfigState(PORT_CONFIG_DONE);
             }
@@ -4407,8 +4484,9 @@ void PortsOrch::doPortTask(Consumer &consumer)
 
             /* Delete port from port list */
             m_portConfigMap.erase(alias);
+            removePortFromOidCache(alias);
             m_portList.erase(alias);
-            saiOidToAlias.erase(port_id);
+            removeSaiOidToAlias(port_id);
 
             SWSS_LOG_NOTICE("Removed port %s", alias.c_str());
         }
@@ -5207,6 +5285,15 @@ void PortsOrch::initializeQueues(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto prefetched = m_prefetchedQosObjects.find(port.m_port_id);
+    if (prefetched != m_prefetchedQosObjects.end())
+    {
+        port.m_queue_ids = prefetched->second.queueIds;
+        port.m_queue_lock.resize(port.m_queue_ids.size());
+        SWSS_LOG_INFO("Get %zu prefetched queues for port %s", port.m_queue_ids.size(), port.m_alias.c_str());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5247,54 +5334,18 @@ void PortsOrch::initializeQueues(Port &port)
     SWSS_LOG_INFO("Get queues for port %s", port.m_alias.c_str());
 }
 
-void PortsOrch::initializeSchedulerGroups(Port &port)
+void PortsOrch::initializePriorityGroups(Port &port)
 {
-    std::vector<sai_object_id_t> scheduler_group_ids;
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attr;
-    attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
-    sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to get number of scheduler groups for port:%s", port.m_alias.c_str());
-        task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
-        if (handle_status != task_process_status::task_success)
-        {
-            throw runtime_error("PortsOrch initialization failure.");
-        }
-    }
-    SWSS_LOG_INFO("Got %d number of scheduler groups for port %s", attr.value.u32, port.m_alias.c_str());
-
-    scheduler_group_ids.resize(attr.value.u32);
-
-    if (attr.value.u32 == 0)
+    auto prefetched = m_prefetchedQosObjects.find(port.m_port_id);
+    if (prefetched != m_prefetchedQosObjects.end())
     {
+        port.m_priority_group_ids = prefetched->second.priorityGroupIds;
+        SWSS_LOG_INFO("Get %zu prefetched priority groups for port %s", port.m_priority_group_ids.size(), port.m_alias.c_str());
         return;
     }
 
-    attr.id = SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST;
-    attr.value.objlist.count = (uint32_t)scheduler_group_ids.size();
-    attr.value.objlist.list = scheduler_group_ids.data();
-
-    status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to get scheduler group list for port %s rv:%d", port.m_alias.c_str(), status);
-        task_process_status handle_status = handleSaiGetStatus(SAI_API_PORT, status);
-        if (handle_status != task_process_status::task_success)
-        {
-            throw runtime_error("PortsOrch initialization failure.");
-        }
-    }
-
-    SWSS_LOG_INFO("Got scheduler groups for port %s", port.m_alias.c_str());
-}
-
-void PortsOrch::initializePriorityGroups(Port &port)
-{
-    SWSS_LOG_ENTER();
-
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5357,6 +5408,152 @@ void PortsOrch::initializePortBufferMaximumParameters(Port &port)
     m_stateBufferMaximumValueTable->set(port.m_alias, fvVector);
 }
 
+/*
+ * Read the queues and PGs of the ports in two bulk gets, the counts then the
+ * lists, instead of four gets per port. The ports which can't be read this
+ * way are left to the per port gets of initializeQueues() and
+ * initializePriorityGroups(). The scheduler groups are not read here, they
+ * are discovered by QosOrch once a scheduler is configured on the port.
+ */
+void PortsOrch::prefetchPortQosObjects(const std::vector<PortConfig> &portConfigs)
+{
+    SWSS_LOG_ENTER();
+
+    if (gMySwitchType == "dpu")
+    {
+        return;
+    }
+
+    std::vector<sai_object_key_t> object_keys;
+    for (const auto &cit : portConfigs)
+    {
+        auto lanes = m_portListLaneMap.find(cit.lanes.value);
+        if (lanes == m_portListLaneMap.end())
+        {
+            continue;
+        }
+
+        auto port = m_portList.find(cit.key);
+        if (port != m_portList.end() && port->second.m_port_id == lanes->second)
+        {
+            continue;
+        }
+
+        sai_object_key_t object_key;
+        object_key.key.object_id = lanes->second;
+        object_keys.push_back(object_key);
+    }
+
+    if (object_keys.size() < 2)
+    {
+        return;
+    }
+
+    uint32_t object_count = static_cast<uint32_t>(object_keys.size());
+    std::vector<std::vector<sai_attribute_t>> attrs(object_count, std::vector<sai_attribute_t>(2));
+    std::vector<sai_attribute_t *> attr_lists(object_count);
+    std::vector<uint32_t> attr_counts(object_count, 2);
+    std::vector<sai_status_t> statuses(object_count, SAI_STATUS_NOT_EXECUTED);
+
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        attrs[i][0].id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+        attrs[i][1].id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+        attr_lists[i] = attrs[i].data();
+    }
+
+    sai_status_t status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_PORT, object_count, object_keys.data(),
+                                                        attr_counts.data(), attr_lists.data(),
+                                                        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        SWSS_LOG_NOTICE("Bulk get of port attributes is not supported, read the queues and PGs port by port");
+        return;
+    }
+
+    std::vector<sai_object_key_t> list_keys;
+    std::vector<PortQosObjects> qos_objects;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get number of queues and PGs of port 0x%" PRIx64 " in bulk, rv:%d",
+                          object_keys[i].key.object_id, statuses[i]);
+            continue;
+        }
+
+        PortQosObjects objects;
+        objects.queueIds.resize(attrs[i][0].value.u32);
+        objects.priorityGroupIds.resize(attrs[i][1].value.u32);
+        if (objects.queueIds.empty() && objects.priorityGroupIds.empty())
+        {
+            m_prefetchedQosObjects[object_keys[i].key.object_id] = std::move(objects);
+            continue;
+        }
+
+        list_keys.push_back(object_keys[i]);
+        qos_objects.push_back(std::move(objects));
+    }
+
+    if (list_keys.empty())
+    {
+        return;
+    }
+
+    object_count = static_cast<uint32_t>(list_keys.size());
+    attrs.assign(object_count, std::vector<sai_attribute_t>());
+    attr_lists.assign(object_count, nullptr);
+    attr_counts.assign(object_count, 0);
+    statuses.assign(object_count, SAI_STATUS_NOT_EXECUTED);
+
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        auto &objects = qos_objects[i];
+        sai_attribute_t attr;
+
+        if (!objects.queueIds.empty())
+        {
+            attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+            attr.value.objlist.count = static_cast<uint32_t>(objects.queueIds.size());
+            attr.value.objlist.list = objects.queueIds.data();
+            attrs[i].push_back(attr);
+        }
+
+        if (!objects.priorityGroupIds.empty())
+        {
+            attr.id = SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST;
+            attr.value.objlist.count = static_cast<uint32_t>(objects.priorityGroupIds.size());
+            attr.value.objlist.list = objects.priorityGroupIds.data();
+            attrs[i].push_back(attr);
+        }
+
+        attr_counts[i] = static_cast<uint32_t>(attrs[i].size());
+        attr_lists[i] = attrs[i].data();
+    }
+
+    status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_PORT, object_count, list_keys.data(),
+                                           attr_counts.data(), attr_lists.data(),
+                                           SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get queue and PG lists of port 0x%" PRIx64 " in bulk, rv:%d",
+                          list_keys[i].key.object_id, statuses[i]);
+            continue;
+        }
+
+        m_prefetchedQosObjects[list_keys[i].key.object_id] = std::move(qos_objects[i]);
+    }
+
+    SWSS_LOG_NOTICE("Got the queues and PGs of %zu ports in bulk", m_prefetchedQosObjects.size());
+}
+
 bool PortsOrch::initializePort(Port &port)
 {
     SWSS_LOG_ENTER();
@@ -5367,7 +5564,6 @@ bool PortsOrch::initializePort(Port &port)
     {
         initializePriorityGroups(port);
         initializeQueues(port);
-        initializeSchedulerGroups(port);
         initializePortBufferMaximumParameters(port);
     }
 
@@ -5767,7 +5963,7 @@ bool PortsOrch::removeBridgePort(Port &port)
             return parseHandleSaiStatusFailure(handle_status);
         }
     }
-    saiOidToAlias.erase(port.m_bridge_port_id);
+    removeSaiOidToAlias(port.m_bridge_port_id);
     port.m_bridge_port_id = SAI_NULL_OBJECT_ID;
 
     /* Remove bridge port */
@@ -5909,7 +6105,8 @@ bool PortsOrch::removeVlan(Port vlan)
     SWSS_LOG_NOTICE("Remove VLAN %s vid:%hu", vlan.m_alias.c_str(),
             vlan.m_vlan_info.vlan_id);
 
-    saiOidToAlias.erase(vlan.m_vlan_info.vlan_oid);
+    removeSaiOidToAlias(vlan.m_vlan_info.vlan_oid);
+    removePortFromOidCache(vlan.m_alias);
     m_portList.erase(vlan.m_alias);
     m_port_ref_count.erase(vlan.m_alias);
     m_vlanPorts.erase(vlan.m_alias);
@@ -6501,7 +6698,8 @@ bool PortsOrch::removeLag(Port lag)
 
     SWSS_LOG_NOTICE("Remove LAG %s lid:%" PRIx64, lag.m_alias.c_str(), lag.m_lag_id);
 
-    saiOidToAlias.erase(lag.m_lag_id);
+    removeSaiOidToAlias(lag.m_lag_id);
+    removePortFromOidCache(lag.m_alias);
     m_portList.erase(lag.m_alias);
     m_port_ref_count.erase(lag.m_alias);
 
@@ -6796,6 +6994,7 @@ bool PortsOrch::removeTunnel(Port tunnel)
 {
     SWSS_LOG_ENTER();
 
+    removePortFromOidCache(tunnel.m_alias);
     m_portList.erase(tunnel.m_alias);
 
     return true;
@@ -1,6 +1,7 @@
 #ifndef SWSS_PORTSORCH_H
 #define SWSS_PORTSORCH_H
 
+#include <chrono>
 #include <map>
 #include <unordered_set>
 
@@ -139,6 +140,13 @@ public:
     void increasePortRefCount(const string &alias);
     void decreasePortRefCount(const string &alias);
     bool getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port);
+    /*
+     * Lookups without copy. The returned port is owned by PortsOrch and is
+     * only valid until the port is removed, don't keep it across tasks.
+     */
+    const Port *findPort(const string &alias) const;
+    const Port *findPort(sai_object_id_t id);
+    const Port *findPortByBridgePortId(sai_object_id_t bridge_port_id);
     void setPort(string alias, Port port);
     void getCpuPort(Port &port);
     void initHostTxReadyState(Port &port);
@@ -284,6 +292,17 @@ private:
 
     bool m_initDone = false;
     bool m_isSendToIngressPortConfigured = false;
+
+    // Queues and PGs of the ports being initialized, read in bulk ahead of initializePort()
+    struct PortQosObjects
+    {
+        std::vector<sai_object_id_t> queueIds;
+        std::vector<sai_object_id_t> priorityGroupIds;
+    };
+    std::map<sai_object_id_t, PortQosObjects> m_prefetchedQosObjects;
+
+    // Time spent in each phase of the port initialization, reported at PortInitDone
+    std::map<std::string, std::chrono::steady_clock::duration> m_portInitPhaseTime;
     Port m_cpuPort;
     // TODO: Add Bridge/Vlan class
     sai_object_id_t m_default1QBridge;
@@ -324,6 +343,8 @@ private:
      * coming from SAI
      */
     unordered_map<sai_object_id_t, string> saiOidToAlias;
+    /* Direct mapping from SAI object ID to the port storage, filled by lookups */
+    unordered_map<sai_object_id_t, Port *> m_portOidCache;
     unordered_map<sai_object_id_t, uint16_t> m_portOidToIndex;
     map<string, uint32_t> m_port_ref_count;
     unordered_set<string> m_pendingPortSet;
@@ -357,6 +378,9 @@ private:
 
     void removePortFromLanesMap(string alias);
     void removePortFromPortListMap(sai_object_id_t port_id);
+    Port *getPortFromOidCache(sai_object_id_t id);
+    void removePortFromOidCache(const string &alias);
+    void removeSaiOidToAlias(sai_object_id_t id);
     void removeDefaultVlanMembers();
     void removeDefaultBridgePorts();
 
@@ -364,8 +388,8 @@ private:
     void initializePriorityGroups(Port &port);
     void initializePortBufferMaximumParameters(Port &port);
     void initializeQueues(Port &port);
-    void initializeSchedulerGroups(Port &port);
     void initializeVoqs(Port &port);
+    void prefetchPortQosObjects(const std::vector<PortConfig> &portConfigs);
 
     bool addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id);
     bool setHostIntfsStripTag(Port &port, sai_hostif_vlan_tag_t strip);
@@ -7,6 +7,7 @@
 
 #include <inttypes.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 #include <string>
@@ -145,6 +146,12 @@ task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFiel
         {
             return task_process_status::task_invalid_entry;
         }
+        if (isContentShared())
+        {
+            task_process_status status = setSharedQosItem(qos_map_type_name, qos_object_name, sai_object, attributes);
+            freeAttribResources(attributes);
+            return status;
+        }
         if (SAI_NULL_OBJECT_ID != sai_object)
         {
             if (!modifyQosItem(sai_object, attributes))
@@ -184,7 +191,7 @@ task_process_status QosMapHandler::processWorkItem(Consumer& consumer, KeyOpFiel
             (*(QosOrch::getTypeMap()[qos_map_type_name]))[qos_object_name].m_pendingRemove = true;
             return task_process_status::task_need_retry;
         }
-        if (!removeQosItem(sai_object))
+        if (isContentShared() ? !releaseSharedQosItem(sai_object) : !removeQosItem(sai_object))
         {
             SWSS_LOG_ERROR("Failed to remove QoS map. db name:%s sai object:%" PRIx64, qos_object_name.c_str(), sai_object);
             return task_process_status::task_failed;
@@ -231,6 +238,168 @@ void QosMapHandler::freeAttribResources(vector<sai_attribute_t> &attributes)
     delete[] attributes[0].value.qosmap.list;
 }
 
+bool QosMapHandler::isContentShared() const
+{
+    return true;
+}
+
+string QosMapHandler::getContentKey(const string &qos_map_type_name, const vector<sai_attribute_t> &attributes) const
+{
+    SWSS_LOG_ENTER();
+
+    /* The entries are sorted, so that maps listing them in a different order share the key */
+    const sai_qos_map_list_t &map_list = attributes[0].value.qosmap;
+    vector<string> entries;
+    for (uint32_t ind = 0; ind < map_list.count; ind++)
+    {
+        const sai_qos_map_params_t &key = map_list.list[ind].key;
+        const sai_qos_map_params_t &value = map_list.list[ind].value;
+        ostringstream entry;
+        for (const auto &params : { &key, &value })
+        {
+            entry << (uint32_t)params->tc << "," << (uint32_t)params->dscp << "," << (uint32_t)params->dot1p << ","
+                  << (uint32_t)params->prio << "," << (uint32_t)params->pg << "," << (uint32_t)params->queue_index << ","
+                  << (uint32_t)params->color << "," << (uint32_t)params->mpls_exp << "," << (uint32_t)params->fc << ";";
+        }
+        entries.push_back(entry.str());
+    }
+    sort(entries.begin(), entries.end());
+
+    string content_key = qos_map_type_name;
+    for (const auto &entry : entries)
+    {
+        content_key += "|" + entry;
+    }
+    return content_key;
+}
+
+task_process_status QosMapHandler::setSharedQosItem(const string &qos_map_type_name, const string &qos_object_name,
+                                                    sai_object_id_t sai_object, vector<sai_attribute_t> &attributes)
+{
+    SWSS_LOG_ENTER();
+
+    auto &objects = gQosOrch->m_qosMapObjects;
+    auto &objects_by_content = gQosOrch->m_qosMapsByContent;
+    string content_key = getContentKey(qos_map_type_name, attributes);
+
+    if (SAI_NULL_OBJECT_ID != sai_object)
+    {
+        auto &current = objects[sai_object];
+        if (current.contentKey == content_key)
+        {
+            SWSS_LOG_INFO("[%s:%s] is not changed", qos_map_type_name.c_str(), qos_object_name.c_str());
+            return task_process_status::task_success;
+        }
+
+        /*
+         * The object is used by this map only, modify it in place unless another
+         * object has the new content and the users of this map can move to it
+         */
+        bool can_rebind = gQosOrch->canRebindQosMap(qos_map_type_name, qos_object_name);
+        if (current.refCount == 1 && (!can_rebind || objects_by_content.find(content_key) == objects_by_content.end()))
+        {
+            if (!modifyQosItem(sai_object, attributes))
+            {
+                SWSS_LOG_ERROR("Failed to set [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
+                return task_process_status::task_failed;
+            }
+            auto indexed = objects_by_content.find(current.contentKey);
+            if (indexed != objects_by_content.end() && indexed->second == sai_object)
+            {
+                objects_by_content.erase(indexed);
+            }
+            /*
+             * Another object may already have the content, this one is then not shared any more.
+             * Neither is it while the map has users which can't be moved, see unshareQosMap
+             */
+            if (can_rebind)
+            {
+                objects_by_content.emplace(content_key, sai_object);
+            }
+            current.contentKey = content_key;
+            SWSS_LOG_NOTICE("Set [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
+            return task_process_status::task_success;
+        }
+
+        /* The object is shared with other maps and can't be modified, nor can the users of this map be moved */
+        if (!can_rebind)
+        {
+            SWSS_LOG_NOTICE("Can't set [%s:%s] while its QoS map object is shared", qos_map_type_name.c_str(), qos_object_name.c_str());
+            return task_process_status::task_need_retry;
+        }
+    }
+
+    sai_object_id_t new_object;
+    auto found = objects_by_content.find(content_key);
+    if (found != objects_by_content.end())
+    {
+        new_object = found->second;
+        objects[new_object].refCount++;
+        SWSS_LOG_INFO("[%s:%s] shares QoS map object:%" PRIx64, qos_map_type_name.c_str(), qos_object_name.c_str(), new_object);
+    }
+    else
+    {
+        new_object = addQosItem(attributes);
+        if (new_object == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("Failed to create [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
+            return task_process_status::task_failed;
+        }
+        objects[new_object] = { content_key, 1 };
+        objects_by_content[content_key] = new_object;
+    }
+
+    if (SAI_NULL_OBJECT_ID != sai_object)
+    {
+        /* The object is shared with other maps, move the users of this map to the object of the new content */
+        if (!gQosOrch->rebindQosMap(qos_map_type_name, qos_object_name, new_object))
+        {
+            releaseSharedQosItem(new_object);
+            return task_process_status::task_need_retry;
+        }
+        releaseSharedQosItem(sai_object);
+        SWSS_LOG_NOTICE("Set [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
+    }
+    else
+    {
+        SWSS_LOG_NOTICE("Created [%s:%s]", qos_map_type_name.c_str(), qos_object_name.c_str());
+    }
+
+    (*(QosOrch::getTypeMap()[qos_map_type_name]))[qos_object_name].m_saiObjectId = new_object;
+    (*(QosOrch::getTypeMap()[qos_map_type_name]))[qos_object_name].m_pendingRemove = false;
+    return task_process_status::task_success;
+}
+
+bool QosMapHandler::releaseSharedQosItem(sai_object_id_t sai_object)
+{
+    SWSS_LOG_ENTER();
+
+    auto &objects = gQosOrch->m_qosMapObjects;
+    auto found = objects.find(sai_object);
+    if (found == objects.end())
+    {
+        return removeQosItem(sai_object);
+    }
+
+    if (found->second.refCount > 1)
+    {
+        found->second.refCount--;
+        return true;
+    }
+
+    if (!removeQosItem(sai_object))
+    {
+        return false;
+    }
+    auto indexed = gQosOrch->m_qosMapsByContent.find(found->second.contentKey);
+    if (indexed != gQosOrch->m_qosMapsByContent.end() && indexed->second == sai_object)
+    {
+        gQosOrch->m_qosMapsByContent.erase(indexed);
+    }
+    objects.erase(found);
+    return true;
+}
+
 bool DscpToTcMapHandler::convertFieldValuesToAttributes(KeyOpFieldsValuesTuple &tuple, vector<sai_attribute_t> &attributes)
 {
     SWSS_LOG_ENTER();
@@ -860,6 +1029,11 @@ sai_object_id_t WredMapHandler::addQosItem(const vector<sai_attribute_t> &attrib
     return sai_object;
 }
 
+bool WredMapHandler::isContentShared() const
+{
+    return false;
+}
+
 bool WredMapHandler::removeQosItem(sai_object_id_t sai_object)
 {
     SWSS_LOG_ENTER();
@@ -1970,6 +2144,217 @@ bool QosOrch::applyDscpToTcMapToSwitch(sai_attr_id_t attr_id, sai_object_id_t ma
     return true;
 }
 
+task_process_status QosOrch::setPortsAttribute(const vector<Port> &ports, const sai_attribute_t &attr, const string &attr_name)
+{
+    SWSS_LOG_ENTER();
+
+    if (ports.empty())
+    {
+        return task_process_status::task_success;
+    }
+
+    vector<sai_object_id_t> port_ids;
+    for (const auto &port : ports)
+    {
+        port_ids.push_back(port.m_port_id);
+    }
+    vector<sai_attribute_t> attrs(ports.size(), attr);
+    vector<sai_status_t> statuses(ports.size(), SAI_STATUS_NOT_EXECUTED);
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+    if (ports.size() > 1 && sai_port_api->set_ports_attribute)
+    {
+        status = sai_port_api->set_ports_attribute((uint32_t)ports.size(), port_ids.data(), attrs.data(),
+                                                   SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        /* Set the ports one by one when the bulk set is not available */
+        for (size_t i = 0; i < ports.size(); i++)
+        {
+            statuses[i] = sai_port_api->set_port_attribute(port_ids[i], &attr);
+        }
+    }
+
+    for (size_t i = 0; i < ports.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to set %s on port %s, rv:%d",
+                           attr_name.c_str(), ports[i].m_alias.c_str(), statuses[i]);
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, statuses[i]);
+            if (handle_status != task_process_status::task_success)
+            {
+                return task_process_status::task_invalid_entry;
+            }
+        }
+        SWSS_LOG_INFO("Set %s on port %s", attr_name.c_str(), ports[i].m_alias.c_str());
+    }
+
+    return task_process_status::task_success;
+}
+
+bool QosOrch::getQosMapBindings(const string &qos_map_type_name, const string &qos_object_name,
+                                 vector<pair<string, string>> &bindings)
+{
+    SWSS_LOG_ENTER();
+
+    auto &port_qos_maps = *m_qos_maps[CFG_PORT_QOS_MAP_TABLE_NAME];
+    string reference = qos_map_type_name + delimiter + qos_object_name;
+
+    for (const auto &dependent : (*m_qos_maps[qos_map_type_name])[qos_object_name].m_objsDependingOnMe)
+    {
+        bool found = false;
+        auto port_qos_map = port_qos_maps.find(dependent);
+        if (port_qos_map != port_qos_maps.end())
+        {
+            for (const auto &field_ref : port_qos_map->second.m_objsReferencingByMe)
+            {
+                if (field_ref.second == reference)
+                {
+                    bindings.emplace_back(dependent, field_ref.first);
+                    found = true;
+                }
+            }
+        }
+
+        if (!found)
+        {
+            SWSS_LOG_INFO("%s can't be moved to another QoS map object due to being referenced by %s",
+                          reference.c_str(), dependent.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool QosOrch::canRebindQosMap(const string &qos_map_type_name, const string &qos_object_name)
+{
+    vector<pair<string, string>> bindings;
+    return getQosMapBindings(qos_map_type_name, qos_object_name, bindings);
+}
+
+bool QosOrch::rebindQosMap(const string &qos_map_type_name, const string &qos_object_name, sai_object_id_t sai_object)
+{
+    SWSS_LOG_ENTER();
+
+    /* Collect the PORT_QOS_MAP keys and fields using the map */
+    vector<pair<string, string>> bindings;
+    if (!getQosMapBindings(qos_map_type_name, qos_object_name, bindings))
+    {
+        return false;
+    }
+
+    for (const auto &binding : bindings)
+    {
+        if (binding.first == PORT_NAME_GLOBAL)
+        {
+            if (!applyDscpToTcMapToSwitch(SAI_SWITCH_ATTR_QOS_DSCP_TO_TC_MAP, sai_object))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        vector<Port> ports;
+        for (const auto &port_name : tokenize(binding.first, list_item_delimiter))
+        {
+            Port port;
+            if (gPortsOrch->getPort(port_name, port))
+            {
+                ports.push_back(port);
+            }
+        }
+
+        sai_attribute_t attr;
+        attr.id = qos_to_attr_map[binding.second];
+        attr.value.oid = sai_object;
+        if (setPortsAttribute(ports, attr, qos_object_name) != task_process_status::task_success)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+sai_object_id_t QosOrch::copyQosMapObject(sai_object_id_t sai_object)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_qos_map_t> map_list(DSCP_MAX_VAL + 1);
+    vector<sai_attribute_t> attrs(2);
+    attrs[0].id = SAI_QOS_MAP_ATTR_TYPE;
+    attrs[1].id = SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST;
+    attrs[1].value.qosmap.count = (uint32_t)map_list.size();
+    attrs[1].value.qosmap.list = map_list.data();
+    sai_status_t sai_status = sai_qos_map_api->get_qos_map_attribute(sai_object, (uint32_t)attrs.size(), attrs.data());
+    if (sai_status == SAI_STATUS_BUFFER_OVERFLOW)
+    {
+        map_list.resize(attrs[1].value.qosmap.count);
+        attrs[1].value.qosmap.list = map_list.data();
+        sai_status = sai_qos_map_api->get_qos_map_attribute(sai_object, (uint32_t)attrs.size(), attrs.data());
+    }
+    if (sai_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to get QoS map object:%" PRIx64 ", status:%d", sai_object, sai_status);
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    sai_object_id_t new_object;
+    sai_status = sai_qos_map_api->create_qos_map(&new_object, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (sai_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to copy QoS map object:%" PRIx64 ", status:%d", sai_object, sai_status);
+        return SAI_NULL_OBJECT_ID;
+    }
+    return new_object;
+}
+
+sai_object_id_t QosOrch::unshareQosMap(const string &qos_map_type_name, const string &qos_object_name)
+{
+    SWSS_LOG_ENTER();
+
+    auto &qos_map = (*m_qos_maps[qos_map_type_name])[qos_object_name];
+    auto found = m_qosMapObjects.find(qos_map.m_saiObjectId);
+    if (found == m_qosMapObjects.end())
+    {
+        return qos_map.m_saiObjectId;
+    }
+
+    /* Other maps must not start sharing the object, whose users can't all be moved any more */
+    auto indexed = m_qosMapsByContent.find(found->second.contentKey);
+    if (indexed != m_qosMapsByContent.end() && indexed->second == qos_map.m_saiObjectId)
+    {
+        m_qosMapsByContent.erase(indexed);
+    }
+    if (found->second.refCount == 1)
+    {
+        return qos_map.m_saiObjectId;
+    }
+
+    /* The object is shared with other maps, move this map and its ports to a copy */
+    sai_object_id_t new_object = copyQosMapObject(qos_map.m_saiObjectId);
+    if (new_object == SAI_NULL_OBJECT_ID)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+    if (!rebindQosMap(qos_map_type_name, qos_object_name, new_object))
+    {
+        rebindQosMap(qos_map_type_name, qos_object_name, qos_map.m_saiObjectId);
+        sai_qos_map_api->remove_qos_map(new_object);
+        return SAI_NULL_OBJECT_ID;
+    }
+    m_qosMapObjects[new_object] = { found->second.contentKey, 1 };
+    found->second.refCount--;
+    SWSS_LOG_NOTICE("[%s:%s] stops sharing QoS map object:%" PRIx64 ", moved to object:%" PRIx64,
+                    qos_map_type_name.c_str(), qos_object_name.c_str(), qos_map.m_saiObjectId, new_object);
+    qos_map.m_saiObjectId = new_object;
+    return new_object;
+}
+
 task_process_status QosOrch::handleGlobalQosMap(const string &OP, KeyOpFieldsValuesTuple &tuple)
 {
     SWSS_LOG_ENTER();
@@ -2050,52 +2435,49 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
 
     vector<string> port_names = tokenize(key, list_item_delimiter);
 
+    /* Skip port which is not found */
+    vector<Port> ports;
+    for (string port_name : port_names)
+    {
+        Port port;
+        if (!gPortsOrch->getPort(port_name, port))
+        {
+            SWSS_LOG_ERROR("Failed to apply QoS maps to port %s. Port is not found.", port_name.c_str());
+            continue;
+        }
+        ports.push_back(port);
+    }
+
     if (op == DEL_COMMAND)
     {
         /* Handle DEL command. Just set all the maps to oid:0x0 */
-        for (string port_name : port_names)
+        for (auto &mapRef : qos_to_attr_map)
         {
-            Port port;
-
-            /* Skip port which is not found */
-            if (!gPortsOrch->getPort(port_name, port))
+            string referenced_obj;
+            if (!doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
             {
-                SWSS_LOG_ERROR("Failed to apply QoS maps to port %s. Port is not found.", port_name.c_str());
                 continue;
             }
 
-            for (auto &mapRef : qos_to_attr_map)
-            {
-                string referenced_obj;
-                if (!doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
-                {
-                    continue;
-                }
-
-                sai_attribute_t attr;
-                attr.id = mapRef.second;
-                attr.value.oid = SAI_NULL_OBJECT_ID;
+            sai_attribute_t attr;
+            attr.id = mapRef.second;
+            attr.value.oid = SAI_NULL_OBJECT_ID;
 
-                sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-                if (status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("Failed to remove %s on port %s, rv:%d",
-                                   mapRef.first.c_str(), port_name.c_str(), status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
-                    if (handle_status != task_process_status::task_success)
-                    {
-                        return task_process_status::task_invalid_entry;
-                    }
-                }
-                SWSS_LOG_INFO("Removed %s on port %s", mapRef.first.c_str(), port_name.c_str());
+            task_process_status status = setPortsAttribute(ports, attr, mapRef.first);
+            if (status != task_process_status::task_success)
+            {
+                return status;
             }
+        }
 
+        for (const auto &port : ports)
+        {
             if (!gPortsOrch->setPortPfc(port.m_port_id, 0))
             {
-                SWSS_LOG_ERROR("Failed to disable PFC on port %s", port_name.c_str());
+                SWSS_LOG_ERROR("Failed to disable PFC on port %s", port.m_alias.c_str());
             }
 
-            SWSS_LOG_INFO("Disabled PFC on port %s", port_name.c_str());
+            SWSS_LOG_INFO("Disabled PFC on port %s", port.m_alias.c_str());
         }
 
         removeObject(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key);
@@ -2165,37 +2547,23 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
         }
     }
 
-    for (string port_name : port_names)
+    /* Apply a list of attributes to be applied, to all the ports at once */
+    for (auto it = update_list.begin(); it != update_list.end(); it++)
     {
-        Port port;
+        sai_attribute_t attr;
+        attr.id = it->first;
+        attr.value.oid = it->second.second;
 
-        /* Skip port which is not found */
-        if (!gPortsOrch->getPort(port_name, port))
+        task_process_status status = setPortsAttribute(ports, attr, it->second.first);
+        if (status != task_process_status::task_success)
         {
-            SWSS_LOG_ERROR("Failed to apply QoS maps to port %s. Port is not found.", port_name.c_str());
-            continue;
+            return status;
         }
+    }
 
-        /* Apply a list of attributes to be applied */
-        for (auto it = update_list.begin(); it != update_list.end(); it++)
-        {
-            sai_attribute_t attr;
-            attr.id = it->first;
-            attr.value.oid = it->second.second;
-
-            sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_ERROR("Failed to apply %s to port %s, rv:%d",
-                               it->second.first.c_str(), port_name.c_str(), status);
-                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
-                if (handle_status != task_process_status::task_success)
-                {
-                    return task_process_status::task_invalid_entry;
-                }
-            }
-            SWSS_LOG_INFO("Applied %s to port %s", it->second.first.c_str(), port_name.c_str());
-        }
+    for (const auto &port : ports)
+    {
+        const string &port_name = port.m_alias;
 
         sai_uint8_t old_pfc_enable = 0;
         if (!gPortsOrch->getPortPfc(port.m_port_id, &old_pfc_enable))
@@ -2311,7 +2679,12 @@ sai_object_id_t QosOrch::resolveTunnelQosMap(std::string referencing_table_name,
     ref_resolve_status status = resolveFieldRefValue(m_qos_maps, map_type_name, qos_to_ref_table_map.at(map_type_name), tuple, id, object_name);
     if (status == ref_resolve_status::success)
     {
-        
+        /* The tunnel can't be moved to another QoS map object, so the map stops sharing its object */
+        id = unshareQosMap(qos_to_ref_table_map.at(map_type_name), object_name);
+        if (id == SAI_NULL_OBJECT_ID)
+        {
+            return SAI_NULL_OBJECT_ID;
+        }
         setObjectReference(m_qos_maps, referencing_table_name, tunnel_name, map_type_name, object_name);
         SWSS_LOG_INFO("Resolved QoS map for table %s tunnel %s type %s name %s", referencing_table_name.c_str(), tunnel_name.c_str(), map_type_name.c_str(), object_name.c_str());
         return id;
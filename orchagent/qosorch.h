@@ -71,6 +71,13 @@ public:
     virtual bool modifyQosItem(sai_object_id_t, vector<sai_attribute_t> &attributes);
     virtual sai_object_id_t addQosItem(const vector<sai_attribute_t> &attributes) = 0;//different for sub-classes
     virtual bool removeQosItem(sai_object_id_t sai_object);
+    // Maps with the same content share one SAI object
+    virtual bool isContentShared() const;
+protected:
+    string getContentKey(const string &qos_map_type_name, const vector<sai_attribute_t> &attributes) const;
+    task_process_status setSharedQosItem(const string &qos_map_type_name, const string &qos_object_name,
+                                         sai_object_id_t sai_object, vector<sai_attribute_t> &attributes);
+    bool releaseSharedQosItem(sai_object_id_t sai_object);
 };
 
 class DscpToTcMapHandler : public QosMapHandler
@@ -110,6 +117,7 @@ public:
     sai_object_id_t addQosItem(const vector<sai_attribute_t> &attributes);
     bool modifyQosItem(sai_object_id_t sai_object, vector<sai_attribute_t> &attribs);
     bool removeQosItem(sai_object_id_t sai_object);
+    bool isContentShared() const override;
 protected:
     bool convertEcnMode(string str, sai_ecn_mark_mode_t &ecn_val);
     bool convertBool(string str, bool &val);
@@ -227,9 +235,35 @@ private:
     bool applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id);
     bool applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile);
     bool applyDscpToTcMapToSwitch(sai_attr_id_t attr_id, sai_object_id_t sai_dscp_to_tc_map);
+    task_process_status setPortsAttribute(const vector<Port> &ports, const sai_attribute_t &attr, const string &attr_name);
+    /* Whether all the users of a map are PORT_QOS_MAP bindings, which rebindQosMap can move */
+    bool canRebindQosMap(const string &qos_map_type_name, const string &qos_object_name);
+    bool rebindQosMap(const string &qos_map_type_name, const string &qos_object_name, sai_object_id_t sai_object);
+    /*
+     * Gives a map an object of its own before it gets a user which rebindQosMap can't move,
+     * such as a tunnel. Returns the object of the map, or SAI_NULL_OBJECT_ID on failure
+     */
+    sai_object_id_t unshareQosMap(const string &qos_map_type_name, const string &qos_object_name);
 private:
+    sai_object_id_t copyQosMapObject(sai_object_id_t sai_object);
+    bool getQosMapBindings(const string &qos_map_type_name, const string &qos_object_name,
+                           vector<pair<string, string>> &bindings);
+
     qos_table_handler_map m_qos_handler_map;
 
+    /*
+     * QoS maps of the same table and content share one SAI object, which is
+     * removed along with the last map name using it
+     */
+    struct QosMapObject
+    {
+        string contentKey;
+        uint32_t refCount;
+    };
+
+    map<sai_object_id_t, QosMapObject> m_qosMapObjects;
+    map<string, sai_object_id_t> m_qosMapsByContent;
+
     struct SchedulerGroupPortInfo_t
     {
         std::vector<sai_object_id_t> groups;
@@ -19,6 +19,7 @@ extern "C" {
 #include "timestamp.h"
 #include "sai_serialize.h"
 #include "saihelper.h"
+#include "saiprofiler.h"
 #include "orch.h"
 
 using namespace std;
@@ -84,6 +85,12 @@ sai_dash_vip_api_t*                 sai_dash_vip_api;
 sai_dash_direction_lookup_api_t*    sai_dash_direction_lookup_api;
 sai_twamp_api_t*                    sai_twamp_api;
 
+/* The ACL entries and counters are bulked with the generic bulk functions, see bulker.h */
+sai_bulk_object_create_fn   sai_bulk_create_acl_entries = sai_bulk_object_create;
+sai_bulk_object_remove_fn   sai_bulk_remove_acl_entries = sai_bulk_object_remove;
+sai_bulk_object_create_fn   sai_bulk_create_acl_counters = sai_bulk_object_create;
+sai_bulk_object_remove_fn   sai_bulk_remove_acl_counters = sai_bulk_object_remove;
+
 extern sai_object_id_t gSwitchId;
 
 static map<string, sai_switch_hardware_access_bus_t> hardware_access_map =
@@ -259,6 +266,11 @@ void initSaiApi()
     sai_log_set(SAI_API_MY_MAC,                 SAI_LOG_LEVEL_NOTICE);
     sai_log_set(SAI_API_GENERIC_PROGRAMMABLE,   SAI_LOG_LEVEL_NOTICE);
     sai_log_set(SAI_API_TWAMP,                  SAI_LOG_LEVEL_NOTICE);
+
+    if (SaiProfiler::isEnabled())
+    {
+        SaiProfiler::hookApis();
+    }
 }
 
 void initSaiRedis()
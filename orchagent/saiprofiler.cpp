@@ -0,0 +1,534 @@
+#include <map>
+#include <sstream>
+#include <type_traits>
+
+#include "logger.h"
+#include "sai_serialize.h"
+#include "timer.h"
+#include "saiprofiler.h"
+
+using namespace std;
+using namespace swss;
+
+extern sai_switch_api_t*            sai_switch_api;
+extern sai_bridge_api_t*            sai_bridge_api;
+extern sai_virtual_router_api_t*    sai_virtual_router_api;
+extern sai_port_api_t*              sai_port_api;
+extern sai_vlan_api_t*              sai_vlan_api;
+extern sai_router_interface_api_t*  sai_router_intfs_api;
+extern sai_hostif_api_t*            sai_hostif_api;
+extern sai_neighbor_api_t*          sai_neighbor_api;
+extern sai_next_hop_api_t*          sai_next_hop_api;
+extern sai_next_hop_group_api_t*    sai_next_hop_group_api;
+extern sai_route_api_t*             sai_route_api;
+extern sai_mpls_api_t*              sai_mpls_api;
+extern sai_lag_api_t*               sai_lag_api;
+extern sai_policer_api_t*           sai_policer_api;
+extern sai_tunnel_api_t*            sai_tunnel_api;
+extern sai_queue_api_t*             sai_queue_api;
+extern sai_scheduler_api_t*         sai_scheduler_api;
+extern sai_scheduler_group_api_t*   sai_scheduler_group_api;
+extern sai_wred_api_t*              sai_wred_api;
+extern sai_qos_map_api_t*           sai_qos_map_api;
+extern sai_buffer_api_t*            sai_buffer_api;
+extern sai_acl_api_t*               sai_acl_api;
+extern sai_bulk_object_create_fn    sai_bulk_create_acl_entries;
+extern sai_bulk_object_remove_fn    sai_bulk_remove_acl_entries;
+extern sai_bulk_object_create_fn    sai_bulk_create_acl_counters;
+extern sai_bulk_object_remove_fn    sai_bulk_remove_acl_counters;
+extern sai_mirror_api_t*            sai_mirror_api;
+extern sai_fdb_api_t*               sai_fdb_api;
+extern sai_counter_api_t*           sai_counter_api;
+extern sai_nat_api_t*               sai_nat_api;
+extern sai_bfd_api_t*               sai_bfd_api;
+extern sai_srv6_api_t*              sai_srv6_api;
+
+bool SaiProfiler::m_enabled = false;
+int SaiProfiler::m_interval = SAI_PROFILER_INTERVAL_DEFAULT;
+atomic<bool> SaiProfiler::m_dumpRequested(false);
+
+namespace
+{
+    struct HookInfo
+    {
+        bool registered;
+        sai_object_type_t objectType;
+        SaiProfiler::Op op;
+    };
+
+    struct Aggregate
+    {
+        uint64_t count = 0;
+        uint64_t totalUs = 0;
+        uint64_t maxUs = 0;
+        uint64_t buckets[SAI_PROFILER_BUCKETS] = {};
+    };
+
+    HookInfo g_hooks[SAI_PROFILER_MAX_HOOKS];
+    SaiProfiler::Counters g_counters[SAI_PROFILER_MAX_HOOKS];
+
+    /* Call count of each key at the last export */
+    map<string, uint64_t> g_exported;
+
+    uint64_t bucketUpperBound(size_t bucket)
+    {
+        return 1ULL << bucket;
+    }
+
+    uint64_t percentile(const Aggregate &aggregate, uint64_t percent)
+    {
+        uint64_t calls = 0;
+        for (size_t i = 0; i < SAI_PROFILER_BUCKETS; i++)
+        {
+            calls += aggregate.buckets[i];
+            if (calls * 100 >= aggregate.count * percent)
+            {
+                return bucketUpperBound(i);
+            }
+        }
+
+        return bucketUpperBound(SAI_PROFILER_BUCKETS - 1);
+    }
+
+    map<string, Aggregate> aggregateCounters()
+    {
+        map<string, Aggregate> aggregates;
+
+        for (size_t id = 0; id < SAI_PROFILER_MAX_HOOKS; id++)
+        {
+            if (!g_hooks[id].registered)
+            {
+                continue;
+            }
+
+            const auto &counters = g_counters[id];
+            uint64_t count = counters.count.load(memory_order_relaxed);
+            if (count == 0)
+            {
+                continue;
+            }
+
+            string key = sai_serialize_object_type(g_hooks[id].objectType) + ":" + SaiProfiler::getOpName(g_hooks[id].op);
+            auto &aggregate = aggregates[key];
+            aggregate.count += count;
+            aggregate.totalUs += counters.totalUs.load(memory_order_relaxed);
+            aggregate.maxUs = max(aggregate.maxUs, counters.maxUs.load(memory_order_relaxed));
+            for (size_t i = 0; i < SAI_PROFILER_BUCKETS; i++)
+            {
+                aggregate.buckets[i] += counters.buckets[i].load(memory_order_relaxed);
+            }
+        }
+
+        return aggregates;
+    }
+
+    vector<FieldValueTuple> serializeAggregate(const Aggregate &aggregate)
+    {
+        ostringstream histogram;
+        for (size_t i = 0; i < SAI_PROFILER_BUCKETS; i++)
+        {
+            if (aggregate.buckets[i] == 0)
+            {
+                continue;
+            }
+
+            if (histogram.tellp() > 0)
+            {
+                histogram << ",";
+            }
+
+            if (i == SAI_PROFILER_BUCKETS - 1)
+            {
+                histogram << "inf:" << aggregate.buckets[i];
+            }
+            else
+            {
+                histogram << bucketUpperBound(i) << ":" << aggregate.buckets[i];
+            }
+        }
+
+        return {
+            { "count", to_string(aggregate.count) },
+            { "total_us", to_string(aggregate.totalUs) },
+            { "avg_us", to_string(aggregate.totalUs / aggregate.count) },
+            { "max_us", to_string(aggregate.maxUs) },
+            { "p50_us", to_string(percentile(aggregate, 50)) },
+            { "p99_us", to_string(percentile(aggregate, 99)) },
+            { "histogram", histogram.str() },
+        };
+    }
+}
+
+void SaiProfiler::enable(int interval)
+{
+    m_enabled = true;
+    m_interval = interval > 0 ? interval : SAI_PROFILER_INTERVAL_DEFAULT;
+}
+
+bool SaiProfiler::isEnabled()
+{
+    return m_enabled;
+}
+
+int SaiProfiler::getInterval()
+{
+    return m_interval;
+}
+
+void SaiProfiler::requestDump()
+{
+    m_dumpRequested.store(true, memory_order_relaxed);
+}
+
+bool SaiProfiler::isDumpRequested()
+{
+    return m_dumpRequested.exchange(false, memory_order_relaxed);
+}
+
+string SaiProfiler::getOpName(Op op)
+{
+    switch (op)
+    {
+        case Op::CREATE:      return "create";
+        case Op::REMOVE:      return "remove";
+        case Op::SET:         return "set";
+        case Op::GET:         return "get";
+        case Op::BULK_CREATE: return "bulk_create";
+        case Op::BULK_REMOVE: return "bulk_remove";
+        case Op::BULK_SET:    return "bulk_set";
+        case Op::BULK_GET:    return "bulk_get";
+        default:              return "other";
+    }
+}
+
+void SaiProfiler::registerHook(size_t id, sai_object_type_t objectType, Op op)
+{
+    g_hooks[id] = { true, objectType, op };
+}
+
+void SaiProfiler::record(size_t id, chrono::steady_clock::time_point start)
+{
+    uint64_t us = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(
+                chrono::steady_clock::now() - start).count());
+    auto &counters = g_counters[id];
+
+    counters.count.fetch_add(1, memory_order_relaxed);
+    counters.totalUs.fetch_add(us, memory_order_relaxed);
+
+    uint64_t maxUs = counters.maxUs.load(memory_order_relaxed);
+    while (us > maxUs && !counters.maxUs.compare_exchange_weak(maxUs, us, memory_order_relaxed));
+
+    size_t bucket = us ? static_cast<size_t>(64 - __builtin_clzll(us)) : 0;
+    if (bucket >= SAI_PROFILER_BUCKETS)
+    {
+        bucket = SAI_PROFILER_BUCKETS - 1;
+    }
+    counters.buckets[bucket].fetch_add(1, memory_order_relaxed);
+}
+
+uint64_t SaiProfiler::getCallCount(sai_object_type_t objectType, Op op)
+{
+    uint64_t count = 0;
+
+    for (size_t id = 0; id < SAI_PROFILER_MAX_HOOKS; id++)
+    {
+        if (g_hooks[id].registered && g_hooks[id].objectType == objectType && g_hooks[id].op == op)
+        {
+            count += g_counters[id].count.load(memory_order_relaxed);
+        }
+    }
+
+    return count;
+}
+
+void SaiProfiler::exportCounters(Table &table)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &it: aggregateCounters())
+    {
+        auto &exported = g_exported[it.first];
+        if (exported == it.second.count)
+        {
+            continue;
+        }
+
+        table.set(it.first, serializeAggregate(it.second));
+        exported = it.second.count;
+    }
+}
+
+void SaiProfiler::logCounters()
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &it: aggregateCounters())
+    {
+        ostringstream fields;
+        for (const auto &fv: serializeAggregate(it.second))
+        {
+            fields << " " << fvField(fv) << "=" << fvValue(fv);
+        }
+
+        SWSS_LOG_NOTICE("SAI profiler %s:%s", it.first.c_str(), fields.str().c_str());
+    }
+}
+
+/*
+ * The API tables returned by sai_api_query() are read-only, so each one is
+ * copied and the global API pointer is moved to the copy before hooking it.
+ */
+#define SAI_PROFILER_API(api) \
+    static remove_pointer<decltype(sai_##api##_api)>::type api##_table; \
+    if (sai_##api##_api) \
+    { \
+        api##_table = *sai_##api##_api; \
+        sai_##api##_api = &api##_table; \
+    }
+
+#define SAI_PROFILER_HOOK(api, fn, objectType, op) \
+    SaiProfiler::hook<__COUNTER__>(api##_table.fn, SAI_OBJECT_TYPE_##objectType, SaiProfiler::Op::op)
+
+void SaiProfiler::hookApis()
+{
+    SWSS_LOG_ENTER();
+
+    SAI_PROFILER_API(switch);
+    SAI_PROFILER_HOOK(switch, set_switch_attribute, SWITCH, SET);
+    SAI_PROFILER_HOOK(switch, get_switch_attribute, SWITCH, GET);
+
+    SAI_PROFILER_API(bridge);
+    SAI_PROFILER_HOOK(bridge, create_bridge_port, BRIDGE_PORT, CREATE);
+    SAI_PROFILER_HOOK(bridge, remove_bridge_port, BRIDGE_PORT, REMOVE);
+    SAI_PROFILER_HOOK(bridge, set_bridge_port_attribute, BRIDGE_PORT, SET);
+    SAI_PROFILER_HOOK(bridge, get_bridge_port_attribute, BRIDGE_PORT, GET);
+
+    SAI_PROFILER_API(virtual_router);
+    SAI_PROFILER_HOOK(virtual_router, create_virtual_router, VIRTUAL_ROUTER, CREATE);
+    SAI_PROFILER_HOOK(virtual_router, remove_virtual_router, VIRTUAL_ROUTER, REMOVE);
+    SAI_PROFILER_HOOK(virtual_router, set_virtual_router_attribute, VIRTUAL_ROUTER, SET);
+
+    SAI_PROFILER_API(port);
+    SAI_PROFILER_HOOK(port, create_port, PORT, CREATE);
+    SAI_PROFILER_HOOK(port, remove_port, PORT, REMOVE);
+    SAI_PROFILER_HOOK(port, set_port_attribute, PORT, SET);
+    SAI_PROFILER_HOOK(port, get_port_attribute, PORT, GET);
+    SAI_PROFILER_HOOK(port, create_ports, PORT, BULK_CREATE);
+    SAI_PROFILER_HOOK(port, remove_ports, PORT, BULK_REMOVE);
+    SAI_PROFILER_HOOK(port, set_ports_attribute, PORT, BULK_SET);
+    SAI_PROFILER_HOOK(port, get_ports_attribute, PORT, BULK_GET);
+    SAI_PROFILER_HOOK(port, create_port_serdes, PORT_SERDES, CREATE);
+    SAI_PROFILER_HOOK(port, remove_port_serdes, PORT_SERDES, REMOVE);
+
+    SAI_PROFILER_API(vlan);
+    SAI_PROFILER_HOOK(vlan, create_vlan, VLAN, CREATE);
+    SAI_PROFILER_HOOK(vlan, remove_vlan, VLAN, REMOVE);
+    SAI_PROFILER_HOOK(vlan, set_vlan_attribute, VLAN, SET);
+    SAI_PROFILER_HOOK(vlan, get_vlan_attribute, VLAN, GET);
+    SAI_PROFILER_HOOK(vlan, create_vlan_member, VLAN_MEMBER, CREATE);
+    SAI_PROFILER_HOOK(vlan, remove_vlan_member, VLAN_MEMBER, REMOVE);
+
+    SAI_PROFILER_API(router_intfs);
+    SAI_PROFILER_HOOK(router_intfs, create_router_interface, ROUTER_INTERFACE, CREATE);
+    SAI_PROFILER_HOOK(router_intfs, remove_router_interface, ROUTER_INTERFACE, REMOVE);
+    SAI_PROFILER_HOOK(router_intfs, set_router_interface_attribute, ROUTER_INTERFACE, SET);
+    SAI_PROFILER_HOOK(router_intfs, get_router_interface_attribute, ROUTER_INTERFACE, GET);
+
+    SAI_PROFILER_API(hostif);
+    SAI_PROFILER_HOOK(hostif, create_hostif, HOSTIF, CREATE);
+    SAI_PROFILER_HOOK(hostif, remove_hostif, HOSTIF, REMOVE);
+    SAI_PROFILER_HOOK(hostif, set_hostif_attribute, HOSTIF, SET);
+    SAI_PROFILER_HOOK(hostif, create_hostif_trap, HOSTIF_TRAP, CREATE);
+    SAI_PROFILER_HOOK(hostif, remove_hostif_trap, HOSTIF_TRAP, REMOVE);
+    SAI_PROFILER_HOOK(hostif, set_hostif_trap_attribute, HOSTIF_TRAP, SET);
+
+    SAI_PROFILER_API(neighbor);
+    SAI_PROFILER_HOOK(neighbor, create_neighbor_entry, NEIGHBOR_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(neighbor, remove_neighbor_entry, NEIGHBOR_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(neighbor, set_neighbor_entry_attribute, NEIGHBOR_ENTRY, SET);
+    SAI_PROFILER_HOOK(neighbor, get_neighbor_entry_attribute, NEIGHBOR_ENTRY, GET);
+    SAI_PROFILER_HOOK(neighbor, create_neighbor_entries, NEIGHBOR_ENTRY, BULK_CREATE);
+    SAI_PROFILER_HOOK(neighbor, remove_neighbor_entries, NEIGHBOR_ENTRY, BULK_REMOVE);
+    SAI_PROFILER_HOOK(neighbor, set_neighbor_entries_attribute, NEIGHBOR_ENTRY, BULK_SET);
+
+    SAI_PROFILER_API(next_hop);
+    SAI_PROFILER_HOOK(next_hop, create_next_hop, NEXT_HOP, CREATE);
+    SAI_PROFILER_HOOK(next_hop, remove_next_hop, NEXT_HOP, REMOVE);
+    SAI_PROFILER_HOOK(next_hop, set_next_hop_attribute, NEXT_HOP, SET);
+    SAI_PROFILER_HOOK(next_hop, get_next_hop_attribute, NEXT_HOP, GET);
+
+    SAI_PROFILER_API(next_hop_group);
+    SAI_PROFILER_HOOK(next_hop_group, create_next_hop_group, NEXT_HOP_GROUP, CREATE);
+    SAI_PROFILER_HOOK(next_hop_group, remove_next_hop_group, NEXT_HOP_GROUP, REMOVE);
+    SAI_PROFILER_HOOK(next_hop_group, set_next_hop_group_attribute, NEXT_HOP_GROUP, SET);
+    SAI_PROFILER_HOOK(next_hop_group, get_next_hop_group_attribute, NEXT_HOP_GROUP, GET);
+    SAI_PROFILER_HOOK(next_hop_group, create_next_hop_group_member, NEXT_HOP_GROUP_MEMBER, CREATE);
+    SAI_PROFILER_HOOK(next_hop_group, remove_next_hop_group_member, NEXT_HOP_GROUP_MEMBER, REMOVE);
+    SAI_PROFILER_HOOK(next_hop_group, set_next_hop_group_member_attribute, NEXT_HOP_GROUP_MEMBER, SET);
+    SAI_PROFILER_HOOK(next_hop_group, create_next_hop_group_members, NEXT_HOP_GROUP_MEMBER, BULK_CREATE);
+    SAI_PROFILER_HOOK(next_hop_group, remove_next_hop_group_members, NEXT_HOP_GROUP_MEMBER, BULK_REMOVE);
+
+    SAI_PROFILER_API(route);
+    SAI_PROFILER_HOOK(route, create_route_entry, ROUTE_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(route, remove_route_entry, ROUTE_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(route, set_route_entry_attribute, ROUTE_ENTRY, SET);
+    SAI_PROFILER_HOOK(route, get_route_entry_attribute, ROUTE_ENTRY, GET);
+    SAI_PROFILER_HOOK(route, create_route_entries, ROUTE_ENTRY, BULK_CREATE);
+    SAI_PROFILER_HOOK(route, remove_route_entries, ROUTE_ENTRY, BULK_REMOVE);
+    SAI_PROFILER_HOOK(route, set_route_entries_attribute, ROUTE_ENTRY, BULK_SET);
+    SAI_PROFILER_HOOK(route, get_route_entries_attribute, ROUTE_ENTRY, BULK_GET);
+
+    SAI_PROFILER_API(mpls);
+    SAI_PROFILER_HOOK(mpls, create_inseg_entry, INSEG_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(mpls, remove_inseg_entry, INSEG_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(mpls, set_inseg_entry_attribute, INSEG_ENTRY, SET);
+    SAI_PROFILER_HOOK(mpls, create_inseg_entries, INSEG_ENTRY, BULK_CREATE);
+    SAI_PROFILER_HOOK(mpls, remove_inseg_entries, INSEG_ENTRY, BULK_REMOVE);
+    SAI_PROFILER_HOOK(mpls, set_inseg_entries_attribute, INSEG_ENTRY, BULK_SET);
+
+    SAI_PROFILER_API(lag);
+    SAI_PROFILER_HOOK(lag, create_lag, LAG, CREATE);
+    SAI_PROFILER_HOOK(lag, remove_lag, LAG, REMOVE);
+    SAI_PROFILER_HOOK(lag, set_lag_attribute, LAG, SET);
+    SAI_PROFILER_HOOK(lag, create_lag_member, LAG_MEMBER, CREATE);
+    SAI_PROFILER_HOOK(lag, remove_lag_member, LAG_MEMBER, REMOVE);
+    SAI_PROFILER_HOOK(lag, set_lag_member_attribute, LAG_MEMBER, SET);
+
+    SAI_PROFILER_API(policer);
+    SAI_PROFILER_HOOK(policer, create_policer, POLICER, CREATE);
+    SAI_PROFILER_HOOK(policer, remove_policer, POLICER, REMOVE);
+    SAI_PROFILER_HOOK(policer, set_policer_attribute, POLICER, SET);
+
+    SAI_PROFILER_API(tunnel);
+    SAI_PROFILER_HOOK(tunnel, create_tunnel, TUNNEL, CREATE);
+    SAI_PROFILER_HOOK(tunnel, remove_tunnel, TUNNEL, REMOVE);
+    SAI_PROFILER_HOOK(tunnel, set_tunnel_attribute, TUNNEL, SET);
+    SAI_PROFILER_HOOK(tunnel, create_tunnel_map_entry, TUNNEL_MAP_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(tunnel, remove_tunnel_map_entry, TUNNEL_MAP_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(tunnel, create_tunnel_term_table_entry, TUNNEL_TERM_TABLE_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(tunnel, remove_tunnel_term_table_entry, TUNNEL_TERM_TABLE_ENTRY, REMOVE);
+
+    SAI_PROFILER_API(queue);
+    SAI_PROFILER_HOOK(queue, set_queue_attribute, QUEUE, SET);
+    SAI_PROFILER_HOOK(queue, get_queue_attribute, QUEUE, GET);
+
+    SAI_PROFILER_API(scheduler);
+    SAI_PROFILER_HOOK(scheduler, create_scheduler, SCHEDULER, CREATE);
+    SAI_PROFILER_HOOK(scheduler, remove_scheduler, SCHEDULER, REMOVE);
+    SAI_PROFILER_HOOK(scheduler, set_scheduler_attribute, SCHEDULER, SET);
+
+    SAI_PROFILER_API(scheduler_group);
+    SAI_PROFILER_HOOK(scheduler_group, set_scheduler_group_attribute, SCHEDULER_GROUP, SET);
+    SAI_PROFILER_HOOK(scheduler_group, get_scheduler_group_attribute, SCHEDULER_GROUP, GET);
+
+    SAI_PROFILER_API(wred);
+    SAI_PROFILER_HOOK(wred, create_wred, WRED, CREATE);
+    SAI_PROFILER_HOOK(wred, remove_wred, WRED, REMOVE);
+    SAI_PROFILER_HOOK(wred, set_wred_attribute, WRED, SET);
+
+    SAI_PROFILER_API(qos_map);
+    SAI_PROFILER_HOOK(qos_map, create_qos_map, QOS_MAP, CREATE);
+    SAI_PROFILER_HOOK(qos_map, remove_qos_map, QOS_MAP, REMOVE);
+    SAI_PROFILER_HOOK(qos_map, set_qos_map_attribute, QOS_MAP, SET);
+
+    SAI_PROFILER_API(buffer);
+    SAI_PROFILER_HOOK(buffer, create_buffer_pool, BUFFER_POOL, CREATE);
+    SAI_PROFILER_HOOK(buffer, remove_buffer_pool, BUFFER_POOL, REMOVE);
+    SAI_PROFILER_HOOK(buffer, set_buffer_pool_attribute, BUFFER_POOL, SET);
+    SAI_PROFILER_HOOK(buffer, create_buffer_profile, BUFFER_PROFILE, CREATE);
+    SAI_PROFILER_HOOK(buffer, remove_buffer_profile, BUFFER_PROFILE, REMOVE);
+    SAI_PROFILER_HOOK(buffer, set_buffer_profile_attribute, BUFFER_PROFILE, SET);
+    SAI_PROFILER_HOOK(buffer, set_ingress_priority_group_attribute, INGRESS_PRIORITY_GROUP, SET);
+
+    SAI_PROFILER_API(acl);
+    SAI_PROFILER_HOOK(acl, create_acl_table, ACL_TABLE, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_table, ACL_TABLE, REMOVE);
+    SAI_PROFILER_HOOK(acl, get_acl_table_attribute, ACL_TABLE, GET);
+    SAI_PROFILER_HOOK(acl, create_acl_entry, ACL_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_entry, ACL_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(acl, set_acl_entry_attribute, ACL_ENTRY, SET);
+    SAI_PROFILER_HOOK(acl, create_acl_counter, ACL_COUNTER, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_counter, ACL_COUNTER, REMOVE);
+    SAI_PROFILER_HOOK(acl, get_acl_counter_attribute, ACL_COUNTER, GET);
+    SAI_PROFILER_HOOK(acl, create_acl_range, ACL_RANGE, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_range, ACL_RANGE, REMOVE);
+    SAI_PROFILER_HOOK(acl, create_acl_table_group, ACL_TABLE_GROUP, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_table_group, ACL_TABLE_GROUP, REMOVE);
+    SAI_PROFILER_HOOK(acl, create_acl_table_group_member, ACL_TABLE_GROUP_MEMBER, CREATE);
+    SAI_PROFILER_HOOK(acl, remove_acl_table_group_member, ACL_TABLE_GROUP_MEMBER, REMOVE);
+    SaiProfiler::hook<__COUNTER__>(sai_bulk_create_acl_entries, SAI_OBJECT_TYPE_ACL_ENTRY, Op::BULK_CREATE);
+    SaiProfiler::hook<__COUNTER__>(sai_bulk_remove_acl_entries, SAI_OBJECT_TYPE_ACL_ENTRY, Op::BULK_REMOVE);
+    SaiProfiler::hook<__COUNTER__>(sai_bulk_create_acl_counters, SAI_OBJECT_TYPE_ACL_COUNTER, Op::BULK_CREATE);
+    SaiProfiler::hook<__COUNTER__>(sai_bulk_remove_acl_counters, SAI_OBJECT_TYPE_ACL_COUNTER, Op::BULK_REMOVE);
+
+    SAI_PROFILER_API(mirror);
+    SAI_PROFILER_HOOK(mirror, create_mirror_session, MIRROR_SESSION, CREATE);
+    SAI_PROFILER_HOOK(mirror, remove_mirror_session, MIRROR_SESSION, REMOVE);
+    SAI_PROFILER_HOOK(mirror, set_mirror_session_attribute, MIRROR_SESSION, SET);
+    SAI_PROFILER_HOOK(mirror, get_mirror_session_attribute, MIRROR_SESSION, GET);
+
+    SAI_PROFILER_API(fdb);
+    SAI_PROFILER_HOOK(fdb, create_fdb_entry, FDB_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(fdb, remove_fdb_entry, FDB_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(fdb, set_fdb_entry_attribute, FDB_ENTRY, SET);
+    SAI_PROFILER_HOOK(fdb, create_fdb_entries, FDB_ENTRY, BULK_CREATE);
+    SAI_PROFILER_HOOK(fdb, remove_fdb_entries, FDB_ENTRY, BULK_REMOVE);
+    SAI_PROFILER_HOOK(fdb, set_fdb_entries_attribute, FDB_ENTRY, BULK_SET);
+    SAI_PROFILER_HOOK(fdb, flush_fdb_entries, FDB_FLUSH, OTHER);
+
+    SAI_PROFILER_API(counter);
+    SAI_PROFILER_HOOK(counter, create_counter, COUNTER, CREATE);
+    SAI_PROFILER_HOOK(counter, remove_counter, COUNTER, REMOVE);
+
+    SAI_PROFILER_API(nat);
+    SAI_PROFILER_HOOK(nat, create_nat_entry, NAT_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(nat, remove_nat_entry, NAT_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(nat, set_nat_entry_attribute, NAT_ENTRY, SET);
+    SAI_PROFILER_HOOK(nat, get_nat_entry_attribute, NAT_ENTRY, GET);
+
+    SAI_PROFILER_API(bfd);
+    SAI_PROFILER_HOOK(bfd, create_bfd_session, BFD_SESSION, CREATE);
+    SAI_PROFILER_HOOK(bfd, remove_bfd_session, BFD_SESSION, REMOVE);
+    SAI_PROFILER_HOOK(bfd, set_bfd_session_attribute, BFD_SESSION, SET);
+    SAI_PROFILER_HOOK(bfd, get_bfd_session_attribute, BFD_SESSION, GET);
+
+    SAI_PROFILER_API(srv6);
+    SAI_PROFILER_HOOK(srv6, create_srv6_sidlist, SRV6_SIDLIST, CREATE);
+    SAI_PROFILER_HOOK(srv6, remove_srv6_sidlist, SRV6_SIDLIST, REMOVE);
+    SAI_PROFILER_HOOK(srv6, set_srv6_sidlist_attribute, SRV6_SIDLIST, SET);
+    SAI_PROFILER_HOOK(srv6, create_my_sid_entry, MY_SID_ENTRY, CREATE);
+    SAI_PROFILER_HOOK(srv6, remove_my_sid_entry, MY_SID_ENTRY, REMOVE);
+    SAI_PROFILER_HOOK(srv6, set_my_sid_entry_attribute, MY_SID_ENTRY, SET);
+
+    SWSS_LOG_NOTICE("SAI profiler is enabled, export interval %d seconds", m_interval);
+}
+
+SaiProfilerOrch::SaiProfilerOrch(DBConnector *countersDb, int interval) :
+    Orch(),
+    m_countersPipeline(new RedisPipeline(countersDb)),
+    m_profilerTable(new Table(m_countersPipeline.get(), SAI_PROFILER_TABLE, true))
+{
+    SWSS_LOG_ENTER();
+
+    auto timer = new SelectableTimer(timespec { .tv_sec = interval, .tv_nsec = 0 });
+    auto executor = new ExecutableTimer(timer, this, "SAI_PROFILER_EXPORT");
+    Orch::addExecutor(executor);
+    timer->start();
+}
+
+void SaiProfilerOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
+
+    SaiProfiler::exportCounters(*m_profilerTable);
+    m_countersPipeline->flush();
+}
+
+void SaiProfilerOrch::dump()
+{
+    SWSS_LOG_ENTER();
+
+    SaiProfiler::logCounters();
+    SaiProfiler::exportCounters(*m_profilerTable);
+    m_countersPipeline->flush();
+}
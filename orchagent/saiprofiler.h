@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "orch.h"
+#include "table.h"
+#include "redispipeline.h"
+#include "selectabletimer.h"
+
+extern "C" {
+#include "sai.h"
+}
+
+#define SAI_PROFILER_TABLE "SAI_PROFILER"
+#define SAI_PROFILER_MAX_HOOKS 512
+/* Bucket i counts the calls which took less than 2^i us, the last bucket counts the rest */
+#define SAI_PROFILER_BUCKETS 24
+#define SAI_PROFILER_INTERVAL_DEFAULT 10
+
+/*
+ * Times the SAI calls of orchagent.
+ *
+ * When the profiler is enabled, the SAI API tables queried by initSaiApi()
+ * are copied and their create, remove, set, get and bulk functions are
+ * replaced by hooks which time the original function. The latency of every
+ * call is accumulated, without lock, in a histogram per object type and
+ * operation. When the profiler is disabled, the tables are not touched.
+ *
+ * Only the functions listed in hookApis() are timed. The hash, UDF, DTel,
+ * samplepacket, debug counter, isolation group, system port, MACsec, L2MC,
+ * my MAC, TWAMP, generic programmable and DASH APIs are not profiled. The
+ * sai_bulk_object_*() functions are not part of an API table, only their use
+ * for the ACL entries and counters, through the pointers of bulker.h, is timed.
+ */
+class SaiProfiler
+{
+public:
+    enum class Op
+    {
+        CREATE,
+        REMOVE,
+        SET,
+        GET,
+        BULK_CREATE,
+        BULK_REMOVE,
+        BULK_SET,
+        BULK_GET,
+        OTHER,
+    };
+
+    struct Counters
+    {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> totalUs;
+        std::atomic<uint64_t> maxUs;
+        std::atomic<uint64_t> buckets[SAI_PROFILER_BUCKETS];
+    };
+
+    /* Must be called before initSaiApi() */
+    static void enable(int interval);
+    static bool isEnabled();
+    static int getInterval();
+
+    /* Replace the functions of the SAI API tables by the hooks */
+    static void hookApis();
+
+    /* Async-signal-safe, the dump is done by the next call of isDumpRequested() */
+    static void requestDump();
+    static bool isDumpRequested();
+
+    static void record(size_t id, std::chrono::steady_clock::time_point start);
+    static uint64_t getCallCount(sai_object_type_t objectType, Op op);
+    static std::string getOpName(Op op);
+
+    /* Write the counters which changed since the last export, to table */
+    static void exportCounters(swss::Table &table);
+    static void logCounters();
+
+    template <size_t Id, typename... Args>
+    static void hook(sai_status_t (*&fn)(Args...), sai_object_type_t objectType, Op op);
+
+private:
+    static void registerHook(size_t id, sai_object_type_t objectType, Op op);
+
+    static bool m_enabled;
+    static int m_interval;
+    static std::atomic<bool> m_dumpRequested;
+};
+
+template <size_t Id, typename Fn>
+struct SaiProfilerHook;
+
+template <size_t Id, typename... Args>
+struct SaiProfilerHook<Id, sai_status_t (*)(Args...)>
+{
+    static sai_status_t (*original)(Args...);
+
+    static sai_status_t call(Args... args)
+    {
+        auto start = std::chrono::steady_clock::now();
+        sai_status_t status = original(args...);
+        SaiProfiler::record(Id, start);
+        return status;
+    }
+};
+
+template <size_t Id, typename... Args>
+sai_status_t (*SaiProfilerHook<Id, sai_status_t (*)(Args...)>::original)(Args...) = nullptr;
+
+template <size_t Id, typename... Args>
+void SaiProfiler::hook(sai_status_t (*&fn)(Args...), sai_object_type_t objectType, Op op)
+{
+    static_assert(Id < SAI_PROFILER_MAX_HOOKS, "Too many SAI profiler hooks");
+
+    using Hook = SaiProfilerHook<Id, sai_status_t (*)(Args...)>;
+
+    if (fn == nullptr || fn == &Hook::call)
+    {
+        return;
+    }
+
+    Hook::original = fn;
+    fn = &Hook::call;
+    registerHook(Id, objectType, op);
+}
+
+class SaiProfilerOrch : public Orch
+{
+public:
+    SaiProfilerOrch(swss::DBConnector *countersDb, int interval);
+
+    void doTask(swss::SelectableTimer &timer);
+    void dump();
+
+private:
+    std::unique_ptr<swss::RedisPipeline> m_countersPipeline;
+    std::unique_ptr<swss::Table> m_profilerTable;
+};
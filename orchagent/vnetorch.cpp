@@ -22,6 +22,7 @@
 #include "crmorch.h"
 #include "routeorch.h"
 #include "flowcounterrouteorch.h"
+#include "zmqorch.h"
 
 extern sai_virtual_router_api_t* sai_virtual_router_api;
 extern sai_route_api_t* sai_route_api;
@@ -716,11 +717,16 @@ static bool update_route(sai_object_id_t vr_id, sai_ip_prefix_t& ip_pfx, sai_obj
     return true;
 }
 
-VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *vnetOrch)
+VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *vnetOrch, ZmqServer *zmqServer)
                                   : Orch2(db, tableNames, request_), vnet_orch_(vnetOrch), bfd_session_producer_(db, APP_BFD_SESSION_TABLE_NAME)
 {
     SWSS_LOG_ENTER();
 
+    if (zmqServer != nullptr && find(tableNames.begin(), tableNames.end(), APP_VNET_RT_TUNNEL_TABLE_NAME) != tableNames.end())
+    {
+        addExecutor(ZmqConsumer::createAlongsideRedis(db, APP_VNET_RT_TUNNEL_TABLE_NAME, default_orch_pri, *zmqServer, this));
+    }
+
     handler_map_.insert(handler_pair(APP_VNET_RT_TABLE_NAME, &VNetRouteOrch::handleRoutes));
     handler_map_.insert(handler_pair(APP_VNET_RT_TUNNEL_TABLE_NAME, &VNetRouteOrch::handleTunnel));
 
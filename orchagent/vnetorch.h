@@ -413,7 +413,7 @@ typedef std::map<IpAddress, VNetNextHopInfo> VNetEndpointInfoTable;
 class VNetRouteOrch : public Orch2, public Subject, public Observer
 {
 public:
-    VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *);
+    VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *, ZmqServer *zmqServer = nullptr);
 
     typedef pair<string, bool (VNetRouteOrch::*) (const Request& )> handler_pair;
     typedef map<string, bool (VNetRouteOrch::*) (const Request& )> handler_map;
@@ -15,7 +15,7 @@ void ZmqConsumer::execute()
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
         table->pops(entries);
-        update_size = addToSync(entries);
+        update_size = addToSync(std::move(entries));
     } while (update_size != 0);
 
     drain();
@@ -24,9 +24,30 @@ void ZmqConsumer::execute()
 void ZmqConsumer::drain()
 {
     if (!m_toSync.empty())
-        (static_cast<ZmqOrch*>(m_orch))->doTask(*this);
+        accountDrain([this]() { m_orch->doTask((ConsumerBase &)*this); });
 }
 
+size_t ZmqConsumer::refillToSync()
+{
+    if (!m_refill)
+    {
+        return 0;
+    }
+
+    return ConsumerBase::refillToSync();
+}
+
+ZmqConsumer *ZmqConsumer::create(DBConnector *db, const string &tableName, int pri, ZmqServer &zmqServer, Orch *orch)
+{
+    return new ZmqConsumer(new ZmqConsumerStateTable(db, tableName, zmqServer, gBatchSize, pri), orch, tableName);
+}
+
+ZmqConsumer *ZmqConsumer::createAlongsideRedis(DBConnector *db, const string &tableName, int pri, ZmqServer &zmqServer, Orch *orch)
+{
+    SWSS_LOG_NOTICE("Consume %s over ZMQ, next to redis", tableName.c_str());
+    return new ZmqConsumer(new ZmqConsumerStateTable(db, tableName, zmqServer, gBatchSize, pri), orch,
+                           tableName + ZMQ_CONSUMER_NAME_SUFFIX, false);
+}
 
 ZmqOrch::ZmqOrch(DBConnector *db, const vector<string> &tableNames, ZmqServer *zmqServer)
 : Orch()
@@ -44,7 +65,7 @@ void ZmqOrch::addConsumer(DBConnector *db, string tableName, int pri, ZmqServer
         if (zmqServer != nullptr)
         {
             SWSS_LOG_DEBUG("ZmqConsumer initialize for: %s", tableName.c_str());
-            addExecutor(new ZmqConsumer(new ZmqConsumerStateTable(db, tableName, *zmqServer, gBatchSize, pri), this, tableName));
+            addExecutor(ZmqConsumer::create(db, tableName, pri, *zmqServer, this));
         }
         else
         {
@@ -5,10 +5,14 @@
 #include <orch.h>
 #include "zmqserver.h"
 
+/* Name suffix of the ZmqConsumer of a table which is also consumed from redis */
+#define ZMQ_CONSUMER_NAME_SUFFIX "_ZMQ"
+
 class ZmqConsumer : public ConsumerBase {
 public:
-    ZmqConsumer(swss::ZmqConsumerStateTable *select, Orch *orch, const std::string &name)
-        : ConsumerBase(select, orch, name)
+    ZmqConsumer(swss::ZmqConsumerStateTable *select, Orch *orch, const std::string &name, bool refill = true)
+        : ConsumerBase(select, orch, name),
+          m_refill(refill)
     {
     }
 
@@ -20,6 +24,26 @@ public:
 
     void execute() override;
     void drain() override;
+
+    using ConsumerBase::refillToSync;
+    size_t refillToSync() override;
+
+    /*
+     * Consume an APPL_DB table over ZMQ. The ZmqConsumerStateTable still
+     * writes the received entries to APPL_DB asynchronously, so the table is
+     * there for warm restart and for the readers of APPL_DB.
+     */
+    static ZmqConsumer *create(swss::DBConnector *db, const std::string &tableName, int pri, swss::ZmqServer &zmqServer, Orch *orch);
+
+    /*
+     * Consume an APPL_DB table over ZMQ, next to its redis consumer. The
+     * producers of the table may still write it through redis, so the redis
+     * consumer is kept, and it alone refills the table at warm start.
+     */
+    static ZmqConsumer *createAlongsideRedis(swss::DBConnector *db, const std::string &tableName, int pri, swss::ZmqServer &zmqServer, Orch *orch);
+
+private:
+    bool m_refill;
 };
 
 class ZmqOrch : public Orch
@@ -27,7 +51,7 @@ class ZmqOrch : public Orch
 public:
     ZmqOrch(swss::DBConnector *db, const std::vector<std::string> &tableNames, swss::ZmqServer *zmqServer);
 
-    virtual void doTask(ConsumerBase &consumer) { };
+    void doTask(ConsumerBase &consumer) override { };
     void doTask(Consumer &consumer) override;
 
 private:
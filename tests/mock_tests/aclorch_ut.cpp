@@ -27,6 +27,10 @@ extern sai_route_api_t *sai_route_api;
 extern sai_mpls_api_t *sai_mpls_api;
 extern sai_next_hop_group_api_t* sai_next_hop_group_api;
 extern string gMySwitchType;
+extern sai_bulk_object_create_fn sai_bulk_create_acl_entries;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_entries;
+extern sai_bulk_object_create_fn sai_bulk_create_acl_counters;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_counters;
 
 using namespace saimeta;
 
@@ -34,6 +38,122 @@ namespace aclorch_test
 {
     using namespace std;
 
+    // Record the order of the ACL entry and counter calls: 'C'/'E' create a counter/entry, 'c'/'e' remove one,
+    // the objects of a bulk call are enclosed in parentheses
+    sai_acl_api_t ut_sai_acl_api;
+    sai_acl_api_t *pold_sai_acl_api;
+    sai_bulk_object_create_fn pold_sai_bulk_create_acl_entries;
+    sai_bulk_object_remove_fn pold_sai_bulk_remove_acl_entries;
+    sai_bulk_object_create_fn pold_sai_bulk_create_acl_counters;
+    sai_bulk_object_remove_fn pold_sai_bulk_remove_acl_counters;
+    string _sai_acl_calls;
+    // Number of the entry creation to fail, counted from 1, 0 to fail none
+    size_t _sai_acl_entry_create_fail_at;
+    size_t _sai_acl_entry_create_count;
+
+    sai_status_t _ut_stub_sai_create_acl_entry(sai_object_id_t *oid, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        _sai_acl_calls += 'E';
+        if (++_sai_acl_entry_create_count == _sai_acl_entry_create_fail_at)
+        {
+            return SAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        return pold_sai_acl_api->create_acl_entry(oid, switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_remove_acl_entry(sai_object_id_t oid)
+    {
+        _sai_acl_calls += 'e';
+        return pold_sai_acl_api->remove_acl_entry(oid);
+    }
+
+    sai_status_t _ut_stub_sai_create_acl_counter(sai_object_id_t *oid, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        _sai_acl_calls += 'C';
+        return pold_sai_acl_api->create_acl_counter(oid, switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_remove_acl_counter(sai_object_id_t oid)
+    {
+        _sai_acl_calls += 'c';
+        return pold_sai_acl_api->remove_acl_counter(oid);
+    }
+
+    sai_status_t _ut_stub_sai_bulk_create_acl_entries(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                                      const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                                      sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        _sai_acl_calls += "(" + string(object_count, 'E') + ")";
+        auto status = pold_sai_bulk_create_acl_entries(switch_id, object_type, object_count, attr_count, attr_list,
+                                                       mode, object_id, object_statuses);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (++_sai_acl_entry_create_count == _sai_acl_entry_create_fail_at && object_statuses[i] == SAI_STATUS_SUCCESS)
+            {
+                // Undo the creation of the entry to fail
+                pold_sai_acl_api->remove_acl_entry(object_id[i]);
+                object_id[i] = SAI_NULL_OBJECT_ID;
+                object_statuses[i] = SAI_STATUS_INSUFFICIENT_RESOURCES;
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_bulk_remove_acl_entries(sai_object_type_t object_type, uint32_t object_count, const sai_object_id_t *object_id,
+                                                      sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        _sai_acl_calls += "(" + string(object_count, 'e') + ")";
+        return pold_sai_bulk_remove_acl_entries(object_type, object_count, object_id, mode, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_bulk_create_acl_counters(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                                       const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                                       sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        _sai_acl_calls += "(" + string(object_count, 'C') + ")";
+        return pold_sai_bulk_create_acl_counters(switch_id, object_type, object_count, attr_count, attr_list,
+                                                 mode, object_id, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_bulk_remove_acl_counters(sai_object_type_t object_type, uint32_t object_count, const sai_object_id_t *object_id,
+                                                       sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        _sai_acl_calls += "(" + string(object_count, 'c') + ")";
+        return pold_sai_bulk_remove_acl_counters(object_type, object_count, object_id, mode, object_statuses);
+    }
+
+    void _hook_sai_acl_api()
+    {
+        ut_sai_acl_api = *sai_acl_api;
+        pold_sai_acl_api = sai_acl_api;
+        ut_sai_acl_api.create_acl_entry = _ut_stub_sai_create_acl_entry;
+        ut_sai_acl_api.remove_acl_entry = _ut_stub_sai_remove_acl_entry;
+        ut_sai_acl_api.create_acl_counter = _ut_stub_sai_create_acl_counter;
+        ut_sai_acl_api.remove_acl_counter = _ut_stub_sai_remove_acl_counter;
+        sai_acl_api = &ut_sai_acl_api;
+        pold_sai_bulk_create_acl_entries = sai_bulk_create_acl_entries;
+        pold_sai_bulk_remove_acl_entries = sai_bulk_remove_acl_entries;
+        pold_sai_bulk_create_acl_counters = sai_bulk_create_acl_counters;
+        pold_sai_bulk_remove_acl_counters = sai_bulk_remove_acl_counters;
+        sai_bulk_create_acl_entries = _ut_stub_sai_bulk_create_acl_entries;
+        sai_bulk_remove_acl_entries = _ut_stub_sai_bulk_remove_acl_entries;
+        sai_bulk_create_acl_counters = _ut_stub_sai_bulk_create_acl_counters;
+        sai_bulk_remove_acl_counters = _ut_stub_sai_bulk_remove_acl_counters;
+        _sai_acl_calls.clear();
+        _sai_acl_entry_create_fail_at = 0;
+        _sai_acl_entry_create_count = 0;
+    }
+
+    void _unhook_sai_acl_api()
+    {
+        sai_acl_api = pold_sai_acl_api;
+        sai_bulk_create_acl_entries = pold_sai_bulk_create_acl_entries;
+        sai_bulk_remove_acl_entries = pold_sai_bulk_remove_acl_entries;
+        sai_bulk_create_acl_counters = pold_sai_bulk_create_acl_counters;
+        sai_bulk_remove_acl_counters = pold_sai_bulk_remove_acl_counters;
+    }
+
     struct AclTestBase : public ::testing::Test
     {
         vector<int32_t *> m_s32list_pool;
@@ -1376,6 +1496,165 @@ namespace aclorch_test
         ASSERT_EQ(tableIt, orch->getAclTables().end());
     }
 
+    // Rules of the same table set or deleted in one pass are created and removed in bulk
+    TEST_F(AclOrchTest, AclRule_Bulk_Creation_and_Removal)
+    {
+        string tableId = "acl_table_1";
+        vector<string> ruleIds = { "acl_rule_1", "acl_rule_2", "acl_rule_3" };
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+
+        auto tableIt = orch->getAclTables().find(tableOid);
+        ASSERT_NE(tableIt, orch->getAclTables().end());
+        auto &tableObj = tableIt->second;
+
+        // add acl rules ...
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRule;
+        for (size_t i = 0; i < ruleIds.size(); i++)
+        {
+            kvfAclRule.push_back({
+                tableId + "|" + ruleIds[i],
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                    { MATCH_SRC_IP, "1.2.3." + to_string(i + 1) }
+                }
+            });
+        }
+
+        _hook_sai_acl_api();
+        orch->doAclRuleTask(kvfAclRule);
+        _unhook_sai_acl_api();
+
+        // The counters of all the rules are created in one bulk call, then their entries in another
+        ASSERT_EQ(_sai_acl_calls, "(CCC)(EEE)");
+
+        // validate acl rules add ...
+
+        ASSERT_EQ(tableObj.rules.size(), ruleIds.size());
+        for (size_t i = 0; i < ruleIds.size(); i++)
+        {
+            auto ruleIt = tableObj.rules.find(ruleIds[i]);
+            ASSERT_NE(ruleIt, tableObj.rules.end());
+            ASSERT_NE(ruleIt->second->getOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_NE(ruleIt->second->getCounterOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_TRUE(validateAclRuleByConfOp(*ruleIt->second, kfvFieldsValues(kvfAclRule[i])));
+        }
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+
+        // overwrite and delete acl rules in one pass ...
+
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({
+            {
+                tableId + "|" + ruleIds[0],
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, "1.2.3.4" }
+                }
+            },
+            { tableId + "|" + ruleIds[1], DEL_COMMAND, {} },
+            { tableId + "|" + ruleIds[2], DEL_COMMAND, {} }
+        });
+
+        _hook_sai_acl_api();
+        orch->doAclRuleTask(kvfAclRule);
+        _unhook_sai_acl_api();
+
+        // The entries of rules 2 and 3 are removed in bulk before their counters, then rule 1 is removed and created again
+        ASSERT_EQ(_sai_acl_calls, "(ee)(cc)" "ec" "CE");
+
+        // validate acl rules update and delete ...
+
+        ASSERT_EQ(tableObj.rules.size(), 1);
+        auto ruleIt = tableObj.rules.find(ruleIds[0]);
+        ASSERT_NE(ruleIt, tableObj.rules.end());
+        ASSERT_TRUE(validateAclRuleByConfOp(*ruleIt->second, kfvFieldsValues(kvfAclRule[0])));
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{ tableId + "|" + ruleIds[0], DEL_COMMAND, {} }});
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_TRUE(tableObj.rules.empty());
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+    }
+
+    // A rule whose entry can't be created in bulk is rolled back and created alone, the rules after it are kept
+    TEST_F(AclOrchTest, AclRule_Bulk_Creation_Partial_Failure)
+    {
+        string tableId = "acl_table_1";
+        vector<string> ruleIds = { "acl_rule_1", "acl_rule_2", "acl_rule_3" };
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+        auto &tableObj = orch->getAclTables().find(tableOid)->second;
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRule;
+        for (size_t i = 0; i < ruleIds.size(); i++)
+        {
+            kvfAclRule.push_back({
+                tableId + "|" + ruleIds[i],
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                    { MATCH_SRC_IP, "1.2.3." + to_string(i + 1) }
+                }
+            });
+        }
+
+        _hook_sai_acl_api();
+        _sai_acl_entry_create_fail_at = 2;
+        orch->doAclRuleTask(kvfAclRule);
+        _unhook_sai_acl_api();
+
+        // The bulk goes on after the failed entry, only the counter of rule 2 is removed and the rule created alone
+        ASSERT_EQ(_sai_acl_calls, "(CCC)(EEE)" "cCE");
+
+        ASSERT_EQ(tableObj.rules.size(), ruleIds.size());
+        for (size_t i = 0; i < ruleIds.size(); i++)
+        {
+            auto ruleIt = tableObj.rules.find(ruleIds[i]);
+            ASSERT_NE(ruleIt, tableObj.rules.end());
+            ASSERT_NE(ruleIt->second->getOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_NE(ruleIt->second->getCounterOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_TRUE(validateAclRuleByConfOp(*ruleIt->second, kfvFieldsValues(kvfAclRule[i])));
+        }
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+    }
+
     TEST_F(AclOrchTest, AclTableType_Configuration)
     {
         const string aclTableTypeName = "TEST_TYPE";
@@ -49,6 +49,34 @@ namespace buffermgrdyn_test
     map<string, vector<FieldValueTuple>> zeroProfileMap;
     vector<KeyOpFieldsValuesTuple> zeroProfile;
 
+    // Calculator returning the configured pool sizes without running the lua plugin, counting the calculations
+    class MockBufferCalculator : public BufferCalculator
+    {
+    public:
+        MockBufferCalculator() : BufferCalculator(m_config_db.get(), m_state_db.get(), m_app_db.get()) {}
+
+        vector<string> calculatePoolSizes() override
+        {
+            vector<string> sizes = {
+                "ingress_lossless_pool:1024000",
+                "egress_lossless_pool:1024000",
+                "egress_lossy_pool:1024000"
+            };
+
+            poolSizeCalculations++;
+            // The plugin provides the debug information only if the sizes are calculated from all buffer items
+            if (fullyCalculated)
+            {
+                sizes.push_back("debug:mock");
+            }
+
+            return sizes;
+        }
+
+        int poolSizeCalculations = 0;
+        bool fullyCalculated = true;
+    };
+
     struct BufferMgrDynTest : public ::testing::Test
     {
         map<string, vector<FieldValueTuple>> testBufferProfile;
@@ -1423,4 +1451,198 @@ namespace buffermgrdyn_test
         HandleTable(cableLengthTable);
         ASSERT_EQ(m_dynamicBuffer->m_portInfoLookup["Ethernet12"].state, PORT_READY);
     }
+
+    /*
+     * Test native headroom calculation and the memo of headroom
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestNativeHeadroomCalculation)
+    {
+        Table stateAsicTable(m_state_db.get(), "ASIC_TABLE");
+        Table losslessTrafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+        MellanoxBufferCalculator calculator(m_config_db.get(), m_state_db.get(), m_app_db.get());
+        BufferHeadroomCache cache;
+        buffer_headroom_input_t input;
+        buffer_headroom_t headroom, cachedHeadroom;
+
+        stateAsicTable.set("MELLANOX-SPECTRUM-2",
+                           {
+                               {"cell_size", "144"},
+                               {"pipeline_latency", "19"},
+                               {"mac_phy_delay", "0.8"},
+                               {"peer_response_time", "3.8"}
+                           });
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1024"},
+                                            {"small_packet_percentage", "100"}
+                                        });
+
+        input.speed = "100000";
+        input.cable_length = "5m";
+        input.port_mtu = "9100";
+        input.lane_count = 4;
+
+        ASSERT_TRUE(calculator.isHeadroomCalculatedNatively());
+        ASSERT_TRUE(calculator.calculateHeadroom(input, headroom));
+        ASSERT_EQ(headroom.xon, "19456");
+        ASSERT_EQ(stol(headroom.size), stol(headroom.xon) + stol(headroom.xoff));
+
+        ASSERT_FALSE(cache.lookup(input, cachedHeadroom));
+        cache.insert(input, headroom);
+        ASSERT_TRUE(cache.lookup(input, cachedHeadroom));
+        ASSERT_EQ(cachedHeadroom.xoff, headroom.xoff);
+        ASSERT_EQ(cache.hits(), 1u);
+        ASSERT_EQ(cache.misses(), 1u);
+
+        // Different cable length results in a different entry
+        input.cable_length = "40m";
+        ASSERT_FALSE(cache.lookup(input, cachedHeadroom));
+        ASSERT_TRUE(calculator.calculateHeadroom(input, cachedHeadroom));
+        ASSERT_GT(stol(cachedHeadroom.xoff), stol(headroom.xoff));
+
+        // Only xon is reserved in the headroom once the shared headroom pool is enabled
+        input.over_subscribe_ratio = "2";
+        ASSERT_TRUE(calculator.calculateHeadroom(input, headroom));
+        ASSERT_EQ(headroom.size, headroom.xon);
+
+        cache.clear();
+        input.cable_length = "5m";
+        ASSERT_FALSE(cache.lookup(input, cachedHeadroom));
+
+        stateAsicTable.del("MELLANOX-SPECTRUM-2");
+        losslessTrafficPatternTable.del("AZURE");
+    }
+
+    /*
+     * Test the headroom parameters are fetched again once the tables feeding the headroom calculation are updated
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestHeadroomParametersReloaded)
+    {
+        Table stateAsicTable(m_state_db.get(), "ASIC_TABLE");
+        Table losslessTrafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+        buffer_profile_t profile;
+
+        stateAsicTable.set("MELLANOX-SPECTRUM-2",
+                           {
+                               {"cell_size", "144"},
+                               {"pipeline_latency", "19"},
+                               {"mac_phy_delay", "0.8"},
+                               {"peer_response_time", "3.8"}
+                           });
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1024"},
+                                            {"small_packet_percentage", "100"}
+                                        });
+
+        InitMmuSize();
+        StartBufferManager();
+        m_dynamicBuffer->m_bufferCalculator.reset(new MellanoxBufferCalculator(m_config_db.get(), m_state_db.get(), m_app_db.get()));
+        InitBufferPool();
+
+        profile.speed = "100000";
+        profile.cable_length = "5m";
+        profile.port_mtu = "9100";
+        profile.lane_count = 4;
+
+        m_dynamicBuffer->calculateHeadroomSize(profile);
+        ASSERT_EQ(profile.xon, "19456");
+
+        // Neither the parameters nor the memoized headroom are refreshed by the update itself
+        stateAsicTable.hset("MELLANOX-SPECTRUM-2", "pipeline_latency", "30");
+        m_dynamicBuffer->calculateHeadroomSize(profile);
+        ASSERT_EQ(profile.xon, "19456");
+
+        InitDefaultLosslessParameter();
+        m_dynamicBuffer->calculateHeadroomSize(profile);
+        ASSERT_EQ(profile.xon, "30720");
+
+        stateAsicTable.hset("MELLANOX-SPECTRUM-2", "pipeline_latency", "19");
+        InitCableLength("Ethernet0", "5m");
+        m_dynamicBuffer->calculateHeadroomSize(profile);
+        ASSERT_EQ(profile.xon, "19456");
+
+        stateAsicTable.hset("MELLANOX-SPECTRUM-2", "pipeline_latency", "30");
+        InitPort();
+        m_dynamicBuffer->calculateHeadroomSize(profile);
+        ASSERT_EQ(profile.xon, "30720");
+
+        stateAsicTable.del("MELLANOX-SPECTRUM-2");
+        losslessTrafficPatternTable.del("AZURE");
+    }
+
+    /*
+     * Test the pool size recalculations requested during a doTask pass are coalesced into one
+     * and the periodic recalculation is skipped while the pool sizes are settled
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestPoolRecalculationCoalesced)
+    {
+        vector<string> ports = {"Ethernet0", "Ethernet4", "Ethernet8", "Ethernet12"};
+        vector<FieldValueTuple> cableLengths;
+
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+        StartBufferManager();
+
+        auto calculator = new MockBufferCalculator();
+        m_dynamicBuffer->m_bufferCalculator.reset(calculator);
+
+        for (auto &port : ports)
+        {
+            InitPort(port);
+        }
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+        InitBufferPool();
+        InitDefaultBufferProfile();
+        for (auto &port : ports)
+        {
+            InitBufferPg(port + "|3-4");
+        }
+        // Apply the pending buffer objects
+        m_dynamicBuffer->doTask(m_selectableTable);
+
+        // The cable length of all the ports is updated in one item, each port requests a recalculation
+        for (auto &port : ports)
+        {
+            cableLengths.emplace_back(port, "5m");
+        }
+        cableLengthTable.set("AZURE", cableLengths);
+        calculator->poolSizeCalculations = 0;
+        HandleTable(cableLengthTable);
+        for (auto &port : ports)
+        {
+            CheckPg(port, port + ":3-4", "pg_lossless_100000_5m_profile");
+        }
+        ASSERT_EQ(calculator->poolSizeCalculations, 1);
+        ASSERT_TRUE(m_dynamicBuffer->m_poolSizeSettled);
+
+        // Nothing changed, the timer skips BUFFERMGR_POOL_RESYNC_PERIODS periods and recalculates the sizes in the next one
+        calculator->poolSizeCalculations = 0;
+        m_dynamicBuffer->m_poolSizeResyncCountdown = BUFFERMGR_POOL_RESYNC_PERIODS;
+        for (int i = 0; i < BUFFERMGR_POOL_RESYNC_PERIODS; i++)
+        {
+            m_dynamicBuffer->doTask(m_selectableTable);
+        }
+        ASSERT_EQ(calculator->poolSizeCalculations, 0);
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(calculator->poolSizeCalculations, 1);
+
+        // The sizes taken from APPL_DB are not settled, the timer keeps recalculating them
+        calculator->fullyCalculated = false;
+        InitCableLength("Ethernet0", "40m");
+        ASSERT_FALSE(m_dynamicBuffer->m_poolSizeSettled);
+        calculator->poolSizeCalculations = 0;
+        m_dynamicBuffer->doTask(m_selectableTable);
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(calculator->poolSizeCalculations, 2);
+
+        // Settled again once they are fully calculated
+        calculator->fullyCalculated = true;
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_TRUE(m_dynamicBuffer->m_poolSizeSettled);
+        calculator->poolSizeCalculations = 0;
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(calculator->poolSizeCalculations, 0);
+    }
 }
@@ -8,8 +8,10 @@
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 #include "mock_response_publisher.h"
+#include "mock_sai_bulk.h"
 
 extern string gMySwitchType;
+extern std::map<string, std::map<size_t, string>> pg_port_flags;
 
 extern std::unique_ptr<MockResponsePublisher> gMockResponsePublisher;
 
@@ -146,6 +148,21 @@ namespace bufferorch_test
         sai_queue_api = pold_sai_queue_api;
     }
 
+    /* Fail the bulk set of the given PGs with the status, and set the other PGs one by one */
+    void _hook_bulk_pg_set(const set<sai_object_id_t> &failedPgs, sai_status_t failedStatus)
+    {
+        mock_sai_bulk::set_attribute_hook = [failedPgs, failedStatus](sai_object_id_t, sai_object_type_t, uint32_t object_count,
+                                                                      const sai_object_key_t *object_key, const sai_attribute_t *attr_list,
+                                                                      sai_bulk_op_error_mode_t, sai_status_t *object_statuses) {
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                sai_object_id_t pg = object_key[i].key.object_id;
+                object_statuses[i] = failedPgs.count(pg) ? failedStatus : sai_buffer_api->set_ingress_priority_group_attribute(pg, &attr_list[i]);
+            }
+            return failedPgs.empty() ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+        };
+    }
+
     struct BufferOrchTest : public ::testing::Test
     {
         BufferOrchTest()
@@ -792,4 +809,210 @@ namespace bufferorch_test
         _ut_stub_buffer_profile_sanity_check = false;
         _unhook_sai_apis();
     }
+
+    TEST_F(BufferOrchTest, BufferOrchTestBulkPriorityGroupProfile)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Apply the PG profiles of all the ports in one pass
+        for (const auto &it : ports)
+        {
+            entries.push_back({it.first + ":3-4", "SET",
+                               {
+                                   {"profile", "ingress_lossless_profile"}
+                               }});
+        }
+        auto bufferPgConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+        bufferPgConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        auto profile = (*BufferOrch::m_buffer_type_maps[APP_BUFFER_PROFILE_TABLE_NAME])["ingress_lossless_profile"].m_saiObjectId;
+        for (const auto &it : ports)
+        {
+            CheckDependency(APP_BUFFER_PG_TABLE_NAME, it.first + ":3-4", "profile", APP_BUFFER_PROFILE_TABLE_NAME, "ingress_lossless_profile");
+
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            for (size_t ind = 3; ind <= 4; ind++)
+            {
+                sai_attribute_t attr;
+                attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
+                ASSERT_EQ(sai_buffer_api->get_ingress_priority_group_attribute(port.m_priority_group_ids[ind], 1, &attr), SAI_STATUS_SUCCESS);
+                ASSERT_EQ(attr.value.oid, profile);
+            }
+        }
+
+        // Remove them in one pass
+        for (const auto &it : ports)
+        {
+            entries.push_back({it.first + ":3-4", "DEL", {}});
+        }
+        bufferPgConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            sai_attribute_t attr;
+            attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
+            ASSERT_EQ(sai_buffer_api->get_ingress_priority_group_attribute(port.m_priority_group_ids[3], 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attr.value.oid, SAI_NULL_OBJECT_ID);
+        }
+    }
+
+    TEST_F(BufferOrchTest, BufferOrchTestBulkPriorityGroupFailedObjects)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto ports = ut_helper::getInitialSaiPorts();
+        const string failedPort = ports.begin()->first;
+        pg_port_flags.clear();
+
+        Port port;
+        ASSERT_TRUE(gPortsOrch->getPort(failedPort, port));
+        _hook_bulk_pg_set({ port.m_priority_group_ids[3], port.m_priority_group_ids[4] }, SAI_STATUS_INSUFFICIENT_RESOURCES);
+
+        for (const auto &it : ports)
+        {
+            gBufferOrch->m_ready_list[it.first + ":3-4"] = false;
+            entries.push_back({it.first + ":3-4", "SET",
+                               {
+                                   {"profile", "ingress_lossless_profile"}
+                               }});
+        }
+        auto bufferPgConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+        bufferPgConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        mock_sai_bulk::set_attribute_hook = nullptr;
+
+        // The failed entry isn't retried, and neither becomes ready nor references its port
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        ASSERT_FALSE(gBufferOrch->m_ready_list[failedPort + ":3-4"]);
+        ASSERT_EQ(pg_port_flags[failedPort][3], "");
+        ASSERT_EQ(pg_port_flags[failedPort][4], "");
+
+        for (const auto &it : ports)
+        {
+            if (it.first == failedPort)
+            {
+                continue;
+            }
+            ASSERT_TRUE(gBufferOrch->m_ready_list[it.first + ":3-4"]);
+            ASSERT_EQ(pg_port_flags[it.first][3], SET_COMMAND);
+            ASSERT_EQ(pg_port_flags[it.first][4], SET_COMMAND);
+        }
+
+        pg_port_flags.clear();
+    }
+
+    TEST_F(BufferOrchTest, BufferOrchTestBulkPriorityGroupRetryNotExecuted)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto ports = ut_helper::getInitialSaiPorts();
+        const string failedPort = ports.begin()->first;
+        pg_port_flags.clear();
+
+        Port port;
+        ASSERT_TRUE(gPortsOrch->getPort(failedPort, port));
+        _hook_bulk_pg_set({ port.m_priority_group_ids[3], port.m_priority_group_ids[4] }, SAI_STATUS_NOT_EXECUTED);
+
+        for (const auto &it : ports)
+        {
+            gBufferOrch->m_ready_list[it.first + ":3-4"] = false;
+            entries.push_back({it.first + ":3-4", "SET",
+                               {
+                                   {"profile", "ingress_lossless_profile"}
+                               }});
+        }
+        auto bufferPgConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+        bufferPgConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        // Only the entry which wasn't executed is left to retry
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_EQ(ts.size(), 1);
+        ASSERT_EQ(ts[0], "BUFFER_PG_TABLE:" + failedPort + ":3-4|SET|profile:ingress_lossless_profile");
+        ts.clear();
+        ASSERT_FALSE(gBufferOrch->m_ready_list[failedPort + ":3-4"]);
+        ASSERT_EQ(pg_port_flags[failedPort][3], "");
+        for (const auto &it : ports)
+        {
+            if (it.first != failedPort)
+            {
+                ASSERT_TRUE(gBufferOrch->m_ready_list[it.first + ":3-4"]);
+                ASSERT_EQ(pg_port_flags[it.first][3], SET_COMMAND);
+            }
+        }
+
+        // The retry applies it
+        mock_sai_bulk::set_attribute_hook = nullptr;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        ASSERT_TRUE(gBufferOrch->m_ready_list[failedPort + ":3-4"]);
+        ASSERT_EQ(pg_port_flags[failedPort][3], SET_COMMAND);
+        ASSERT_EQ(pg_port_flags[failedPort][4], SET_COMMAND);
+
+        auto profile = (*BufferOrch::m_buffer_type_maps[APP_BUFFER_PROFILE_TABLE_NAME])["ingress_lossless_profile"].m_saiObjectId;
+        sai_attribute_t attr;
+        attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
+        ASSERT_EQ(sai_buffer_api->get_ingress_priority_group_attribute(port.m_priority_group_ids[3], 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, profile);
+
+        pg_port_flags.clear();
+    }
+
+    TEST_F(BufferOrchTest, BufferOrchTestBulkPriorityGroupNotImplemented)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto ports = ut_helper::getInitialSaiPorts();
+        pg_port_flags.clear();
+
+        // A SAI without the generic bulk set gets the PGs set one by one
+        _hook_sai_apis();
+        mock_sai_bulk::set_attribute_hook = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *,
+                                               const sai_attribute_t *, sai_bulk_op_error_mode_t, sai_status_t *) {
+            return SAI_STATUS_NOT_IMPLEMENTED;
+        };
+
+        for (const auto &it : ports)
+        {
+            entries.push_back({it.first + ":3-4", "SET",
+                               {
+                                   {"profile", "ingress_lossless_profile"}
+                               }});
+        }
+        auto bufferPgConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+        bufferPgConsumer->addToSync(entries);
+        entries.clear();
+        auto sai_pg_attr_set_count = _ut_stub_set_pg_count;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        mock_sai_bulk::set_attribute_hook = nullptr;
+        _unhook_sai_apis();
+
+        ASSERT_EQ(sai_pg_attr_set_count + ports.size() * 2, _ut_stub_set_pg_count);
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        for (const auto &it : ports)
+        {
+            ASSERT_EQ(pg_port_flags[it.first][3], SET_COMMAND);
+            ASSERT_EQ(pg_port_flags[it.first][4], SET_COMMAND);
+        }
+
+        pg_port_flags.clear();
+    }
 }
@@ -1,7 +1,12 @@
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
+#include "zmqorch.h"
+#include "zmqclient.h"
+#include "zmqproducerstatetable.h"
+#include "select.h"
 
+#include <chrono>
 #include <sstream>
 
 extern PortsOrch *gPortsOrch;
@@ -300,6 +305,45 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
     }
 
+    TEST_F(ConsumerTest, ConsumerAddToSync_Move_Del_Set_Setnew)
+    {
+        // Test case, DEL, SET, then SET with new fields, moved into m_toSync
+        auto entrya = KeyOpFieldsValuesTuple(
+            { key,
+                DEL_COMMAND,
+                { { } } });
+
+        auto entryb = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a },
+                    { f2, v2a } } });
+
+        auto entryc = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1b },
+                    { f3, v3a } } });
+
+        kofv_q.push_back(entrya);
+        kofv_q.push_back(entryb);
+        kofv_q.push_back(entryc);
+        ASSERT_EQ(consumer->addToSync(std::move(kofv_q)), 3);
+
+        // expect the same result as when the entries are copied
+        exp_kofv = entrya;
+        validate_syncmap(consumer->m_toSync, 2, key, exp_kofv);
+
+        exp_kofv = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f2, v2a },
+                    { f1, v1b },
+                    { f3, v3a } } });
+
+        validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+    }
+
     TEST_F(ConsumerTest, ConsumerAddToSync_Ind_Set_Del)
     {
         // Test case,  Add individuals by addToSync, SET then DEL
@@ -322,4 +366,125 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
 
     }
+
+    class DrainStatsOrch : public Orch
+    {
+    public:
+        DrainStatsOrch(swss::DBConnector *db) : Orch(db, "DRAIN_STATS_TABLE")
+        {
+        }
+
+        // Consume the first task, leave the others for retry
+        void doTask(Consumer &consumer) override
+        {
+            consumer.m_toSync.erase(consumer.m_toSync.begin());
+        }
+    };
+
+    TEST_F(ConsumerTest, ConsumerDrainStats)
+    {
+        DrainStatsOrch orch(m_app_db.get());
+        Consumer drainConsumer(new swss::ConsumerStateTable(m_app_db.get(), "DRAIN_STATS_TABLE", 1, 1), &orch, "DRAIN_STATS_TABLE");
+
+        for (const auto &k : { "key1", "key2", "key3" })
+        {
+            drainConsumer.addToSync(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1a } } }));
+        }
+
+        drainConsumer.drain();
+
+        auto stats = drainConsumer.getStats();
+        ASSERT_EQ(stats.executions, 1);
+        ASSERT_EQ(stats.tuples, 1);
+        ASSERT_EQ(stats.retries, 2);
+
+        // Nothing to do, the drain is not accounted
+        drainConsumer.m_toSync.clear();
+        drainConsumer.drain();
+        ASSERT_EQ(drainConsumer.getStats().executions, 1);
+
+        swss::DBConnector countersDb("COUNTERS_DB", 0);
+        swss::Table statsTable(&countersDb, "ORCH_CONSUMER_STATS");
+        drainConsumer.exportStats(statsTable);
+
+        string value;
+        ASSERT_TRUE(statsTable.hget("DRAIN_STATS_TABLE", "executions", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(statsTable.hget("DRAIN_STATS_TABLE", "retries", value));
+        ASSERT_EQ(value, "2");
+    }
+
+    class CountingOrch : public Orch
+    {
+    public:
+        CountingOrch(swss::DBConnector *db, const string &tableName) : Orch(db, tableName)
+        {
+        }
+
+        using Orch::addExecutor;
+
+        void doTask(ConsumerBase &consumer) override
+        {
+            consumed += consumer.m_toSync.size();
+            consumer.m_toSync.clear();
+        }
+
+        void doTask(Consumer &consumer) override
+        {
+            doTask(static_cast<ConsumerBase &>(consumer));
+        }
+
+        size_t consumed = 0;
+    };
+
+    /*
+     * Time the same number of entries through the redis consumer and the ZMQ
+     * consumer of a table. The redis database is mocked in memory here, so its
+     * figure is a lower bound of the real redis path.
+     */
+    TEST_F(ConsumerTest, ConsumerZmqThroughput)
+    {
+        const size_t entries = 10000;
+        const vector<FieldValueTuple> fvs = { { f1, v1a }, { f2, v2a } };
+        auto batchSize = gBatchSize;
+        gBatchSize = 128;
+
+        swss::ZmqServer zmqServer("tcp://127.0.0.1:8111");
+        CountingOrch orch(m_app_db.get(), "ZMQ_THROUGHPUT_TABLE");
+        auto zmqConsumer = ZmqConsumer::createAlongsideRedis(m_app_db.get(), "ZMQ_THROUGHPUT_TABLE", 1, zmqServer, &orch);
+        orch.addExecutor(zmqConsumer);
+
+        auto start = chrono::steady_clock::now();
+        swss::ProducerStateTable redisProducer(m_app_db.get(), "ZMQ_THROUGHPUT_TABLE");
+        for (size_t i = 0; i < entries; i++)
+        {
+            redisProducer.set("key" + to_string(i), fvs);
+        }
+        orch.addExistingData("ZMQ_THROUGHPUT_TABLE");
+        static_cast<Orch &>(orch).doTask();
+        auto redisUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(orch.consumed, entries);
+
+        swss::ZmqClient zmqClient("tcp://127.0.0.1:8111");
+        swss::ZmqProducerStateTable zmqProducer(m_app_db.get(), "ZMQ_THROUGHPUT_TABLE", zmqClient, false);
+        swss::Select s;
+        swss::Selectable *sel;
+        s.addSelectable(zmqConsumer);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < entries; i++)
+        {
+            zmqProducer.set("key" + to_string(i), fvs);
+        }
+        while (orch.consumed < 2 * entries && s.select(&sel, 5000) == swss::Select::OBJECT)
+        {
+            zmqConsumer->execute();
+        }
+        auto zmqUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(orch.consumed, 2 * entries);
+
+        cout << entries << " entries: redis " << redisUs << " us, ZMQ " << zmqUs << " us" << endl;
+
+        gBatchSize = batchSize;
+    }
 }
@@ -0,0 +1,94 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_counters_crm_table;
+        shared_ptr<CrmOrch> m_crmOrch;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_counters_crm_table = make_shared<swss::Table>(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            m_crmOrch = make_shared<CrmOrch>(m_config_db.get(), CFG_CRM_TABLE_NAME);
+        }
+
+        void TearDown() override
+        {
+            m_crmOrch.reset();
+        }
+
+        // Publish the counters and return the fields written to COUNTERS_DB by this publish
+        map<string, string> publish()
+        {
+            vector<FieldValueTuple> fvs;
+            map<string, string> written;
+
+            m_counters_crm_table->del("STATS");
+            Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch.get());
+
+            if (m_counters_crm_table->get("STATS", fvs))
+            {
+                for (const auto &fv : fvs)
+                {
+                    written[fvField(fv)] = fvValue(fv);
+                }
+            }
+
+            return written;
+        }
+    };
+
+    TEST_F(CrmOrchTest, OnlyChangedCountersArePublished)
+    {
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
+
+        // Everything is published the first time
+        auto written = publish();
+        ASSERT_EQ(written.size(), 4u);
+        ASSERT_EQ(written["crm_stats_ipv4_route_used"], "1");
+        ASSERT_EQ(written["crm_stats_ipv4_route_available"], "0");
+        ASSERT_EQ(written["crm_stats_ipv6_route_used"], "1");
+        ASSERT_EQ(written["crm_stats_ipv6_route_available"], "0");
+
+        // Nothing changed
+        ASSERT_TRUE(publish().empty());
+
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
+        m_crmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
+
+        // The IPv6 route counter is back to its published value
+        written = publish();
+        ASSERT_EQ(written.size(), 1u);
+        ASSERT_EQ(written["crm_stats_ipv4_route_used"], "2");
+    }
+
+    TEST_F(CrmOrchTest, AllCountersAreRepublishedPeriodically)
+    {
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+
+        auto full = publish();
+        ASSERT_FALSE(full.empty());
+
+        // The counters lost by COUNTERS_DB are written again after CRM_COUNTERS_REPUBLISH_PERIODS polling intervals
+        for (int i = 1; i < CRM_COUNTERS_REPUBLISH_PERIODS; i++)
+        {
+            ASSERT_TRUE(publish().empty());
+        }
+        ASSERT_EQ(publish(), full);
+
+        ASSERT_TRUE(publish().empty());
+    }
+}
@@ -424,7 +424,7 @@ namespace fdb_syncd_flush_test
 
         /* Delete the bridge_port_oid in the internal OA cache */
         m_portsOrch->m_portList[ETH0].m_bridge_port_id = SAI_NULL_OBJECT_ID;
-        m_portsOrch->saiOidToAlias.erase(bridge_port_oid);
+        m_portsOrch->removeSaiOidToAlias(bridge_port_oid);
 
         /* Event 2: Generate a FDB Flush per port and per vlan */
         vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
@@ -0,0 +1,184 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include "../mock_table.h"
+#define private public
+#include "fdbsync.h"
+#undef private
+
+extern std::vector<std::string> mockCallArgs;
+
+/*
+ * Fake netlink socket: every request sent is acknowledged without error.
+ * The functions are wrapped with -Wl,-wrap, see tests_fdbsyncd_CXXFLAGS.
+ */
+namespace fake_netlink_socket
+{
+    std::vector<uint32_t> pendingSeqs;
+    size_t sendCount = 0;
+    size_t messageCount = 0;
+}
+
+extern "C"
+{
+
+int __wrap_nl_connect(struct nl_sock *sk, int protocol)
+{
+    return 0;
+}
+
+int __wrap_nl_sendto(struct nl_sock *sk, void *buf, size_t size)
+{
+    using namespace fake_netlink_socket;
+
+    auto *hdr = static_cast<struct nlmsghdr *>(buf);
+    int len = static_cast<int>(size);
+    while (nlmsg_ok(hdr, len))
+    {
+        pendingSeqs.push_back(hdr->nlmsg_seq);
+        messageCount++;
+        hdr = nlmsg_next(hdr, &len);
+    }
+    sendCount++;
+
+    return static_cast<int>(size);
+}
+
+int __wrap_nl_recv(struct nl_sock *sk, struct sockaddr_nl *nla, unsigned char **buf, struct ucred **creds)
+{
+    using namespace fake_netlink_socket;
+
+    size_t ackLen = NLMSG_LENGTH(sizeof(struct nlmsgerr));
+    size_t total = NLMSG_ALIGN(ackLen) * pendingSeqs.size();
+    *buf = static_cast<unsigned char *>(calloc(1, total));
+
+    unsigned char *p = *buf;
+    for (auto seq : pendingSeqs)
+    {
+        auto *hdr = reinterpret_cast<struct nlmsghdr *>(p);
+        hdr->nlmsg_len = static_cast<uint32_t>(ackLen);
+        hdr->nlmsg_type = NLMSG_ERROR;
+        hdr->nlmsg_seq = seq;
+        p += NLMSG_ALIGN(ackLen);
+    }
+    pendingSeqs.clear();
+
+    return static_cast<int>(total);
+}
+
+unsigned int __wrap_if_nametoindex(const char *ifname)
+{
+    return 100;
+}
+
+}
+
+namespace fdbsync_ut
+{
+    using namespace std;
+    using namespace swss;
+
+    struct FdbSyncTest : public ::testing::Test
+    {
+        shared_ptr<DBConnector> m_app_db;
+        shared_ptr<DBConnector> m_state_db;
+        shared_ptr<DBConnector> m_config_db;
+        shared_ptr<RedisPipeline> m_pipeline;
+        shared_ptr<FdbSync> m_sync;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            mockCallArgs.clear();
+
+            ASSERT_TRUE(NetlinkBatch::enable());
+            fake_netlink_socket::sendCount = 0;
+            fake_netlink_socket::messageCount = 0;
+
+            m_app_db = make_shared<DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<DBConnector>("STATE_DB", 0);
+            m_config_db = make_shared<DBConnector>("CONFIG_DB", 0);
+            m_pipeline = make_shared<RedisPipeline>(m_app_db.get());
+            m_sync = make_shared<FdbSync>(m_pipeline.get(), m_state_db.get(), m_config_db.get());
+            m_sync->m_isEvpnNvoExist = true;
+        }
+
+        static string mac(size_t i)
+        {
+            char buf[18];
+            snprintf(buf, sizeof(buf), "00:11:22:%02zx:%02zx:%02zx", (i >> 16) & 0xff, (i >> 8) & 0xff, i & 0xff);
+            return buf;
+        }
+    };
+
+    TEST_F(FdbSyncTest, LocalMacBurstIsBatched)
+    {
+        const size_t count = 20000;
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+        {
+            m_fdb_info info;
+            info.mac = mac(i);
+            info.vid = "Vlan" + to_string(100 + i % 10);
+            info.port_name = "Ethernet" + to_string((i % 32) * 4);
+            info.type = FDB_TYPE_DYNAMIC;
+            info.op_type = FDB_OPER_ADD;
+            m_sync->updateLocalMac(&info);
+        }
+        m_sync->flushKernelFdb();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        RecordProperty("fdb_per_second", to_string(static_cast<uint64_t>(count / (seconds > 0 ? seconds : 1e-9))));
+
+        ASSERT_TRUE(mockCallArgs.empty());
+        ASSERT_EQ(fake_netlink_socket::messageCount, count);
+        ASSERT_LT(fake_netlink_socket::sendCount, count / 100);
+        ASSERT_EQ(m_sync->m_kernelFdbBatch.size(), 0u);
+        ASSERT_EQ(m_sync->m_fdb_mac.size(), count);
+
+        /* Remove them all, the cache is updated before the kernel */
+        for (size_t i = 0; i < count; i++)
+        {
+            m_fdb_info info;
+            info.mac = mac(i);
+            info.vid = "Vlan" + to_string(100 + i % 10);
+            info.op_type = FDB_OPER_DEL;
+            m_sync->updateLocalMac(&info);
+        }
+        ASSERT_TRUE(m_sync->m_fdb_mac.empty());
+        m_sync->flushKernelFdb();
+
+        ASSERT_TRUE(mockCallArgs.empty());
+        ASSERT_EQ(fake_netlink_socket::messageCount, 2 * count);
+    }
+
+    TEST_F(FdbSyncTest, EvpnNvoChangeIsBatched)
+    {
+        const size_t count = 1000;
+
+        m_sync->m_isEvpnNvoExist = false;
+        for (size_t i = 0; i < count; i++)
+        {
+            m_fdb_info info;
+            info.mac = mac(i);
+            info.vid = "Vlan100";
+            info.port_name = "Ethernet0";
+            info.type = FDB_TYPE_STATIC;
+            info.op_type = FDB_OPER_ADD;
+            m_sync->updateLocalMac(&info);
+        }
+        m_sync->flushKernelFdb();
+        ASSERT_EQ(fake_netlink_socket::messageCount, 0u);
+
+        m_sync->m_isEvpnNvoExist = true;
+        m_sync->updateAllLocalMac();
+        m_sync->flushKernelFdb();
+
+        ASSERT_TRUE(mockCallArgs.empty());
+        ASSERT_EQ(fake_netlink_socket::messageCount, count);
+        ASSERT_LT(fake_netlink_socket::sendCount, count / 10);
+    }
+}
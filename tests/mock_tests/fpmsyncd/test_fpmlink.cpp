@@ -1,7 +1,13 @@
+#define private public
 #include "fpmsyncd/fpmlink.h"
+#undef private
 
 #include <swss/netdispatcher.h>
 
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -69,3 +75,76 @@ TEST_F(FpmLinkTest, TwoNlMessagesInFpmMessage)
     m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
 }
 
+TEST_F(FpmLinkTest, SendIsCoalescedUntilFlush)
+{
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    m_fpm.m_connection_socket = fds[0];
+
+    alignas(nlmsghdr) char nlMsg[NLMSG_SPACE(sizeof(rtmsg))] = {};
+    nlmsghdr *hdr = reinterpret_cast<nlmsghdr*>(nlMsg);
+    hdr->nlmsg_len = NLMSG_LENGTH(sizeof(rtmsg));
+    hdr->nlmsg_type = RTM_NEWROUTE;
+
+    EXPECT_TRUE(m_fpm.send(hdr));
+    EXPECT_TRUE(m_fpm.send(hdr));
+
+    // Nothing is written to the socket before the flush
+    char buf[1024];
+    EXPECT_EQ(recv(fds[1], buf, sizeof(buf), MSG_DONTWAIT), -1);
+
+    EXPECT_TRUE(m_fpm.flush());
+
+    size_t len = fpm_msg_align(sizeof(fpm_msg_hdr_t) + hdr->nlmsg_len);
+    EXPECT_EQ(recv(fds[1], buf, sizeof(buf), MSG_DONTWAIT), (ssize_t)(2 * len));
+
+    auto fpmHdr = reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(buf + len));
+    EXPECT_EQ(fpm_msg_len(fpmHdr), len);
+    EXPECT_EQ(reinterpret_cast<nlmsghdr*>(fpm_msg_data(fpmHdr))->nlmsg_type, RTM_NEWROUTE);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(FpmLinkTest, NewConnectionDropsCoalescedMessages)
+{
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    m_fpm.m_connection_socket = fds[0];
+
+    alignas(nlmsghdr) char nlMsg[NLMSG_SPACE(sizeof(rtmsg))] = {};
+    nlmsghdr *hdr = reinterpret_cast<nlmsghdr*>(nlMsg);
+    hdr->nlmsg_len = NLMSG_LENGTH(sizeof(rtmsg));
+    hdr->nlmsg_type = RTM_NEWROUTE;
+
+    // The connection is lost with a message in the send buffer and a partial message in the read buffer
+    EXPECT_TRUE(m_fpm.send(hdr));
+    m_fpm.m_pos = FPM_MSG_HDR_LEN - 1;
+    close(fds[0]);
+    close(fds[1]);
+
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(client, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(FPM_DEFAULT_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(connect(client, (struct sockaddr *)&addr, sizeof(addr)), 0);
+
+    m_fpm.accept();
+    EXPECT_EQ(m_fpm.m_pos, 0u);
+    EXPECT_EQ(m_fpm.m_sendPos, 0u);
+
+    // Nothing of the previous connection is sent on the new one
+    EXPECT_TRUE(m_fpm.flush());
+    char buf[1024];
+    EXPECT_EQ(recv(client, buf, sizeof(buf), MSG_DONTWAIT), -1);
+
+    EXPECT_TRUE(m_fpm.send(hdr));
+    EXPECT_TRUE(m_fpm.flush());
+    size_t len = fpm_msg_align(sizeof(fpm_msg_hdr_t) + hdr->nlmsg_len);
+    EXPECT_EQ(recv(client, buf, sizeof(buf), 0), (ssize_t)len);
+
+    close(m_fpm.m_connection_socket);
+    close(client);
+}
@@ -192,6 +192,85 @@ TEST_F(FpmSyncdResponseTest, WarmRestart)
     m_routeSync.onWarmStartEnd(applStateDb);
 }
 
+TEST_F(FpmSyncdResponseTest, OffloadReplyStats)
+{
+    EXPECT_CALL(m_mockFpm, send(_)).Times(2).WillRepeatedly([&](nlmsghdr* hdr) -> bool {
+        rtnl_route* routeObject{};
+
+        EXPECT_EQ(rtnl_route_parse(hdr, &routeObject), 0);
+        EXPECT_EQ(rtnl_route_get_type(routeObject), RTN_UNICAST);
+        EXPECT_EQ(nl_addr_get_prefixlen(rtnl_route_get_dst(routeObject)), 64u);
+        EXPECT_EQ(rtnl_route_get_flags(routeObject) & RTM_F_OFFLOAD, RTM_F_OFFLOAD);
+        rtnl_route_put(routeObject);
+
+        return true;
+    });
+
+    m_routeSync.onRouteResponse("1::/64", {
+        {"err_str", "SWSS_RC_SUCCESS"},
+        {"protocol", "kernel"},
+    });
+    m_routeSync.onRouteResponse("Vrf0:2::/64", {
+        {"err_str", "SWSS_RC_SUCCESS"},
+        {"protocol", "kernel"},
+    });
+    // Failure and deletion responses are not replied
+    m_routeSync.onRouteResponse("3::/64", {
+        {"err_str", "SWSS_RC_FAILURE"},
+        {"protocol", "kernel"},
+    });
+    m_routeSync.onRouteResponse("4::/64", {
+        {"err_str", "SWSS_RC_SUCCESS"},
+    });
+
+    DBConnector stateDb{"STATE_DB", 0};
+    Table statsTable{&stateDb, "FPMSYNCD_STATS"};
+    m_routeSync.publishStats(statsTable);
+
+    std::string value;
+    ASSERT_TRUE(statsTable.hget("offload", "offload_replies", value));
+    EXPECT_EQ(value, "2");
+}
+
+TEST_F(FpmSyncdResponseTest, RouteCoalescing)
+{
+    std::vector<FieldValueTuple> fvs1 = {{"nexthop", "10.0.0.1"}, {"ifname", "Ethernet0"}, {"protocol", "bgp"}};
+    std::vector<FieldValueTuple> fvs2 = {{"nexthop", "10.0.0.2"}, {"ifname", "Ethernet4"}, {"protocol", "bgp"}};
+
+    m_routeSync.setRouteCoalescing(100, 3);
+
+    // Flapping prefix, only the latest update is pending
+    m_routeSync.setRoute("1.0.0.0/24", fvs1);
+    m_routeSync.delRoute("1.0.0.0/24");
+    m_routeSync.setRoute("1.0.0.0/24", fvs2);
+    m_routeSync.setRoute("Vrf0:1.0.0.0/24", fvs1);
+
+    ASSERT_EQ(m_routeSync.m_pendingRoutes.size(), 2u);
+    EXPECT_EQ(kfvOp(m_routeSync.m_pendingRoutes["1.0.0.0/24"]), SET_COMMAND);
+    EXPECT_EQ(kfvFieldsValues(m_routeSync.m_pendingRoutes["1.0.0.0/24"]), fvs2);
+    EXPECT_EQ(m_routeSync.m_routeUpdatesReceived, 4u);
+    EXPECT_EQ(m_routeSync.m_routeUpdatesWritten, 0u);
+
+    m_routeSync.flushPendingRoutes();
+    EXPECT_TRUE(m_routeSync.m_pendingRoutes.empty());
+    EXPECT_EQ(m_routeSync.m_routeUpdatesWritten, 2u);
+
+    // Reaching the max number of pending routes flushes them
+    m_routeSync.setRoute("2.0.0.0/24", fvs1);
+    m_routeSync.setRoute("3.0.0.0/24", fvs1);
+    EXPECT_EQ(m_routeSync.m_pendingRoutes.size(), 2u);
+    m_routeSync.delRoute("4.0.0.0/24");
+    EXPECT_TRUE(m_routeSync.m_pendingRoutes.empty());
+    EXPECT_EQ(m_routeSync.m_routeUpdatesWritten, 5u);
+
+    // Disabled, updates are written right away
+    m_routeSync.setRouteCoalescing(0);
+    m_routeSync.setRoute("5.0.0.0/24", fvs1);
+    EXPECT_TRUE(m_routeSync.m_pendingRoutes.empty());
+    EXPECT_EQ(m_routeSync.m_routeUpdatesReceived, 8u);
+    EXPECT_EQ(m_routeSync.m_routeUpdatesWritten, 6u);
+}
+
 TEST_F(FpmSyncdResponseTest, testEvpn)
 {
     struct nlmsghdr *nlh = (struct nlmsghdr *) malloc(NLMSG_SPACE(MAX_PAYLOAD));
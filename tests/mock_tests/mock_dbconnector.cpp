@@ -9,6 +9,8 @@
 
 #include "dbconnector.h"
 
+void mockRegisterContext(redisContext *c, int dbId);
+
 namespace swss
 {
     DBConnector::DBConnector(int dbId, const std::string &hostname, int port, unsigned int timeout) :
@@ -20,6 +22,7 @@ namespace swss
         conn->tcp.port = port;
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        mockRegisterContext(conn, m_dbId);
     }
 
     DBConnector::DBConnector(int dbId, const std::string &unixPath, unsigned int timeout) :
@@ -30,6 +33,7 @@ namespace swss
         conn->unix_sock.path = strdup(unixPath.c_str());
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        mockRegisterContext(conn, m_dbId);
     }
 
     DBConnector::DBConnector(const std::string& dbName, unsigned int timeout, bool isTcpConn)
@@ -46,6 +50,7 @@ namespace swss
             conn->tcp.port = swss::SonicDBConfig::getDbPort(dbName);
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            mockRegisterContext(conn, m_dbId);
         }
         else
         {
@@ -54,6 +59,7 @@ namespace swss
             conn->unix_sock.path = strdup(swss::SonicDBConfig::getDbSock(dbName).c_str());
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            mockRegisterContext(conn, m_dbId);
         }
     }
 
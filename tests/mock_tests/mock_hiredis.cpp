@@ -1,37 +1,239 @@
 #include <stdlib.h>
+#include <string.h>
 #include <hiredis/hiredis.h>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "table.h"
+
+namespace testing_db
+{
+    extern std::map<int, std::map<std::string, std::map<std::string, std::vector<swss::FieldValueTuple>>>> gDB;
+}
 
 // Add a global redisReply for user to mock
 redisReply *mockReply = nullptr;
 
+// Number of SCAN and HGETALL commands answered from testing_db
+std::map<std::string, size_t> mockCommandCount;
+
+namespace
+{
+    // DB of each connection, connections may be created by the constructors of global objects
+    std::map<redisContext *, int> &contextDbIds()
+    {
+        static std::map<redisContext *, int> dbIds;
+        return dbIds;
+    }
+
+    // Commands appended to each connection which are not answered yet
+    std::map<redisContext *, std::deque<std::vector<std::string>>> &pendingCommands()
+    {
+        static std::map<redisContext *, std::deque<std::vector<std::string>>> commands;
+        return commands;
+    }
+
+    std::vector<std::string> parseCommand(const char *cmd, size_t len)
+    {
+        // Formatted commands are "*<argc>\r\n" followed by "$<len>\r\n<arg>\r\n" for each argument
+        std::vector<std::string> argv;
+        const char *end = cmd + len;
+
+        if (len == 0 || *cmd != '*')
+        {
+            return argv;
+        }
+
+        size_t argc = strtoul(cmd + 1, nullptr, 10);
+        const char *p = strstr(cmd, "\r\n");
+        for (size_t i = 0; i < argc && p && p + 3 < end; i++)
+        {
+            size_t argLen = strtoul(p + 3, nullptr, 10);
+            p = strstr(p + 3, "\r\n");
+            if (!p || p + 2 + argLen > end)
+            {
+                break;
+            }
+            argv.emplace_back(p + 2, argLen);
+            p += 2 + argLen;
+        }
+
+        return argv;
+    }
+
+    redisReply *createReply(int type)
+    {
+        auto reply = (redisReply *)calloc(sizeof(redisReply), 1);
+        reply->type = type;
+        return reply;
+    }
+
+    redisReply *createStringReply(const std::string &str)
+    {
+        auto reply = createReply(REDIS_REPLY_STRING);
+        reply->str = (char *)malloc(str.length() + 1);
+        memcpy(reply->str, str.c_str(), str.length() + 1);
+        reply->len = str.length();
+        return reply;
+    }
+
+    redisReply *createArrayReply(const std::vector<redisReply *> &elements)
+    {
+        auto reply = createReply(REDIS_REPLY_ARRAY);
+        reply->elements = elements.size();
+        reply->element = (redisReply **)calloc(sizeof(redisReply *), elements.size() ? elements.size() : 1);
+        for (size_t i = 0; i < elements.size(); i++)
+        {
+            reply->element[i] = elements[i];
+        }
+        return reply;
+    }
+
+    // SCAN <cursor> MATCH <table><separator>* COUNT <count>, the cursor is the index of the next key
+    redisReply *scan(int dbId, const std::vector<std::string> &argv)
+    {
+        if (argv.size() != 6 || argv[2] != "MATCH" || argv[4] != "COUNT" || argv[3].length() < 2 || argv[3].back() != '*')
+        {
+            return nullptr;
+        }
+
+        std::string prefix = argv[3].substr(0, argv[3].length() - 1);
+        std::string tableName = prefix.substr(0, prefix.length() - 1);
+        size_t cursor = strtoul(argv[1].c_str(), nullptr, 10);
+        size_t count = strtoul(argv[5].c_str(), nullptr, 10);
+
+        std::vector<std::string> keys;
+        for (const auto &it : testing_db::gDB[dbId][tableName])
+        {
+            keys.push_back(prefix + it.first);
+        }
+
+        std::vector<redisReply *> found;
+        size_t next = cursor;
+        for (; next < keys.size() && found.size() < count; next++)
+        {
+            found.push_back(createStringReply(keys[next]));
+        }
+
+        mockCommandCount["SCAN"]++;
+        return createArrayReply({ createStringReply(std::to_string(next < keys.size() ? next : 0)), createArrayReply(found) });
+    }
+
+    // HGETALL <table><separator><key>
+    redisReply *hgetall(int dbId, const std::vector<std::string> &argv)
+    {
+        if (argv.size() != 2)
+        {
+            return nullptr;
+        }
+
+        std::vector<redisReply *> fieldValues;
+        for (const auto &table : testing_db::gDB[dbId])
+        {
+            const std::string &name = table.first;
+            if (argv[1].length() <= name.length() || argv[1].compare(0, name.length(), name) != 0 ||
+                (argv[1][name.length()] != ':' && argv[1][name.length()] != '|'))
+            {
+                continue;
+            }
+
+            auto entry = table.second.find(argv[1].substr(name.length() + 1));
+            if (entry == table.second.end())
+            {
+                continue;
+            }
+
+            for (const auto &fv : entry->second)
+            {
+                fieldValues.push_back(createStringReply(fvField(fv)));
+                fieldValues.push_back(createStringReply(fvValue(fv)));
+            }
+            break;
+        }
+
+        mockCommandCount["HGETALL"]++;
+        return createArrayReply(fieldValues);
+    }
+
+    redisReply *answer(redisContext *c, const std::vector<std::string> &argv)
+    {
+        auto db = contextDbIds().find(c);
+        if (db == contextDbIds().end() || argv.empty())
+        {
+            return nullptr;
+        }
+
+        if (argv[0] == "SCAN")
+        {
+            return scan(db->second, argv);
+        }
+        if (argv[0] == "HGETALL")
+        {
+            return hgetall(db->second, argv);
+        }
+
+        return nullptr;
+    }
+}
+
+// Called by the mocked DBConnector constructors, so SCAN and HGETALL are answered from the DB of the connection
+void mockRegisterContext(redisContext *c, int dbId)
+{
+    contextDbIds()[c] = dbId;
+    pendingCommands().erase(c);
+}
+
 int redisGetReply(redisContext *c, void **reply)
 {
-    if (mockReply == nullptr)
+    std::vector<std::string> argv;
+    auto pending = pendingCommands().find(c);
+    if (pending != pendingCommands().end() && !pending->second.empty())
     {
-        *reply = calloc(sizeof(redisReply), 1);
-        ((redisReply *)*reply)->type = 3;
+        argv = pending->second.front();
+        pending->second.pop_front();
     }
-    else
+
+    if (mockReply != nullptr)
     {
         *reply = mockReply;
     }
+    else if (redisReply *answered = answer(c, argv))
+    {
+        *reply = answered;
+    }
+    else
+    {
+        *reply = calloc(sizeof(redisReply), 1);
+        ((redisReply *)*reply)->type = 3;
+    }
     return 0;
 }
 
 int redisAppendFormattedCommand(redisContext *c, const char *cmd, size_t len)
 {
+    pendingCommands()[c].push_back(parseCommand(cmd, len));
     return 0;
 }
 
 int redisvAppendCommand(redisContext *c, const char *format, va_list ap)
 {
+    char *cmd = nullptr;
+    int len = redisvFormatCommand(&cmd, format, ap);
+    pendingCommands()[c].push_back(len > 0 ? parseCommand(cmd, len) : std::vector<std::string>());
+    free(cmd);
     return 0;
 }
 
 int redisAppendCommand(redisContext *c, const char *format, ...)
 {
-    return 0;
+    va_list ap;
+    va_start(ap, format);
+    int ret = redisvAppendCommand(c, format, ap);
+    va_end(ap);
+    return ret;
 }
 
 int redisGetReplyFromReader(redisContext *c, void **reply)
@@ -0,0 +1,60 @@
+#include "mock_sai_bulk.h"
+
+/* The test binary is linked with -wrap for both functions, see Makefile.am */
+extern "C"
+{
+sai_status_t __real_sai_bulk_object_set_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                  uint32_t object_count, const sai_object_key_t *object_key,
+                                                  const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                                  sai_status_t *object_statuses);
+sai_status_t __real_sai_bulk_object_get_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                  uint32_t object_count, const sai_object_key_t *object_key,
+                                                  uint32_t *attr_count, sai_attribute_t **attr_list,
+                                                  sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses);
+
+sai_status_t __wrap_sai_bulk_object_set_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                  uint32_t object_count, const sai_object_key_t *object_key,
+                                                  const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                                  sai_status_t *object_statuses)
+{
+    if (mock_sai_bulk::set_attribute_hook)
+    {
+        return mock_sai_bulk::set_attribute_hook(switch_id, object_type, object_count, object_key, attr_list, mode, object_statuses);
+    }
+    return __real_sai_bulk_object_set_attribute(switch_id, object_type, object_count, object_key, attr_list, mode, object_statuses);
+}
+
+sai_status_t __wrap_sai_bulk_object_get_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                  uint32_t object_count, const sai_object_key_t *object_key,
+                                                  uint32_t *attr_count, sai_attribute_t **attr_list,
+                                                  sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    if (mock_sai_bulk::get_attribute_hook)
+    {
+        return mock_sai_bulk::get_attribute_hook(switch_id, object_type, object_count, object_key, attr_count, attr_list, mode, object_statuses);
+    }
+    return __real_sai_bulk_object_get_attribute(switch_id, object_type, object_count, object_key, attr_count, attr_list, mode, object_statuses);
+}
+}
+
+namespace mock_sai_bulk
+{
+    set_attribute_fn set_attribute_hook;
+    get_attribute_fn get_attribute_hook;
+
+    sai_status_t real_set_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                    uint32_t object_count, const sai_object_key_t *object_key,
+                                    const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                    sai_status_t *object_statuses)
+    {
+        return __real_sai_bulk_object_set_attribute(switch_id, object_type, object_count, object_key, attr_list, mode, object_statuses);
+    }
+
+    sai_status_t real_get_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                    uint32_t object_count, const sai_object_key_t *object_key,
+                                    uint32_t *attr_count, sai_attribute_t **attr_list,
+                                    sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        return __real_sai_bulk_object_get_attribute(switch_id, object_type, object_count, object_key, attr_count, attr_list, mode, object_statuses);
+    }
+}
@@ -0,0 +1,34 @@
+// Hook the generic SAI bulk attribute functions, which are not reached through a SAI API table.
+#pragma once
+
+#include <functional>
+
+extern "C"
+{
+#include "sai.h"
+}
+
+namespace mock_sai_bulk
+{
+    using set_attribute_fn = std::function<sai_status_t(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                        uint32_t object_count, const sai_object_key_t *object_key,
+                                                        const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                                        sai_status_t *object_statuses)>;
+    using get_attribute_fn = std::function<sai_status_t(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                                        uint32_t object_count, const sai_object_key_t *object_key,
+                                                        uint32_t *attr_count, sai_attribute_t **attr_list,
+                                                        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)>;
+
+    // The hooks replace the real functions while they are set, and can call real_set_attribute/real_get_attribute
+    extern set_attribute_fn set_attribute_hook;
+    extern get_attribute_fn get_attribute_hook;
+
+    sai_status_t real_set_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                    uint32_t object_count, const sai_object_key_t *object_key,
+                                    const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode,
+                                    sai_status_t *object_statuses);
+    sai_status_t real_get_attribute(sai_object_id_t switch_id, sai_object_type_t object_type,
+                                    uint32_t object_count, const sai_object_key_t *object_key,
+                                    uint32_t *attr_count, sai_attribute_t **attr_list,
+                                    sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses);
+}
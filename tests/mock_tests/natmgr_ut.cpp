@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#include "shellcmd.h"
+#define private public
+#include "natmgr.h"
+#undef private
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+
+namespace natmgr_ut
+{
+    using namespace swss;
+    using namespace std;
+
+    vector<string> execCmds;
+    vector<string> failingCmds;
+
+    /* Record the commands, those starting with one of failingCmds fail */
+    int execCmd(const string &cmd, string &stdout)
+    {
+        execCmds.push_back(cmd);
+        for (const auto &failingCmd : failingCmds)
+        {
+            if (cmd.find(failingCmd) == 0)
+            {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    struct NatMgrTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_app_db;
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_state_db;
+        shared_ptr<NatMgr> m_natMgr;
+
+        NatMgrTest()
+        {
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+        }
+
+        virtual void SetUp() override
+        {
+            ::testing_db::reset();
+            vector<string> cfg_nat_tables = {
+                CFG_STATIC_NAT_TABLE_NAME,
+            };
+            m_natMgr.reset(new NatMgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nat_tables));
+            m_natMgr->m_natZoneInterfaceInfo["Ethernet0"] = "1";
+
+            execCmds.clear();
+            failingCmds.clear();
+            callback = execCmd;
+        }
+
+        virtual void TearDown() override
+        {
+            callback = nullptr;
+        }
+
+        bool setStaticNat(const string &opCmd, const string &external_ip)
+        {
+            return m_natMgr->setStaticNatIptablesRules(opCmd, "Ethernet0", external_ip, "10.0.0.1", DNAT_NAT_TYPE);
+        }
+    };
+
+    TEST_F(NatMgrTest, IptablesRulesAppliedBeforeConntrack)
+    {
+        // The rules of a call are applied right away, in one transaction
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.1"));
+        ASSERT_EQ(execCmds.size(), 1);
+        ASSERT_EQ(execCmds[0].find(IPTABLES_RESTORE_CMD), 0);
+
+        // Batched rules are still applied before the conntrack entries are deleted
+        execCmds.clear();
+        m_natMgr->batchIptablesRules();
+        ASSERT_TRUE(setStaticNat(DELETE, "65.55.42.1"));
+        ASSERT_TRUE(execCmds.empty());
+        m_natMgr->deleteConntrackDynamicEntries("65.55.42.1");
+        ASSERT_EQ(execCmds.size(), 2);
+        ASSERT_EQ(execCmds[0].find(IPTABLES_RESTORE_CMD), 0);
+        ASSERT_EQ(execCmds[1].find(CONNTRACK_CMD), 0);
+
+        // Nothing left to apply
+        execCmds.clear();
+        ASSERT_TRUE(m_natMgr->applyIptablesRules());
+        ASSERT_TRUE(execCmds.empty());
+    }
+
+    TEST_F(NatMgrTest, IptablesRulesFailureReturned)
+    {
+        // The transaction and each rule applied alone fail
+        failingCmds = { IPTABLES_RESTORE_CMD, IPTABLES_CMD " " };
+        ASSERT_FALSE(setStaticNat(INSERT, "65.55.42.1"));
+        ASSERT_EQ(execCmds.size(), 3);
+        ASSERT_EQ(execCmds[0].find(IPTABLES_RESTORE_CMD), 0);
+        ASSERT_EQ(execCmds[1].find(IPTABLES_CMD " -t nat -I PREROUTING"), 0);
+        ASSERT_EQ(execCmds[2].find(IPTABLES_CMD " -t nat -I POSTROUTING"), 0);
+
+        // The failed rules are not known to be installed, so they are applied again
+        execCmds.clear();
+        failingCmds.clear();
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.1"));
+        ASSERT_EQ(execCmds.size(), 1);
+
+        // The transaction is rejected but each rule applied alone succeeds
+        execCmds.clear();
+        failingCmds = { IPTABLES_RESTORE_CMD };
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.2"));
+        ASSERT_EQ(execCmds.size(), 3);
+
+        // Only one of the rules fails, which is enough to return the failure
+        execCmds.clear();
+        failingCmds = { IPTABLES_RESTORE_CMD, IPTABLES_CMD " -t nat -D POSTROUTING" };
+        ASSERT_FALSE(setStaticNat(DELETE, "65.55.42.1"));
+        ASSERT_EQ(execCmds.size(), 3);
+    }
+
+    TEST_F(NatMgrTest, IptablesRulesBatchedAndReferenced)
+    {
+        // The rules of both entries are applied in one transaction
+        m_natMgr->batchIptablesRules();
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.1"));
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.2"));
+        ASSERT_TRUE(execCmds.empty());
+        ASSERT_TRUE(m_natMgr->applyIptablesRules());
+        ASSERT_EQ(execCmds.size(), 1);
+        ASSERT_EQ(execCmds[0].find(IPTABLES_RESTORE_CMD), 0);
+
+        // Installed rules only take another reference, and are deleted along with the last one
+        execCmds.clear();
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.1"));
+        ASSERT_TRUE(execCmds.empty());
+        ASSERT_TRUE(setStaticNat(DELETE, "65.55.42.1"));
+        ASSERT_TRUE(execCmds.empty());
+        ASSERT_TRUE(setStaticNat(DELETE, "65.55.42.1"));
+        ASSERT_EQ(execCmds.size(), 1);
+
+        // Rules known to be absent are not deleted again
+        execCmds.clear();
+        ASSERT_TRUE(setStaticNat(DELETE, "65.55.42.1"));
+        ASSERT_TRUE(execCmds.empty());
+    }
+
+    TEST_F(NatMgrTest, IptablesRulesBatchedPerTask)
+    {
+        m_natMgr->natAdminMode = ENABLED;
+        m_natMgr->m_natIpInterfaceInfo["Ethernet0"] = { "65.55.42.0/24" };
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"65.55.42.1", "SET", {{"local_ip", "10.0.0.1"}, {"nat_type", "dnat"}}});
+        entries.push_back({"65.55.42.2", "SET", {{"local_ip", "10.0.0.2"}, {"nat_type", "dnat"}}});
+        auto consumer = dynamic_cast<Consumer *>(m_natMgr->getExecutor(CFG_STATIC_NAT_TABLE_NAME));
+        consumer->addToSync(entries);
+        m_natMgr->doTask(*consumer);
+
+        // The rules of an entry are applied before the next conntrack command, the last ones at the end of the task
+        ASSERT_EQ(execCmds.size(), 4);
+        ASSERT_EQ(execCmds[0].find(CONNTRACK_CMD), 0);
+        ASSERT_EQ(execCmds[1].find(IPTABLES_RESTORE_CMD), 0);
+        ASSERT_EQ(execCmds[2].find(CONNTRACK_CMD), 0);
+        ASSERT_EQ(execCmds[3].find(IPTABLES_RESTORE_CMD), 0);
+
+        // The rules are applied right away again after the task
+        execCmds.clear();
+        ASSERT_TRUE(setStaticNat(INSERT, "65.55.42.3"));
+        ASSERT_EQ(execCmds.size(), 1);
+    }
+}
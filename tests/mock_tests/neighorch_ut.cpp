@@ -8,6 +8,10 @@
 #include "mock_orchagent_main.h"
 #include "mock_sai_api.h"
 #include "mock_orch_test.h"
+#include "zmqorch.h"
+#include "zmqclient.h"
+#include "zmqproducerstatetable.h"
+#include "select.h"
 
 
 EXTERN_MOCK_FNS
@@ -195,4 +199,36 @@ namespace neighorch_test
         ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(VLAN1000_NEIGH), 1);
         ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(VLAN2000_NEIGH), 0);
     }
+
+    TEST_F(NeighOrchTest, ZmqConsumerNextToRedis)
+    {
+        auto batchSize = gBatchSize;
+        gBatchSize = 128;
+
+        swss::ZmqServer zmqServer("tcp://127.0.0.1:8110");
+        NeighOrch neighOrch(m_app_db.get(), APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassis_app_db.get(), &zmqServer);
+
+        // The redis consumer is kept, the ZMQ one does not refill at warm start
+        ASSERT_NE(dynamic_cast<Consumer *>(neighOrch.getExecutor(APP_NEIGH_TABLE_NAME)), nullptr);
+        auto zmqConsumer = dynamic_cast<ZmqConsumer *>(neighOrch.getExecutor(string(APP_NEIGH_TABLE_NAME) + ZMQ_CONSUMER_NAME_SUFFIX));
+        ASSERT_NE(zmqConsumer, nullptr);
+        ASSERT_EQ(zmqConsumer->getTableName(), APP_NEIGH_TABLE_NAME);
+        ASSERT_EQ(zmqConsumer->refillToSync(), 0);
+
+        swss::ZmqClient zmqClient("tcp://127.0.0.1:8110");
+        swss::ZmqProducerStateTable neighProducer(m_app_db.get(), APP_NEIGH_TABLE_NAME, zmqClient, false);
+        neighProducer.set(VLAN_1000 + ":" + TEST_IP, { { "neigh", MAC1 }, { "family", "IPv4" } });
+
+        swss::Select s;
+        swss::Selectable *sel;
+        s.addSelectable(zmqConsumer);
+        ASSERT_EQ(s.select(&sel, 5000), swss::Select::OBJECT);
+
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entry);
+        zmqConsumer->execute();
+        ASSERT_EQ(neighOrch.m_syncdNeighbors.count(VLAN1000_NEIGH), 1);
+        ASSERT_EQ(zmqConsumer->getStats().executions, 1);
+
+        gBatchSize = batchSize;
+    }
 }
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <vector>
+#define private public
+#include "neighrestore.h"
+#undef private
+
+using namespace std;
+using namespace swss;
+
+namespace neighrestore_ut
+{
+    const MacAddress SRC_MAC("00:11:22:33:44:55");
+
+    /* One's complement sum of the ICMPv6 message and its pseudo header, 0xffff when the checksum is valid */
+    uint16_t icmpv6Sum(const vector<uint8_t> &frame)
+    {
+        const size_t ip6Offset = 14;
+        const size_t icmpOffset = ip6Offset + 40;
+        size_t len = frame.size() - icmpOffset;
+        uint32_t sum = 0;
+
+        for (size_t i = ip6Offset + 8; i < icmpOffset; i += 2)
+        {
+            sum += static_cast<uint32_t>((frame[i] << 8) | frame[i + 1]);
+        }
+        sum += static_cast<uint32_t>(len);
+        sum += frame[ip6Offset + 6];
+        for (size_t i = icmpOffset; i + 1 < frame.size(); i += 2)
+        {
+            sum += static_cast<uint32_t>((frame[i] << 8) | frame[i + 1]);
+        }
+        while (sum >> 16)
+        {
+            sum = (sum & 0xffff) + (sum >> 16);
+        }
+
+        return static_cast<uint16_t>(sum);
+    }
+
+    TEST(NeighRestore, BuildArpRequest)
+    {
+        auto frame = NeighRestore::buildArpRequest(SRC_MAC, IpAddress("10.0.0.1"), IpAddress("10.0.0.2"));
+
+        const vector<uint8_t> expected = {
+            /* Ethernet: broadcast, source MAC, ARP */
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+            0x08, 0x06,
+            /* Ethernet/IPv4, who-has */
+            0x00, 0x01, 0x08, 0x00, 0x06, 0x04, 0x00, 0x01,
+            0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+            0x0a, 0x00, 0x00, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0a, 0x00, 0x00, 0x02,
+        };
+        ASSERT_EQ(frame, expected);
+    }
+
+    TEST(NeighRestore, BuildNeighSolicitation)
+    {
+        auto frame = NeighRestore::buildNeighSolicitation(SRC_MAC, IpAddress("fe80::1"), IpAddress("2001:db8::abcd:1234"));
+
+        const vector<uint8_t> expected = {
+            /* Ethernet: solicited-node multicast MAC, source MAC, IPv6 */
+            0x33, 0x33, 0xff, 0xcd, 0x12, 0x34,
+            0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+            0x86, 0xdd,
+            /* IPv6: payload 32, ICMPv6, hop limit 255 */
+            0x60, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3a, 0xff,
+            0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+            0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x01, 0xff, 0xcd, 0x12, 0x34,
+            /* Neighbor solicitation, the checksum is checked below */
+            0x87, 0x00, frame[56], frame[57], 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xab, 0xcd, 0x12, 0x34,
+            /* Source link-layer address option */
+            0x01, 0x01, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+        };
+        ASSERT_EQ(frame.size(), expected.size());
+        ASSERT_EQ(frame, expected);
+        ASSERT_EQ(icmpv6Sum(frame), 0xffff);
+    }
+}
@@ -0,0 +1,434 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <set>
+#include <net/if.h>
+#include <linux/if_bridge.h>
+#include <linux/rtnetlink.h>
+#include <netlink/netlink.h>
+#include <netlink/attr.h>
+#include <netlink/msg.h>
+#include "netlinkbatch.h"
+
+/*
+ * Fake rtnetlink socket keeping a table of links. RTM_NEWLINK requests with
+ * NLM_F_CREATE add a link with a new index, RTM_DELLINK requests remove it.
+ * RTM_GETLINK dumps are answered with one datagram per link and NLMSG_DONE.
+ * The functions are wrapped with -Wl,-wrap, see tests_netlinkbatch_CXXFLAGS.
+ */
+namespace fake_netlink_socket
+{
+    struct request_t
+    {
+        uint16_t type;
+        uint16_t flags;
+        int ifindex;
+    };
+
+    std::map<std::string, int> links;
+    int nextIfindex = 1;
+    /* Index of the requests to fail and their errno */
+    std::map<size_t, int> failures;
+    std::vector<uint32_t> pendingSeqs;
+    std::vector<int> pendingErrors;
+    std::vector<request_t> requests;
+    size_t sendCount = 0;
+    /* Bridge VLANs of each link, returned by the dumps */
+    std::map<std::string, std::vector<uint16_t>> bridgeVlans;
+    /* Datagrams received before the acknowledgements */
+    std::deque<std::vector<unsigned char>> replies;
+
+    void reset()
+    {
+        links.clear();
+        bridgeVlans.clear();
+        replies.clear();
+        nextIfindex = 1;
+        failures.clear();
+        pendingSeqs.clear();
+        pendingErrors.clear();
+        requests.clear();
+        sendCount = 0;
+    }
+
+    void addLink(const std::string &name)
+    {
+        links[name] = nextIfindex++;
+    }
+
+    void queueReply(struct nl_msg *msg, uint32_t seq)
+    {
+        struct nlmsghdr *hdr = nlmsg_hdr(msg);
+        hdr->nlmsg_seq = seq;
+        auto *data = reinterpret_cast<unsigned char *>(hdr);
+        replies.emplace_back(data, data + hdr->nlmsg_len);
+        nlmsg_free(msg);
+    }
+
+    void dump(uint32_t seq)
+    {
+        for (const auto &link : links)
+        {
+            struct nl_msg *msg = nlmsg_alloc_simple(RTM_NEWLINK, NLM_F_MULTI);
+            struct ifinfomsg ifi = {};
+            ifi.ifi_family = AF_BRIDGE;
+            ifi.ifi_index = link.second;
+            nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO);
+
+            struct nlattr *spec = nla_nest_start(msg, IFLA_AF_SPEC);
+            for (auto vid : bridgeVlans[link.first])
+            {
+                struct bridge_vlan_info vinfo = {};
+                vinfo.vid = vid;
+                nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo);
+            }
+            nla_nest_end(msg, spec);
+            queueReply(msg, seq);
+        }
+
+        struct nl_msg *msg = nlmsg_alloc_simple(NLMSG_DONE, NLM_F_MULTI);
+        int status = 0;
+        nlmsg_append(msg, &status, sizeof(status), NLMSG_ALIGNTO);
+        queueReply(msg, seq);
+    }
+
+    int handle(struct nlmsghdr *hdr)
+    {
+        auto *ifi = static_cast<struct ifinfomsg *>(nlmsg_data(hdr));
+        requests.push_back({hdr->nlmsg_type, hdr->nlmsg_flags, ifi->ifi_index});
+
+        auto failure = failures.find(requests.size() - 1);
+        if (failure != failures.end())
+        {
+            return failure->second;
+        }
+
+        if (hdr->nlmsg_type == RTM_NEWLINK && (hdr->nlmsg_flags & NLM_F_CREATE))
+        {
+            struct nlattr *name = nlmsg_find_attr(hdr, sizeof(struct ifinfomsg), IFLA_IFNAME);
+            if (!name)
+            {
+                return EINVAL;
+            }
+            if (links.count(nla_get_string(name)))
+            {
+                return EEXIST;
+            }
+            addLink(nla_get_string(name));
+        }
+        else if (hdr->nlmsg_type == RTM_DELLINK)
+        {
+            for (auto it = links.begin(); it != links.end(); ++it)
+            {
+                if (it->second == ifi->ifi_index)
+                {
+                    links.erase(it);
+                    return 0;
+                }
+            }
+            return ENODEV;
+        }
+
+        return 0;
+    }
+}
+
+extern "C"
+{
+
+int __wrap_nl_connect(struct nl_sock *sk, int protocol)
+{
+    return 0;
+}
+
+int __wrap_nl_sendto(struct nl_sock *sk, void *buf, size_t size)
+{
+    using namespace fake_netlink_socket;
+
+    auto *hdr = static_cast<struct nlmsghdr *>(buf);
+    int len = static_cast<int>(size);
+    while (nlmsg_ok(hdr, len))
+    {
+        if (hdr->nlmsg_type == RTM_GETLINK && (hdr->nlmsg_flags & NLM_F_DUMP) == NLM_F_DUMP)
+        {
+            dump(hdr->nlmsg_seq);
+        }
+        else
+        {
+            pendingSeqs.push_back(hdr->nlmsg_seq);
+            pendingErrors.push_back(handle(hdr));
+        }
+        hdr = nlmsg_next(hdr, &len);
+    }
+    sendCount++;
+
+    return static_cast<int>(size);
+}
+
+int __wrap_nl_recv(struct nl_sock *sk, struct sockaddr_nl *nla, unsigned char **buf, struct ucred **creds)
+{
+    using namespace fake_netlink_socket;
+
+    if (!replies.empty())
+    {
+        auto reply = replies.front();
+        replies.pop_front();
+        *buf = static_cast<unsigned char *>(malloc(reply.size()));
+        memcpy(*buf, reply.data(), reply.size());
+        return static_cast<int>(reply.size());
+    }
+
+    size_t ackLen = NLMSG_LENGTH(sizeof(struct nlmsgerr));
+    size_t total = NLMSG_ALIGN(ackLen) * pendingSeqs.size();
+    *buf = static_cast<unsigned char *>(calloc(1, total));
+
+    unsigned char *p = *buf;
+    for (size_t i = 0; i < pendingSeqs.size(); i++)
+    {
+        auto *hdr = reinterpret_cast<struct nlmsghdr *>(p);
+        hdr->nlmsg_len = static_cast<uint32_t>(ackLen);
+        hdr->nlmsg_type = NLMSG_ERROR;
+        hdr->nlmsg_seq = pendingSeqs[i];
+        static_cast<struct nlmsgerr *>(nlmsg_data(hdr))->error = -pendingErrors[i];
+        p += NLMSG_ALIGN(ackLen);
+    }
+    pendingSeqs.clear();
+    pendingErrors.clear();
+
+    return static_cast<int>(total);
+}
+
+unsigned int __wrap_if_nametoindex(const char *ifname)
+{
+    auto it = fake_netlink_socket::links.find(ifname);
+    return it == fake_netlink_socket::links.end() ? 0 : static_cast<unsigned int>(it->second);
+}
+
+}
+
+namespace netlinkbatch_ut
+{
+    using namespace std;
+    using namespace swss;
+
+    struct NetlinkBatchTest : public ::testing::Test
+    {
+        void SetUp() override
+        {
+            ASSERT_TRUE(NetlinkBatch::enable());
+            fake_netlink_socket::reset();
+            fake_netlink_socket::addLink("Bridge");
+            fake_netlink_socket::addLink("Ethernet0");
+        }
+    };
+
+    TEST_F(NetlinkBatchTest, RequestsArePackedIntoOneSend)
+    {
+        NetlinkBatch batch;
+        for (uint16_t vlan = 1; vlan <= 100; vlan++)
+        {
+            batch.addBridgeVlan("Ethernet0", vlan, false);
+        }
+        batch.setLinkMtu("Ethernet0", 9100);
+        batch.setLinkAdminState("Ethernet0", true);
+        ASSERT_EQ(batch.size(), 102u);
+
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(batch.size(), 0u);
+        ASSERT_EQ(batch.results(), vector<int>(102, 0));
+        ASSERT_EQ(fake_netlink_socket::requests.size(), 102u);
+        ASSERT_EQ(fake_netlink_socket::sendCount, 1u);
+    }
+
+    TEST_F(NetlinkBatchTest, LinkIsConfiguredInTheBatchCreatingIt)
+    {
+        NetlinkBatch batch;
+        batch.addVlanLink("Bridge", "Vlan10", 10);
+        batch.setLinkMtu("Vlan10", 9100);
+        batch.setLinkAdminState("Vlan10", true);
+
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(fake_netlink_socket::requests.size(), 3u);
+        ASSERT_EQ(fake_netlink_socket::requests[1].ifindex, fake_netlink_socket::links["Vlan10"]);
+        ASSERT_EQ(fake_netlink_socket::requests[2].ifindex, fake_netlink_socket::links["Vlan10"]);
+    }
+
+    TEST_F(NetlinkBatchTest, RecreatedLinkIsResolvedAgain)
+    {
+        fake_netlink_socket::addLink("Vlan10");
+        int oldIfindex = fake_netlink_socket::links["Vlan10"];
+
+        NetlinkBatch batch;
+        batch.delLink("Vlan10");
+        batch.addVlanLink("Bridge", "Vlan10", 10);
+        batch.setLinkAdminState("Vlan10", true);
+
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(fake_netlink_socket::requests.size(), 3u);
+        ASSERT_EQ(fake_netlink_socket::requests[0].ifindex, oldIfindex);
+        ASSERT_NE(fake_netlink_socket::requests[2].ifindex, oldIfindex);
+        ASSERT_EQ(fake_netlink_socket::requests[2].ifindex, fake_netlink_socket::links["Vlan10"]);
+    }
+
+    TEST_F(NetlinkBatchTest, UnknownLinkFailsOnlyItsOperation)
+    {
+        NetlinkBatch batch;
+        batch.setLinkAdminState("Ethernet0", true);
+        batch.setLinkAdminState("Ethernet4", true);
+        batch.setLinkMtu("Ethernet0", 9100);
+
+        ASSERT_FALSE(batch.commit());
+        ASSERT_EQ(batch.results(), vector<int>({0, ENODEV, 0}));
+        ASSERT_EQ(batch.getLastError(), "link set Ethernet4 up : " + string(strerror(ENODEV)));
+        ASSERT_EQ(fake_netlink_socket::requests.size(), 2u);
+    }
+
+    TEST_F(NetlinkBatchTest, HandlersGetTheResultOfTheirOperations)
+    {
+        fake_netlink_socket::failures[2] = EBUSY;
+
+        vector<pair<int, string>> results;
+        auto handler = [&](int error, const string &description) {
+            results.emplace_back(error, description);
+        };
+
+        NetlinkBatch batch;
+        batch.setLinkAdminState("Ethernet0", true);
+        batch.setLinkMtu("Ethernet0", 9100);
+        batch.onResult(handler);
+        batch.setLinkMtu("Bridge", 9100);
+        batch.setLinkAdminState("Bridge", true);
+        batch.onResult(handler);
+        batch.onResult(handler);
+        ASSERT_TRUE(results.empty());
+
+        ASSERT_FALSE(batch.commit());
+        ASSERT_EQ(fake_netlink_socket::sendCount, 1u);
+        ASSERT_EQ(results.size(), 3u);
+        ASSERT_EQ(results[0], make_pair(0, string()));
+        ASSERT_EQ(results[1], make_pair(EBUSY, string("link set Bridge mtu 9100")));
+        /* No operation was queued between the last two handlers */
+        ASSERT_EQ(results[2], make_pair(0, string()));
+    }
+
+    TEST_F(NetlinkBatchTest, HandlerOfEmptyBatchRunsImmediately)
+    {
+        int calls = 0;
+        NetlinkBatch batch;
+        batch.onResult([&](int error, const string &) {
+            ASSERT_EQ(error, 0);
+            calls++;
+        });
+        ASSERT_EQ(calls, 1);
+
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(calls, 1);
+        ASSERT_EQ(fake_netlink_socket::sendCount, 0u);
+    }
+
+    TEST_F(NetlinkBatchTest, OperationsQueuedByHandlersAreCommitted)
+    {
+        fake_netlink_socket::failures[0] = EEXIST;
+
+        vector<int> order;
+        NetlinkBatch batch;
+        batch.addVlanLink("Bridge", "Vlan10", 10);
+        batch.onResult([&](int error, const string &) {
+            order.push_back(1);
+            /* Roll back like VxlanMgr::createVxlan() */
+            if (error)
+            {
+                batch.delLink("Bridge");
+                batch.onResult([&](int error, const string &) {
+                    ASSERT_EQ(error, 0);
+                    order.push_back(3);
+                });
+            }
+        });
+        batch.setLinkAdminState("Ethernet0", true);
+        batch.onResult([&](int error, const string &) {
+            ASSERT_EQ(error, 0);
+            order.push_back(2);
+        });
+
+        ASSERT_FALSE(batch.commit());
+        ASSERT_EQ(order, vector<int>({1, 2, 3}));
+        ASSERT_EQ(batch.results(), vector<int>({EEXIST, 0, 0}));
+        ASSERT_EQ(fake_netlink_socket::sendCount, 2u);
+        ASSERT_EQ(fake_netlink_socket::links.count("Bridge"), 0u);
+        ASSERT_EQ(batch.size(), 0u);
+    }
+
+    TEST_F(NetlinkBatchTest, BatchIsReusedAfterCommit)
+    {
+        fake_netlink_socket::failures[0] = EINVAL;
+
+        NetlinkBatch batch;
+        batch.setLinkMtu("Ethernet0", 100000);
+        ASSERT_FALSE(batch.commit());
+        ASSERT_FALSE(batch.getLastError().empty());
+
+        batch.setLinkMtu("Ethernet0", 9100);
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(batch.results(), vector<int>({0}));
+        ASSERT_TRUE(batch.getLastError().empty());
+    }
+
+    TEST_F(NetlinkBatchTest, BridgeVlanDumpIsReadToTheEnd)
+    {
+        fake_netlink_socket::bridgeVlans["Bridge"] = {1};
+        fake_netlink_socket::bridgeVlans["Ethernet0"] = {10, 20};
+
+        /* An error left by an earlier request is skipped */
+        struct nl_msg *stale = nlmsg_alloc_simple(NLMSG_ERROR, 0);
+        struct nlmsgerr nlerr = {};
+        nlerr.error = -EBUSY;
+        nlmsg_append(stale, &nlerr, sizeof(nlerr), NLMSG_ALIGNTO);
+        fake_netlink_socket::queueReply(stale, 0xdead);
+
+        vector<uint16_t> vlans;
+        ASSERT_TRUE(NetlinkBatch::getBridgeVlans("Ethernet0", vlans));
+        ASSERT_EQ(vlans, vector<uint16_t>({10, 20}));
+        ASSERT_TRUE(fake_netlink_socket::replies.empty());
+
+        /* The next request gets its own acknowledgement */
+        NetlinkBatch batch;
+        batch.setLinkMtu("Ethernet0", 9100);
+        ASSERT_TRUE(batch.commit());
+        ASSERT_EQ(batch.results(), vector<int>({0}));
+        ASSERT_TRUE(NetlinkBatch::getBridgeVlans("Bridge", vlans));
+        ASSERT_EQ(vlans, vector<uint16_t>({1}));
+        ASSERT_FALSE(NetlinkBatch::getBridgeVlans("Ethernet4", vlans));
+    }
+
+    TEST_F(NetlinkBatchTest, VlanMemberBurstThroughput)
+    {
+        const size_t members = 4096;
+        const uint16_t vlans = 64;
+
+        auto start = chrono::steady_clock::now();
+        NetlinkBatch batch;
+        for (size_t i = 0; i < members; i++)
+        {
+            string port = "Ethernet" + to_string(i % 256);
+            if (i < 256)
+            {
+                fake_netlink_socket::addLink(port);
+                batch.setLinkMaster(port, "Bridge");
+            }
+            batch.addBridgeVlan(port, static_cast<uint16_t>(1 + i % vlans), false);
+            batch.onResult([](int error, const string &) {
+                ASSERT_EQ(error, 0);
+            });
+        }
+        ASSERT_TRUE(batch.commit());
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        RecordProperty("operations_per_second",
+                       to_string(static_cast<uint64_t>((members + 256) / (seconds > 0 ? seconds : 1e-9))));
+
+        ASSERT_EQ(fake_netlink_socket::requests.size(), members + 256);
+        ASSERT_LT(fake_netlink_socket::sendCount, (members + 256) / 100);
+    }
+}
@@ -0,0 +1,91 @@
+#include "ut_helper.h"
+#include "observer.h"
+
+namespace observer_test
+{
+    using namespace std;
+
+    struct TestUpdate
+    {
+        string key;
+        int value;
+    };
+
+    class TestSubject : public Subject
+    {
+    public:
+        void queue(const TestUpdate &update)
+        {
+            notifyDeferred(SUBJECT_TYPE_FDB_CHANGE, update.key, update);
+        }
+
+        void flush()
+        {
+            flushNotifications();
+        }
+    };
+
+    class TestObserver : public Observer
+    {
+    public:
+        void update(SubjectType type, void *cntx) override
+        {
+            auto update = static_cast<TestUpdate *>(cntx);
+            m_updates.push_back(*update);
+        }
+
+        vector<TestUpdate> m_updates;
+    };
+
+    class TestBatchObserver : public TestObserver
+    {
+    public:
+        void updateBatch(SubjectType type, const vector<void *> &cntxs) override
+        {
+            m_batchSizes.push_back(cntxs.size());
+            Observer::updateBatch(type, cntxs);
+        }
+
+        vector<size_t> m_batchSizes;
+    };
+
+    TEST(ObserverTest, DeferredUpdatesAreCoalescedAndBatched)
+    {
+        TestSubject subject;
+        TestObserver observer;
+        TestBatchObserver batchObserver;
+        subject.attach(&observer);
+        subject.attach(&batchObserver);
+
+        subject.queue({ "Ethernet0", 1 });
+        subject.queue({ "Ethernet4", 2 });
+        subject.queue({ "Ethernet0", 3 });
+
+        // Nothing is delivered until the flush
+        ASSERT_TRUE(observer.m_updates.empty());
+
+        subject.flush();
+
+        // Only the latest update of a key is delivered, in the order of the first update
+        ASSERT_EQ(observer.m_updates.size(), 2);
+        ASSERT_EQ(observer.m_updates[0].key, "Ethernet0");
+        ASSERT_EQ(observer.m_updates[0].value, 3);
+        ASSERT_EQ(observer.m_updates[1].key, "Ethernet4");
+        ASSERT_EQ(observer.m_updates[1].value, 2);
+
+        ASSERT_EQ(batchObserver.m_batchSizes, vector<size_t>({ 2 }));
+        ASSERT_EQ(batchObserver.m_updates.size(), 2);
+
+        // The queue is empty after the flush
+        subject.flush();
+        ASSERT_EQ(observer.m_updates.size(), 2);
+
+        const auto &stats = subject.getObserverStats();
+        ASSERT_EQ(stats.at(&observer).batches, 1);
+        ASSERT_EQ(stats.at(&observer).updates, 2);
+        ASSERT_EQ(stats.at(&batchObserver).batches, 1);
+
+        subject.detach(&observer);
+        ASSERT_EQ(subject.getObserverStats().count(&observer), 0);
+    }
+}
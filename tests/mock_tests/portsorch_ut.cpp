@@ -8,6 +8,7 @@
 #include "mock_table.h"
 #include "notifier.h"
 #include "mock_sai_bridge.h"
+#include "mock_sai_bulk.h"
 #define private public
 #include "pfcactionhandler.h"
 #include "switchorch.h"
@@ -17,6 +18,7 @@
 #include "warm_restart.h"
 #undef private
 
+#include <chrono>
 #include <sstream>
 
 extern redisReply *mockReply;
@@ -39,6 +41,7 @@ namespace portsorch_test
     uint32_t _sai_set_port_fec_count;
     int32_t _sai_port_fec_mode;
     vector<sai_port_fec_mode_t> mock_port_fec_modes = {SAI_PORT_FEC_MODE_RS, SAI_PORT_FEC_MODE_FC};
+    uint32_t _sai_get_port_qos_attr_count;
 
     sai_status_t _ut_stub_sai_get_port_attribute(
         _In_ sai_object_id_t port_id,
@@ -75,11 +78,55 @@ namespace portsorch_test
         }
         else
         {
+            if (attr_list[0].id == SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES ||
+                attr_list[0].id == SAI_PORT_ATTR_QOS_QUEUE_LIST ||
+                attr_list[0].id == SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS ||
+                attr_list[0].id == SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST)
+            {
+                _sai_get_port_qos_attr_count++;
+            }
             status = pold_sai_port_api->get_port_attribute(port_id, attr_count, attr_list);
         }
         return status;
     }
 
+    // Bulk get of port attributes, served by the per port get of the virtual switch
+    vector<uint32_t> _sai_bulk_get_port_object_counts;
+    sai_object_id_t _sai_bulk_get_port_failed_oid;
+    sai_status_t _ut_stub_sai_bulk_get_port_attribute(
+        sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+        const sai_object_key_t *object_key, uint32_t *attr_count, sai_attribute_t **attr_list,
+        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_PORT)
+        {
+            return mock_sai_bulk::real_get_attribute(switch_id, object_type, object_count, object_key,
+                                                     attr_count, attr_list, mode, object_statuses);
+        }
+
+        _sai_bulk_get_port_object_counts.push_back(object_count);
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (object_key[i].key.object_id == _sai_bulk_get_port_failed_oid)
+            {
+                object_statuses[i] = SAI_STATUS_FAILURE;
+            }
+            else
+            {
+                object_statuses[i] = pold_sai_port_api->get_port_attribute(object_key[i].key.object_id,
+                                                                           attr_count[i], attr_list[i]);
+            }
+
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
     uint32_t _sai_set_pfc_mode_count;
     uint32_t _sai_set_admin_state_up_count;
     uint32_t _sai_set_admin_state_down_count;
@@ -1054,6 +1101,301 @@ namespace portsorch_test
         _unhook_sai_queue_api();
     }
 
+    /*
+    * Test case: lookups by alias, port ID and bridge port ID return the port storage without copy
+    */
+    TEST_F(PortsOrchTest, FindPortTest)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        std::deque<KeyOpFieldsValuesTuple> entries;
+
+        // Get SAI default ports to populate DB
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        const Port *port = gPortsOrch->findPort("Ethernet0");
+        ASSERT_NE(port, nullptr);
+        ASSERT_EQ(port, &gPortsOrch->getAllPorts().at("Ethernet0"));
+        ASSERT_EQ(gPortsOrch->findPort(port->m_port_id), port);
+        ASSERT_EQ(gPortsOrch->findPort("Ethernet1000"), nullptr);
+
+        // The copy returned by getPort() matches the storage
+        Port p;
+        ASSERT_TRUE(gPortsOrch->getPort(port->m_port_id, p));
+        ASSERT_EQ(p.m_alias, port->m_alias);
+        ASSERT_EQ(p.m_queue_ids, port->m_queue_ids);
+
+        // Bridge port lookups share the storage and follow setPort()
+        ASSERT_TRUE(gPortsOrch->addBridgePort(p));
+        auto bridge_port_id = p.m_bridge_port_id;
+        ASSERT_NE(bridge_port_id, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(gPortsOrch->findPortByBridgePortId(bridge_port_id), port);
+        ASSERT_EQ(port->m_bridge_port_id, bridge_port_id);
+
+        ASSERT_TRUE(gPortsOrch->removeBridgePort(p));
+        ASSERT_EQ(gPortsOrch->findPortByBridgePortId(bridge_port_id), nullptr);
+        ASSERT_FALSE(gPortsOrch->getPortByBridgePortId(bridge_port_id, p));
+        ASSERT_EQ(port->m_bridge_port_id, SAI_NULL_OBJECT_ID);
+
+        // Delete port
+        auto port_id = port->m_port_id;
+        entries.push_back({"Ethernet0", "DEL", {}});
+        auto consumer = dynamic_cast<Consumer *>(gPortsOrch->getExecutor(APP_PORT_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+        entries.clear();
+
+        ASSERT_EQ(gPortsOrch->findPort("Ethernet0"), nullptr);
+        ASSERT_EQ(gPortsOrch->findPort(port_id), nullptr);
+        ASSERT_EQ(gPortsOrch->m_portOidCache.find(port_id), gPortsOrch->m_portOidCache.end());
+    }
+
+    /*
+    * Test case: time the lookups by port ID through the object ID cache against the alias map lookup and copy
+    */
+    TEST_F(PortsOrchTest, FindPortLookupTime)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        vector<sai_object_id_t> port_ids;
+        for (const auto &it : ports)
+        {
+            const Port *port = gPortsOrch->findPort(it.first);
+            ASSERT_NE(port, nullptr);
+            port_ids.push_back(port->m_port_id);
+        }
+
+        const size_t lookups = 100000;
+        size_t found = 0;
+
+        // The lookup before the cache: alias of the object ID, then the port by alias, copied
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; i++)
+        {
+            auto alias = gPortsOrch->saiOidToAlias.find(port_ids[i % port_ids.size()]);
+            Port port = gPortsOrch->m_portList.find(alias->second)->second;
+            found += port.m_port_id != SAI_NULL_OBJECT_ID;
+        }
+        auto map_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; i++)
+        {
+            Port port;
+            found += gPortsOrch->getPort(port_ids[i % port_ids.size()], port);
+        }
+        auto copy_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; i++)
+        {
+            found += gPortsOrch->findPort(port_ids[i % port_ids.size()]) != nullptr;
+        }
+        auto cache_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        ASSERT_EQ(found, 3 * lookups);
+        cout << lookups << " lookups of " << port_ids.size() << " ports: alias map and copy " << map_us.count()
+             << " us, getPort() " << copy_us.count() << " us, findPort() " << cache_us.count() << " us" << endl;
+    }
+
+    /*
+    * Test case: queues and PGs of all the ports are read ahead of the port initialization
+    */
+    TEST_F(PortsOrchTest, PortQosObjectsInitialization)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        _hook_sai_port_api();
+        _sai_get_port_qos_attr_count = 0;
+        _sai_bulk_get_port_object_counts.clear();
+        _sai_bulk_get_port_failed_oid = SAI_NULL_OBJECT_ID;
+        mock_sai_bulk::get_attribute_hook = _ut_stub_sai_bulk_get_port_attribute;
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        mock_sai_bulk::get_attribute_hook = nullptr;
+        _unhook_sai_port_api();
+
+        // One bulk get for the numbers of queues and PGs of all the ports, one for their lists, no per port get
+        ASSERT_EQ(_sai_bulk_get_port_object_counts, vector<uint32_t>({ (uint32_t)ports.size(), (uint32_t)ports.size() }));
+        ASSERT_EQ(_sai_get_port_qos_attr_count, 0u);
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_queue_ids.size(), attr.value.u32);
+            ASSERT_EQ(port.m_queue_lock.size(), attr.value.u32);
+
+            attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_priority_group_ids.size(), attr.value.u32);
+
+            for (const auto &queue_id : port.m_queue_ids)
+            {
+                ASSERT_NE(queue_id, SAI_NULL_OBJECT_ID);
+            }
+            for (const auto &pg_id : port.m_priority_group_ids)
+            {
+                ASSERT_NE(pg_id, SAI_NULL_OBJECT_ID);
+            }
+        }
+
+        // The prefetched objects are released once the ports are initialized
+        ASSERT_TRUE(gPortsOrch->m_prefetchedQosObjects.empty());
+        ASSERT_NE(gPortsOrch->m_portInitPhaseTime.find("qos_discovery"), gPortsOrch->m_portInitPhaseTime.end());
+        ASSERT_NE(gPortsOrch->m_portInitPhaseTime.find("port_init"), gPortsOrch->m_portInitPhaseTime.end());
+    }
+
+    /*
+     * Test case: the queues and PGs are read port by port when the bulk get isn't supported
+     */
+    TEST_F(PortsOrchTest, PortQosObjectsInitializationFallback)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        _hook_sai_port_api();
+        _sai_get_port_qos_attr_count = 0;
+        _sai_bulk_get_port_object_counts.clear();
+        _sai_bulk_get_port_failed_oid = SAI_NULL_OBJECT_ID;
+
+        size_t bulkCalls = 0;
+        mock_sai_bulk::get_attribute_hook = [&](sai_object_id_t, sai_object_type_t object_type, uint32_t,
+                                                const sai_object_key_t *, uint32_t *, sai_attribute_t **,
+                                                sai_bulk_op_error_mode_t, sai_status_t *) {
+            if (object_type == SAI_OBJECT_TYPE_PORT)
+            {
+                bulkCalls++;
+            }
+            return SAI_STATUS_NOT_SUPPORTED;
+        };
+
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        mock_sai_bulk::get_attribute_hook = nullptr;
+        _unhook_sai_port_api();
+
+        // The lists aren't requested once the bulk get of the numbers isn't supported
+        ASSERT_EQ(bulkCalls, 1u);
+
+        // At least the numbers of queues and PGs are read for each port
+        ASSERT_GE(_sai_get_port_qos_attr_count, 2 * ports.size());
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_queue_ids.size(), attr.value.u32);
+
+            attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_priority_group_ids.size(), attr.value.u32);
+        }
+        ASSERT_TRUE(gPortsOrch->m_prefetchedQosObjects.empty());
+    }
+
+    /*
+     * Test case: a port whose queue and PG numbers can't be read in bulk is read on its own
+     */
+    TEST_F(PortsOrchTest, PortQosObjectsInitializationPartialFailure)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        _hook_sai_port_api();
+        _sai_get_port_qos_attr_count = 0;
+        _sai_bulk_get_port_object_counts.clear();
+        _sai_bulk_get_port_failed_oid = gPortsOrch->m_portListLaneMap.begin()->second;
+        mock_sai_bulk::get_attribute_hook = _ut_stub_sai_bulk_get_port_attribute;
+
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        mock_sai_bulk::get_attribute_hook = nullptr;
+        _unhook_sai_port_api();
+
+        // The failed port is left out of the bulk get of the lists and read with up to four gets
+        ASSERT_EQ(_sai_bulk_get_port_object_counts, vector<uint32_t>({ (uint32_t)ports.size(), (uint32_t)ports.size() - 1 }));
+        ASSERT_GT(_sai_get_port_qos_attr_count, 0u);
+        ASSERT_LE(_sai_get_port_qos_attr_count, 4u);
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_queue_ids.size(), attr.value.u32);
+
+            attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_priority_group_ids.size(), attr.value.u32);
+        }
+    }
+
     /**
      * Test case: PortsOrch::addBridgePort() does not add router port to .1Q bridge
      */
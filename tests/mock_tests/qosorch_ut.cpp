@@ -8,6 +8,8 @@
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 
+#include <chrono>
+
 extern string gMySwitchType;
 
 
@@ -1588,4 +1590,218 @@ namespace qosorch_test
         static_cast<Orch *>(tunnel_decap_orch)->doTask();
         entries.clear();
     }
+
+    TEST_F(QosOrchTest, QosOrchTestSharedQosMapAndReload)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        const size_t map_count = 8;
+
+        // Create maps of the same content under different names
+        for (size_t i = 0; i < map_count; i++)
+        {
+            entries.push_back({"AZURE_SHARED_" + to_string(i), "SET",
+                               {
+                                   {"2", "2"},
+                                   {"3", "3"}
+                               }});
+        }
+        auto dscpToTcMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_DSCP_TO_TC_MAP_TABLE_NAME));
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        auto &dscpToTcMaps = (*QosOrch::getTypeMap()[CFG_DSCP_TO_TC_MAP_TABLE_NAME]);
+        auto shared_object = dscpToTcMaps["AZURE_SHARED_0"].m_saiObjectId;
+        ASSERT_NE(shared_object, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(shared_object, dscpToTcMaps["AZURE"].m_saiObjectId);
+        for (size_t i = 1; i < map_count; i++)
+        {
+            ASSERT_EQ(dscpToTcMaps["AZURE_SHARED_" + to_string(i)].m_saiObjectId, shared_object);
+        }
+
+        // Bind the maps to all the ports, then reload them
+        string port_key;
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            port_key += (port_key.empty() ? "" : ",") + it.first;
+        }
+        vector<FieldValueTuple> port_qos_map = {
+            {"dscp_to_tc_map", "AZURE_SHARED_0"},
+            {"tc_to_queue_map", "AZURE"}
+        };
+
+        auto portQosMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        auto start = std::chrono::steady_clock::now();
+        entries.push_back({port_key, "SET", port_qos_map});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        entries.push_back({port_key, "DEL", {}});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        entries.push_back({port_key, "SET", port_qos_map});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        cout << "Reloaded QoS maps of " << ports.size() << " ports in " << elapsed.count() << " us" << endl;
+
+        CheckDependency(CFG_PORT_QOS_MAP_TABLE_NAME, port_key, "dscp_to_tc_map", CFG_DSCP_TO_TC_MAP_TABLE_NAME, "AZURE_SHARED_0");
+
+        Port port;
+        sai_attribute_t attr;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
+        attr.id = SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP;
+        ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, shared_object);
+
+        // Modifying a shared map moves it and its ports to another object, the other names keep the shared one
+        auto current_sai_remove_qos_map_count = sai_remove_qos_map_count;
+        entries.push_back({"AZURE_SHARED_0", "SET",
+                           {
+                               {"2", "3"}
+                           }});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        auto moved_object = dscpToTcMaps["AZURE_SHARED_0"].m_saiObjectId;
+        ASSERT_NE(moved_object, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(moved_object, shared_object);
+        ASSERT_EQ(dscpToTcMaps["AZURE_SHARED_1"].m_saiObjectId, shared_object);
+        ASSERT_EQ(current_sai_remove_qos_map_count, sai_remove_qos_map_count);
+        ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, moved_object);
+
+        // The shared object is removed along with the last name using it
+        for (size_t i = 1; i < map_count; i++)
+        {
+            entries.push_back({"AZURE_SHARED_" + to_string(i), "DEL", {}});
+        }
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_EQ(current_sai_remove_qos_map_count + 1, sai_remove_qos_map_count);
+        ASSERT_EQ(dscpToTcMaps.count("AZURE_SHARED_1"), 0);
+    }
+
+    TEST_F(QosOrchTest, QosOrchTestUnsharedQosMapReferencedByTunnel)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto dscpToTcMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_DSCP_TO_TC_MAP_TABLE_NAME));
+        entries.push_back({"AZURE_TUNNEL", "SET", {{"4", "4"}}});
+        entries.push_back({"AZURE_OTHER", "SET", {{"5", "5"}}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        auto &dscpToTcMaps = (*QosOrch::getTypeMap()[CFG_DSCP_TO_TC_MAP_TABLE_NAME]);
+        auto tunnel_object = dscpToTcMaps["AZURE_TUNNEL"].m_saiObjectId;
+        auto other_object = dscpToTcMaps["AZURE_OTHER"].m_saiObjectId;
+        ASSERT_NE(tunnel_object, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(tunnel_object, other_object);
+
+        // Reference the map from a tunnel, which can't be moved to another QoS map object
+        entries.push_back({"MuxTunnel0", "SET",
+                           {
+                               {"decap_dscp_to_tc_map", "AZURE_TUNNEL"},
+                               {"dscp_mode", "pipe"},
+                               {"dst_ip", "10.1.0.32"},
+                               {"src_ip", "10.1.0.33"},
+                               {"ttl_mode", "pipe"},
+                               {"tunnel_type", "IPINIP"}
+                           }});
+        auto tunnelConsumer = dynamic_cast<Consumer *>(tunnel_decap_orch->getExecutor(APP_TUNNEL_DECAP_TABLE_NAME));
+        tunnelConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(tunnel_decap_orch)->doTask();
+        ASSERT_FALSE(gQosOrch->canRebindQosMap(CFG_DSCP_TO_TC_MAP_TABLE_NAME, "AZURE_TUNNEL"));
+
+        // Setting the unshared map to the content of another map modifies it in place instead of retrying
+        auto current_sai_remove_qos_map_count = sai_remove_qos_map_count;
+        entries.push_back({"AZURE_TUNNEL", "SET", {{"5", "5"}}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_TRUE(dscpToTcMapConsumer->m_toSync.empty());
+        ASSERT_EQ(dscpToTcMaps["AZURE_TUNNEL"].m_saiObjectId, tunnel_object);
+        ASSERT_EQ(dscpToTcMaps["AZURE_OTHER"].m_saiObjectId, other_object);
+        ASSERT_EQ(current_sai_remove_qos_map_count, sai_remove_qos_map_count);
+
+        // Each object is still removed along with its own map
+        entries.push_back({"AZURE_OTHER", "DEL", {}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_EQ(current_sai_remove_qos_map_count + 1, sai_remove_qos_map_count);
+        ASSERT_EQ(dscpToTcMaps["AZURE_TUNNEL"].m_saiObjectId, tunnel_object);
+    }
+
+    TEST_F(QosOrchTest, QosOrchTestSharedQosMapReferencedByTunnel)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto dscpToTcMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_DSCP_TO_TC_MAP_TABLE_NAME));
+        entries.push_back({"AZURE_TUNNEL_SHARED", "SET", {{"6", "6"}}});
+        entries.push_back({"AZURE_PORT_SHARED", "SET", {{"6", "6"}}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        auto &dscpToTcMaps = (*QosOrch::getTypeMap()[CFG_DSCP_TO_TC_MAP_TABLE_NAME]);
+        auto shared_object = dscpToTcMaps["AZURE_TUNNEL_SHARED"].m_saiObjectId;
+        ASSERT_NE(shared_object, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(dscpToTcMaps["AZURE_PORT_SHARED"].m_saiObjectId, shared_object);
+
+        // Bind the map to a port as well
+        auto portQosMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        entries.push_back({"Ethernet0", "SET", {{"dscp_to_tc_map", "AZURE_TUNNEL_SHARED"}}});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        // Referencing the map from a tunnel moves it and its port to an object of its own
+        entries.push_back({"MuxTunnel2", "SET",
+                           {
+                               {"decap_dscp_to_tc_map", "AZURE_TUNNEL_SHARED"},
+                               {"dscp_mode", "pipe"},
+                               {"dst_ip", "10.1.0.32"},
+                               {"src_ip", "10.1.0.33"},
+                               {"ttl_mode", "pipe"},
+                               {"tunnel_type", "IPINIP"}
+                           }});
+        auto tunnelConsumer = dynamic_cast<Consumer *>(tunnel_decap_orch->getExecutor(APP_TUNNEL_DECAP_TABLE_NAME));
+        tunnelConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(tunnel_decap_orch)->doTask();
+        auto tunnel_object = dscpToTcMaps["AZURE_TUNNEL_SHARED"].m_saiObjectId;
+        ASSERT_NE(tunnel_object, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(tunnel_object, shared_object);
+        ASSERT_EQ(dscpToTcMaps["AZURE_PORT_SHARED"].m_saiObjectId, shared_object);
+
+        Port port;
+        sai_attribute_t attr;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
+        attr.id = SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP;
+        ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, tunnel_object);
+
+        // A new map of the same content doesn't share the object of the tunnel
+        entries.push_back({"AZURE_NEW_SHARED", "SET", {{"6", "6"}}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_EQ(dscpToTcMaps["AZURE_NEW_SHARED"].m_saiObjectId, shared_object);
+
+        // Setting the map modifies its object in place instead of retrying
+        auto current_sai_remove_qos_map_count = sai_remove_qos_map_count;
+        entries.push_back({"AZURE_TUNNEL_SHARED", "SET", {{"6", "7"}}});
+        dscpToTcMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_TRUE(dscpToTcMapConsumer->m_toSync.empty());
+        ASSERT_EQ(dscpToTcMaps["AZURE_TUNNEL_SHARED"].m_saiObjectId, tunnel_object);
+        ASSERT_EQ(dscpToTcMaps["AZURE_PORT_SHARED"].m_saiObjectId, shared_object);
+        ASSERT_EQ(current_sai_remove_qos_map_count, sai_remove_qos_map_count);
+    }
 }
@@ -0,0 +1,149 @@
+#include "ut_helper.h"
+#include "saiprofiler.h"
+
+extern sai_mirror_api_t *sai_mirror_api;
+extern sai_nat_api_t *sai_nat_api;
+extern sai_bfd_api_t *sai_bfd_api;
+extern sai_srv6_api_t *sai_srv6_api;
+extern sai_bulk_object_create_fn sai_bulk_create_acl_entries;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_entries;
+extern sai_bulk_object_create_fn sai_bulk_create_acl_counters;
+extern sai_bulk_object_remove_fn sai_bulk_remove_acl_counters;
+
+/* The API pointers redirected by SaiProfiler::hookApis() */
+#define SAI_PROFILER_UT_APIS(X) \
+    X(switch) X(bridge) X(virtual_router) X(port) X(vlan) X(router_intfs) X(hostif) \
+    X(neighbor) X(next_hop) X(next_hop_group) X(route) X(mpls) X(lag) X(policer) \
+    X(tunnel) X(queue) X(scheduler) X(scheduler_group) X(wred) X(qos_map) X(buffer) \
+    X(acl) X(mirror) X(fdb) X(counter) X(nat) X(bfd) X(srv6)
+
+namespace saiprofiler_test
+{
+    using namespace std;
+
+    sai_status_t create_route_entry(const sai_route_entry_t *route_entry, uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t create_bfd_session(sai_object_id_t *session_id, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t bulk_object_create(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                    const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                    sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct SaiProfilerTest : public ::testing::Test
+    {
+#define SAI_PROFILER_UT_SAVED(api) decltype(sai_##api##_api) m_saved_##api;
+        SAI_PROFILER_UT_APIS(SAI_PROFILER_UT_SAVED)
+#undef SAI_PROFILER_UT_SAVED
+        sai_route_api_t m_routeApi;
+        sai_bfd_api_t m_bfdApi;
+        sai_bulk_object_create_fn m_savedBulkCreateAclEntries;
+        sai_bulk_object_remove_fn m_savedBulkRemoveAclEntries;
+        sai_bulk_object_create_fn m_savedBulkCreateAclCounters;
+        sai_bulk_object_remove_fn m_savedBulkRemoveAclCounters;
+
+        void SetUp() override
+        {
+#define SAI_PROFILER_UT_SAVE(api) m_saved_##api = sai_##api##_api;
+            SAI_PROFILER_UT_APIS(SAI_PROFILER_UT_SAVE)
+#undef SAI_PROFILER_UT_SAVE
+            m_savedBulkCreateAclEntries = sai_bulk_create_acl_entries;
+            m_savedBulkRemoveAclEntries = sai_bulk_remove_acl_entries;
+            m_savedBulkCreateAclCounters = sai_bulk_create_acl_counters;
+            m_savedBulkRemoveAclCounters = sai_bulk_remove_acl_counters;
+
+            m_routeApi = {};
+            m_routeApi.create_route_entry = create_route_entry;
+            sai_route_api = &m_routeApi;
+
+            m_bfdApi = {};
+            m_bfdApi.create_bfd_session = create_bfd_session;
+            sai_bfd_api = &m_bfdApi;
+        }
+
+        void TearDown() override
+        {
+            // hookApis() moves every API pointer to a hooked copy, restore them for the other tests
+#define SAI_PROFILER_UT_RESTORE(api) sai_##api##_api = m_saved_##api;
+            SAI_PROFILER_UT_APIS(SAI_PROFILER_UT_RESTORE)
+#undef SAI_PROFILER_UT_RESTORE
+            sai_bulk_create_acl_entries = m_savedBulkCreateAclEntries;
+            sai_bulk_remove_acl_entries = m_savedBulkRemoveAclEntries;
+            sai_bulk_create_acl_counters = m_savedBulkCreateAclCounters;
+            sai_bulk_remove_acl_counters = m_savedBulkRemoveAclCounters;
+        }
+    };
+
+    TEST_F(SaiProfilerTest, HookedCallsAreCountedAndExported)
+    {
+        SaiProfiler::hookApis();
+
+        // The read-only table is replaced by a hooked copy
+        ASSERT_NE(sai_route_api, &m_routeApi);
+        ASSERT_NE(sai_route_api->create_route_entry, create_route_entry);
+        ASSERT_EQ(sai_route_api->remove_route_entry, nullptr);
+
+        auto count = SaiProfiler::getCallCount(SAI_OBJECT_TYPE_ROUTE_ENTRY, SaiProfiler::Op::CREATE);
+
+        sai_route_entry_t route_entry = {};
+        ASSERT_EQ(sai_route_api->create_route_entry(&route_entry, 0, nullptr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(SaiProfiler::getCallCount(SAI_OBJECT_TYPE_ROUTE_ENTRY, SaiProfiler::Op::CREATE), count + 1);
+
+        // Hooking again doesn't wrap the hooks
+        SaiProfiler::hookApis();
+        ASSERT_EQ(sai_route_api->create_route_entry(&route_entry, 0, nullptr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(SaiProfiler::getCallCount(SAI_OBJECT_TYPE_ROUTE_ENTRY, SaiProfiler::Op::CREATE), count + 2);
+
+        swss::DBConnector countersDb("COUNTERS_DB", 0);
+        swss::Table profilerTable(&countersDb, SAI_PROFILER_TABLE);
+        SaiProfiler::exportCounters(profilerTable);
+
+        string value;
+        ASSERT_TRUE(profilerTable.hget("SAI_OBJECT_TYPE_ROUTE_ENTRY:create", "count", value));
+        ASSERT_EQ(value, to_string(count + 2));
+        ASSERT_TRUE(profilerTable.hget("SAI_OBJECT_TYPE_ROUTE_ENTRY:create", "histogram", value));
+        ASSERT_FALSE(value.empty());
+    }
+
+    TEST_F(SaiProfilerTest, BfdSessionCallsAreCounted)
+    {
+        SaiProfiler::hookApis();
+
+        ASSERT_NE(sai_bfd_api, &m_bfdApi);
+        ASSERT_NE(sai_bfd_api->create_bfd_session, create_bfd_session);
+
+        auto count = SaiProfiler::getCallCount(SAI_OBJECT_TYPE_BFD_SESSION, SaiProfiler::Op::CREATE);
+
+        sai_object_id_t session_id;
+        ASSERT_EQ(sai_bfd_api->create_bfd_session(&session_id, 0, 0, nullptr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(SaiProfiler::getCallCount(SAI_OBJECT_TYPE_BFD_SESSION, SaiProfiler::Op::CREATE), count + 1);
+    }
+
+    TEST_F(SaiProfilerTest, AclBulkCallsAreCounted)
+    {
+        sai_bulk_create_acl_entries = bulk_object_create;
+        SaiProfiler::hookApis();
+
+        // The generic bulk function is hooked for the ACL entries
+        ASSERT_NE(sai_bulk_create_acl_entries, bulk_object_create);
+
+        auto count = SaiProfiler::getCallCount(SAI_OBJECT_TYPE_ACL_ENTRY, SaiProfiler::Op::BULK_CREATE);
+
+        sai_object_id_t object_id;
+        sai_status_t object_status;
+        uint32_t attr_count = 0;
+        const sai_attribute_t *attr_list = nullptr;
+        ASSERT_EQ(sai_bulk_create_acl_entries(0, SAI_OBJECT_TYPE_ACL_ENTRY, 1, &attr_count, &attr_list,
+                                              SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, &object_id, &object_status),
+                  SAI_STATUS_SUCCESS);
+        ASSERT_EQ(SaiProfiler::getCallCount(SAI_OBJECT_TYPE_ACL_ENTRY, SaiProfiler::Op::BULK_CREATE), count + 1);
+    }
+}
@@ -0,0 +1,348 @@
+#include "gtest/gtest.h"
+#include <cerrno>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "dbconnector.h"
+#include "table.h"
+#include "mock_table.h"
+#include "json_scanner.h"
+#include "teamdctl_mgr.h"
+#include "values_store.h"
+
+/*
+ * Fake libteamdctl keeping the json dump of each teamd.
+ * The functions are wrapped with -Wl,-wrap, see tests_tlm_teamd_CXXFLAGS.
+ */
+namespace fake_teamd
+{
+    std::map<std::string, std::string> dumps;
+    std::set<std::string> failingDumps;
+    std::map<struct teamdctl *, std::string> connections;
+    std::map<std::string, size_t> dumpCount;
+
+    void reset()
+    {
+        dumps.clear();
+        failingDumps.clear();
+        dumpCount.clear();
+    }
+}
+
+extern "C"
+{
+
+struct teamdctl *__wrap_teamdctl_alloc(void)
+{
+    return static_cast<struct teamdctl *>(calloc(1, 1));
+}
+
+void __wrap_teamdctl_free(struct teamdctl *tdc)
+{
+    free(tdc);
+}
+
+void __wrap_teamdctl_set_log_fn(struct teamdctl *tdc,
+                                void (*log_fn)(struct teamdctl *tdc, int priority,
+                                               const char *file, int line,
+                                               const char *fn, const char *format,
+                                               va_list args))
+{
+}
+
+int __wrap_teamdctl_connect(struct teamdctl *tdc, const char *team_name, const char *addr, const char *cli_type)
+{
+    if (fake_teamd::dumps.find(team_name) == fake_teamd::dumps.end())
+    {
+        return -ENOENT;
+    }
+
+    fake_teamd::connections[tdc] = team_name;
+    return 0;
+}
+
+void __wrap_teamdctl_disconnect(struct teamdctl *tdc)
+{
+    fake_teamd::connections.erase(tdc);
+}
+
+int __wrap_teamdctl_state_get_raw_direct(struct teamdctl *tdc, char **p_cont)
+{
+    const auto &lag_name = fake_teamd::connections.at(tdc);
+    fake_teamd::dumpCount[lag_name]++;
+    if (fake_teamd::failingDumps.count(lag_name))
+    {
+        return -EIO;
+    }
+
+    *p_cont = const_cast<char *>(fake_teamd::dumps.at(lag_name).c_str());
+    return 0;
+}
+
+}
+
+namespace tlm_teamd_ut
+{
+    using namespace std;
+
+    /* A teamd dump with the published fields and some of the fields which are not published */
+    string makeMember(const string &port, int ifindex, bool up, const string &state = "current")
+    {
+        string upStr = up ? "true" : "false";
+        return "\"" + port + "\": {"
+               "\"ifinfo\": {\"dev_addr\": \"52:54:00:12:34:56\", \"dev_addr_len\": 6, \"ifindex\": " + to_string(ifindex) + ", \"ifname\": \"" + port + "\"},"
+               "\"link\": {\"duplex\": \"full\", \"speed\": 100000, \"up\": " + upStr + "},"
+               "\"link_watches\": {\"list\": {\"link_watch_0\": {\"delay_down\": 0, \"delay_up\": 0, \"down_count\": 0, \"name\": \"ethtool\", \"up\": " + upStr + "}}, \"up\": " + upStr + "},"
+               "\"runner\": {"
+                   "\"actor_lacpdu_info\": {\"key\": 1, \"port\": " + to_string(ifindex) + ", \"port_priority\": 255, \"state\": 61, \"system\": \"52:54:00:12:34:56\", \"system_priority\": 65535},"
+                   "\"aggregator\": {\"id\": 5, \"selected\": true},"
+                   "\"key\": 1,"
+                   "\"partner_lacpdu_info\": {\"key\": 1, \"port\": 1, \"port_priority\": 255, \"state\": 61, \"system\": \"22:48:23:2a:bd:c4\", \"system_priority\": 65535},"
+                   "\"prio\": 255,"
+                   "\"selected\": true,"
+                   "\"state\": \"" + state + "\""
+               "}"
+               "}";
+    }
+
+    string makeDump(const string &lag, const vector<string> &members, int pid = 42, const string &comment = "")
+    {
+        string ports;
+        for (const auto &member : members)
+        {
+            ports += (ports.empty() ? "" : ",") + member;
+        }
+
+        return "{"
+               "\"ports\": {" + ports + "},"
+               "\"runner\": {\"active\": true, \"fallback\": false, \"fast_rate\": false, \"sys_prio\": 65535,"
+                   "\"tx_hash\": [\"eth\", \"ipv4\", \"ipv6\"]},"
+               "\"setup\": {\"daemonized\": false, \"dbus_enabled\": false, \"debug_level\": 0,"
+                   "\"kernel_team_mode_name\": \"loadbalance\", \"pid\": " + to_string(pid) + ", \"pid_file\": \"/var/run/teamd/" + lag + ".pid\","
+                   "\"runner_name\": \"lacp\", \"zmq_enabled\": false},"
+               "\"team_device\": {\"ifinfo\": {\"dev_addr\": \"52:54:00:12:34:56\", \"dev_addr_len\": 6, \"ifindex\": 17, \"ifname\": \"" + lag + "\"}},"
+               "\"comment\": \"" + comment + "\""
+               "}";
+    }
+
+    TEST(JsonScanner, PublishedValuesAreExtracted)
+    {
+        JsonScanner scanner;
+        scanner.add_path("a.b");
+        scanner.add_path("a.c");
+        scanner.add_path("list.*.x");
+
+        auto res = scanner.scan("{\"skip\": {\"z\": [1, {\"q\": \"}]\\\"{\"}], \"a\": 1}, \"a\": {\"b\": \"s\\u00e9\\n\", \"c\": -17, \"d\": [true]},"
+                                " \"list\": {\"k1\": {\"x\": true, \"y\": 1}, \"k2\": {\"x\": null}}}");
+
+        ASSERT_EQ(res.values.size(), 4u);
+        ASSERT_EQ(res.values["a.b"].type, JsonScanner::value_type::string);
+        ASSERT_EQ(res.values["a.b"].text, "s\xc3\xa9\n");
+        ASSERT_EQ(res.values["a.c"].type, JsonScanner::value_type::integer);
+        ASSERT_EQ(res.values["a.c"].text, "-17");
+        ASSERT_EQ(res.values["list.k1.x"].type, JsonScanner::value_type::boolean);
+        ASSERT_EQ(res.values["list.k1.x"].text, "true");
+        ASSERT_EQ(res.values["list.k2.x"].type, JsonScanner::value_type::other);
+        ASSERT_EQ(res.keys["list"], vector<string>({ "k1", "k2" }));
+        ASSERT_EQ(res.values.count("skip.a"), 0u);
+    }
+
+    TEST(JsonScanner, MalformedDumpThrows)
+    {
+        JsonScanner scanner;
+        scanner.add_path("a.b");
+
+        ASSERT_THROW(scanner.scan("{\"a\": {\"b\": 1}"), std::runtime_error);
+        ASSERT_THROW(scanner.scan("{\"a\": {\"b\": 1}} x"), std::runtime_error);
+        ASSERT_THROW(scanner.scan("{\"skip\": [\"unterminated}"), std::runtime_error);
+        ASSERT_THROW(scanner.scan("{\"a\": {\"b\": \"\\x\"}}"), std::runtime_error);
+    }
+
+    struct TeamdCtlMgrTest : public ::testing::Test
+    {
+        void SetUp() override
+        {
+            fake_teamd::reset();
+        }
+    };
+
+    TEST_F(TeamdCtlMgrTest, EveryLagIsPolledOncePerInterval)
+    {
+        TeamdCtlMgr mgr;
+        for (const auto &lag : { "PortChannel1", "PortChannel2", "PortChannel3", "PortChannel4", "PortChannel5" })
+        {
+            fake_teamd::dumps[lag] = makeDump(lag, {});
+            ASSERT_TRUE(mgr.add_lag(lag));
+        }
+
+        // The new LAGs are dumped right away
+        ASSERT_EQ(mgr.get_lags_to_poll(3).size(), 5u);
+
+        // Then each of them once per 3 slices
+        map<string, int> polled;
+        for (int i = 0; i < 3; i++)
+        {
+            auto lags = mgr.get_lags_to_poll(3);
+            ASSERT_LE(lags.size(), 2u);
+            for (const auto &lag : lags)
+            {
+                polled[lag]++;
+            }
+        }
+        ASSERT_EQ(polled.size(), 5u);
+        for (const auto &p : polled)
+        {
+            ASSERT_LE(p.second, 2);
+        }
+    }
+
+    TEST_F(TeamdCtlMgrTest, ChangedLagIsPolledOnNextSlice)
+    {
+        TeamdCtlMgr mgr;
+        for (const auto &lag : { "PortChannel1", "PortChannel2", "PortChannel3", "PortChannel4" })
+        {
+            fake_teamd::dumps[lag] = makeDump(lag, {});
+            ASSERT_TRUE(mgr.add_lag(lag));
+        }
+        mgr.get_lags_to_poll(4);
+
+        auto lags = mgr.get_lags_to_poll(4);
+        ASSERT_EQ(lags, vector<string>({ "PortChannel2" }));
+
+        // The changed LAG is dumped before its turn
+        mgr.set_changed("PortChannel1");
+        mgr.set_changed("PortChannel9");
+        lags = mgr.get_lags_to_poll(4);
+        ASSERT_EQ(lags, vector<string>({ "PortChannel1", "PortChannel3" }));
+
+        mgr.remove_lag("PortChannel3");
+        lags = mgr.get_lags_to_poll(4);
+        ASSERT_EQ(lags.size(), 1u);
+        ASSERT_NE(lags[0], "PortChannel3");
+    }
+
+    TEST_F(TeamdCtlMgrTest, FailedDumpsAreSkipped)
+    {
+        TeamdCtlMgr mgr;
+        fake_teamd::dumps["PortChannel1"] = makeDump("PortChannel1", {});
+        fake_teamd::dumps["PortChannel2"] = makeDump("PortChannel2", {});
+        ASSERT_TRUE(mgr.add_lag("PortChannel1"));
+        ASSERT_TRUE(mgr.add_lag("PortChannel2"));
+        ASSERT_FALSE(mgr.add_lag("PortChannel3"));
+
+        fake_teamd::failingDumps.insert("PortChannel2");
+        auto dumps = mgr.get_dumps({ "PortChannel1", "PortChannel2" }, true);
+        ASSERT_EQ(dumps.size(), 1u);
+        ASSERT_EQ(dumps[0].first, "PortChannel1");
+        ASSERT_EQ(dumps[0].second, fake_teamd::dumps["PortChannel1"]);
+        ASSERT_EQ(fake_teamd::dumpCount["PortChannel2"], 1u);
+    }
+
+    struct ValuesStoreTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_state_db;
+        shared_ptr<swss::Table> m_lag_table;
+        shared_ptr<swss::Table> m_member_table;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_lag_table = make_shared<swss::Table>(m_state_db.get(), "LAG_TABLE");
+            m_member_table = make_shared<swss::Table>(m_state_db.get(), "LAG_MEMBER_TABLE");
+        }
+
+        map<string, string> get(swss::Table &table, const string &key)
+        {
+            vector<swss::FieldValueTuple> fvs;
+            map<string, string> res;
+            if (table.get(key, fvs))
+            {
+                res.insert(fvs.begin(), fvs.end());
+            }
+            return res;
+        }
+
+        vector<string> keys(swss::Table &table)
+        {
+            vector<string> res;
+            table.getKeys(res);
+            return res;
+        }
+    };
+
+    TEST_F(ValuesStoreTest, PublishedFieldsAreWritten)
+    {
+        ValuesStore store(m_state_db.get());
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true), makeMember("Ethernet4", 11, false) }) } },
+                     { "PortChannel1" });
+
+        auto lag = get(*m_lag_table, "PortChannel1");
+        ASSERT_EQ(lag.size(), 7u);
+        ASSERT_EQ(lag["setup.kernel_team_mode_name"], "loadbalance");
+        ASSERT_EQ(lag["setup.pid"], "42");
+        ASSERT_EQ(lag["runner.active"], "true");
+        ASSERT_EQ(lag["team_device.ifinfo.ifindex"], "17");
+
+        ASSERT_EQ(keys(*m_member_table), vector<string>({ "PortChannel1|Ethernet0", "PortChannel1|Ethernet4" }));
+        auto member = get(*m_member_table, "PortChannel1|Ethernet4");
+        ASSERT_EQ(member.size(), 14u);
+        ASSERT_EQ(member["ifinfo.ifindex"], "11");
+        ASSERT_EQ(member["link.up"], "false");
+        ASSERT_EQ(member["link_watches.list.link_watch_0.up"], "false");
+        ASSERT_EQ(member["runner.partner_lacpdu_info.system"], "22:48:23:2a:bd:c4");
+        ASSERT_EQ(member["runner.state"], "current");
+        ASSERT_EQ(member.count("runner.prio"), 0u);
+    }
+
+    TEST_F(ValuesStoreTest, OnlyChangedFieldsAreWritten)
+    {
+        ValuesStore store(m_state_db.get());
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true) }) } }, { "PortChannel1" });
+
+        // The fields which aren't published are changed
+        testing_db::reset();
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true) }, 42, "changed") } }, { "PortChannel1" });
+        ASSERT_TRUE(keys(*m_lag_table).empty());
+        ASSERT_TRUE(keys(*m_member_table).empty());
+
+        testing_db::reset();
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true, "expired") }, 43) } }, { "PortChannel1" });
+        ASSERT_EQ(get(*m_lag_table, "PortChannel1"), (map<string, string>{ { "setup.pid", "43" } }));
+        ASSERT_EQ(get(*m_member_table, "PortChannel1|Ethernet0"), (map<string, string>{ { "runner.state", "expired" } }));
+    }
+
+    TEST_F(ValuesStoreTest, RemovedMemberIsDeleted)
+    {
+        ValuesStore store(m_state_db.get());
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true), makeMember("Ethernet4", 11, true) }) } },
+                     { "PortChannel1" });
+        store.update({ { "PortChannel1", makeDump("PortChannel1", { makeMember("Ethernet0", 10, true) }) } }, { "PortChannel1" });
+        ASSERT_EQ(keys(*m_member_table), vector<string>({ "PortChannel1|Ethernet0" }));
+
+        store.remove_lag("PortChannel1");
+        ASSERT_TRUE(keys(*m_lag_table).empty());
+        ASSERT_TRUE(keys(*m_member_table).empty());
+    }
+
+    TEST_F(ValuesStoreTest, DumpWithoutPublishedFieldIsIgnored)
+    {
+        ValuesStore store(m_state_db.get());
+        auto dump = makeDump("PortChannel1", { makeMember("Ethernet0", 10, true) });
+        auto pos = dump.find("\"fast_rate\": false, ");
+        ASSERT_NE(pos, string::npos);
+        dump.erase(pos, strlen("\"fast_rate\": false, "));
+
+        store.update({ { "PortChannel1", dump } }, { "PortChannel1" });
+        ASSERT_TRUE(keys(*m_lag_table).empty());
+        ASSERT_TRUE(keys(*m_member_table).empty());
+
+        store.update({ { "PortChannel1", "{\"ports\": " } }, { "PortChannel1" });
+        ASSERT_TRUE(keys(*m_lag_table).empty());
+    }
+}
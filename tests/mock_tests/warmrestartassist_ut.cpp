@@ -1,3 +1,6 @@
+#include <set>
+#include <cstring>
+#include <hiredis/hiredis.h>
 #define protected public
 #include "orch.h"
 #undef protected
@@ -5,12 +8,16 @@
 //#include "mock_orchagent_main.h"
 #include "mock_table.h"
 #include "warm_restart.h"
+#include "tablereader.h"
 #define private public
 #include "warmRestartAssist.h"
 #undef private
 
 #define APP_WRA_TEST_TABLE_NAME "TEST_TABLE"
 
+extern std::map<std::string, size_t> mockCommandCount;
+extern redisReply *mockReply;
+
 namespace warmrestartassist_test
 {
     using namespace std;
@@ -33,6 +40,7 @@ namespace warmrestartassist_test
         void SetUp() override
         {
             testing_db::reset();
+            mockCommandCount.clear();
 
             Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
             testTable.set("key",
@@ -61,4 +69,115 @@ namespace warmrestartassist_test
         ASSERT_EQ(fvField(fvVector[0]), "field");
         ASSERT_EQ(fvValue(fvVector[0]), "value1");
     }
+
+    TEST_F(WarmrestartassistTest, tableReaderBatchTest)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        for (int i = 1; i < 5; i++)
+        {
+            testTable.set("key" + to_string(i), { {"field", "value" + to_string(i)} });
+        }
+
+        TableReader reader(m_app_db.get(), APP_WRA_TEST_TABLE_NAME, 2);
+        deque<KeyOpFieldsValuesTuple> entries;
+        map<string, string> values;
+        size_t batches = 0;
+
+        while (reader.next(entries))
+        {
+            ASSERT_LE(entries.size(), 2u);
+            batches++;
+            for (const auto &entry : entries)
+            {
+                ASSERT_EQ(kfvOp(entry), SET_COMMAND);
+                values[kfvKey(entry)] = fvValue(kfvFieldsValues(entry)[0]);
+            }
+        }
+
+        ASSERT_EQ(batches, 3u);
+        ASSERT_EQ(reader.count(), 5u);
+        ASSERT_EQ(values.size(), 5u);
+        ASSERT_EQ(values["key"], "value0");
+        ASSERT_EQ(values["key4"], "value4");
+
+        // Keys are iterated by SCAN over three cursors, their HGETALL are pipelined by batch
+        ASSERT_EQ(mockCommandCount["SCAN"], 3u);
+        ASSERT_EQ(mockCommandCount["HGETALL"], 5u);
+
+        appRestartAssist->readTablesToMap();
+        ASSERT_EQ(appRestartAssist->appTableCacheMap[APP_WRA_TEST_TABLE_NAME].size(), 5u);
+    }
+
+    TEST_F(WarmrestartassistTest, tableReaderScanCursorTest)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        for (int i = 1; i < 10; i++)
+        {
+            testTable.set("key" + to_string(i), { {"field", "value" + to_string(i)} });
+        }
+
+        // The table spans three SCAN cursors, one per batch
+        TableReader reader(m_app_db.get(), APP_WRA_TEST_TABLE_NAME, 4);
+        deque<KeyOpFieldsValuesTuple> entries;
+        vector<size_t> batchSizes;
+        set<string> keys;
+
+        while (reader.next(entries))
+        {
+            batchSizes.push_back(entries.size());
+            for (const auto &entry : entries)
+            {
+                ASSERT_TRUE(keys.insert(kfvKey(entry)).second);
+            }
+        }
+
+        ASSERT_EQ(batchSizes, vector<size_t>({4, 4, 2}));
+        ASSERT_EQ(keys.size(), 10u);
+        ASSERT_EQ(reader.count(), 10u);
+        ASSERT_EQ(mockCommandCount["SCAN"], 3u);
+        ASSERT_EQ(mockCommandCount["HGETALL"], 10u);
+
+        // Keys which don't exist are skipped
+        reader.read({"key1", "missing", "key9"}, entries);
+        ASSERT_EQ(entries.size(), 2u);
+        ASSERT_EQ(kfvKey(entries[0]), "key1");
+        ASSERT_EQ(kfvKey(entries[1]), "key9");
+        ASSERT_EQ(mockCommandCount["HGETALL"], 13u);
+    }
+
+    TEST_F(WarmrestartassistTest, tableReaderScanUnavailableTest)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        for (int i = 1; i < 3; i++)
+        {
+            testTable.set("key" + to_string(i), { {"field", "value" + to_string(i)} });
+        }
+
+        // The server answers the first SCAN with an error, the table is read by KEYS
+        const char *error = "ERR unknown command 'SCAN'";
+        mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+        mockReply->type = REDIS_REPLY_ERROR;
+        mockReply->str = strdup(error);
+        mockReply->len = strlen(error);
+
+        TableReader reader(m_app_db.get(), APP_WRA_TEST_TABLE_NAME, 2);
+        deque<KeyOpFieldsValuesTuple> entries;
+        set<string> keys;
+
+        ASSERT_TRUE(reader.next(entries));
+        mockReply = nullptr;
+        do
+        {
+            ASSERT_LE(entries.size(), 2u);
+            for (const auto &entry : entries)
+            {
+                keys.insert(kfvKey(entry));
+            }
+        } while (reader.next(entries));
+
+        ASSERT_EQ(keys, set<string>({"key", "key1", "key2"}));
+        ASSERT_EQ(reader.count(), 3u);
+        ASSERT_EQ(mockCommandCount["SCAN"], 0u);
+        ASSERT_EQ(mockCommandCount["HGETALL"], 0u);
+    }
 }
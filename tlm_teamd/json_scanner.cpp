@@ -0,0 +1,302 @@
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+#include "json_scanner.h"
+
+///
+/// Add a path to extract
+/// @param path a path in format "key1.key2.key3". The key "*" matches any key
+///
+void JsonScanner::add_path(const std::string & path)
+{
+    node * cur = &m_root;
+    size_t last = 0, next = 0;
+    do
+    {
+        next = path.find('.', last);
+        const auto & key = path.substr(last, next == std::string::npos ? std::string::npos : next - last);
+        auto & child = (key == "*") ? cur->any : cur->children[key];
+        if (!child)
+        {
+            child = std::make_unique<node>();
+        }
+        cur = child.get();
+        last = next + 1;
+    }
+    while (next != std::string::npos);
+
+    cur->leaf = true;
+}
+
+///
+/// Extract the values of the added paths from a json text
+/// @param data a json text
+/// @return the values found and the keys matched by the wildcards
+///
+JsonScanner::result JsonScanner::scan(const std::string & data) const
+{
+    result res;
+    const char * p = data.c_str();
+    const char * end = p + data.size();
+
+    try
+    {
+        scan_value(p, end, &m_root, "", res);
+        skip_spaces(p, end);
+        if (p != end)
+        {
+            throw std::runtime_error("trailing characters");
+        }
+    }
+    catch (const std::exception & e)
+    {
+        throw std::runtime_error("Can't parse json dump = '" + data + "': " + e.what());
+    }
+
+    return res;
+}
+
+void JsonScanner::skip_spaces(const char *& p, const char * end)
+{
+    while (p < end && isspace(static_cast<unsigned char>(*p)))
+    {
+        p++;
+    }
+}
+
+void JsonScanner::expect(const char *& p, const char * end, char c)
+{
+    skip_spaces(p, end);
+    if (p == end || *p != c)
+    {
+        throw std::runtime_error(std::string("expected '") + c + "'");
+    }
+    p++;
+}
+
+///
+/// Parse a json string, p points to the opening quote
+/// @return the unescaped string
+///
+std::string JsonScanner::parse_string(const char *& p, const char * end)
+{
+    std::string res;
+
+    expect(p, end, '"');
+    while (p < end && *p != '"')
+    {
+        if (*p != '\\')
+        {
+            res += *p++;
+            continue;
+        }
+
+        if (++p == end)
+        {
+            break;
+        }
+        switch (*p++)
+        {
+            case '"':  res += '"';  break;
+            case '\\': res += '\\'; break;
+            case '/':  res += '/';  break;
+            case 'b':  res += '\b'; break;
+            case 'f':  res += '\f'; break;
+            case 'n':  res += '\n'; break;
+            case 'r':  res += '\r'; break;
+            case 't':  res += '\t'; break;
+            case 'u':
+            {
+                if (end - p < 4)
+                {
+                    throw std::runtime_error("invalid unicode escape");
+                }
+                unsigned long code = std::stoul(std::string(p, 4), nullptr, 16);
+                p += 4;
+                // encoded in utf-8, the surrogate pairs aren't combined
+                if (code < 0x80)
+                {
+                    res += static_cast<char>(code);
+                }
+                else if (code < 0x800)
+                {
+                    res += static_cast<char>(0xc0 | (code >> 6));
+                    res += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                else
+                {
+                    res += static_cast<char>(0xe0 | (code >> 12));
+                    res += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    res += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                break;
+            }
+            default:
+                throw std::runtime_error("invalid escape");
+        }
+    }
+    expect(p, end, '"');
+
+    return res;
+}
+
+///
+/// Skip a json string, p points to the opening quote
+///
+void JsonScanner::skip_string(const char *& p, const char * end)
+{
+    for (p++; p < end && *p != '"'; p++)
+    {
+        if (*p == '\\' && p + 1 < end)
+        {
+            p++;
+        }
+    }
+    expect(p, end, '"');
+}
+
+///
+/// Skip a json value of any type, including its nested values
+///
+void JsonScanner::skip_value(const char *& p, const char * end)
+{
+    skip_spaces(p, end);
+    if (p == end)
+    {
+        throw std::runtime_error("unexpected end");
+    }
+
+    if (*p == '"')
+    {
+        skip_string(p, end);
+        return;
+    }
+
+    if (*p == '{' || *p == '[')
+    {
+        int depth = 0;
+        while (p < end)
+        {
+            if (*p == '"')
+            {
+                skip_string(p, end);
+                continue;
+            }
+            if (*p == '{' || *p == '[')
+            {
+                depth++;
+            }
+            else if ((*p == '}' || *p == ']') && --depth == 0)
+            {
+                p++;
+                return;
+            }
+            p++;
+        }
+        throw std::runtime_error("unterminated object");
+    }
+
+    while (p < end && !isspace(static_cast<unsigned char>(*p)) && !strchr(",}]", *p))
+    {
+        p++;
+    }
+}
+
+///
+/// Parse a json value on one of the paths
+/// @return the value. Its type is value_type::other if it isn't a string, a boolean or an integer
+///
+JsonScanner::value JsonScanner::parse_scalar(const char *& p, const char * end)
+{
+    skip_spaces(p, end);
+    if (p == end)
+    {
+        throw std::runtime_error("unexpected end");
+    }
+
+    if (*p == '"')
+    {
+        return { value_type::string, parse_string(p, end) };
+    }
+
+    const char * begin = p;
+    skip_value(p, end);
+    std::string text(begin, p);
+
+    if (text == "true" || text == "false")
+    {
+        return { value_type::boolean, text };
+    }
+
+    if (!text.empty() && text.find_first_not_of("-0123456789") == std::string::npos)
+    {
+        return { value_type::integer, std::to_string(std::stoll(text)) };
+    }
+
+    return { value_type::other, text };
+}
+
+///
+/// Scan a json value, extracting the values on the paths of the node n
+/// @param n the node of the paths at this value, nullptr if the value isn't on any path
+/// @param path the path of the value
+/// @param res the values found
+///
+void JsonScanner::scan_value(const char *& p, const char * end, const node * n, const std::string & path, result & res)
+{
+    if (n == nullptr)
+    {
+        skip_value(p, end);
+        return;
+    }
+
+    if (n->leaf)
+    {
+        res.values.emplace(path, parse_scalar(p, end));
+        return;
+    }
+
+    skip_spaces(p, end);
+    if (p == end || *p != '{')
+    {
+        skip_value(p, end);
+        return;
+    }
+
+    expect(p, end, '{');
+    skip_spaces(p, end);
+    if (p < end && *p == '}')
+    {
+        p++;
+        return;
+    }
+
+    for (;;)
+    {
+        const auto & key = parse_string(p, end);
+        expect(p, end, ':');
+
+        const node * child = nullptr;
+        const auto & it = n->children.find(key);
+        if (it != n->children.end())
+        {
+            child = it->second.get();
+        }
+        else if (n->any)
+        {
+            child = n->any.get();
+            res.keys[path].push_back(key);
+        }
+
+        scan_value(p, end, child, path.empty() ? key : path + "." + key, res);
+        skip_spaces(p, end);
+        if (p == end || *p != ',')
+        {
+            break;
+        }
+        p++;
+    }
+
+    expect(p, end, '}');
+}
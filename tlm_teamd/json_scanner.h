@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+///
+/// JsonScanner extracts the values of a set of paths from a json text without building
+/// the json tree. The values which are not on any of the paths are skipped, not parsed.
+///
+class JsonScanner
+{
+public:
+    enum class value_type
+    {
+        string,
+        boolean,
+        integer,
+        other,
+    };
+
+    struct value
+    {
+        value_type type;
+        std::string text;
+    };
+
+    struct result
+    {
+        // the scalar values found, by their path with the actual keys
+        std::unordered_map<std::string, value> values;
+        // the keys matched by a wildcard, by the path of their parent object
+        std::unordered_map<std::string, std::vector<std::string>> keys;
+    };
+
+    void add_path(const std::string & path);
+    result scan(const std::string & data) const;
+
+private:
+    struct node
+    {
+        std::unordered_map<std::string, std::unique_ptr<node>> children;
+        std::unique_ptr<node> any;
+        bool leaf = false;
+    };
+
+    node m_root;
+
+    static void skip_spaces(const char *& p, const char * end);
+    static void expect(const char *& p, const char * end, char c);
+    static std::string parse_string(const char *& p, const char * end);
+    static void skip_string(const char *& p, const char * end);
+    static void skip_value(const char *& p, const char * end);
+    static value parse_scalar(const char *& p, const char * end);
+    static void scan_value(const char *& p, const char * end, const node * n, const std::string & path, result & res);
+};
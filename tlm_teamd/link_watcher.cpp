@@ -0,0 +1,62 @@
+#include <cstring>
+
+#include <netlink/route/link.h>
+
+#include <logger.h>
+
+#include "link_watcher.h"
+
+#define TEAM_DRV_NAME "team"
+
+///
+/// Process RTM_NEWLINK and RTM_DELLINK messages
+/// A change of a LAG interface marks the LAG as changed.
+/// A change of a LAG member marks as changed its current LAG and the LAG it was a member of before
+/// @param nlmsg_type type of the netlink message
+/// @param obj a pointer to the rtnl_link object
+///
+void LinkWatcher::onMsg(int nlmsg_type, struct nl_object * obj)
+{
+    if ((nlmsg_type != RTM_NEWLINK) && (nlmsg_type != RTM_DELLINK))
+    {
+        return;
+    }
+
+    struct rtnl_link * link = (struct rtnl_link *)obj;
+    int ifindex = rtnl_link_get_ifindex(link);
+
+    const char * type = rtnl_link_get_type(link);
+    if (type && strcmp(type, TEAM_DRV_NAME) == 0)
+    {
+        const std::string lag_name = rtnl_link_get_name(link);
+        if (nlmsg_type == RTM_DELLINK)
+        {
+            m_lags.erase(ifindex);
+            return;
+        }
+
+        m_lags[ifindex] = lag_name;
+        m_mgr.set_changed(lag_name);
+        return;
+    }
+
+    auto member = m_members.find(ifindex);
+    if (member != m_members.end())
+    {
+        m_mgr.set_changed(member->second);
+        m_members.erase(member);
+    }
+
+    if (nlmsg_type == RTM_DELLINK)
+    {
+        return;
+    }
+
+    auto lag = m_lags.find(rtnl_link_get_master(link));
+    if (lag != m_lags.end())
+    {
+        SWSS_LOG_DEBUG("Link event of LAG '%s' member '%s'", lag->second.c_str(), rtnl_link_get_name(link));
+        m_members[ifindex] = lag->second;
+        m_mgr.set_changed(lag->second);
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <netmsg.h>
+
+#include "teamdctl_mgr.h"
+
+///
+/// Listen to the kernel link events of the LAG interfaces and their members,
+/// and mark the LAG interface as changed in the TeamdCtlMgr, so its state
+/// is dumped without waiting for the next polling interval
+///
+class LinkWatcher : public swss::NetMsg
+{
+public:
+    LinkWatcher(TeamdCtlMgr & mgr) : m_mgr(mgr) {}
+    virtual void onMsg(int nlmsg_type, struct nl_object * obj);
+
+private:
+    TeamdCtlMgr & m_mgr;
+    std::unordered_map<int, std::string> m_lags;     // ifindex of a LAG interface -> LAG name
+    std::unordered_map<int, std::string> m_members;  // ifindex of a LAG member -> LAG name
+};
@@ -6,9 +6,13 @@
 #include <select.h>
 #include <dbconnector.h>
 #include <subscriberstatetable.h>
+#include <selectabletimer.h>
+#include <netdispatcher.h>
+#include <netlink.h>
 
 #include "teamdctl_mgr.h"
 #include "values_store.h"
+#include "link_watcher.h"
 #include "subintf.h"
 
 
@@ -20,8 +24,9 @@ bool g_run = true;
 ///
 /// @param table reference to the SubscriberStateTable
 /// @param mgr   reference to the TeamdCtlMgr
+/// @param values_store reference to the ValuesStore
 ///
-void update_interfaces(swss::SubscriberStateTable & table, TeamdCtlMgr & mgr)
+void update_interfaces(swss::SubscriberStateTable & table, TeamdCtlMgr & mgr, ValuesStore & values_store)
 {
     std::deque<swss::KeyOpFieldsValuesTuple> entries;
 
@@ -43,6 +48,7 @@ void update_interfaces(swss::SubscriberStateTable & table, TeamdCtlMgr & mgr)
         else if (op == "DEL")
         {
             mgr.remove_lag(lag_name);
+            values_store.remove_lag(lag_name);
         }
         else
         {
@@ -66,6 +72,9 @@ void sig_handler(int signo)
 int main()
 {
     const int ms_select_timeout = 1000;
+    // every LAG is dumped once per ms_select_timeout, a slice of them every ms_poll_interval
+    const int ms_poll_interval = 100;
+    const int poll_slices = ms_select_timeout / ms_poll_interval;
 
     sighandler_t sig_res;
 
@@ -93,18 +102,48 @@ int main()
         ValuesStore values_store(&db);
         TeamdCtlMgr teamdctl_mgr;
 
+        LinkWatcher link_watcher(teamdctl_mgr);
+        swss::NetDispatcher::getInstance().registerMessageHandler(RTM_NEWLINK, &link_watcher);
+        swss::NetDispatcher::getInstance().registerMessageHandler(RTM_DELLINK, &link_watcher);
+
         swss::Select s;
         swss::Selectable * event;
         swss::SubscriberStateTable sst_lag(&db, STATE_LAG_TABLE_NAME);
         s.addSelectable(&sst_lag);
 
+        swss::NetLink netlink;
+        netlink.registerGroup(RTNLGRP_LINK);
+        netlink.dumpRequest(RTM_GETLINK);
+        s.addSelectable(&netlink);
+
+        swss::SelectableTimer poll_timer(timespec { .tv_sec = 0, .tv_nsec = ms_poll_interval * 1000000 });
+        s.addSelectable(&poll_timer);
+        poll_timer.start();
+        int poll_ticks = 0;
+
         while (g_run && rc == 0)
         {
             int res = s.select(&event, ms_select_timeout);
-            if (res == swss::Select::OBJECT)
+            if (res == swss::Select::OBJECT && event == &poll_timer)
+            {
+                if (++poll_ticks == poll_slices)
+                {
+                    teamdctl_mgr.process_add_queue();
+                    poll_ticks = 0;
+                }
+                // In the case of lag removal, there is a scenario where the dump is
+                // requested for resource which was in process of getting deleted.
+                // The fix here is to retry and check if this is a real failure.
+                const auto & lag_names = teamdctl_mgr.get_lags_to_poll(poll_slices);
+                values_store.update(teamdctl_mgr.get_dumps(lag_names, true), lag_names);
+            }
+            else if (res == swss::Select::OBJECT && event == &sst_lag)
+            {
+                update_interfaces(sst_lag, teamdctl_mgr, values_store);
+            }
+            else if (res == swss::Select::OBJECT)
             {
-                update_interfaces(sst_lag, teamdctl_mgr);
-                values_store.update(teamdctl_mgr.get_dumps(false));
+                // link events are dispatched to the LinkWatcher, the LAGs are dumped on the next poll
             }
             else if (res == swss::Select::ERROR)
             {
@@ -113,11 +152,7 @@ int main()
             }
             else if (res == swss::Select::TIMEOUT)
             {
-                teamdctl_mgr.process_add_queue();
-                // In the case of lag removal, there is a scenario where the select::TIMEOUT
-                // occurs, it triggers get_dumps incorrectly for resource which was in process of 
-                // getting deleted. The fix here is to retry and check if this is a real failure.
-                values_store.update(teamdctl_mgr.get_dumps(true));
+                // the poll timer fires more often than the select timeout
             }
             else
             {
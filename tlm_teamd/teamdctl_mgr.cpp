@@ -108,6 +108,7 @@ bool TeamdCtlMgr::try_add_lag(const std::string & lag_name)
 
     m_handlers.emplace(lag_name, tdc);
     m_lags_to_add.erase(lag_name);
+    m_lags_changed.insert(lag_name);
     SWSS_LOG_NOTICE("The LAG '%s' has been added.", lag_name.c_str());
 
     return true;
@@ -127,6 +128,7 @@ bool TeamdCtlMgr::remove_lag(const std::string & lag_name)
         teamdctl_disconnect(tdc);
         teamdctl_free(tdc);
         m_handlers.erase(lag_name);
+        m_lags_changed.erase(lag_name);
         SWSS_LOG_NOTICE("The LAG '%s' has been removed.", lag_name.c_str());
     }
     else if (m_lags_to_add.find(lag_name) != m_lags_to_add.end())
@@ -236,25 +238,67 @@ TeamdCtlDump TeamdCtlMgr::get_dump(const std::string & lag_name, bool to_retry)
 }
 
 ///
-/// Get dumps for all registered LAG interfaces
+/// Get dumps for the LAG interfaces with names lag_names
+/// @param lag_names names of the LAG interfaces, they must be registered
+/// @param to_retry is the flag used to do retry or not.
 /// @return vector of pairs. Each pair first value is a name of LAG, second value is a dump
 ///
-TeamdCtlDumps TeamdCtlMgr::get_dumps(bool to_retry)
+TeamdCtlDumps TeamdCtlMgr::get_dumps(const std::vector<std::string> & lag_names, bool to_retry)
 {
     TeamdCtlDumps res;
 
-    for (const auto & p: m_handlers)
+    for (const auto & lag_name: lag_names)
     {
-        const auto & lag_name = p.first;
         const auto & result = get_dump(lag_name, to_retry);
-        const auto & status = result.first;
-        const auto & dump = result.second;
-        if (status)
+        if (result.first)
         {
-            res.push_back({ lag_name, dump });
+            res.push_back({ lag_name, result.second });
         }
     }
 
     return res;
 }
 
+///
+/// Mark the LAG interface with name lag_name as changed, so it is dumped
+/// by the next call of get_lags_to_poll()
+/// @param lag_name a name for LAG interface
+///
+void TeamdCtlMgr::set_changed(const std::string & lag_name)
+{
+    if (has_key(lag_name))
+    {
+        m_lags_changed.insert(lag_name);
+    }
+}
+
+///
+/// Get the LAG interfaces to dump now. The polling interval is divided in slices,
+/// and every registered LAG is returned once per interval, in round robin, so the
+/// dumps are spread across the interval. The LAGs marked as changed are returned
+/// right away.
+/// @param slices number of calls per polling interval
+/// @return names of the LAG interfaces to dump
+///
+std::vector<std::string> TeamdCtlMgr::get_lags_to_poll(size_t slices)
+{
+    std::vector<std::string> lag_names;
+    std::transform(m_handlers.begin(), m_handlers.end(), std::back_inserter(lag_names), [](const auto & pair) { return pair.first; });
+    std::sort(lag_names.begin(), lag_names.end());
+
+    std::set<std::string> res;
+    res.swap(m_lags_changed);
+
+    if (!lag_names.empty())
+    {
+        slices = std::max(slices, size_t(1));
+        size_t count = (lag_names.size() + slices - 1) / slices;
+        for (size_t i = 0; i < count; i++)
+        {
+            res.insert(lag_names[(m_poll_cursor + i) % lag_names.size()]);
+        }
+        m_poll_cursor = (m_poll_cursor + count) % lag_names.size();
+    }
+
+    return std::vector<std::string>(res.begin(), res.end());
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <set>
 #include <vector>
 #include <unordered_map>
 
@@ -20,7 +21,9 @@ public:
     void process_add_queue();
     // Retry logic added to prevent incorrect error reporting in dump API's
     TeamdCtlDump get_dump(const std::string & lag_name, bool to_retry);
-    TeamdCtlDumps get_dumps(bool to_retry);
+    TeamdCtlDumps get_dumps(const std::vector<std::string> & lag_names, bool to_retry);
+    void set_changed(const std::string & lag_name);
+    std::vector<std::string> get_lags_to_poll(size_t slices);
 
 private:
     bool has_key(const std::string & lag_name) const;
@@ -29,6 +32,8 @@ private:
     std::unordered_map<std::string, struct teamdctl*> m_handlers;
     std::unordered_map<std::string, int> m_lags_to_add;
     std::unordered_map<std::string, int> m_lags_err_retry;
+    std::set<std::string> m_lags_changed;
+    size_t m_poll_cursor = 0;
 
     const int max_attempts_to_add = 10;
 };
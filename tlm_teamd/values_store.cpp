@@ -1,4 +1,4 @@
-#include <jansson.h>
+#include <stdexcept>
 
 #include <logger.h>
 #include <table.h>
@@ -6,176 +6,94 @@
 #include "values_store.h"
 
 ///
-/// Extract port names from teamd status json dump.
-/// @return vector of LAG member port names from the dump
+/// The constructor registers the published paths to the json scanner
+/// @param db STATE_DB connector
 ///
-std::vector<std::string> ValuesStore::get_ports(json_t * root)
+ValuesStore::ValuesStore(const swss::DBConnector * db) :
+    m_db(db),
+    m_pipeline(db)
 {
-    std::vector<std::string> result;
-    json_t * ports = nullptr;
-    int err = json_unpack(root, "{s:o}", "ports", &ports);
-    if (err != 0)
-    {
-        return result;
-    }
-
-    const char * key;
-    json_t * value;
-    json_object_foreach(ports, key, value)
-    {
-        result.emplace_back(std::string(key));
-    }
-
-    return result;
-}
-
-///
-/// Split the json path in format "key1.key2.key3" to the internal format
-/// where all elements except last are put to the vector, and last key
-/// extract separately.
-/// @return a pair. The first element in the pair is the vector of the path elements
-///         The second element in the pair is the last element of the path elements
-///
-std::pair<std::vector<std::string>, std::string> ValuesStore::convert_path(const std::string & path)
-{
-    size_t last = 0, next = 0;
-    std::vector<std::string> result;
-    while ((next = path.find('.', last)) != std::string::npos)
-    {
-        result.emplace_back(path.substr(last, next-last));
-        last = next + 1;
-    }
-    return { result,  path.substr(last) };
-}
-
-///
-/// Traverse parsed json structure to find correct object to extract the value
-/// @param root parsed json structure
-/// @param path_array path array as a first element from ValuesStore::convert_path()
-/// @param path canonical path
-///
-json_t * ValuesStore::traverse(json_t * root, const std::vector<std::string> & path_array, const std::string & path)
-{
-    json_t * cur_root = root;
-    for (const auto & key: path_array)
-    {
-        json_t * cur = nullptr;
-        int err = json_unpack(cur_root, "{s:o}", key.c_str(), &cur);
-        if (err != 0)
-        {
-            throw std::runtime_error("Can't traverse through the path '" + path + "'. not found key = " + key);
-        }
-        cur_root = cur;
-    }
-
-    return cur_root;
-}
-
-///
-/// Extract json string value from json structure
-/// @return extracted string
-///
-std::string ValuesStore::unpack_string(json_t * root, const std::string & key, const std::string & path)
-{
-    const auto & c_key = key.c_str();
-    const char * str = nullptr;
-    int err = json_unpack(root, "{s:s}", c_key, &str);
-    if (err != 0)
+    for (const auto & p: m_lag_paths)
     {
-        throw std::runtime_error("Can't unpack a string. key='" + path + "' json='" + json_dumps(root, 0) + "'");
+        m_scanner.add_path(p.first);
     }
-    return std::string(str);
-}
-
-///
-/// Extract json boolean value from json structure
-/// @return extracted boolean as a string
-///
-std::string ValuesStore::unpack_boolean(json_t * root, const std::string & key, const std::string & path)
-{
-    const auto & c_key = key.c_str();
-    int value;
-    int err = json_unpack(root, "{s:b}", c_key, &value);
-    if (err != 0)
+    for (const auto & p: m_member_paths)
     {
-        throw std::runtime_error("Can't unpack a boolean. key='" + path + "' json='" + json_dumps(root, 0) + "'");
+        m_scanner.add_path("ports.*." + p.first);
     }
-    return std::string(value ? "true" : "false");
 }
 
 ///
-/// Extract json integer value from json structure
-/// @return extracted integer as a string
+/// Get a value extracted from the json dump. The value must be of type type.
+/// @param values the values extracted from the json dump
+/// @param path the path of the value
+/// @param type the type of the value
+/// @return the value as a string
 ///
-std::string ValuesStore::unpack_integer(json_t * root, const std::string & key, const std::string & path)
+std::string ValuesStore::get_value(const JsonScanner::result & values, const std::string & path, ValuesStore::json_type type)
 {
-    const auto & c_key = key.c_str();
-    int value;
-    int err = json_unpack(root, "{s:i}", c_key, &value);
-    if (err != 0)
+    const auto & it = values.values.find(path);
+    if (it == values.values.end())
     {
-        throw std::runtime_error("Can't unpack an integer. key='" + path + "' json='" + json_dumps(root, 0) + "'");
+        throw std::runtime_error("Can't find the path '" + path + "'");
     }
-    return std::to_string(value);
-}
-
-///
-/// Extract a value from the parsed json. Path to the value is defined by path, and type of the value
-/// is defined by type.
-/// @param root a pointer to parsed json structure
-/// @param path a canonical path to the value
-/// @param type a type of the value
-///
-std::string ValuesStore::get_value(json_t * root, const std::string & path, ValuesStore::json_type type)
-{
-    auto path_pair = convert_path(path);
-
-    json_t * found_object = traverse(root, path_pair.first, path);
-
-    const auto & key = path_pair.second;
 
+    const auto & value = it->second;
     switch (type)
     {
-        case ValuesStore::json_type::string:  return unpack_string(found_object, key, path);
-        case ValuesStore::json_type::boolean: return unpack_boolean(found_object, key, path);
-        case ValuesStore::json_type::integer: return unpack_integer(found_object, key, path);
+        case ValuesStore::json_type::string:
+            if (value.type != JsonScanner::value_type::string)
+            {
+                throw std::runtime_error("Can't unpack a string. key='" + path + "' value='" + value.text + "'");
+            }
+            break;
+        case ValuesStore::json_type::boolean:
+            if (value.type != JsonScanner::value_type::boolean)
+            {
+                throw std::runtime_error("Can't unpack a boolean. key='" + path + "' value='" + value.text + "'");
+            }
+            break;
+        case ValuesStore::json_type::integer:
+            if (value.type != JsonScanner::value_type::integer)
+            {
+                throw std::runtime_error("Can't unpack an integer. key='" + path + "' value='" + value.text + "'");
+            }
+            break;
     }
 
-    throw std::runtime_error("Reach the end of the ValuesStore::get_value. Path=" + path);
+    return value.text;
 }
 
 ///
-/// Extract values for LAG with name lag_name, from the parsed json tree with root, to the temporary storage
+/// Extract values for LAG with name lag_name, from the values extracted from its json dump, to the temporary storage
 /// @param lag_name a name of the LAG
-/// @param root a pointer to the parsed json tree
+/// @param values the values extracted from the json dump
 /// @param storage a reference to the temporary storage
 ///
-void ValuesStore::extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage)
+void ValuesStore::extract_values(const std::string & lag_name, const JsonScanner::result & values, HashOfRecords & storage)
 {
 
     const std::string key = "LAG_TABLE|" + lag_name;
     Records lag_values;
-    for (const auto & p: m_lag_paths)
+    for (const auto & path: m_lag_paths)
     {
-        const auto & path = p.first;
-        const auto & type = p.second;
-        const auto & value = get_value(root, path, type);
-        lag_values.emplace(path, value);
+        lag_values.emplace(path.first, get_value(values, path.first, path.second));
     }
     storage.emplace(key, lag_values);
 
-    const auto & ports = get_ports(root);
-    for (const auto & port: ports)
+    const auto & ports = values.keys.find("ports");
+    if (ports == values.keys.end())
+    {
+        return;
+    }
+
+    for (const auto & port: ports->second)
     {
         const std::string key = "LAG_MEMBER_TABLE|" + lag_name + "|" + port;
         Records member_values;
-        for (const auto & p: m_member_paths)
+        for (const auto & path: m_member_paths)
         {
-            const auto & path = p.first;
-            const auto & type = p.second;
-            const std::string full_path = "ports." + port + "." + path;
-            const auto & value = get_value(root, full_path, type);
-            member_values.emplace(path, value);
+            member_values.emplace(path.first, get_value(values, "ports." + port + "." + path.first, path.second));
         }
         storage.emplace(key, member_values);
     }
@@ -183,26 +101,9 @@ void ValuesStore::extract_values(const std::string & lag_name, json_t * root, Ha
     return;
 }
 
-///
-/// Parse json from the data
-/// @return a pointer to the parsed json tree
-///
-json_t * ValuesStore::load_json(const std::string & data)
-{
-    json_t * root;
-    json_error_t error;
-    root = json_loads(data.c_str(), 0, &error);
-    if (!root)
-    {
-        throw std::runtime_error("Can't parse json dump = '" + data + "'");
-    }
-
-    return root;
-}
-
-
 ///
 /// Convert json input from all teamds to the temporary storage
+/// Only the published values are parsed, the rest of the dumps is skipped
 /// @param dumps dumps from all teamds. It is a vector of pairs. Each pair
 ///              has a first element - name of the LAG and a second element
 ///              - json dump
@@ -215,9 +116,7 @@ HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
     {
         const auto & lag_name = p.first;
         const auto & json_dump = p.second;
-        json_t * root = load_json(json_dump);
-        extract_values(lag_name, root, storage);
-        json_decref(root);
+        extract_values(lag_name, m_scanner.scan(json_dump), storage);
     }
 
     return storage;
@@ -225,18 +124,19 @@ HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
 
 ///
 /// Extract a list of stale keys from the storage.
-/// The stale key is a key which a presented in the storage, but not presented
-/// in the temporary storage. That means that the key must be removed
+/// The stale key is a key of one of the LAGs lag_names which a presented in the storage,
+/// but not presented in the temporary storage. That means that the key must be removed
 /// @param storage a reference to the temporary storage
+/// @param lag_names names of the LAGs which were dumped
 /// @return list of stale keys
 ///
-std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage)
+std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage, const std::unordered_set<std::string> & lag_names)
 {
     std::vector<std::string> old_keys;
     for (const auto & p: m_storage)
     {
         const auto & db_key = p.first;
-        if (storage.find(db_key) == storage.end())
+        if (storage.find(db_key) == storage.end() && lag_names.find(get_lag_name(db_key)) != lag_names.end())
         {
             old_keys.push_back(db_key);
         }
@@ -270,6 +170,34 @@ StringPair ValuesStore::split_key(const std::string & key)
     return std::make_pair(key.substr(0, sep_pos), key.substr(sep_pos + 1));
 }
 
+///
+/// Extract the LAG name from a full key
+/// For example" LAG_MEMBER_TABLE|PortChannel1|Ethernet0 would return "PortChannel1"
+/// @param key a database key.
+/// @return the LAG name
+///
+std::string ValuesStore::get_lag_name(const std::string & key)
+{
+    const auto & entry_key = split_key(key).second;
+    return entry_key.substr(0, entry_key.find('|'));
+}
+
+///
+/// Get the table with name table_name, writing through the pipeline
+/// @param table_name a name of the table
+/// @return a reference to the table
+///
+swss::Table & ValuesStore::get_table(const std::string & table_name)
+{
+    auto it = m_tables.find(table_name);
+    if (it == m_tables.end())
+    {
+        it = m_tables.emplace(table_name, std::make_unique<swss::Table>(&m_pipeline, table_name, true)).first;
+    }
+
+    return *it->second;
+}
+
 ///
 /// Remove keys from the db
 /// @param keys a list of keys to remove
@@ -281,8 +209,7 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
         const auto & p = split_key(key);
         const auto & table_name = p.first;
         const auto & table_key = p.second;
-        swss::Table table(m_db, table_name);
-        table.del(table_key);
+        get_table(table_name).del(table_key);
     }
 }
 
@@ -291,85 +218,124 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
 /// The update is the following:
 /// 1. For each key in the temporary storage we check that we have that key in the storage
 /// 2. if not, we insert the key and value to the storage
-/// 3. if yes, we check that value of the key is not changed. If the value is changed we
-///    replace that value with the value from the temporary storage
-/// This method returns a list of keys which should be updated in the database
+/// 3. if yes, we replace the values of the key which are changed with the values
+///    from the temporary storage
+/// This method returns the values which should be updated in the database
 /// @param storage the temporary storage
-/// @retorun a list of keys which must be updated in the storage
+/// @return the new and changed values, for each key
 ///
-std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & storage)
+HashOfRecords ValuesStore::update_storage(const HashOfRecords & storage)
 {
-    std::vector<std::string> to_update;
+    HashOfRecords changes;
 
     for (const auto & entry_pair: storage)
     {
         const auto & entry_key    = entry_pair.first;
         const auto & entry_values = entry_pair.second;
-        if (m_storage.find(entry_key) == m_storage.end())
+        auto it = m_storage.find(entry_key);
+        if (it == m_storage.end())
         {
             m_storage.emplace(entry_pair);
-            to_update.emplace_back(entry_key);
+            changes.emplace(entry_pair);
+            continue;
         }
-        else
+
+        Records changed;
+        for (const auto & row_pair: entry_values)
         {
-            bool is_changed = false;
-            for (const auto & row_pair: entry_values)
+            auto & stored_value = it->second[row_pair.first];
+            if (stored_value != row_pair.second)
             {
-                const auto & row_key   = row_pair.first;
-                const auto & row_value = row_pair.second;
-                if (m_storage[entry_key][row_key] != row_value)
-                {
-                    is_changed = true;
-                    break;
-                }
+                stored_value = row_pair.second;
+                changed.emplace(row_pair);
             }
+        }
 
-            if (is_changed)
-            {
-                m_storage.erase(entry_key);
-                m_storage.emplace(entry_pair);
-                to_update.emplace_back(entry_key);
-            }
+        if (!changed.empty())
+        {
+            changes.emplace(entry_key, changed);
         }
     }
 
-    return to_update;
+    return changes;
 }
 
 ///
-/// Update values in the db with values from the temporary storage
-/// @param storage a reference to the temporary storage
-/// @param keys_to_refresh a list of keys which must be refreshed in the db
+/// Update values in the db with the changed values
+/// @param changes a reference to the new and changed values
 ///
-void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh)
+void ValuesStore::update_db(const HashOfRecords & changes)
 {
-    for (const auto & key: keys_to_refresh)
+    for (const auto & change: changes)
     {
-        std::vector<swss::FieldValueTuple> fvp;
-        for (const auto & row_pair: storage.at(key))
+        std::vector<swss::FieldValueTuple> fvp(change.second.begin(), change.second.end());
+        const auto & table_pair = split_key(change.first);
+        get_table(table_pair.first).set(table_pair.second, fvp);
+    }
+}
+
+
+///
+/// Update the storage with json dumps of the LAG interfaces lag_names.
+/// Only the dumps which are different from the previous dump of the LAG are parsed,
+/// and only the changed values are written to the db.
+/// @param dumps dumps of the LAG interfaces which were dumped successfully
+/// @param lag_names names of the LAG interfaces which were dumped. The values
+///                  of a LAG without dump are removed
+///
+void ValuesStore::update(const std::vector<StringPair> & dumps, const std::vector<std::string> & lag_names)
+{
+    try
+    {
+        std::unordered_set<std::string> dumped_lags(lag_names.begin(), lag_names.end());
+        std::vector<StringPair> changed_dumps;
+        for (const auto & p: dumps)
+        {
+            const auto & it = m_dumps.find(p.first);
+            if (it != m_dumps.end() && it->second == p.second)
+            {
+                dumped_lags.erase(p.first);
+                continue;
+            }
+            changed_dumps.push_back(p);
+        }
+
+        const auto & storage = from_json(changed_dumps);
+        const auto & old_keys = get_old_keys(storage, dumped_lags);
+        remove_keys_db(old_keys);
+        remove_keys_storage(old_keys);
+        const auto & changes = update_storage(storage);
+        update_db(changes);
+        m_pipeline.flush();
+
+        for (const auto & lag_name: dumped_lags)
+        {
+            m_dumps.erase(lag_name);
+        }
+        for (const auto & p: changed_dumps)
         {
-            fvp.emplace_back(row_pair);
+            m_dumps[p.first] = p.second;
         }
-        const auto & table_pair = split_key(key);
-        swss::Table table(m_db, table_pair.first);
-        table.set(table_pair.second, fvp);
+    }
+    catch (const std::exception & e)
+    {
+        SWSS_LOG_WARN("Exception '%s' had been thrown in ValuesStore", e.what());
     }
 }
 
-
 ///
-/// Update the storage with json dumps for every registered LAG interface.
+/// Remove all the values of the LAG interface with name lag_name
+/// @param lag_name a name of the LAG
 ///
-void ValuesStore::update(const std::vector<StringPair> & dumps)
+void ValuesStore::remove_lag(const std::string & lag_name)
 {
     try
     {
-        const auto & storage = from_json(dumps);
-        const auto & old_keys = get_old_keys(storage);
+        const auto & old_keys = get_old_keys({}, { lag_name });
         remove_keys_db(old_keys);
         remove_keys_storage(old_keys);
-        const auto & keys_to_refresh = update_storage(storage);
-        update_db(storage, keys_to_refresh);
+        m_pipeline.flush();
+        m_dumps.erase(lag_name);
     }
     catch (const std::exception & e)
     {
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
-
-#include <jansson.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <dbconnector.h>
+#include <redispipeline.h>
+#include <table.h>
+
+#include "json_scanner.h"
 
 using StringPair = std::pair<std::string, std::string>;
 using Records = std::unordered_map<std::string, std::string>;
@@ -14,8 +19,9 @@ using HashOfRecords = std::unordered_map<std::string, Records>;
 class ValuesStore
 {
 public:
-    ValuesStore(const swss::DBConnector * db) : m_db(db) {};
-    void update(const std::vector<StringPair> & dumps);
+    ValuesStore(const swss::DBConnector * db);
+    void update(const std::vector<StringPair> & dumps, const std::vector<std::string> & lag_names);
+    void remove_lag(const std::string & lag_name);
 
 private:
     enum class json_type
@@ -25,25 +31,23 @@ private:
         integer,
     };
 
-    json_t * load_json(const std::string & data);
-    std::vector<std::string> get_ports(json_t * root);
-    std::pair<std::vector<std::string>, std::string> convert_path(const std::string & path);
-    json_t * traverse(json_t * root, const std::vector<std::string> & path_array, const std::string & path);
-    std::string unpack_string(json_t * root, const std::string & key, const std::string & path);
-    std::string unpack_boolean(json_t * root, const std::string & key, const std::string & path);
-    std::string unpack_integer(json_t * root, const std::string & key, const std::string & path);
-    std::string get_value(json_t * root, const std::string & path, ValuesStore::json_type type);
+    std::string get_value(const JsonScanner::result & values, const std::string & path, ValuesStore::json_type type);
     HashOfRecords from_json(const std::vector<StringPair> & dumps);
-    std::vector<std::string> get_old_keys(const HashOfRecords & storage);
+    std::vector<std::string> get_old_keys(const HashOfRecords & storage, const std::unordered_set<std::string> & lag_names);
     void remove_keys_storage(const std::vector<std::string> & keys);
     void remove_keys_db(const std::vector<std::string> & keys);
     StringPair split_key(const std::string & key);
-    std::vector<std::string> update_storage(const HashOfRecords & storage);
-    void update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh);
-    void extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage);
+    std::string get_lag_name(const std::string & key);
+    swss::Table & get_table(const std::string & table_name);
+    HashOfRecords update_storage(const HashOfRecords & storage);
+    void update_db(const HashOfRecords & changes);
+    void extract_values(const std::string & lag_name, const JsonScanner::result & values, HashOfRecords & storage);
 
     HashOfRecords m_storage;  // our main storage
+    std::unordered_map<std::string, std::string> m_dumps;  // last json dump of each LAG
     const swss::DBConnector * m_db;
+    swss::RedisPipeline m_pipeline;  // all the changes of an update are written at once
+    std::unordered_map<std::string, std::unique_ptr<swss::Table>> m_tables;
 
     const std::vector<std::pair<std::string, ValuesStore::json_type>> m_lag_paths = {
         { "setup.kernel_team_mode_name", ValuesStore::json_type::string  },
@@ -70,4 +74,7 @@ private:
         { "runner.selected",                   ValuesStore::json_type::boolean },
         { "runner.state",                      ValuesStore::json_type::string  },
     };
+
+    // extracts only the values of m_lag_paths and m_member_paths from the dumps
+    JsonScanner m_scanner;
 };
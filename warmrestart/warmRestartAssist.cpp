@@ -4,6 +4,7 @@
 #include "schema.h"
 #include "warm_restart.h"
 #include "warmRestartAssist.h"
+#include "tablereader.h"
 
 using namespace std;
 using namespace swss;
@@ -130,36 +131,34 @@ void AppRestartAssist::warmStartDisabled()
 // Read table(s) from APPDB and append stale flag then insert to cachemap
 void AppRestartAssist::readTablesToMap()
 {
-    vector<string> keys;
-
     for (auto it = m_appTables.begin(); it != m_appTables.end(); it++)
     {
-        (it->second)->getKeys(keys);
+        TableReader reader(m_pipeLine->getDBConnector(), it->first);
+        deque<KeyOpFieldsValuesTuple> entries;
         FieldValueTuple state(CACHE_STATE_FIELD, "");
 
-        for (const auto &key: keys)
+        // entries whose fieldvalue is empty are not returned by the reader
+        while (reader.next(entries))
         {
-            vector<FieldValueTuple> fv;
-
-                // if the fieldvalue is empty, skip
-            if (!(it->second)->get(key, fv))
+            for (auto &entry: entries)
             {
-                continue;
-            }
+                auto &fv = kfvFieldsValues(entry);
 
-            fv.push_back(state);
-            setCacheEntryState(fv, STALE);
+                fv.push_back(state);
+                setCacheEntryState(fv, STALE);
 
-            string s = joinVectorString(fv);
+                string s = joinVectorString(fv);
 
-            SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
-                   "%s", (it->first).c_str(), key.c_str(), s.c_str());
+                SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
+                       "%s", (it->first).c_str(), kfvKey(entry).c_str(), s.c_str());
 
-            // insert to the cache map
-            appTableCacheMap[it->first][key] = fv;
+                // insert to the cache map
+                appTableCacheMap[it->first][kfvKey(entry)] = std::move(fv);
+            }
         }
         WarmStart::setWarmStartState(m_appName, WarmStart::RESTORED);
-        SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map", (it->first).c_str());
+        SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map, %zu entries, %.0f entries/s",
+                        (it->first).c_str(), reader.count(), reader.rate());
     }
     return;
 }